@@ -0,0 +1,153 @@
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "RigidRotationKinematics.h"
+#include "ibamr/namespaces.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+RigidRotationKinematics::RigidRotationKinematics(const std::string& object_name,
+                                                 Pointer<Database> input_db,
+                                                 LDataManager* l_data_manager)
+    : ConstraintIBKinematics(object_name, input_db, l_data_manager, /*register_for_restart*/ false),
+      d_omega(input_db->getDouble("angular_velocity")), d_reference_shape(NDIM), d_kinematics_vel(NDIM), d_shape(NDIM)
+{
+    // Read the initial node positions from the vertex file.
+    const std::string vertex_file_name = input_db->getString("vertex_file_name");
+    std::ifstream vertex_stream(vertex_file_name.c_str());
+    int num_nodes = 0;
+    if (!(vertex_stream >> num_nodes) || num_nodes <= 0)
+    {
+        TBOX_ERROR(d_object_name << "::RigidRotationKinematics():\n"
+                                 << "  unable to read vertex file " << vertex_file_name << std::endl);
+    }
+    double X_com[NDIM];
+    for (int d = 0; d < NDIM; ++d)
+    {
+        d_reference_shape[d].resize(num_nodes);
+        X_com[d] = 0.0;
+    }
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        for (int d = 0; d < NDIM; ++d)
+        {
+            if (!(vertex_stream >> d_reference_shape[d][k]))
+            {
+                TBOX_ERROR(d_object_name << "::RigidRotationKinematics():\n"
+                                         << "  unable to read vertex file " << vertex_file_name << std::endl);
+            }
+            X_com[d] += d_reference_shape[d][k];
+        }
+    }
+    for (int d = 0; d < NDIM; ++d)
+    {
+        X_com[d] /= static_cast<double>(num_nodes);
+        for (int k = 0; k < num_nodes; ++k) d_reference_shape[d][k] -= X_com[d];
+        d_kinematics_vel[d].resize(num_nodes, 0.0);
+        d_shape[d] = d_reference_shape[d];
+    }
+    return;
+} // RigidRotationKinematics
+
+RigidRotationKinematics::~RigidRotationKinematics()
+{
+    // intentionally blank
+    return;
+} // ~RigidRotationKinematics
+
+void RigidRotationKinematics::setKinematicsVelocity(const double time,
+                                                    const std::vector<double>& /*incremented_angle*/,
+                                                    const std::vector<double>& /*center_of_mass*/,
+                                                    const std::vector<double>& /*tagged_pt_position*/)
+{
+    // U = omega e_z X r, in which r is the rotated node position.
+    std::vector<std::vector<double> > X(NDIM);
+    rotateReferenceShape(time, X);
+    const int num_nodes = static_cast<int>(X[0].size());
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        d_kinematics_vel[0][k] = -d_omega * X[1][k];
+        d_kinematics_vel[1][k] = d_omega * X[0][k];
+    }
+    return;
+} // setKinematicsVelocity
+
+const std::vector<std::vector<double> >& RigidRotationKinematics::getKinematicsVelocity(const int /*level*/) const
+{
+    return d_kinematics_vel;
+} // getKinematicsVelocity
+
+void RigidRotationKinematics::setShape(const double time,
+                                       const std::vector<double>& /*incremented_angle_from_reference_axis*/)
+{
+    rotateReferenceShape(time, d_shape);
+    return;
+} // setShape
+
+const std::vector<std::vector<double> >& RigidRotationKinematics::getShape(const int /*level*/) const
+{
+    return d_shape;
+} // getShape
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void RigidRotationKinematics::rotateReferenceShape(const double time, std::vector<std::vector<double> >& X) const
+{
+    const double theta = d_omega * time;
+    const double cos_theta = std::cos(theta);
+    const double sin_theta = std::sin(theta);
+    const int num_nodes = static_cast<int>(d_reference_shape[0].size());
+    for (int d = 0; d < NDIM; ++d) X[d].resize(num_nodes);
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        const double x = d_reference_shape[0][k];
+        const double y = d_reference_shape[1][k];
+        X[0][k] = cos_theta * x - sin_theta * y;
+        X[1][k] = sin_theta * x + cos_theta * y;
+    }
+    return;
+} // rotateReferenceShape
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,140 @@
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_RigidRotationKinematics
+#define included_RigidRotationKinematics
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "ibamr/ConstraintIBKinematics.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+namespace IBTK
+{
+class LDataManager;
+} // namespace IBTK
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class RigidRotationKinematics imposes a rigid rotation with constant
+ * angular velocity about the initial center of mass of a two-dimensional
+ * structure.  The reference shape of the structure is read from the vertex
+ * file that is used to initialize the structure.
+ */
+class RigidRotationKinematics : public ConstraintIBKinematics
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    RigidRotationKinematics(const std::string& object_name,
+                            SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                            IBTK::LDataManager* l_data_manager);
+
+    /*!
+     * \brief Destructor.
+     */
+    virtual ~RigidRotationKinematics();
+
+    /*!
+     * \brief Set the kinematics velocity of the structure.
+     * \see IBAMR::ConstraintIBKinematics::setKinematicsVelocity
+     */
+    virtual void setKinematicsVelocity(const double time,
+                                       const std::vector<double>& incremented_angle_from_reference_axis,
+                                       const std::vector<double>& center_of_mass,
+                                       const std::vector<double>& tagged_pt_position);
+
+    /*!
+     * \brief Get the kinematics velocity on the specified level.
+     * \see IBAMR::ConstraintIBKinematics::getKinematicsVelocity
+     */
+    virtual const std::vector<std::vector<double> >& getKinematicsVelocity(const int level) const;
+
+    /*!
+     * \brief Set the shape of the structure at the required time.
+     * \see IBAMR::ConstraintIBKinematics::setShape
+     */
+    virtual void setShape(const double time, const std::vector<double>& incremented_angle_from_reference_axis);
+
+    /*!
+     * \brief Get the shape of the structure on the specified level.
+     * \see IBAMR::ConstraintIBKinematics::getShape
+     */
+    virtual const std::vector<std::vector<double> >& getShape(const int level) const;
+
+private:
+    /*!
+     * \brief The default constructor is not implemented and should not be used.
+     */
+    RigidRotationKinematics();
+
+    /*!
+     * \brief The copy constructor is not implemented and should not be used.
+     */
+    RigidRotationKinematics(const RigidRotationKinematics& from);
+
+    /*!
+     * \brief The assignment operator is not implemented and should not be used.
+     */
+    RigidRotationKinematics& operator=(const RigidRotationKinematics& that);
+
+    /*!
+     * \brief Rotate the reference shape by the angle swept at the given time.
+     */
+    void rotateReferenceShape(double time, std::vector<std::vector<double> >& X) const;
+
+    /*!
+     * Angular velocity of the structure.
+     */
+    double d_omega;
+
+    /*!
+     * Positions of the structure nodes relative to the initial center of mass.
+     */
+    std::vector<std::vector<double> > d_reference_shape;
+
+    /*!
+     * Kinematics velocity and shape vectors.
+     */
+    std::vector<std::vector<double> > d_kinematics_vel;
+    std::vector<std::vector<double> > d_shape;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_RigidRotationKinematics
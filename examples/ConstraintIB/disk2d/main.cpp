@@ -0,0 +1,285 @@
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic C++ objects
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/ConstraintIBMethod.h>
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+
+// Application
+#include "RigidRotationKinematics.h"
+
+// Function prototypes
+void write_disk_vertex_file(Pointer<Database> disk_db);
+bool read_last_line(const string& file_name, vector<double>& vals, int& num_lines);
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, PETSC_NULL, PETSC_NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Generate the Lagrangian mesh of the disk.
+        if (SAMRAI_MPI::getRank() == 0) write_disk_vertex_file(app_initializer->getComponentDatabase("Disk"));
+        SAMRAI_MPI::barrier();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<ConstraintIBMethod> ib_method_ops = new ConstraintIBMethod(
+            "ConstraintIBMethod", app_initializer->getComponentDatabase("ConstraintIBMethod"), /*no_structures*/ 1);
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Create the ConstraintIBKinematics object and register it with
+        // ConstraintIBMethod.
+        vector<Pointer<ConstraintIBKinematics> > ibkinematics_ops_vec;
+        ibkinematics_ops_vec.push_back(new RigidRotationKinematics(
+            "disk2d",
+            app_initializer->getComponentDatabase("ConstraintIBKinematics")->getDatabase("disk2d"),
+            ib_method_ops->getLDataManager()));
+        ib_method_ops->registerConstraintIBKinematics(ibkinematics_ops_vec);
+        ib_method_ops->initializeHierarchyOperatorsandData();
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Main time step loop.
+        double loop_time = time_integrator->getIntegratorTime();
+        double loop_time_end = time_integrator->getEndTime();
+        double dt = 0.0;
+        while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+        {
+            const int iteration_num = time_integrator->getIntegratorStep();
+            loop_time = time_integrator->getIntegratorTime();
+
+            pout << "\n";
+            pout << "+++++++++++++++++++++++++++++++++++++++++++++++++++\n";
+            pout << "At beginning of timestep # " << iteration_num << "\n";
+            pout << "Simulation time is " << loop_time << "\n";
+
+            dt = time_integrator->getMaximumTimeStepSize();
+            time_integrator->advanceHierarchy(dt);
+            loop_time += dt;
+
+            pout << "\n";
+            pout << "At end       of timestep # " << iteration_num << "\n";
+            pout << "Simulation time is " << loop_time << "\n";
+            pout << "+++++++++++++++++++++++++++++++++++++++++++++++++++\n";
+            pout << "\n";
+        }
+
+        // Check the hydrodynamic quantities written by ConstraintIBMethod.  To
+        // spin the disk, the constraint force must exert a torque about the
+        // out-of-plane axis in the direction of rotation and do positive work
+        // on the fluid.  Drag is not requested, so the drag file must be
+        // empty.
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            Pointer<Database> output_db = input_db->getDatabase("ConstraintIBMethod")->getDatabase("PrintOutput");
+            const string base_file_name = output_db->getString("output_dirname") + "/" +
+                                          output_db->getString("base_filename") + "_";
+            const double omega =
+                input_db->getDatabase("ConstraintIBKinematics")->getDatabase("disk2d")->getDouble("angular_velocity");
+            bool passed = true;
+            vector<double> vals;
+            int num_lines = 0;
+            if (!read_last_line(base_file_name + "Torque_struct_no_0", vals, num_lines) || vals.size() != 7)
+            {
+                pout << "possible errors encountered: no torque data were written.\n";
+                passed = false;
+            }
+            else
+            {
+                pout << "constraint torque = " << vals[4] << ", " << vals[5] << ", " << vals[6] << "\n";
+                if (vals[4] != 0.0 || vals[5] != 0.0 || !(omega * vals[6] > 0.0))
+                {
+                    pout << "possible errors encountered: unexpected constraint torque.\n";
+                    passed = false;
+                }
+            }
+            if (!read_last_line(base_file_name + "Power_spent_struct_no_0", vals, num_lines) || vals.size() != 7)
+            {
+                pout << "possible errors encountered: no power data were written.\n";
+                passed = false;
+            }
+            else
+            {
+                const double constraint_power = vals[4] + vals[5] + vals[6];
+                pout << "constraint power = " << constraint_power << "\n";
+                if (!(constraint_power > 0.0))
+                {
+                    pout << "possible errors encountered: unexpected constraint power.\n";
+                    passed = false;
+                }
+            }
+            read_last_line(base_file_name + "Drag_force_struct_no_0", vals, num_lines);
+            if (num_lines != 0)
+            {
+                pout << "possible errors encountered: drag data were written but not requested.\n";
+                passed = false;
+            }
+            if (passed) pout << "ConstraintIBMethod hydrodynamic output appears to be correct.\n";
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return 0;
+} // main
+
+void write_disk_vertex_file(Pointer<Database> disk_db)
+{
+    // The disk is discretized by concentric rings of nodes, so that its center
+    // of mass is its center.
+    const string structure_name = disk_db->getString("structure_name");
+    const double radius = disk_db->getDouble("radius");
+    const double ds = disk_db->getDouble("lagrangian_spacing");
+    double center[NDIM];
+    disk_db->getDoubleArray("center", center, NDIM);
+    vector<double> X, Y;
+    X.push_back(center[0]);
+    Y.push_back(center[1]);
+    const int num_rings = static_cast<int>(floor(radius / ds));
+    for (int k = 1; k <= num_rings; ++k)
+    {
+        const double r = k * ds;
+        const int num_ring_nodes = static_cast<int>(floor(2.0 * M_PI * r / ds + 0.5));
+        for (int j = 0; j < num_ring_nodes; ++j)
+        {
+            const double theta = 2.0 * M_PI * j / num_ring_nodes;
+            X.push_back(center[0] + r * cos(theta));
+            Y.push_back(center[1] + r * sin(theta));
+        }
+    }
+    ofstream vertex_stream((structure_name + ".vertex").c_str());
+    vertex_stream.precision(16);
+    vertex_stream << X.size() << "\n";
+    for (unsigned int k = 0; k < X.size(); ++k)
+    {
+        vertex_stream << X[k] << "\t" << Y[k] << "\n";
+    }
+    return;
+} // write_disk_vertex_file
+
+bool read_last_line(const string& file_name, vector<double>& vals, int& num_lines)
+{
+    vals.clear();
+    num_lines = 0;
+    ifstream file_stream(file_name.c_str());
+    if (!file_stream) return false;
+    string line, last_line;
+    while (getline(file_stream, line))
+    {
+        if (line.empty()) continue;
+        last_line = line;
+        ++num_lines;
+    }
+    istringstream line_stream(last_line);
+    double val;
+    while (line_stream >> val) vals.push_back(val);
+    return num_lines > 0;
+} // read_last_line
@@ -0,0 +1,356 @@
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <RefineAlgorithm.h>
+#include <RefineSchedule.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/LocalCopyFillPattern.h>
+#include <ibtk/SideDataSynchronization.h>
+#include <ibtk/SideSynchCopyFillPattern.h>
+#include <ibtk/app_namespaces.h>
+
+// Value used to initialize data that is not set by the tests.
+static const double UNSET_VALUE = -1.0e10;
+
+// Functions used to set up and compare the test data.
+void initialize_data(int data_idx, Pointer<PatchHierarchy<NDIM> > hierarchy, bool perturb_by_patch);
+void fill_data_via_schedule(int dst_idx,
+                            int src_idx,
+                            Pointer<VariableFillPattern<NDIM> > fill_pattern,
+                            Pointer<PatchHierarchy<NDIM> > hierarchy);
+void fill_data_via_local_copies(int dst_idx,
+                                int src_idx,
+                                Pointer<VariableFillPattern<NDIM> > fill_pattern,
+                                Pointer<PatchHierarchy<NDIM> > hierarchy);
+int count_differences(int idx1, int idx2, Pointer<PatchHierarchy<NDIM> > hierarchy);
+void report_differences(const std::string& test_name, int num_differences);
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "local_copies.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            int num_local_patches = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++) ++num_local_patches;
+            pout << "level number = " << ln << "\n";
+            pout << "number of patches = " << level->getNumberOfPatches() << "\n";
+            pout << "number of local patches = " << num_local_patches << "\n";
+            pout << "\n";
+        }
+
+        // Create cell- and side-centered data.  The "A" data are filled by the
+        // standard SAMRAI communication schedules, and the "B" data are filled
+        // using direct copies between local patches.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> a_ctx = var_db->getContext("A");
+        Pointer<VariableContext> b_ctx = var_db->getContext("B");
+        Pointer<VariableContext> src_ctx = var_db->getContext("SRC");
+        const int depth = 2;
+        const int gcw = 2;
+        Pointer<CellVariable<NDIM, double> > q_var = new CellVariable<NDIM, double>("q", depth);
+        const int q_a_idx = var_db->registerVariableAndContext(q_var, a_ctx, gcw);
+        const int q_b_idx = var_db->registerVariableAndContext(q_var, b_ctx, gcw);
+        const int q_src_idx = var_db->registerVariableAndContext(q_var, src_ctx, gcw);
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u", depth);
+        const int u_a_idx = var_db->registerVariableAndContext(u_var, a_ctx, gcw);
+        const int u_b_idx = var_db->registerVariableAndContext(u_var, b_ctx, gcw);
+        const int u_src_idx = var_db->registerVariableAndContext(u_var, src_ctx, gcw);
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(q_a_idx);
+            level->allocatePatchData(q_b_idx);
+            level->allocatePatchData(q_src_idx);
+            level->allocatePatchData(u_a_idx);
+            level->allocatePatchData(u_b_idx);
+            level->allocatePatchData(u_src_idx);
+        }
+
+        // Fill ghost cell values from neighboring patches, including periodic
+        // images, using LocalCopyFillPattern directly.
+        initialize_data(q_a_idx, patch_hierarchy, false);
+        initialize_data(q_b_idx, patch_hierarchy, false);
+        fill_data_via_schedule(q_a_idx, q_a_idx, NULL, patch_hierarchy);
+        fill_data_via_local_copies(q_b_idx, q_b_idx, NULL, patch_hierarchy);
+        report_differences("cell-centered ghost cell data", count_differences(q_a_idx, q_b_idx, patch_hierarchy));
+
+        initialize_data(u_a_idx, patch_hierarchy, false);
+        initialize_data(u_b_idx, patch_hierarchy, false);
+        fill_data_via_schedule(u_a_idx, u_a_idx, NULL, patch_hierarchy);
+        fill_data_via_local_copies(u_b_idx, u_b_idx, NULL, patch_hierarchy);
+        report_differences("side-centered ghost cell data", count_differences(u_a_idx, u_b_idx, patch_hierarchy));
+
+        // Fill data from distinct source data using HierarchyGhostCellInterpolation.
+        typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
+        initialize_data(q_src_idx, patch_hierarchy, true);
+        initialize_data(q_a_idx, patch_hierarchy, false);
+        initialize_data(q_b_idx, patch_hierarchy, false);
+        fill_data_via_schedule(q_a_idx, q_src_idx, NULL, patch_hierarchy);
+        HierarchyGhostCellInterpolation q_fill_op;
+        q_fill_op.initializeOperatorState(
+            InterpolationTransactionComponent(q_b_idx, q_src_idx, "NONE", false, "NONE", "NONE", false, NULL),
+            patch_hierarchy);
+        q_fill_op.fillData(0.0);
+        report_differences("cell-centered data filled by HierarchyGhostCellInterpolation",
+                           count_differences(q_a_idx, q_b_idx, patch_hierarchy));
+
+        initialize_data(u_src_idx, patch_hierarchy, true);
+        initialize_data(u_a_idx, patch_hierarchy, false);
+        initialize_data(u_b_idx, patch_hierarchy, false);
+        fill_data_via_schedule(u_a_idx, u_src_idx, NULL, patch_hierarchy);
+        HierarchyGhostCellInterpolation u_fill_op;
+        u_fill_op.initializeOperatorState(
+            InterpolationTransactionComponent(u_b_idx, u_src_idx, "NONE", false, "NONE", "NONE", false, NULL),
+            patch_hierarchy);
+        u_fill_op.fillData(0.0);
+        report_differences("side-centered data filled by HierarchyGhostCellInterpolation",
+                           count_differences(u_a_idx, u_b_idx, patch_hierarchy));
+
+        // Synchronize side-centered data that differ on patch boundaries using
+        // SideDataSynchronization.
+        typedef SideDataSynchronization::SynchronizationTransactionComponent SynchronizationTransactionComponent;
+        initialize_data(u_a_idx, patch_hierarchy, true);
+        initialize_data(u_b_idx, patch_hierarchy, true);
+        fill_data_via_schedule(u_a_idx, u_a_idx, new SideSynchCopyFillPattern(), patch_hierarchy);
+        SideDataSynchronization u_synch_op;
+        u_synch_op.initializeOperatorState(SynchronizationTransactionComponent(u_b_idx), patch_hierarchy);
+        u_synch_op.synchronizeData(0.0);
+        report_differences("side-centered data synchronized by SideDataSynchronization",
+                           count_differences(u_a_idx, u_b_idx, patch_hierarchy));
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return 0;
+} // main
+
+void initialize_data(const int data_idx, Pointer<PatchHierarchy<NDIM> > hierarchy, const bool perturb_by_patch)
+{
+    // The data are functions of the periodic index, so that periodic images
+    // have the same values.  When requested, the data are perturbed by an
+    // amount that depends on the patch, so that values on patch boundaries are
+    // not consistent.
+    const Box<NDIM> domain_box = hierarchy->getGridGeometry()->getPhysicalDomain()[0];
+    const IntVector<NDIM> period = domain_box.numberCells();
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const double perturbation = perturb_by_patch ? 0.25 * (p() + 1) : 0.0;
+            Pointer<CellData<NDIM, double> > cc_data = patch->getPatchData(data_idx);
+            Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(data_idx);
+            const int n_arrays = cc_data ? 1 : NDIM;
+            for (int axis = 0; axis < n_arrays; ++axis)
+            {
+                ArrayData<NDIM, double>& data = cc_data ? cc_data->getArrayData() : sc_data->getArrayData(axis);
+                data.fillAll(UNSET_VALUE);
+                const Box<NDIM> data_box = cc_data ? patch_box : SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                for (Box<NDIM>::Iterator b(data_box); b; b++)
+                {
+                    const Index<NDIM>& i = b();
+                    for (int d = 0; d < data.getDepth(); ++d)
+                    {
+                        double val = 1.0 + d + 2.0 * axis + perturbation;
+                        double scale = 16.0;
+                        for (unsigned int k = 0; k < NDIM; ++k)
+                        {
+                            const int i_periodic = ((i(k) - domain_box.lower()(k)) % period(k) + period(k)) % period(k);
+                            val += scale * i_periodic;
+                            scale *= 64.0;
+                        }
+                        data(i, d) = val;
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // initialize_data
+
+void fill_data_via_schedule(const int dst_idx,
+                            const int src_idx,
+                            Pointer<VariableFillPattern<NDIM> > fill_pattern,
+                            Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    RefineAlgorithm<NDIM> refine_alg;
+    refine_alg.registerRefine(dst_idx, src_idx, dst_idx, NULL, fill_pattern);
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        refine_alg.createSchedule(hierarchy->getPatchLevel(ln))->fillData(0.0);
+    }
+    return;
+} // fill_data_via_schedule
+
+void fill_data_via_local_copies(const int dst_idx,
+                                const int src_idx,
+                                Pointer<VariableFillPattern<NDIM> > fill_pattern,
+                                Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    Pointer<LocalCopyFillPattern> local_copy_fill_pattern = new LocalCopyFillPattern(fill_pattern);
+    RefineAlgorithm<NDIM> refine_alg;
+    refine_alg.registerRefine(dst_idx, src_idx, dst_idx, NULL, local_copy_fill_pattern);
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        local_copy_fill_pattern->setTargetPatchLevel(level);
+        Pointer<RefineSchedule<NDIM> > refine_sched = refine_alg.createSchedule(level);
+        local_copy_fill_pattern->clearTargetPatchLevel();
+        local_copy_fill_pattern->copyLocalData(dst_idx, src_idx, ln);
+        refine_sched->fillData(0.0);
+    }
+    return;
+} // fill_data_via_local_copies
+
+int count_differences(const int idx1, const int idx2, Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    int num_differences = 0;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > cc_data1 = patch->getPatchData(idx1);
+            Pointer<CellData<NDIM, double> > cc_data2 = patch->getPatchData(idx2);
+            Pointer<SideData<NDIM, double> > sc_data1 = patch->getPatchData(idx1);
+            Pointer<SideData<NDIM, double> > sc_data2 = patch->getPatchData(idx2);
+            const int n_arrays = cc_data1 ? 1 : NDIM;
+            for (int axis = 0; axis < n_arrays; ++axis)
+            {
+                const ArrayData<NDIM, double>& data1 =
+                    cc_data1 ? cc_data1->getArrayData() : sc_data1->getArrayData(axis);
+                const ArrayData<NDIM, double>& data2 =
+                    cc_data2 ? cc_data2->getArrayData() : sc_data2->getArrayData(axis);
+                for (Box<NDIM>::Iterator b(data1.getBox()); b; b++)
+                {
+                    const Index<NDIM>& i = b();
+                    for (int d = 0; d < data1.getDepth(); ++d)
+                    {
+                        if (data1(i, d) != data2(i, d))
+                        {
+                            ++num_differences;
+                            plog << "difference at level " << ln << ", patch " << p() << ", axis " << axis
+                                 << ", index " << i << ", depth " << d << ": " << data1(i, d) << " != " << data2(i, d)
+                                 << "\n";
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return SAMRAI_MPI::sumReduction(num_differences);
+} // count_differences
+
+void report_differences(const std::string& test_name, const int num_differences)
+{
+    if (num_differences == 0)
+    {
+        pout << test_name << " appears to be correct.\n";
+    }
+    else
+    {
+        pout << "possible errors encountered in " << test_name << ": " << num_differences
+             << " values differ from those computed by the SAMRAI communication schedules.\n";
+    }
+    return;
+} // report_differences
@@ -0,0 +1,188 @@
+// Filename: AsyncFileWriter.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_AsyncFileWriter
+#define included_AsyncFileWriter
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <pthread.h>
+#include <stddef.h>
+#include <sys/types.h>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "tbox/DescribedClass.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class AsyncFileWriter writes staged data buffers to files on a
+ * background thread, so that the calling process can resume computation while
+ * the data are written to disk.
+ *
+ * Each write request consists of a file name, an offset within that file, and
+ * a buffer of bytes.  The buffer is taken over by the writer without copying,
+ * so callers typically stage a snapshot of their data in a buffer and then hand
+ * the buffer to the writer.  Requests are processed in the order in which they
+ * are submitted.  Files are not created or truncated by the writer; if
+ * necessary, callers should create the file before submitting requests.
+ *
+ * The total size of the buffers held by the writer may be bounded, in which
+ * case writeAt() blocks until enough of the previously submitted data have been
+ * written.
+ *
+ * \note The background thread performs only POSIX file I/O and does not make
+ * any MPI calls.
+ */
+class AsyncFileWriter : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param max_pending_bytes  The maximum number of bytes that may be held
+     * by the writer before writeAt() blocks.  A value of zero indicates that
+     * the number of pending bytes is unbounded.
+     */
+    AsyncFileWriter(size_t max_pending_bytes = 0);
+
+    /*!
+     * \brief Destructor.
+     *
+     * The destructor blocks until all pending requests have been processed.
+     */
+    ~AsyncFileWriter();
+
+    /*!
+     * \brief Submit a request to write the contents of a buffer to the
+     * specified file starting at the specified offset.
+     *
+     * The contents of the buffer are swapped into the request, so that the
+     * buffer is empty upon return.
+     */
+    void writeAt(const std::string& file_name, off_t offset, std::vector<char>& data);
+
+    /*!
+     * \brief Block until all pending requests have been processed.
+     *
+     * An unrecoverable error results if any of the requests could not be
+     * completed.
+     */
+    void waitForCompletion();
+
+    /*!
+     * \brief Return the number of bytes that have been submitted but not yet
+     * written.
+     */
+    size_t getNumPendingBytes();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    AsyncFileWriter(const AsyncFileWriter& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    AsyncFileWriter& operator=(const AsyncFileWriter& that);
+
+    /*!
+     * \brief Entry point of the background thread.
+     */
+    static void* runWriterThread(void* writer);
+
+    /*!
+     * \brief Process write requests until the writer is shut down.
+     */
+    void processRequests();
+
+    /*!
+     * \brief Report any errors encountered by the background thread.
+     *
+     * \note This method must be called with d_mutex locked.
+     */
+    void checkErrors();
+
+    /*!
+     * \brief A single pending write request.
+     */
+    struct WriteRequest
+    {
+        std::string file_name;
+        off_t offset;
+        std::vector<char> data;
+    };
+
+    /*!
+     * Pending write requests.
+     */
+    std::deque<WriteRequest*> d_requests;
+
+    /*!
+     * The number of pending and in-progress requests, the number of bytes held
+     * by those requests, and the maximum number of pending bytes.
+     */
+    unsigned int d_num_pending_requests;
+    size_t d_num_pending_bytes, d_max_pending_bytes;
+
+    /*!
+     * Synchronization data.
+     */
+    pthread_t d_thread;
+    pthread_mutex_t d_mutex;
+    pthread_cond_t d_request_cond, d_progress_cond;
+    bool d_thread_started, d_shutdown;
+
+    /*!
+     * Error messages from the background thread.
+     */
+    std::string d_error_message;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_AsyncFileWriter
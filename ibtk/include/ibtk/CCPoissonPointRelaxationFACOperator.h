@@ -111,6 +111,10 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ use_tiled_kernels = FALSE                    // see PatchMathOps::setUseTiledKernels()
+ tile_width = 0                               // see PatchMathOps::setTileWidth()
+ use_threaded_tiles = FALSE                   // see PatchMathOps::setUseThreadedTiles()
+ use_threaded_patch_loops = FALSE             // see HierarchyMathOps::setUseThreadedPatchLoops()
  coarse_solver_db {                           // SAMRAI::tbox::Database for initializing coarse
  level solver
     solver_type = "PFMG"
@@ -36,6 +36,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <string>
+#include <vector>
 
 #include "IntVector.h"
 #include "PatchHierarchy.h"
@@ -49,6 +50,7 @@ namespace SAMRAI
 namespace tbox
 {
 class Database;
+class Timer;
 } // namespace tbox
 } // namespace SAMRAI
 
@@ -74,13 +76,45 @@ namespace IBTK
  * stand-alone solver; rather, it is intended to be used in conjunction with an
  * iterative Krylov method.
  *
+ * When full multigrid (FMG) is enabled, the right-hand side is restricted to
+ * all coarser levels and the problem is first solved on the coarsest level.
+ * The approximate solution is then interpolated to each successively finer
+ * level, and num_fmg_cycles FAC cycles of the specified type are applied to the
+ * composite-grid problem that ends at that level.  A single FMG pass typically
+ * provides a substantially better approximation than a single FAC cycle, at a
+ * cost that is a modest multiple of the cost of one cycle.
+ *
+ * When adaptive smoothing is enabled, the residual reduction obtained on each
+ * level is measured during every monitor_interval-th application of the
+ * preconditioner, and the number of post-smoothing sweeps on that level is
+ * adjusted so that the reduction per level visit approximately equals
+ * adaptive_sweeps_target_reduction.  The number of pre-smoothing sweeps is not
+ * modified.  So that the preconditioner remains fixed during the iterations
+ * of a Krylov method that is not flexible (e.g., GMRES or CG), the updated
+ * numbers of sweeps are only applied by initializeSolverState() and
+ * setTimeInterval(), i.e., between outer solves.  Residual reductions are also measured during time steps that are
+ * recorded by PerformanceTrace, in which case the measured reductions are
+ * accumulated in the counter <tt>object_name::level_N::residual_reduction</tt>
+ * and the number of measurements is accumulated in the counter
+ * <tt>object_name::level_N::num_monitored_cycles</tt>.  In all cases, the time
+ * spent performing the work associated with each level (excluding the time
+ * spent on coarser levels) is recorded by the timer
+ * <tt>object_name::level_N</tt>.
+ *
  * Sample parameters for initialization from database (and their default
  * values): \verbatim
 
- cycle_type = "V_CYCLE"  // see setMGCycleType()
- num_pre_sweeps = 0      // see setNumPreSmoothingSweeps()
- num_post_sweeps = 2     // see setNumPostSmoothingSweeps()
- enable_logging = FALSE  // see setLoggingEnabled()
+ cycle_type = "V_CYCLE"                   // see setMGCycleType()
+ num_pre_sweeps = 0                       // see setNumPreSmoothingSweeps()
+ num_post_sweeps = 2                      // see setNumPostSmoothingSweeps()
+ enable_fmg = FALSE                       // see setFullMultigridEnabled()
+ num_fmg_cycles = 1                       // see setNumFullMultigridCycles()
+ enable_adaptive_sweeps = FALSE           // see setAdaptiveSweepsEnabled()
+ adaptive_sweeps_target_reduction = 0.1   // see setAdaptiveSweepsTargetReduction()
+ min_num_post_sweeps = 1                  // see setAdaptiveSweepsLimits()
+ max_num_post_sweeps = 8                  // see setAdaptiveSweepsLimits()
+ monitor_interval = 10                    // see setMonitorInterval()
+ enable_logging = FALSE                   // see setLoggingEnabled()
  \endverbatim
 */
 class FACPreconditioner : public LinearSolver
@@ -266,6 +300,75 @@ public:
      */
     int getNumPostSmoothingSweeps() const;
 
+    /*!
+     * \brief Get the number of post-smoothing sweeps currently employed on
+     * the specified level of the patch hierarchy.
+     *
+     * \note This value differs from getNumPostSmoothingSweeps() only when
+     * adaptive smoothing is enabled.
+     */
+    int getNumPostSmoothingSweeps(int level_num) const;
+
+    /*!
+     * \brief Set whether to use a full multigrid (FMG) cycle.
+     */
+    void setFullMultigridEnabled(bool enable_fmg);
+
+    /*!
+     * \brief Get whether a full multigrid (FMG) cycle is used.
+     */
+    bool getFullMultigridEnabled() const;
+
+    /*!
+     * \brief Set the number of FAC cycles to apply on each level during a full
+     * multigrid (FMG) cycle.
+     */
+    void setNumFullMultigridCycles(int num_fmg_cycles);
+
+    /*!
+     * \brief Get the number of FAC cycles applied on each level during a full
+     * multigrid (FMG) cycle.
+     */
+    int getNumFullMultigridCycles() const;
+
+    /*!
+     * \brief Set whether to adjust the number of post-smoothing sweeps on each
+     * level based on the measured residual reduction.
+     */
+    void setAdaptiveSweepsEnabled(bool enable_adaptive_sweeps);
+
+    /*!
+     * \brief Get whether the number of post-smoothing sweeps is adjusted on
+     * each level based on the measured residual reduction.
+     */
+    bool getAdaptiveSweepsEnabled() const;
+
+    /*!
+     * \brief Set the residual reduction per level visit that adaptive smoothing
+     * attempts to achieve.
+     */
+    void setAdaptiveSweepsTargetReduction(double target_reduction);
+
+    /*!
+     * \brief Set the minimum and maximum numbers of post-smoothing sweeps that
+     * may be selected by adaptive smoothing.
+     */
+    void setAdaptiveSweepsLimits(int min_num_post_sweeps, int max_num_post_sweeps);
+
+    /*!
+     * \brief Set the number of applications of the preconditioner between
+     * measurements of the residual reduction on each level.
+     */
+    void setMonitorInterval(int monitor_interval);
+
+    /*!
+     * \brief Get the residual reduction per level visit most recently measured
+     * on the specified level of the patch hierarchy.
+     *
+     * \note A negative value is returned if no measurement is available.
+     */
+    double getResidualReduction(int level_num) const;
+
     //\}
 
 protected:
@@ -285,6 +388,24 @@ protected:
                    SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& f,
                    int level_num);
 
+    void FACCycle(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& u,
+                  SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& f,
+                  int level_num);
+
+    void FMGCycle(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& u, SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& f);
+
+    /*!
+     * \brief Begin or end a visit to the specified level, measuring the
+     * residual reduction on that level when the current application of the
+     * preconditioner is being monitored.
+     */
+    void beginLevelVisit(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& u,
+                         SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& f,
+                         int level_num);
+    void endLevelVisit(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& u,
+                       SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& f,
+                       int level_num);
+
     SAMRAI::tbox::Pointer<FACPreconditionerStrategy> d_fac_strategy;
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
     int d_coarsest_ln;
@@ -294,6 +415,39 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_f, d_r;
     bool d_recompute_residual;
 
+    /*
+     * Full multigrid parameters and the approximate solution accumulated
+     * during an FMG cycle.
+     */
+    bool d_enable_fmg;
+    int d_num_fmg_cycles;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_fmg_u;
+
+    /*
+     * Adaptive smoothing parameters, the number of post-smoothing sweeps
+     * employed on each level, and the number of post-smoothing sweeps to be
+     * employed on each level once the next outer solve begins.
+     */
+    bool d_enable_adaptive_sweeps;
+    double d_adaptive_sweeps_target_reduction;
+    int d_min_num_post_sweeps, d_max_num_post_sweeps;
+    std::vector<int> d_level_num_post_sweeps, d_level_pending_num_post_sweeps;
+
+    /*
+     * Residual reduction measurements.  The level residual vectors share the
+     * patch data of d_r.
+     */
+    int d_monitor_interval, d_num_applications;
+    bool d_monitor_cycle;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_level_r;
+    std::vector<double> d_level_entry_residual_norm, d_level_log_reduction_sum, d_level_residual_reduction;
+    std::vector<int> d_level_num_monitored_visits;
+
+    /*
+     * Timers for the work performed on each level.
+     */
+    std::vector<SAMRAI::tbox::Timer*> d_level_timers;
+
 private:
     /*!
      * \brief Default constructor.
@@ -322,6 +476,13 @@ private:
      */
     FACPreconditioner& operator=(const FACPreconditioner& that);
 
+    /*!
+     * \brief Select the number of post-smoothing sweeps to be employed on each
+     * level in subsequent outer solves using the residual reductions measured
+     * during the most recent application of the preconditioner.
+     */
+    void updateMonitoredLevels();
+
     void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 };
 } // namespace IBTK
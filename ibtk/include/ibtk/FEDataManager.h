@@ -52,6 +52,8 @@
 #include "StandardTagAndInitStrategy.h"
 #include "VariableContext.h"
 #include "boost/multi_array.hpp"
+#include "ibtk/ScratchDataIndexCache.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_quadrature_type.h"
@@ -110,6 +112,14 @@ public:
      * \brief Struct InterpSpec encapsulates data needed to specify the manner
      * in which Eulerian-to-Lagrangian interpolation is performed when using an
      * FE structural discretization.
+     *
+     * When adaptive quadrature is used, the number of quadrature points is
+     * determined from the deformed element size and point_density.  If
+     * use_anisotropic_quadrature is set, the number of points is chosen
+     * independently along each reference direction of tensor-product elements.
+     * If use_nodal_quadrature is set, the element nodes are used as quadrature
+     * points for linear elements whenever they provide the requested point
+     * density.
      */
     struct InterpSpec
     {
@@ -122,10 +132,13 @@ public:
                    const libMeshEnums::Order& quad_order,
                    bool use_adaptive_quadrature,
                    double point_density,
-                   bool use_consistent_mass_matrix)
+                   bool use_consistent_mass_matrix,
+                   bool use_anisotropic_quadrature = false,
+                   bool use_nodal_quadrature = false)
             : kernel_fcn(kernel_fcn), quad_type(quad_type), quad_order(quad_order),
               use_adaptive_quadrature(use_adaptive_quadrature), point_density(point_density),
-              use_consistent_mass_matrix(use_consistent_mass_matrix)
+              use_consistent_mass_matrix(use_consistent_mass_matrix),
+              use_anisotropic_quadrature(use_anisotropic_quadrature), use_nodal_quadrature(use_nodal_quadrature)
         {
         }
 
@@ -135,12 +148,16 @@ public:
         bool use_adaptive_quadrature;
         double point_density;
         bool use_consistent_mass_matrix;
+        bool use_anisotropic_quadrature;
+        bool use_nodal_quadrature;
     };
 
     /*!
      * \brief Struct SpreadSpec encapsulates data needed to specify the manner
      * in which Lagrangian-to-Eulerian spreading is performed when using an FE
      * structural discretization.
+     *
+     * \see InterpSpec
      */
     struct SpreadSpec
     {
@@ -152,9 +169,12 @@ public:
                    const libMeshEnums::QuadratureType& quad_type,
                    const libMeshEnums::Order& quad_order,
                    bool use_adaptive_quadrature,
-                   double point_density)
+                   double point_density,
+                   bool use_anisotropic_quadrature = false,
+                   bool use_nodal_quadrature = false)
             : kernel_fcn(kernel_fcn), quad_type(quad_type), quad_order(quad_order),
-              use_adaptive_quadrature(use_adaptive_quadrature), point_density(point_density)
+              use_adaptive_quadrature(use_adaptive_quadrature), point_density(point_density),
+              use_anisotropic_quadrature(use_anisotropic_quadrature), use_nodal_quadrature(use_nodal_quadrature)
         {
         }
 
@@ -163,6 +183,8 @@ public:
         libMeshEnums::Order quad_order;
         bool use_adaptive_quadrature;
         double point_density;
+        bool use_anisotropic_quadrature;
+        bool use_nodal_quadrature;
     };
 
     /*!
@@ -219,6 +241,12 @@ public:
     void registerLoadBalancer(SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > load_balancer,
                               int workload_data_idx);
 
+    /*!
+     * \brief Register a workload cost model to use in place of the quadrature
+     * point count based workload estimate.
+     */
+    void registerWorkloadCostModel(SAMRAI::tbox::Pointer<WorkloadCostModel> workload_cost_model);
+
     /*!
      * \name Methods to set and get the patch hierarchy and range of patch
      * levels associated with this manager class.
@@ -449,6 +477,12 @@ public:
 
     /*!
      * \brief Update the cell workload estimate.
+     *
+     * By default, the workload of each cell is incremented by the number of
+     * quadrature points in that cell.  If a WorkloadCostModel has been
+     * registered, each quadrature point instead contributes the modeled cost of
+     * one force evaluation plus that of the grid cells covered by its
+     * interpolation and spreading stencils.
      */
     void updateWorkloadEstimates(int coarsest_ln = -1, int finest_ln = -1);
 
@@ -587,6 +621,59 @@ private:
      */
     void updateQuadPointCountData(int coarsest_ln, int finest_ln);
 
+    /*
+     * Cached per-direction numbers of adaptive quadrature points, stored three
+     * entries per element and indexed by element ID, along with the parameters
+     * used to compute them.  For each element and reference direction,
+     * max_hmax is the largest deformed extent of the element along that
+     * direction that is resolved by the cached number of points.
+     */
+    struct QuadraturePointCache
+    {
+        QuadraturePointCache() : point_density(0.0), dx_min(0.0), npts(), max_hmax()
+        {
+        }
+
+        double point_density, dx_min;
+        std::vector<int> npts;
+        std::vector<double> max_hmax;
+    };
+
+    /*!
+     * Update the quadrature rule for the current element, reusing the numbers
+     * of adaptive quadrature points selected for the element since the element
+     * mappings were last reinitialized unless the element has since grown too
+     * large to be resolved by them.
+     */
+    bool updateCachedQuadratureRule(libMesh::AutoPtr<libMesh::QBase>& qrule,
+                                    const InterpSpec& spec,
+                                    libMesh::Elem* elem,
+                                    const boost::multi_array<double, 2>& X_node,
+                                    double dx_min);
+
+    /*!
+     * Update the quadrature rule for the current element, reusing the numbers
+     * of adaptive quadrature points selected for the element since the element
+     * mappings were last reinitialized unless the element has since grown too
+     * large to be resolved by them.
+     */
+    bool updateCachedQuadratureRule(libMesh::AutoPtr<libMesh::QBase>& qrule,
+                                    const SpreadSpec& spec,
+                                    libMesh::Elem* elem,
+                                    const boost::multi_array<double, 2>& X_node,
+                                    double dx_min);
+
+    /*!
+     * Return the per-direction numbers of adaptive quadrature points for the
+     * element, computing them if they are not already cached or if the element
+     * has grown beyond the size that the cached values can resolve.
+     */
+    const int* getCachedQuadraturePointCounts(QuadraturePointCache& cache,
+                                              libMesh::Elem* elem,
+                                              const boost::multi_array<double, 2>& X_node,
+                                              double point_density,
+                                              double dx_min);
+
     /*!
      * Compute the bounding boxes of all active elements.
      *
@@ -675,6 +762,7 @@ private:
      */
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_workload_var;
     int d_workload_idx;
+    SAMRAI::tbox::Pointer<WorkloadCostModel> d_workload_cost_model;
 
     /*
      * The default kernel functions and quadrature rule used to mediate
@@ -695,6 +783,21 @@ private:
     libMesh::EquationSystems* d_es;
     int d_level_number;
 
+    /*
+     * Persistent scratch patch data used to accumulate spread values, indexed
+     * by the patch data index of the Eulerian data.
+     */
+    ScratchDataIndexCache d_spread_scratch_data_cache;
+
+    /*
+     * Numbers of adaptive quadrature points selected for each element by the
+     * interpolation and spreading quadrature rules.  The cached values are
+     * discarded whenever the element mappings are reinitialized, and the values
+     * for an element are recomputed whenever it stretches beyond the size that
+     * they can resolve.
+     */
+    QuadraturePointCache d_interp_quad_point_cache, d_spread_quad_point_cache;
+
     /*
      * Data to manage mappings between mesh elements and grid patches.
      */
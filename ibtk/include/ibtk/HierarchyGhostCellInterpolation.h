@@ -56,6 +56,7 @@ class CartCellRobinPhysBdryOp;
 class CartExtrapPhysBdryOp;
 class CartSideRobinPhysBdryOp;
 class CoarseFineBoundaryRefinePatchStrategy;
+class LocalCopyFillPattern;
 } // namespace IBTK
 namespace SAMRAI
 {
@@ -363,6 +364,7 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_refine_alg;
     SAMRAI::xfer::RefinePatchStrategy<NDIM>* d_refine_strategy;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_refine_scheds;
+    std::vector<SAMRAI::tbox::Pointer<LocalCopyFillPattern> > d_local_copy_fill_patterns;
 
     // Cached coarse-fine boundary and physical boundary condition handlers.
     std::vector<SAMRAI::tbox::Pointer<CoarseFineBoundaryRefinePatchStrategy> > d_cf_bdry_ops;
@@ -919,6 +919,20 @@ protected:
      */
     SAMRAI::tbox::Array<int> d_tag_buffer;
 
+    /*
+     * Options for the tiled evaluation of the kernels used by the hierarchy
+     * math operations object (see PatchMathOps).
+     */
+    bool d_use_tiled_kernels;
+    int d_tile_width;
+    bool d_use_threaded_tiles;
+
+    /*
+     * Whether the hierarchy math operations object processes the patches of
+     * each level by OpenMP threads (see HierarchyMathOps).
+     */
+    bool d_use_threaded_patch_loops;
+
     /*
      * Hierarchy operations objects.
      */
@@ -211,6 +211,25 @@ public:
      */
     void setCoarsenOperatorName(const std::string& coarsen_op_name);
 
+    /*!
+     * \brief Enable or disable the use of OpenMP threads to process the local
+     * patches of each level concurrently.
+     *
+     * Patches are handed out to threads in order of decreasing size.  Because
+     * each patch is processed independently, the results do not depend on the
+     * number of threads.  Threading is disabled by default, and it has no
+     * effect unless the library is configured with --enable-openmp.  The
+     * operations that copy data to the coarse-fine interface are always
+     * performed serially.
+     */
+    void setUseThreadedPatchLoops(bool use_threaded_patch_loops);
+
+    /*!
+     * \brief Return the patch math operations object used by this object, e.g.
+     * to configure the tiled execution of its kernels.
+     */
+    PatchMathOps& getPatchMathOps();
+
     /*!
      * \brief Compute the cell-centered curl of a cell-centered vector field
      * using centered differences.
@@ -1222,6 +1241,9 @@ private:
     // Patch math operations.
     PatchMathOps d_patch_math_ops;
 
+    // Whether the patch loops are threaded.
+    bool d_use_threaded_patch_loops;
+
     // The cell weights are used to compute norms of data defined on the patch
     // hierarchy.
     SAMRAI::tbox::Pointer<SAMRAI::hier::VariableContext> d_context;
@@ -145,6 +145,12 @@ public:
      */
     unsigned int getGhostNodeCount() const;
 
+    /*!
+     * \brief Returns the global PETSc indices of the nonlocal nodes that are
+     * available in the ghosted local form of the data.
+     */
+    const std::vector<int>& getNonlocalPETScIndices() const;
+
     /*!
      * \brief Returns the depth (i.e., the number of components per node) of the
      * Lagrangian data.
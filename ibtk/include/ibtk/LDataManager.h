@@ -61,6 +61,8 @@
 #include "ibtk/LNodeSetVariable.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ParallelSet.h"
+#include "ibtk/ScratchDataIndexCache.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscao.h"
 #include "petscvec.h"
@@ -69,6 +71,7 @@
 
 namespace IBTK
 {
+class AsyncFileWriter;
 class LData;
 class LMesh;
 class LNode;
@@ -80,6 +83,8 @@ namespace hier
 {
 template <int DIM>
 class BasePatchHierarchy;
+template <int DIM>
+class Patch;
 } // namespace hier
 namespace tbox
 {
@@ -502,6 +507,12 @@ public:
     void registerLoadBalancer(SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > load_balancer,
                               int workload_data_idx);
 
+    /*!
+     * \brief Register a workload cost model to use in place of the node count
+     * based workload estimate.
+     */
+    void registerWorkloadCostModel(SAMRAI::tbox::Pointer<WorkloadCostModel> workload_cost_model);
+
     /*!
      * \brief Indicates whether there is Lagrangian data on the given patch
      * hierarchy level.
@@ -544,6 +555,18 @@ public:
      */
     unsigned int getGlobalNodeOffset(int level_number) const;
 
+    /*!
+     * \return A counter that is incremented whenever the PETSc ordering or the
+     * ghost node layout of the Lagrangian data changes on any level of the
+     * patch hierarchy.
+     *
+     * \note Objects that cache PETSc indices (e.g., force generators) may
+     * compare this value to a previously obtained value to determine whether
+     * their cached data must be regenerated following a call to
+     * endDataRedistribution().
+     */
+    int getNodeDistributionRevision() const;
+
     /*!
      * \brief Get the Lagrangian mesh associated with the given patch hierarchy
      * level.
@@ -567,6 +590,32 @@ public:
     SAMRAI::tbox::Pointer<LData>
     createLData(const std::string& quantity_name, int level_number, unsigned int depth = 1, bool maintain_data = false);
 
+    /*!
+     * \brief Begin updating the ghost values of a collection of Lagrangian
+     * quantities on the specified level of the patch hierarchy.
+     *
+     * The values of all of the quantities are packed into a single ghosted
+     * PETSc Vec, so that one neighbor-only exchange is performed regardless of
+     * the number of quantities.  NULL entries are ignored.
+     *
+     * \note All of the quantities must use the ghost node layout maintained by
+     * the LDataManager on the specified level, e.g., they must have been
+     * created via createLData().
+     *
+     * \note Each call to beginGhostUpdate() must be matched by a call to
+     * endGhostUpdate() with the same arguments.  At most one batched update
+     * with a given total depth may be in progress on a level at a time.
+     */
+    void beginGhostUpdate(const std::vector<SAMRAI::tbox::Pointer<LData> >& data, int level_number);
+
+    /*!
+     * \brief End updating the ghost values of a collection of Lagrangian
+     * quantities on the specified level of the patch hierarchy.
+     *
+     * \see beginGhostUpdate()
+     */
+    void endGhostUpdate(const std::vector<SAMRAI::tbox::Pointer<LData> >& data, int level_number);
+
     /*!
      * \brief Get the patch data descriptor index for the Lagrangian index data.
      */
@@ -753,6 +802,79 @@ public:
      */
     void scatterToZero(Vec& parallel_vec, Vec& sequential_vec) const;
 
+    /*!
+     * \brief Write the Lagrangian data to a restart file that does not depend
+     * on the parallel decomposition of the data.
+     *
+     * The data on all levels are written in global Lagrangian index order to a
+     * single file that is shared by all processes.  Each process writes a
+     * contiguous slab of the nodes of each quantity, either via MPI-IO or by a
+     * background thread (see setAsynchronousLagrangianRestartWrites()).  The
+     * data associated with the nodes are also written, so that the initial
+     * configuration may be reconstructed from the file (see
+     * setInitialLagrangianRestartData()).  Unlike the data written by
+     * putToDatabase(), this file may be read on any number of processes by
+     * readLagrangianRestartData().
+     */
+    void writeLagrangianRestartData(const std::string& dump_dirname,
+                                    int time_step_number,
+                                    double simulation_time) const;
+
+    /*!
+     * \brief Read Lagrangian data from a restart file written by
+     * writeLagrangianRestartData().
+     *
+     * Each process reads a contiguous slab of the nodes of each quantity, and
+     * the values are then scattered to the processes that own those nodes in
+     * the present data distribution.  Only those quantities that are defined
+     * both in the file and by this object are read, and the corresponding
+     * LData objects must already have been allocated, e.g., by
+     * initializeLevelData().
+     *
+     * \return The simulation time at which the data were written.
+     */
+    double readLagrangianRestartData(const std::string& dump_dirname, int time_step_number);
+
+    /*!
+     * \brief Initialize the Lagrangian configuration from a restart file
+     * written by writeLagrangianRestartData() instead of from the registered
+     * LInitStrategy object.
+     *
+     * This must be called before the patch hierarchy is initialized.  The
+     * initial refinement tags and the initial distribution of the nodes are
+     * then determined by the node positions read from the file, and the data
+     * associated with the nodes (e.g., force specification objects) are also
+     * read from the file.  The structure indexing is still provided by the
+     * LInitStrategy object.  After the patch hierarchy is initialized, the
+     * remaining quantities must be restored by readLagrangianRestartData(),
+     * which requires that the file define every quantity managed by this
+     * object.
+     *
+     * \note Each process reads the node positions and node data for all
+     * levels of the patch hierarchy.
+     */
+    void setInitialLagrangianRestartData(const std::string& dump_dirname, int time_step_number);
+
+    /*!
+     * \brief Indicate whether writeLagrangianRestartData() should write data
+     * asynchronously.
+     *
+     * When asynchronous writes are enabled, writeLagrangianRestartData()
+     * returns as soon as each process has staged its data in host memory, and
+     * the data are written to disk by a background thread while the simulation
+     * proceeds.  Only one restart file is written at a time, so that a
+     * subsequent call to writeLagrangianRestartData() first waits for the
+     * preceding file to be completed.  The amount of staged data may also be
+     * bounded by max_pending_bytes (zero indicates no bound).
+     */
+    void setAsynchronousLagrangianRestartWrites(bool async_writes, size_t max_pending_bytes = 0);
+
+    /*!
+     * \brief Block until all asynchronously written Lagrangian restart data
+     * have been written to disk.
+     */
+    void waitForLagrangianRestartWrites() const;
+
     /*!
      * \brief Start the process of redistributing the Lagrangian data.
      *
@@ -797,6 +919,12 @@ public:
      *    workload(i) = 1 + beta_work*node_count(i)
      *
      * in which alpha and beta are parameters that each default to the value 1.
+     *
+     * If a WorkloadCostModel has been registered, the workload contribution of
+     * each node is instead determined by the model from the number of grid
+     * cells of the patch covered by the interpolation and spreading stencils of
+     * the node (including nodes in the ghost cell region of the patch) and the
+     * number of force specification objects associated with the node.
      */
     void updateWorkloadEstimates(int coarsest_ln = -1, int finest_ln = -1);
 
@@ -945,6 +1073,61 @@ private:
      */
     void scatterData(Vec& lagrangian_vec, Vec& petsc_vec, int level_number, ScatterMode mode) const;
 
+    /*!
+     * \brief Create a VecScatter from the global PETSc representation of data
+     * with the specified depth to a distributed vector in which each process
+     * stores a contiguous range of Lagrangian indices.
+     *
+     * \note The caller is responsible for destroying the VecScatter and the
+     * slab vector.
+     */
+    void createLagrangianSlabScatter(VecScatter& vec_scatter,
+                                     Vec& slab_vec,
+                                     Vec petsc_vec,
+                                     int depth,
+                                     int level_number) const;
+
+    /*!
+     * \brief Read the node positions and node data from the Lagrangian restart
+     * file registered by setInitialLagrangianRestartData().
+     */
+    void loadInitialLagrangianRestartData();
+
+    /*!
+     * \brief Determine the Lagrangian indices of the restored nodes on the
+     * specified level that are located in the interior of the patch.
+     */
+    void getInitialRestartPatchNodes(std::vector<int>& patch_lag_idxs,
+                                     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                     SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                     int level_number) const;
+
+    /*!
+     * \brief Determine the number of restored nodes on the specified level
+     * that are local to this process.
+     */
+    unsigned int
+    computeInitialRestartLocalNodeCount(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                        int level_number) const;
+
+    /*!
+     * \brief Initialize the node positions, velocities, and index data on the
+     * specified level from the restored nodes.
+     *
+     * \return The number of local nodes initialized on the level.
+     */
+    unsigned int
+    initializeInitialRestartDataOnPatchLevel(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                             int level_number);
+
+    /*!
+     * \brief Tag cells on the specified level that contain restored nodes
+     * that are assigned to finer levels of the patch hierarchy.
+     */
+    void tagCellsFromInitialRestartData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                        int level_number,
+                                        int tag_index) const;
+
     /*!
      * \brief Begin the process of refilling nonlocal Lagrangian quantities over
      * the specified range of levels in the patch hierarchy.
@@ -963,6 +1146,19 @@ private:
      */
     void endNonlocalDataFill(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * \brief Return the ghosted PETSc Vec used to perform batched ghost value
+     * updates with the specified total depth on the specified level, creating
+     * it if necessary.
+     */
+    Vec getGhostUpdateVec(int total_depth, int level_number);
+
+    /*!
+     * \brief Destroy the ghosted PETSc Vec objects used to perform batched ghost
+     * value updates on the specified level.
+     */
+    void clearGhostUpdateVecs(int level_number);
+
     /*!
      * Determines the global Lagrangian and PETSc indices of the local and
      * nonlocal nodes associated with the processor as well as the local PETSc
@@ -984,8 +1180,14 @@ private:
      * Since each processor may own multiple patches in a given level, nodes
      * appearing in the ghost cell region of a patch may or may not be owned by
      * this processor.
+     *
+     * \note If the set of local nodes has not changed on any processor, the
+     * previous ordering and AO object are retained.  Otherwise, the local nodes
+     * are ordered by patch and a new AO object is created.
+     *
+     * \return Whether the global PETSc ordering has changed.
      */
-    void computeNodeDistribution(AO& ao,
+    bool computeNodeDistribution(AO& ao,
                                  std::vector<int>& local_lag_indices,
                                  std::vector<int>& nonlocal_lag_indices,
                                  std::vector<int>& local_petsc_indices,
@@ -1074,6 +1276,7 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_workload_var;
     int d_workload_idx;
     bool d_output_workload;
+    SAMRAI::tbox::Pointer<WorkloadCostModel> d_workload_cost_model;
 
     /*
      * SAMRAI::hier::Variable pointer and patch data descriptor indices for the
@@ -1157,6 +1360,28 @@ private:
     std::vector<AO> d_ao;
     static std::vector<int> s_ao_dummy;
 
+    /*!
+     * Counter that is incremented whenever the distribution of nodes changes.
+     */
+    int d_node_distribution_revision;
+
+    /*!
+     * Background writer used to write Lagrangian restart data asynchronously.
+     */
+    SAMRAI::tbox::Pointer<AsyncFileWriter> d_async_restart_writer;
+
+    /*!
+     * The Lagrangian restart file from which the initial configuration is
+     * read, and the node positions and node data read from that file.  The
+     * node data entries of each level are indexed by Lagrangian index.
+     */
+    std::string d_init_restart_dirname;
+    int d_init_restart_num;
+    bool d_init_restart_loaded;
+    std::vector<std::vector<double> > d_init_restart_posns;
+    std::vector<char> d_init_restart_node_data;
+    std::vector<std::vector<size_t> > d_init_restart_node_data_offsets;
+
     /*!
      * The total number of nodes for all processors.
      */
@@ -1206,6 +1431,23 @@ private:
     std::vector<std::vector<int> > d_nonlocal_petsc_indices;
 
     //\}
+
+    /*
+     * Scratch patch data, keyed by destination patch data index, used to
+     * accumulate spread values when boundary or prolongation operations must
+     * not be applied to the destination data.
+     */
+    ScratchDataIndexCache d_spread_scratch_data_cache;
+
+    /*
+     * Ghosted PETSc Vec objects, keyed by total depth, used to perform batched
+     * ghost value updates on each level of the patch hierarchy, along with the
+     * node distribution revision for which they were created.  Each vector's
+     * ghost scatter communicates only with the processes that own the nonlocal
+     * nodes and is reused until the node distribution changes.
+     */
+    std::vector<std::map<int, Vec> > d_ghost_update_vecs;
+    std::vector<int> d_ghost_update_vecs_revision;
 };
 } // namespace IBTK
 
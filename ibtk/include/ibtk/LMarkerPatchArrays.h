@@ -0,0 +1,193 @@
+// Filename: LMarkerPatchArrays.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_LMarkerPatchArrays
+#define included_LMarkerPatchArrays
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <iosfwd>
+#include <vector>
+
+#include "ibtk/LMarker.h"
+#include "ibtk/LMarkerSetData.h"
+#include "tbox/Pointer.h"
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Box;
+template <int DIM>
+class Patch;
+} // namespace hier
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LMarkerPatchArrays provides contiguous storage for the
+ * Lagrangian markers associated with a single patch.
+ *
+ * The marker indices, positions, and velocities are stored in separate arrays
+ * in which the markers are sorted by the Cartesian grid cell to which they are
+ * assigned.  Positions and velocities are stored with depth NDIM, so that they
+ * may be passed directly to LEInteractor.  The arrays also keep pointers to the
+ * markers from which they were collected, so that updated values may be
+ * written back to the marker patch data in bulk.
+ *
+ * \note Markers that are assigned to the same cell are stored in the order in
+ * which they appear in the corresponding LMarkerSet.  Consequently, the arrays
+ * collected from two LMarkerSetData objects with the same cell assignments
+ * (e.g., the current and new marker data) store corresponding markers in
+ * corresponding locations.
+ */
+class LMarkerPatchArrays
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    LMarkerPatchArrays();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~LMarkerPatchArrays();
+
+    /*!
+     * \brief Collect the markers that are assigned to cells in the specified
+     * box.
+     */
+    void collectMarkers(SAMRAI::tbox::Pointer<LMarkerSetData> mark_data, const SAMRAI::hier::Box<NDIM>& box);
+
+    /*!
+     * \brief Write the marker positions stored in the position array back to
+     * the collected markers.
+     */
+    void resetMarkerPositions();
+
+    /*!
+     * \brief Write the marker velocities stored in the velocity array back to
+     * the collected markers.
+     */
+    void resetMarkerVelocities();
+
+    /*!
+     * \brief Assign the collected markers whose periodically shifted positions
+     * lie within the specified patch to the cells of mark_data.
+     *
+     * Markers are binned by cell before being inserted, so that each cell's
+     * marker set is allocated exactly once.
+     *
+     * \return The number of markers assigned to mark_data.
+     */
+    unsigned int assignMarkersToCells(SAMRAI::tbox::Pointer<LMarkerSetData> mark_data,
+                                      SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const;
+
+    /*!
+     * \brief Write the collected marker data in a compact binary format.
+     *
+     * The data consist of the number of markers, followed by the marker
+     * indices, positions, and velocities.
+     */
+    void writeData(std::ostream& os) const;
+
+    /*!
+     * \return The number of markers.
+     */
+    unsigned int getNumberOfMarkers() const;
+
+    /*!
+     * \return A const reference to the marker indices.
+     */
+    const std::vector<int>& getIndices() const;
+
+    /*!
+     * \return A reference to the marker positions.
+     */
+    std::vector<double>& getPositions();
+
+    /*!
+     * \return A const reference to the marker positions.
+     */
+    const std::vector<double>& getPositions() const;
+
+    /*!
+     * \return A reference to the marker velocities.
+     */
+    std::vector<double>& getVelocities();
+
+    /*!
+     * \return A const reference to the marker velocities.
+     */
+    const std::vector<double>& getVelocities() const;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LMarkerPatchArrays(const LMarkerPatchArrays& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LMarkerPatchArrays& operator=(const LMarkerPatchArrays& that);
+
+    /*!
+     * The collected markers.
+     */
+    std::vector<SAMRAI::tbox::Pointer<LMarker> > d_marks;
+
+    /*!
+     * The marker data.
+     */
+    std::vector<int> d_idxs;
+    std::vector<double> d_X, d_U;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_LMarkerPatchArrays
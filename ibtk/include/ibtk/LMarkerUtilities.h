@@ -159,6 +159,21 @@ public:
                                      int coarsest_ln = -1,
                                      int finest_ln = -1);
 
+    /*!
+     * Write the indices, positions, and velocities of the markers to a compact
+     * binary file.
+     *
+     * Each process writes the file file_name.proc_XXXX (in which XXXX is the
+     * MPI rank).  The file consists of the spatial dimension (an int) followed
+     * by one block of data per local patch as written by
+     * LMarkerPatchArrays::writeData().
+     */
+    static void writeMarkerData(const std::string& file_name,
+                                int mark_idx,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                int coarsest_ln = -1,
+                                int finest_ln = -1);
+
 private:
     /*!
      * \brief Default constructor.
@@ -199,30 +214,6 @@ private:
      */
     static unsigned int countMarkersOnPatch(SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
 
-    /*!
-     * Collect marker positions into a single vector.
-     */
-    static void collectMarkerPositionsOnPatch(std::vector<double>& X_mark,
-                                              SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
-
-    /*!
-     * Reset marker positions from a single vector.
-     */
-    static void resetMarkerPositionsOnPatch(const std::vector<double>& X_mark,
-                                            SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
-
-    /*!
-     * Collect marker velocities into a single vector.
-     */
-    static void collectMarkerVelocitiesOnPatch(std::vector<double>& U_mark,
-                                               SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
-
-    /*!
-     * Reset marker velocities from a single vector.
-     */
-    static void resetMarkerVelocitiesOnPatch(const std::vector<double>& U_mark,
-                                             SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
-
     /*!
      * Prevent markers from leaving the computational domain through physical
      * boundaries.
@@ -243,9 +243,25 @@ private:
     /*!
      * \brief Build the VecScatter objects required to communicate data for
      * plotting.
+     *
+     * The natural-ordering indices of the local marker clouds, blocks, and
+     * meshes are recomputed only if a new AO has been registered for the
+     * level.
      */
     void buildVecScatters(AO& ao, int level_number);
 
+    /*!
+     * \brief Destroy the PETSc objects used to communicate data for plotting on
+     * the specified level.
+     */
+    void destroyVecScatters(int level_number);
+
+    /*!
+     * \brief Return the total depth of the coordinate and variable data that
+     * are packed together for plotting on the specified level.
+     */
+    int getPackedDepth(int level_number) const;
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -332,11 +348,18 @@ private:
 
     /*
      * Data for obtaining local data.
+     *
+     * The PETSc indices of the nodes in the local clouds, blocks, and meshes
+     * are cached for each level.  The coordinates and all variables on a level
+     * are packed into a single vector, so that the local data are obtained via
+     * one VecScatter per level.
      */
     std::vector<AO> d_ao;
     std::vector<bool> d_build_vec_scatters;
-    std::vector<std::map<int, Vec> > d_src_vec, d_dst_vec;
-    std::vector<std::map<int, VecScatter> > d_vec_scatter;
+    std::vector<std::vector<int> > d_src_is_idxs;
+    std::vector<int> d_packed_depth;
+    std::vector<Vec> d_src_vec, d_dst_vec;
+    std::vector<VecScatter> d_vec_scatter;
 };
 } // namespace IBTK
 
@@ -0,0 +1,324 @@
+// Filename: LocalCopyFillPattern.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_LocalCopyFillPattern
+#define included_LocalCopyFillPattern
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Box.h"
+#include "IntVector.h"
+#include "PatchLevel.h"
+#include "VariableFillPattern.h"
+#include "boost/array.hpp"
+#include "tbox/Pointer.h"
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class BoxGeometry;
+template <int DIM>
+class BoxOverlap;
+template <int DIM>
+class PatchDataFactory;
+} // namespace hier
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LocalCopyFillPattern is a concrete implementation of the
+ * abstract base class SAMRAI::xfer::VariableFillPattern that wraps another
+ * fill pattern and removes the overlaps between patches that are owned by the
+ * same process from the SAMRAI communication schedules that use it.
+ *
+ * When a same-level schedule is created for a patch level that has been
+ * specified via setTargetPatchLevel(), the overlaps between pairs of local
+ * patches are recorded by this object and an empty overlap is returned to
+ * SAMRAI, so that only the overlaps that involve patches on other processes
+ * generate schedule transactions.  The recorded overlaps are executed by
+ * copyLocalData(), which must be called before the schedule is used to fill
+ * data.  For double-precision cell- and side-centered data, the overlaps are
+ * compiled into lists of contiguous index ranges for each pair of destination
+ * and source patch data indices, and the copies are performed directly on the
+ * underlying arrays.  Other data types are copied via
+ * SAMRAI::hier::PatchData::copy().
+ *
+ * Only overlaps between patches of the target level are recorded, so that
+ * this fill pattern may also be used with schedules that interpolate data from
+ * coarser levels.  Each object records the overlaps for a single component of
+ * a schedule, and each object has a distinct pattern name so that SAMRAI does
+ * not share overlaps among the components that use different objects.
+ *
+ * \note This fill pattern may be used only with schedules for which the
+ * destination and scratch patch data indices are identical, so that the
+ * same-level copies may be performed directly into the destination data.
+ */
+class LocalCopyFillPattern : public SAMRAI::xfer::VariableFillPattern<NDIM>
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param fill_pattern  the fill pattern used to calculate overlaps.  If
+     *NULL, overlaps are calculated by the patch data geometry objects.
+     */
+    LocalCopyFillPattern(SAMRAI::tbox::Pointer<SAMRAI::xfer::VariableFillPattern<NDIM> > fill_pattern);
+
+    /*!
+     * \brief Destructor
+     */
+    ~LocalCopyFillPattern();
+
+    /*!
+     * Set the fill pattern used to calculate overlaps for schedules created
+     * subsequently.
+     */
+    void setFillPattern(SAMRAI::tbox::Pointer<SAMRAI::xfer::VariableFillPattern<NDIM> > fill_pattern);
+
+    /*!
+     * Indicate that a schedule is about to be created for the specified patch
+     * level, and that the overlaps between local patches on that level are to
+     * be recorded.  Any overlaps previously recorded for a level with the same
+     * level number are discarded.
+     */
+    void setTargetPatchLevel(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level);
+
+    /*!
+     * Stop recording overlaps between local patches.
+     */
+    void clearTargetPatchLevel();
+
+    /*!
+     * Discard all recorded overlaps.
+     */
+    void clearLocalCopies();
+
+    /*!
+     * Perform the copies between local patches that have been removed from the
+     * schedule associated with the specified level.
+     */
+    void copyLocalData(int data_idx, int level_num);
+
+    /*!
+     * Perform the copies from the source data to the destination data between
+     * local patches that have been removed from the schedule associated with
+     * the specified level.
+     */
+    void copyLocalData(int dst_data_idx, int src_data_idx, int level_num);
+
+    /*!
+     * Calculate overlaps between the destination and source geometries using
+     * the wrapped fill pattern.  If both geometries correspond to local patches
+     * of the target patch level, the overlap is recorded and an empty overlap is
+     * returned.
+     *
+     * \param dst_geometry        geometry object for destination box
+     * \param src_geometry        geometry object for source box
+     * \param dst_patch_box       box for the destination patch
+     * \param src_mask            the source mask, the box resulting from shifting the source
+     *box
+     * \param overwrite_interior  controls whether or not to include the destination box
+     *interior in
+     *the overlap
+     * \param src_offset          the offset between source and destination index space (src +
+     *src_offset = dst)
+     *
+     * \return                    pointer to the calculated overlap object
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::BoxOverlap<NDIM> >
+    calculateOverlap(const SAMRAI::hier::BoxGeometry<NDIM>& dst_geometry,
+                     const SAMRAI::hier::BoxGeometry<NDIM>& src_geometry,
+                     const SAMRAI::hier::Box<NDIM>& dst_patch_box,
+                     const SAMRAI::hier::Box<NDIM>& src_mask,
+                     bool overwrite_interior,
+                     const SAMRAI::hier::IntVector<NDIM>& src_offset) const;
+
+    /*!
+     * Calculate overlaps between the destination and source geometries using
+     * the wrapped fill pattern.  If both geometries correspond to local patches
+     * of the target patch level, the overlap is recorded and an empty overlap is
+     * returned.
+     *
+     * \param dst_geometry        geometry object for destination box
+     * \param src_geometry        geometry object for source box
+     * \param dst_patch_box       box for the destination patch
+     * \param src_mask            the source mask, the box resulting from shifting the source
+     *box
+     * \param overwrite_interior  controls whether or not to include the destination box
+     *interior in
+     *the overlap
+     * \param src_offset          the offset between source and destination index space (src +
+     *src_offset = dst)
+     * \param dst_level_num       the level of the patch hierarchy on which the dst boxes are
+     *located
+     * \param src_level_num       the level of the patch hierarchy on which the src boxes are
+     *located
+     *
+     * \return                    pointer to the calculated overlap object
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::BoxOverlap<NDIM> >
+    calculateOverlapOnLevel(const SAMRAI::hier::BoxGeometry<NDIM>& dst_geometry,
+                            const SAMRAI::hier::BoxGeometry<NDIM>& src_geometry,
+                            const SAMRAI::hier::Box<NDIM>& dst_patch_box,
+                            const SAMRAI::hier::Box<NDIM>& src_mask,
+                            bool overwrite_interior,
+                            const SAMRAI::hier::IntVector<NDIM>& src_offset,
+                            int dst_level_num,
+                            int src_level_num) const;
+
+    /*!
+     * Set the target patch level number for the wrapped fill pattern.
+     */
+    void setTargetPatchLevelNumber(int level_num);
+
+    /*!
+     * Returns the stencil width of the wrapped fill pattern.
+     */
+    SAMRAI::hier::IntVector<NDIM>& getStencilWidth();
+
+    /*!
+     * Returns a string name identifier "LOCAL_COPY_FILL_PATTERN" followed by
+     * the name of the wrapped fill pattern.
+     */
+    const std::string& getPatternName() const;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LocalCopyFillPattern(const LocalCopyFillPattern& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LocalCopyFillPattern& operator=(const LocalCopyFillPattern& that);
+
+    /*!
+     * Record the overlap if both geometries correspond to local patches of the
+     * target patch level.
+     *
+     * \return true if the overlap was recorded; false otherwise.
+     */
+    bool recordLocalCopy(const SAMRAI::hier::BoxGeometry<NDIM>& dst_geometry,
+                         const SAMRAI::hier::BoxGeometry<NDIM>& src_geometry,
+                         SAMRAI::tbox::Pointer<SAMRAI::hier::BoxOverlap<NDIM> > overlap,
+                         const SAMRAI::hier::IntVector<NDIM>& src_offset) const;
+
+    /*!
+     * Compile the recorded overlaps for the specified level into contiguous
+     * index ranges for the specified destination and source patch data
+     * indices.
+     */
+    void compileLocalCopies(int dst_data_idx, int src_data_idx, int level_num);
+
+    /*
+     * The wrapped fill pattern and the name of this fill pattern, which
+     * includes the number of this object.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::VariableFillPattern<NDIM> > d_fill_pattern;
+    std::string d_pattern_name;
+    int d_instance_num;
+    SAMRAI::hier::IntVector<NDIM> d_stencil_width;
+
+    /*
+     * Overlaps between local patches, indexed by level number.
+     */
+    struct LocalCopy
+    {
+        int dst_patch_num, src_patch_num;
+        SAMRAI::tbox::Pointer<SAMRAI::hier::BoxOverlap<NDIM> > overlap;
+        SAMRAI::hier::IntVector<NDIM> src_offset;
+    };
+    std::map<int, SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > > d_levels;
+    mutable std::map<int, std::vector<LocalCopy> > d_local_copies;
+
+    /*
+     * The target patch level and the numbers of its local patches, indexed by
+     * the corners of the patch boxes, and the level number most recently
+     * provided by SAMRAI via setTargetPatchLevelNumber().
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_target_level;
+    int d_target_level_num;
+    std::map<boost::array<int, 2 * NDIM>, int> d_target_local_patch_nums;
+
+    /*
+     * Contiguous index ranges copied between the arrays of a pair of local
+     * patches.  Offsets are relative to the beginning of the arrays for each
+     * depth index.
+     */
+    struct CopyBlock
+    {
+        int array_num;
+        int dst_offset, src_offset;
+        int extent[NDIM];
+        int dst_stride[NDIM], src_stride[NDIM];
+    };
+
+    /*
+     * Copy blocks for each pair of local patches, indexed by level number and
+     * by the destination and source patch data indices.  If the patch data
+     * cannot be copied directly, the blocks are empty and the recorded overlap
+     * is used.
+     */
+    struct CopyPlan
+    {
+        const SAMRAI::hier::PatchDataFactory<NDIM>* dst_factory;
+        const SAMRAI::hier::PatchDataFactory<NDIM>* src_factory;
+        bool copy_arrays, side_data;
+        std::vector<std::vector<CopyBlock> > blocks;
+    };
+    std::map<int, std::map<std::pair<int, int>, CopyPlan> > d_copy_plans;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_LocalCopyFillPattern
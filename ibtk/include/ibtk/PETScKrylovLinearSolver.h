@@ -101,6 +101,22 @@ namespace IBTK
  *   caller's responsibility to ensure that the supplied KSP object is properly
  *   destroyed via KSPDestroy().
  *
+ * When recycle_subspace_size is positive, the solver retains a small subspace
+ * of corrections computed by previous solves, along with the images of those
+ * corrections under the linear operator.  Before each solve, the initial guess
+ * is corrected so that the initial residual is orthogonal to the range of the
+ * operator restricted to that subspace, and the correction computed by the
+ * Krylov method is then added to the subspace.  For sequences of closely
+ * related right-hand sides, such as those arising in time-periodic flows, this
+ * can substantially reduce the number of Krylov iterations.  The subspace
+ * persists across calls to initializeSolverState() as long as the patch
+ * hierarchy configuration does not change, and it requires storage for
+ * 2*recycle_subspace_size+4 additional vectors.  Because the operator may
+ * change when the solver is reinitialized, the images of the retained vectors
+ * are recomputed, at the cost of one operator application per retained vector,
+ * at the first solve following each call to initializeSolverState().  The
+ * initial guess option of the KSP object is not modified by the projection.
+ *
  * Sample parameters for initialization from database (and their default
  * values): \verbatim
 
@@ -110,6 +126,7 @@ namespace IBTK
  rel_residual_tol = 1.0e-5     // see setRelativeTolerance()
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
+ recycle_subspace_size = 0     // see setRecycledSubspaceSize()
  enable_logging = FALSE        // see setLoggingEnabled()
  \endverbatim
  *
@@ -170,6 +187,30 @@ public:
      */
     void setOptionsPrefix(const std::string& options_prefix);
 
+    /*!
+     * \brief Set the maximum number of vectors retained from previous solves
+     * to improve the initial guess.
+     *
+     * \note A value of zero disables subspace recycling.
+     */
+    void setRecycledSubspaceSize(int recycle_subspace_size);
+
+    /*!
+     * \brief Get the maximum number of vectors retained from previous solves
+     * to improve the initial guess.
+     */
+    int getRecycledSubspaceSize() const;
+
+    /*!
+     * \brief Discard all vectors retained from previous solves.
+     *
+     * \note This function should be called whenever the patch hierarchy
+     * configuration changes.  Retained vectors are also discarded automatically
+     * by initializeSolverState() when they are no longer allocated on all
+     * levels of the patch hierarchy.
+     */
+    void clearRecycledSubspace();
+
     /*!
      * \name Functions to access the underlying PETSc objects.
      */
@@ -385,6 +426,45 @@ private:
      */
     void deallocateNullspaceData();
 
+    /*!
+     * \brief Determine whether the retained subspace vectors are compatible with
+     * the supplied solution vector and are allocated on the current patch
+     * hierarchy.
+     */
+    bool recycledSubspaceIsValid(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x) const;
+
+    /*!
+     * \brief Recompute the images of the retained subspace vectors under the
+     * current linear operator.
+     *
+     * \note This requires one application of the linear operator per retained
+     * vector.  It is deferred until the first solve following the
+     * (re-)initialization of the solver, so that repeated reinitializations do
+     * not each incur this cost.
+     */
+    void resetRecycledSubspace();
+
+    /*!
+     * \brief Correct the initial guess using the retained subspace.
+     */
+    void projectInitialGuess(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                             SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Add the correction computed by the Krylov method to the retained
+     * subspace.
+     */
+    void updateRecycledSubspace(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x);
+
+    /*!
+     * \brief Orthonormalize the candidate vector pair (d_recycle_u_new,
+     * d_recycle_c_new) with respect to the retained subspace and append it to
+     * the subspace if it is not (nearly) linearly dependent.
+     *
+     * \return true if the candidate vectors were appended to the subspace
+     */
+    bool appendRecycledVector();
+
     /*!
      * \name Static functions for use by PETSc KSP and MatShell objects.
      */
@@ -422,6 +502,18 @@ private:
     Vec d_petsc_nullspace_constant_vec;
     std::vector<Vec> d_petsc_nullspace_basis_vecs;
     bool d_solver_has_attached_nullspace;
+
+    /*
+     * Retained subspace vectors U, their images C = A*U (which are orthonormal),
+     * the candidate pair to be added to the subspace, and work vectors used to
+     * store the corrected initial guess and residual.  The images are recomputed
+     * at the next solve whenever d_recycle_subspace_needs_reset is true.
+     */
+    int d_recycle_subspace_size;
+    bool d_recycle_subspace_needs_reset;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_recycle_U, d_recycle_C;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_recycle_u_new, d_recycle_c_new;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_recycle_x0, d_recycle_r;
 };
 } // namespace IBTK
 
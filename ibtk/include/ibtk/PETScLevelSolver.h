@@ -218,6 +218,10 @@ public:
      * method.  Instead, they should override the protected method
      * deallocatedSolverStateSpecialized().
      *
+     * \note When d_reuse_petsc_objects is set by the subclass, the PETSc objects
+     * are not destroyed by this method, so that they may be reused by a
+     * subsequent call to initializeSolverState().
+     *
      * \see initializeSolverState
      */
     void deallocateSolverState();
@@ -272,6 +276,11 @@ protected:
      */
     virtual void setupNullspace();
 
+    /*!
+     * \brief Destroy all PETSc objects managed by the solver.
+     */
+    void deallocatePETScObjects();
+
     /*!
      * \brief Associated hierarchy.
      */
@@ -295,6 +304,18 @@ protected:
     Vec d_petsc_x, d_petsc_b;
     //\}
 
+    /*!
+     * \brief Whether to retain the PETSc objects when the solver state is
+     * deallocated.
+     *
+     * When this flag is set, initializeSolverStateSpecialized() is responsible
+     * for either reusing the existing PETSc objects (e.g., by resetting the
+     * values of the matrices and setting d_petsc_ksp_ops_flag appropriately) or
+     * destroying them via deallocatePETScObjects().  The KSP object is created
+     * only if it does not already exist.
+     */
+    bool d_reuse_petsc_objects;
+
 private:
     /*!
      * \brief Copy constructor.
@@ -55,6 +55,16 @@ namespace IBTK
  * \note Memory associated with the component vectors is \em not freed when the
  * vector is destroyed via VecDestroy().  Users must \em not free the array
  * until the vector is destroyed.
+ *
+ * \note When all component vectors provide local reduction operations,
+ * reductions such as VecDot(), VecMDot(), and VecNorm() combine the
+ * contributions of all components in a single MPI reduction.
+ *
+ * \note The component vectors of vectors obtained from VecDuplicate() are
+ * returned to a pool when those vectors are destroyed, and they are reused by
+ * subsequent calls to VecDuplicate().  The pool is shared by the vector and all
+ * vectors duplicated from it, and it is freed when the last of these vectors is
+ * destroyed.
  */
 PetscErrorCode VecCreateMultiVec(MPI_Comm comm, PetscInt n, Vec vv[], Vec* v);
 
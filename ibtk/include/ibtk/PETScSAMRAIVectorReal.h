@@ -35,7 +35,13 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <vector>
+
+#include "ArrayData.h"
+#include "Box.h"
 #include "IntVector.h"
+#include "PatchData.h"
+#include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
 #include "mpi.h"
 #include "petscsys.h"
@@ -66,6 +72,17 @@ namespace IBTK
  * through the static member functions that create and destroy PETSc vector
  * objects.
  *
+ * The vector update operations that PETSc uses most heavily in its Krylov
+ * solvers (\p VecMAXPY, \p VecAXPBY, \p VecAYPX, \p VecWAXPY, and \p
+ * VecAXPBYPCZ) and the fused reductions (\p VecMDot, \p VecDotNorm2, and \p
+ * VecNorm with \p NORM_1_AND_2) are implemented directly on the underlying
+ * patch data arrays whenever all of the vector components are cell- or
+ * side-centered.  These implementations make a single pass over the data
+ * instead of one pass per elementary SAMRAI vector operation.  Pointers to the
+ * arrays are cached and are rebuilt automatically when the patch data storing
+ * the vector change (e.g., after regridding).  All other cases fall back on the
+ * operations provided by SAMRAI::solv::SAMRAIVectorReal.
+ *
  * Finally, we remark that PETSc allows vectors with complex-valued entries.
  * This class and the class SAMRAI::solv::SAMRAIVectorReal assume real-values
  * vectors, i.e., data of type \p double or \p float.  The (currently
@@ -170,6 +187,104 @@ private:
 
     static PetscErrorCode VecDestroy_SAMRAI(Vec v);
 
+    static PetscErrorCode VecMDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscScalar* val);
+
+    static PetscErrorCode VecNorm_SAMRAI(Vec x, NormType type, PetscScalar* val);
+
+    static PetscErrorCode VecAXPBY_SAMRAI(Vec y, PetscScalar alpha, PetscScalar beta, Vec x);
+
+    static PetscErrorCode VecMAXPY_SAMRAI(Vec y, PetscInt nv, const PetscScalar* alpha, Vec* x);
+
+    static PetscErrorCode VecAYPX_SAMRAI(Vec y, PetscScalar alpha, Vec x);
+
+    static PetscErrorCode VecWAXPY_SAMRAI(Vec w, PetscScalar alpha, Vec x, Vec y);
+
+    static PetscErrorCode
+    VecAXPBYPCZ_SAMRAI(Vec z, PetscScalar alpha, PetscScalar beta, PetscScalar gamma, Vec x, Vec y);
+
+    static PetscErrorCode VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscScalar* nm);
+
+    static PetscErrorCode VecDot_local_SAMRAI(Vec x, Vec y, PetscScalar* val);
+
+    static PetscErrorCode VecTDot_local_SAMRAI(Vec x, Vec y, PetscScalar* val);
+
+    static PetscErrorCode VecNorm_local_SAMRAI(Vec x, NormType type, PetscScalar* val);
+
+    static PetscErrorCode VecMDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscScalar* val);
+
+    static PetscErrorCode VecMTDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscScalar* val);
+
+    /*
+     * Compute the local contributions to the dot products of x with each of
+     * the nv vectors y, using a single pass over the data when possible.
+     */
+    static void computeLocalDotProducts(Vec x, PetscInt nv, const Vec* y, PetscScalar* val);
+
+    /*
+     * Compute the local contributions to the L1 norm and to the square of the
+     * L2 norm of x, using a single pass over the data when possible.
+     */
+    static void computeLocalNorms1And2Squared(Vec x, PetscScalar* val);
+
+    /*
+     * Description of one patch data array that stores part of the local vector
+     * data.
+     *
+     * The update operations act on all size values of the array (i.e., they
+     * include ghost cells).  The reductions act on the rows of the interior of
+     * the patch, which start at the offsets stored in data_row_offsets and
+     * contain row_length values.  When the vector has control volume weights,
+     * cvol points to the corresponding weight array, and the rows of the
+     * weights start at the offsets stored in cvol_row_offsets.
+     */
+    struct ArraySpan
+    {
+        PetscScalar* data;
+        int depth, size;
+        SAMRAI::hier::Box<NDIM> array_box;
+        const double* cvol;
+        int row_length;
+        std::vector<int> data_row_offsets, cvol_row_offsets;
+    };
+
+    /*
+     * Identification of one patch data object to which the cached array spans
+     * refer: the address of the patch data, the address of its first data
+     * array, and its ghost box.
+     */
+    struct ArraySpanKey
+    {
+        SAMRAI::hier::PatchData<NDIM>* patch_data;
+        const void* storage;
+        SAMRAI::hier::Box<NDIM> ghost_box;
+    };
+
+    /*
+     * Build the description of a single patch data array.
+     */
+    static ArraySpan buildArraySpan(SAMRAI::pdat::ArrayData<NDIM, PetscScalar>& data,
+                                    const SAMRAI::pdat::ArrayData<NDIM, double>* cvol,
+                                    const SAMRAI::hier::Box<NDIM>& interior_box);
+
+    /*
+     * Build the identification of a single patch data object.
+     */
+    static ArraySpanKey buildArraySpanKey(SAMRAI::hier::PatchData<NDIM>* data);
+
+    /*
+     * Rebuild the cached array spans if the patch levels or the patch data storing the SAMRAI
+     * vector have changed, and return whether the spans may be used by the
+     * fused vector operations.
+     */
+    bool updateArraySpans();
+
+    /*
+     * Return whether the two PETSc vectors can be combined by the fused vector
+     * operations, i.e., whether they both have usable array spans with
+     * identical layouts.
+     */
+    static bool haveMatchingArraySpans(Vec v1, Vec v2);
+
     /*
      * Vector data is maintained in the SAMRAI vector structure.
      */
@@ -180,6 +295,18 @@ private:
      */
     Vec d_petsc_vector;
     bool d_vector_created_via_duplicate;
+
+    /*
+     * Cached array spans used by the fused vector operations, along with the
+     * patch levels and the patch data to which they refer.  Each patch data is
+     * followed by its control volume data (or a NULL entry).  The cache does
+     * not hold references to the patch data, so that it does not keep the
+     * storage of deallocated vectors alive.
+     */
+    std::vector<ArraySpan> d_array_spans;
+    std::vector<const SAMRAI::hier::PatchLevel<NDIM>*> d_array_span_levels;
+    std::vector<ArraySpanKey> d_array_span_patch_data;
+    bool d_array_spans_usable;
 };
 } // namespace IBTK
 
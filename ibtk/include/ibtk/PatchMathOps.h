@@ -84,6 +84,44 @@ public:
      */
     ~PatchMathOps();
 
+    /*!
+     * \name Tiled execution.
+     */
+    //\{
+
+    /*!
+     * \brief Enable or disable the cache-blocked evaluation of the cell- and
+     * side-centered Laplace operators.
+     *
+     * Tiled evaluation is disabled by default, and it is presently used only
+     * when NDIM == 3.  Each tile spans the full extent of the patch in the
+     * unit-stride direction so that the innermost loop can be vectorized.
+     */
+    void setUseTiledKernels(bool use_tiled_kernels);
+
+    /*!
+     * \brief Set the width (in cells) of the tiles used by the tiled kernels.
+     *
+     * A nonpositive value (the default) indicates that the width should be
+     * chosen from the patch size so that the stencil working set remains in
+     * cache.
+     */
+    void setTileWidth(int tile_width);
+
+    /*!
+     * \brief Enable or disable the use of OpenMP threads to process the tiles
+     * of a patch concurrently.
+     *
+     * Threading is disabled by default, and it has no effect unless the
+     * library is configured with --enable-openmp.  Tiles are processed serially
+     * when a kernel is called from within an OpenMP parallel region, e.g., by
+     * the threaded patch loops of HierarchyMathOps, so that the two levels of
+     * threading are never nested.
+     */
+    void setUseThreadedTiles(bool use_threaded_tiles);
+
+    //\}
+
     /*!
      * \name Mathematical operations.
      */
@@ -653,6 +691,13 @@ private:
      * \return A reference to this object.
      */
     PatchMathOps& operator=(const PatchMathOps& that);
+
+    /*!
+     * Parameters controlling the tiled execution of the Laplace operators.
+     */
+    bool d_use_tiled_kernels;
+    int d_tile_width;
+    bool d_use_threaded_tiles;
 };
 } // namespace IBTK
 
@@ -0,0 +1,219 @@
+// Filename: PerformanceTrace.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_PerformanceTrace
+#define included_PerformanceTrace
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace SAMRAI
+{
+namespace tbox
+{
+class Timer;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PerformanceTrace records per-timestep, per-process timing and
+ * counter data.
+ *
+ * When tracing is enabled, the time spent in each SAMRAI timer that is started
+ * and stopped via the IBTK_TIMER_START()/IBTK_TIMER_STOP() and
+ * IBAMR_TIMER_START()/IBAMR_TIMER_STOP() macros is accumulated over each
+ * sampled time step, along with the number of times the timer was started.
+ * Named counters (e.g., the number of Lagrangian markers that are interpolated
+ * or the number of Krylov iterations) may be accumulated via addToCounter().
+ *
+ * Time steps are delimited by calls to beginTimestep() and endTimestep(), which
+ * are made by HierarchyIntegrator::advanceHierarchy().  Only every
+ * sampling_interval-th time step is recorded.  At the end of each recorded time
+ * step, each process appends a single line to the file
+ * <tt>dirname/trace.NNNNN.jsonl</tt>, in which NNNNN is the MPI rank of the
+ * process.  Each line is a JSON object of the form:
+ *
+ * \verbatim
+ {"step": 10, "time": 0.01, "rank": 0, "wall": 1.25,
+  "timers": {"IBTK::LEInteractor::spread()": [0.31, 12], ...},
+  "counters": {"IBTK::LEInteractor::spread::markers": 48000, ...}}
+ \endverbatim
+ *
+ * in which the timer entries are the inclusive time (in seconds) and the number
+ * of calls.  Only timers and counters that were active during the time step
+ * are written.  The script scripts/analyze_performance_trace.py summarizes
+ * the load imbalance among processes for each timer.
+ *
+ * Tracing is typically enabled by class AppInitializer, using the \p Main
+ * database entries \p trace_interval and \p trace_dirname.
+ *
+ * \note Time is only charged to a recorded time step for timers that are
+ * started during that time step; timers that are still running at the end of
+ * the time step are charged up to that point.  Recursive starts of a timer are
+ * not counted twice.  Nested calls to beginTimestep() and endTimestep() are
+ * ignored.
+ */
+class PerformanceTrace
+{
+public:
+    /*!
+     * \brief Enable tracing and record every sampling_interval-th time step in
+     * files in the specified directory.
+     */
+    static void enable(const std::string& dirname, int sampling_interval);
+
+    /*!
+     * \brief Disable tracing and close the trace file.
+     */
+    static void disable();
+
+    /*!
+     * \brief Return whether tracing is enabled.
+     */
+    static bool isEnabled();
+
+    /*!
+     * \brief Return whether the current time step is being recorded.
+     */
+    static bool isRecording();
+
+    /*!
+     * \brief Indicate the beginning of the specified time step.
+     */
+    static void beginTimestep(int step_num, double time);
+
+    /*!
+     * \brief Indicate the end of the current time step, writing the recorded
+     * data if the time step is being recorded.
+     */
+    static void endTimestep();
+
+    /*!
+     * \brief Record that the specified timer has been started.
+     */
+    static void startTimer(const SAMRAI::tbox::Timer* timer);
+
+    /*!
+     * \brief Record that the specified timer has been stopped.
+     */
+    static void stopTimer(const SAMRAI::tbox::Timer* timer);
+
+    /*!
+     * \brief Register a named counter and return its identifier.
+     *
+     * Registering the same name more than once returns the same identifier.
+     */
+    static int registerCounter(const std::string& name);
+
+    /*!
+     * \brief Add the specified value to a counter in the current time step.
+     *
+     * \note Nothing is done unless the current time step is being recorded.
+     */
+    static void addToCounter(int counter_id, double value);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    PerformanceTrace();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PerformanceTrace(const PerformanceTrace& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PerformanceTrace& operator=(const PerformanceTrace& that);
+
+    /*!
+     * \brief Write the data for the current time step to the trace file.
+     */
+    static void writeTimestep(double wall_time);
+
+    /*!
+     * \brief Per-timer data for the current time step.
+     */
+    struct TimerRecord
+    {
+        std::string name;
+        double elapsed_time, start_time;
+        int num_calls, depth;
+    };
+
+    /*!
+     * Tracing state.
+     */
+    static bool s_is_enabled, s_is_recording;
+    static int s_sampling_interval, s_step_num, s_step_depth;
+    static double s_step_time, s_step_start_time;
+    static std::ofstream* s_trace_stream;
+
+    /*!
+     * Timer and counter data.
+     */
+    static std::map<const SAMRAI::tbox::Timer*, int> s_timer_map;
+    static std::vector<TimerRecord> s_timer_records;
+    static std::map<std::string, int> s_counter_map;
+    static std::vector<std::string> s_counter_names;
+    static std::vector<double> s_counter_values;
+};
+} // namespace IBTK
+
+/////////////////////////////// INLINE ///////////////////////////////////////
+
+#include "ibtk/private/PerformanceTrace-inl.h" // IWYU pragma: keep
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_PerformanceTrace
@@ -51,6 +51,7 @@
 #include "VariableFillPattern.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "ibtk/FACPreconditionerStrategy.h"
+#include "ibtk/LocalCopyFillPattern.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "tbox/Pointer.h"
 
@@ -108,6 +109,10 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 10            // see setCoarseSolverMaxIterations()
+ use_tiled_kernels = FALSE                    // see PatchMathOps::setUseTiledKernels()
+ tile_width = 0                               // see PatchMathOps::setTileWidth()
+ use_threaded_tiles = FALSE                   // see PatchMathOps::setUseThreadedTiles()
+ use_threaded_patch_loops = FALSE             // see HierarchyMathOps::setUseThreadedPatchLoops()
  \endverbatim
 */
 class PoissonFACPreconditionerStrategy : public FACPreconditionerStrategy
@@ -443,6 +448,20 @@ protected:
     double d_coarse_solver_abs_residual_tol;
     int d_coarse_solver_max_iterations;
 
+    /*
+     * Options for the tiled evaluation of the operator when computing
+     * residuals (see IBTK::PatchMathOps).
+     */
+    bool d_use_tiled_kernels;
+    int d_tile_width;
+    bool d_use_threaded_tiles;
+
+    /*
+     * Whether the patches of each level are processed by OpenMP threads when
+     * smoothing the error and computing residuals.
+     */
+    bool d_use_threaded_patch_loops;
+
     //\}
 
     /*!
@@ -533,16 +552,22 @@ private:
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > d_restriction_coarsen_schedules;
 
     /*
-     * Refine operator for cell data from same level.
+     * Refine operator for cell data from same level.  Copies between patches
+     * owned by the same process are performed by the fill pattern object
+     * rather than by the schedules.
      */
     SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_ghostfill_nocoarse_refine_algorithm;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_ghostfill_nocoarse_refine_schedules;
+    SAMRAI::tbox::Pointer<LocalCopyFillPattern> d_ghostfill_nocoarse_fill_pattern;
 
     /*
-     * Operator for data synchronization on same level.
+     * Operator for data synchronization on same level.  Copies between patches
+     * owned by the same process are performed by the fill pattern object
+     * rather than by the schedules.
      */
     SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_synch_refine_algorithm;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_synch_refine_schedules;
+    SAMRAI::tbox::Pointer<LocalCopyFillPattern> d_synch_local_copy_fill_pattern;
 
     //\}
 };
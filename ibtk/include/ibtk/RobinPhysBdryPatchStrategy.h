@@ -35,20 +35,29 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <map>
 #include <set>
+#include <utility>
 #include <vector>
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "ComponentSelector.h"
 #include "IntVector.h"
 #include "RefinePatchStrategy.h"
+#include "boost/array.hpp"
+#include "tbox/Pointer.h"
 
 namespace SAMRAI
 {
 namespace hier
 {
 template <int DIM>
+class BoundaryBox;
+template <int DIM>
 class Patch;
+template <int DIM>
+class Variable;
 } // namespace hier
 namespace solv
 {
@@ -68,6 +77,16 @@ namespace IBTK
  * class also provides default implementations of some methods defined in
  * SAMRAI::xfer::RefinePatchStrategy that are generally not needed for filling
  * ghost cell values at physical boundaries.
+ *
+ * Boundary condition coefficient data are stored in persistent buffers that are
+ * associated with each patch, boundary box, and coefficient object, so that
+ * ghost cell filling does not allocate coefficient arrays.  Coefficients
+ * provided by muParserRobinBcCoefs objects are also cached: time-independent
+ * coefficients are evaluated once for each boundary box (i.e., once following
+ * each regridding operation), and time-dependent coefficients are evaluated at
+ * most once per fill time.  Coefficients provided by other
+ * SAMRAI::solv::RobinBcCoefStrategy objects, which may depend on patch data or
+ * be modified between fills, are evaluated each time they are requested.
  */
 class RobinPhysBdryPatchStrategy : public SAMRAI::xfer::RefinePatchStrategy<NDIM>
 {
@@ -126,6 +145,15 @@ public:
      */
     bool getHomogeneousBc() const;
 
+    /*!
+     * \brief Clear all cached boundary condition coefficient data.
+     *
+     * \note Cached data are automatically discarded for patches whose index
+     * space has changed, and so this function typically does not need to be
+     * called following regridding operations.
+     */
+    void clearBcCoefCache();
+
     /*!
      * \name Partial implementation of SAMRAI::xfer::RefinePatchStrategy
      * interface.
@@ -203,6 +231,71 @@ public:
                                                     const SAMRAI::hier::IntVector<NDIM>& ghost_width_to_fill);
 
 protected:
+    /*!
+     * \brief Boundary condition coefficient data associated with a particular
+     * patch, boundary box, and coefficient object.
+     */
+    struct BcCoefData
+    {
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> > acoef_data, bcoef_data, gcoef_data;
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> > zero_gcoef_data;
+        boost::array<double, NDIM> dx;
+        double fill_time;
+        bool is_set;
+    };
+
+    /*!
+     * \brief Return the persistent boundary condition coefficient data for the
+     * specified patch, boundary box, and coefficient object, allocating the
+     * data if necessary.
+     *
+     * \param patch           Patch on which boundary data are to be set.
+     * \param patch_data_idx  Patch data index of the data being filled.
+     * \param bc_coef         Coefficient object used to set the coefficients.
+     * \param location_index  Location index of the boundary box.
+     * \param data_axis       Data axis for side-centered data whose coefficients
+     *                        are set along tangential boundaries, or -1.
+     * \param bc_coef_box     Index space of the coefficient data.
+     */
+    BcCoefData& getBcCoefData(const SAMRAI::hier::Patch<NDIM>& patch,
+                              int patch_data_idx,
+                              const SAMRAI::solv::RobinBcCoefStrategy<NDIM>* bc_coef,
+                              unsigned int location_index,
+                              int data_axis,
+                              const SAMRAI::hier::Box<NDIM>& bc_coef_box);
+
+    /*!
+     * \brief Return whether the coefficient values stored in \a bc_coef_data
+     * may be used without reevaluating the coefficients.
+     *
+     * \note Only coefficients provided by muParserRobinBcCoefs objects are
+     * reused, and only if they were computed for a patch with the same index
+     * space and grid spacing.
+     */
+    bool isBcCoefDataCurrent(const BcCoefData& bc_coef_data,
+                             const SAMRAI::solv::RobinBcCoefStrategy<NDIM>* bc_coef,
+                             const SAMRAI::hier::Patch<NDIM>& patch,
+                             double fill_time) const;
+
+    /*!
+     * \brief Evaluate the boundary condition coefficients, storing the values
+     * in \a bc_coef_data.
+     */
+    void setBcCoefData(BcCoefData& bc_coef_data,
+                       SAMRAI::solv::RobinBcCoefStrategy<NDIM>* bc_coef,
+                       int patch_data_idx,
+                       const SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> >& var,
+                       const SAMRAI::hier::Patch<NDIM>& patch,
+                       const SAMRAI::hier::BoundaryBox<NDIM>& bdry_box,
+                       double fill_time);
+
+    /*!
+     * \brief Return the g coefficient values to use with the coefficient data,
+     * accounting for homogeneous boundary conditions.
+     */
+    const double* getGcoefPointer(BcCoefData& bc_coef_data,
+                                  const SAMRAI::solv::RobinBcCoefStrategy<NDIM>* bc_coef) const;
+
     /*
      * The patch data indices corresponding to the "scratch" patch data that
      * requires extrapolation of ghost cell values at physical boundaries.
@@ -239,6 +332,18 @@ private:
      * \return A reference to this object.
      */
     RobinPhysBdryPatchStrategy& operator=(const RobinPhysBdryPatchStrategy& that);
+
+    /*
+     * Cached boundary condition coefficient data.  The data are indexed by the
+     * level number, patch number, patch data index, boundary location index,
+     * data axis, and coefficient box extents, and by the coefficient object.
+     * The index space of each patch for which data are cached is recorded so
+     * that stale data can be discarded following regridding.
+     */
+    typedef boost::array<int, 5 + 2 * NDIM> BcCoefCacheIndex;
+    typedef std::pair<BcCoefCacheIndex, const SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> BcCoefCacheKey;
+    std::map<BcCoefCacheKey, BcCoefData> d_bc_coef_cache;
+    std::map<std::pair<int, int>, SAMRAI::hier::Box<NDIM> > d_bc_coef_cache_patch_boxes;
 };
 } // namespace IBTK
 
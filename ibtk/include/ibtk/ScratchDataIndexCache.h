@@ -0,0 +1,135 @@
+// Filename: ScratchDataIndexCache.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef included_ScratchDataIndexCache
+#define included_ScratchDataIndexCache
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+
+#include "PatchHierarchy.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class ScratchDataIndexCache manages scratch patch data indices that
+ * are cloned from other patch data indices, e.g., the scratch data used to
+ * spread Lagrangian forces into Eulerian data that do not have enough ghost
+ * cells for the spreading stencil.
+ *
+ * A scratch index is registered with the VariableDatabase the first time that
+ * it is requested for a particular patch data index, and the scratch data are
+ * allocated on demand.  The scratch data should be deallocated whenever the
+ * patch hierarchy is regridded.  The scratch indices are removed from the
+ * VariableDatabase by clear() and by the destructor.
+ */
+class ScratchDataIndexCache
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    ScratchDataIndexCache();
+
+    /*!
+     * \brief Destructor.
+     *
+     * Deallocates the scratch data and removes the scratch patch data indices
+     * from the VariableDatabase.
+     */
+    ~ScratchDataIndexCache();
+
+    /*!
+     * \brief Return a scratch patch data index that is a clone of the
+     * specified patch data index, and ensure that the scratch data are
+     * allocated on the specified range of levels of the patch hierarchy.
+     */
+    int getScratchDataIndex(int data_idx,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                            int coarsest_ln,
+                            int finest_ln);
+
+    /*!
+     * \brief Deallocate the scratch data on all levels of the patch hierarchy.
+     *
+     * The scratch patch data indices remain registered and are reallocated on
+     * demand by getScratchDataIndex().
+     */
+    void deallocateScratchData();
+
+    /*!
+     * \brief Deallocate the scratch data and remove the scratch patch data
+     * indices from the VariableDatabase.
+     */
+    void clear();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    ScratchDataIndexCache(const ScratchDataIndexCache& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    ScratchDataIndexCache& operator=(const ScratchDataIndexCache& that);
+
+    /*
+     * The patch hierarchy on which the scratch data are allocated.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+
+    /*
+     * Map from patch data indices to the corresponding scratch patch data
+     * indices.
+     */
+    std::map<int, int> d_scratch_data_idxs;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_ScratchDataIndexCache
@@ -46,6 +46,10 @@
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
 
+namespace IBTK
+{
+class LocalCopyFillPattern;
+} // namespace IBTK
 namespace SAMRAI
 {
 namespace xfer
@@ -216,6 +220,9 @@ private:
 
     SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_refine_alg;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_refine_scheds;
+
+    // Fill patterns that perform the copies between local patches.
+    std::vector<SAMRAI::tbox::Pointer<LocalCopyFillPattern> > d_local_copy_fill_patterns;
 };
 } // namespace IBTK
 
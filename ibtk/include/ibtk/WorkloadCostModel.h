@@ -0,0 +1,240 @@
+// Filename: WorkloadCostModel.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_WorkloadCostModel
+#define included_WorkloadCostModel
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+
+#include "PatchHierarchy.h"
+#include "tbox/Pointer.h"
+#include "tbox/Serializable.h"
+
+namespace SAMRAI
+{
+namespace tbox
+{
+class Database;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class WorkloadCostModel provides a calibrated linear model of the
+ * computational cost of an immersed boundary timestep that is used to set the
+ * cell workloads for nonuniform load balancing.
+ *
+ * The workload associated with a Cartesian grid cell is modeled as
+ *
+ *    workload(i) = 1 + interaction_cost*interaction_work(i) + force_cost*force_work(i)
+ *
+ * in which the Eulerian cost of a cell is used as the unit of work,
+ * interaction_work(i) is the number of Cartesian grid cells in the
+ * spreading/interpolation stencils of the Lagrangian points that are associated
+ * with cell i (including points in the ghost cell region of the patch), and
+ * force_work(i) counts the Lagrangian force evaluations (e.g., the number of
+ * force specifications or quadrature points) associated with cell i.
+ *
+ * The cost coefficients are calibrated from wall-clock timings of the
+ * Eulerian, Lagrangian-Eulerian interaction, and Lagrangian force parts of each
+ * timestep that are recorded via startTimer() and stopTimer().  At each call to
+ * calibrate(), the per-item cost of each type of work is determined by a
+ * least-squares fit over all MPI processes of the measured time per timestep
+ * against the amount of work of that type assigned to each process, as
+ * reported via addLocalWork().  Because the work counts are gathered while the
+ * workload estimates are being computed, coefficients determined by
+ * calibrate() are used for the \em next workload estimate.
+ *
+ * The calibrated cost coefficients are written to restart files, and they
+ * replace the initial values provided in the input database when the model is
+ * restored from restart.
+ *
+ * Sample input database entries:
+ *
+ * \verbatim
+ WorkloadCostModel {
+    interaction_cost = 0.01  // initial cost per stencil point (default 0.01)
+    force_cost = 0.1         // initial cost per force evaluation (default 0.1)
+    relaxation_factor = 0.5  // weight given to new calibrations (default 0.5)
+    enable_calibration = TRUE
+    enable_logging = TRUE
+ }
+ \endverbatim
+ */
+class WorkloadCostModel : public SAMRAI::tbox::Serializable
+{
+public:
+    /*!
+     * \brief Enumerated type for the types of work tracked by the model.
+     */
+    enum WorkType
+    {
+        EULERIAN_WORK = 0,
+        INTERACTION_WORK = 1,
+        FORCE_WORK = 2,
+        NUM_WORK_TYPES = 3
+    };
+
+    /*!
+     * \brief Constructor.
+     */
+    WorkloadCostModel(const std::string& object_name,
+                      SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db = NULL,
+                      bool register_for_restart = true);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~WorkloadCostModel();
+
+    /*!
+     * \brief Return the cost of a unit of work of the specified type, relative
+     * to the Eulerian cost of a single Cartesian grid cell.
+     */
+    double getCost(WorkType work_type) const;
+
+    /*!
+     * \brief Indicate that a timestep is beginning.
+     */
+    void beginTimestep();
+
+    /*!
+     * \brief Indicate that a timestep has been completed.
+     */
+    void endTimestep();
+
+    /*!
+     * \brief Start timing work of the specified type.
+     *
+     * \note Each type of work must be timed explicitly.  Time that is spent
+     * between beginTimestep() and endTimestep() that is not attributed to any
+     * type of work, including time spent waiting on other processes, is not
+     * used to calibrate the cost coefficients.
+     */
+    void startTimer(WorkType work_type);
+
+    /*!
+     * \brief Stop timing work of the specified type.
+     */
+    void stopTimer(WorkType work_type);
+
+    /*!
+     * \brief Reset the local work counts.
+     */
+    void resetLocalWork();
+
+    /*!
+     * \brief Add to the amount of work of the specified type that has been
+     * assigned to this MPI process.
+     */
+    void addLocalWork(WorkType work_type, double num_items);
+
+    /*!
+     * \brief Recalibrate the cost coefficients using the timings recorded since
+     * the previous calibration and the current local work counts, and reset the
+     * accumulated timings.
+     *
+     * \note This is a collective operation.
+     */
+    void calibrate();
+
+    /*!
+     * \brief Print statistics on the distribution of the workload data with
+     * the specified patch data index over the MPI processes.
+     *
+     * \note This is a collective operation.
+     */
+    void printWorkloadStatistics(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                 int workload_data_idx) const;
+
+    /*!
+     * \brief Write the calibrated cost coefficients to the specified database.
+     */
+    void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    WorkloadCostModel();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    WorkloadCostModel(const WorkloadCostModel& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    WorkloadCostModel& operator=(const WorkloadCostModel& that);
+
+    /*!
+     * \brief Read the calibrated cost coefficients from the restart database.
+     */
+    void getFromRestart();
+
+    std::string d_object_name;
+    bool d_registered_for_restart;
+    bool d_enable_calibration, d_enable_logging;
+    double d_relaxation_factor;
+
+    /*
+     * Cost coefficients, local work counts, and accumulated timings for each
+     * type of work.
+     */
+    double d_cost[NUM_WORK_TYPES];
+    double d_local_work[NUM_WORK_TYPES];
+    double d_elapsed_time[NUM_WORK_TYPES], d_start_time[NUM_WORK_TYPES];
+    double d_elapsed_step_time, d_step_start_time;
+    int d_num_steps;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_WorkloadCostModel
@@ -39,6 +39,7 @@
 
 #include "Eigen/Core" // IWYU pragma: export
 #include "boost/array.hpp"
+#include "ibtk/PerformanceTrace.h"
 #include "tbox/PIO.h"
 #include "tbox/Utilities.h"
 
@@ -114,13 +115,21 @@ static const bool ENABLE_TIMERS = true;
 #define IBTK_TIMER_START(timer)                                                                                        \
     do                                                                                                                 \
     {                                                                                                                  \
-        if (IBTK::ENABLE_TIMERS) timer->start();                                                                       \
+        if (IBTK::ENABLE_TIMERS)                                                                                       \
+        {                                                                                                              \
+            timer->start();                                                                                            \
+            if (IBTK::PerformanceTrace::isRecording()) IBTK::PerformanceTrace::startTimer(timer);                      \
+        }                                                                                                              \
     } while (0);
 
 #define IBTK_TIMER_STOP(timer)                                                                                         \
     do                                                                                                                 \
     {                                                                                                                  \
-        if (IBTK::ENABLE_TIMERS) timer->stop();                                                                        \
+        if (IBTK::ENABLE_TIMERS)                                                                                       \
+        {                                                                                                              \
+            timer->stop();                                                                                             \
+            if (IBTK::PerformanceTrace::isRecording()) IBTK::PerformanceTrace::stopTimer(timer);                       \
+        }                                                                                                              \
     } while (0);
 
 /////////////////////////////// FUNCTION DEFINITIONS /////////////////////////
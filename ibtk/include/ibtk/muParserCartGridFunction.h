@@ -72,6 +72,12 @@ namespace IBTK
  * class CartGridFunction that allows for the run-time specification of
  * (possibly spatially- and temporally-varying) functions which are used to set
  * double precision values on standard SAMRAI SAMRAI::hier::PatchData objects.
+ *
+ * The functions are evaluated in bulk over all of the data locations of each
+ * patch.  If none of the functions depends on time and the input database sets
+ * the boolean key "cache_time_independent_values" to TRUE, the computed values
+ * are cached by patch geometry and reused, so that repeated evaluations on an
+ * unchanged patch hierarchy only copy data.
  */
 class muParserCartGridFunction : public CartGridFunction
 {
@@ -141,6 +147,18 @@ private:
      */
     muParserCartGridFunction& operator=(const muParserCartGridFunction& that);
 
+    /*!
+     * \brief Ensure that the variable arrays can hold the specified number of
+     * evaluation points, and set the time variable for those points.
+     */
+    void resizeParserVariables(unsigned int num_points, double data_time);
+
+    /*!
+     * \brief Evaluate the specified function at the first num_points points
+     * stored in the position variable arrays.
+     */
+    void evaluateParser(int function_depth, unsigned int num_points, double* values);
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -164,10 +182,24 @@ private:
     std::vector<mu::Parser> d_parsers;
 
     /*!
-     * Time and position variables.
+     * Time and position variables.  The parsers are evaluated in bulk mode, in
+     * which each variable provides one value for each evaluation point.
+     */
+    std::vector<double> d_parser_time;
+    boost::array<std::vector<double>, NDIM> d_parser_posn;
+
+    /*!
+     * Whether any of the functions depends on time.
+     */
+    bool d_time_dependent;
+
+    /*!
+     * Cached function values, indexed by the data centering and patch
+     * geometry.
      */
-    double d_parser_time;
-    Point d_parser_posn;
+    bool d_cache_values;
+    std::map<std::vector<double>, std::vector<double> > d_cached_values;
+    size_t d_num_cached_values;
 };
 } // namespace IBTK
 
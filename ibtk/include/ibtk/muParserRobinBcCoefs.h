@@ -42,6 +42,7 @@
 #include "CartesianGridGeometry.h"
 #include "IntVector.h"
 #include "RobinBcCoefStrategy.h"
+#include "boost/array.hpp"
 #include "muParser.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/Pointer.h"
@@ -77,6 +78,11 @@ namespace IBTK
  * SAMRAI::solv::RobinBcCoefStrategy that allows for the run-time specification
  * of (possibly spatially- and temporally-varying) Robin boundary conditions.
  *
+ * The coefficient functions are evaluated in bulk over all of the locations of
+ * each boundary box.  Coefficient functions that do not depend on time are
+ * reported as such by isTimeDependent(), which allows the Robin boundary
+ * operators to reuse the coefficient values that they have already computed.
+ *
  * \warning Not all linear solvers in IBTK properly handle time-varying \em
  * homogeneous Robin boundary condition coefficients.  Note, however, that all
  * linear solvers in IBTK are presently designed to support spatially and
@@ -157,6 +163,15 @@ public:
 
     //\}
 
+    /*!
+     * \brief Return whether any of the coefficient functions depends on the
+     * time variable.
+     *
+     * Coefficients that do not depend on time may be reused by boundary
+     * filling routines for all fill times.
+     */
+    bool isTimeDependent() const;
+
 private:
     /*!
      * \brief Default constructor.
@@ -185,6 +200,12 @@ private:
      */
     muParserRobinBcCoefs& operator=(const muParserRobinBcCoefs& that);
 
+    /*!
+     * \brief Ensure that the variable arrays can hold the specified number of
+     * evaluation points, and set the time variable for those points.
+     */
+    void resizeParserVariables(unsigned int num_points, double fill_time) const;
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -212,10 +233,16 @@ private:
     std::vector<mu::Parser> d_gcoef_parsers;
 
     /*!
-     * Time and position variables.
+     * Time and position variables.  The parsers are evaluated in bulk mode, in
+     * which each variable provides one value for each evaluation point.
+     */
+    std::vector<double>* d_parser_time;
+    boost::array<std::vector<double>, NDIM>* d_parser_posn;
+
+    /*!
+     * Whether any of the coefficient functions depends on the time variable.
      */
-    double* d_parser_time;
-    Point* d_parser_posn;
+    bool d_is_time_dependent;
 };
 } // namespace IBTK
 
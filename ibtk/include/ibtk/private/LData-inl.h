@@ -65,6 +65,11 @@ inline unsigned int LData::getGhostNodeCount() const
     return d_ghost_node_count;
 } // getGhostNodeCount
 
+inline const std::vector<int>& LData::getNonlocalPETScIndices() const
+{
+    return d_nonlocal_petsc_indices;
+} // getNonlocalPETScIndices
+
 inline unsigned int LData::getDepth() const
 {
     return d_depth;
@@ -110,6 +110,11 @@ inline unsigned int LDataManager::getGlobalNodeOffset(const int level_number) co
     return d_node_offset[level_number];
 } // getGlobalNodeOffset
 
+inline int LDataManager::getNodeDistributionRevision() const
+{
+    return d_node_distribution_revision;
+} // getNodeDistributionRevision
+
 inline SAMRAI::tbox::Pointer<LMesh> LDataManager::getLMesh(const int level_number) const
 {
 #if !defined(NDEBUG)
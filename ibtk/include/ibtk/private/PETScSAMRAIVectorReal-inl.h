@@ -97,6 +97,10 @@ inline void PETScSAMRAIVectorReal::replaceSAMRAIVector(
     TBOX_ASSERT(psv);
 #endif
     psv->d_samrai_vector = samrai_vec;
+    psv->d_array_spans.clear();
+    psv->d_array_span_patch_data.clear();
+    psv->d_array_span_levels.clear();
+    psv->d_array_spans_usable = false;
     int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(petsc_vec));
     IBTK_CHKERRQ(ierr);
     return;
@@ -0,0 +1,25 @@
+# -------------------------------------------------------------
+# -------------------------------------------------------------
+AC_DEFUN([CONFIGURE_OPENMP],[
+echo
+echo "==================================="
+echo "Configuring optional OpenMP support"
+echo "==================================="
+
+AC_ARG_ENABLE([openmp],
+  AS_HELP_STRING(--enable-openmp,enable OpenMP threading of patch loops and kernels @<:@default=no@:>@),
+                 [case "$enableval" in
+                    yes)  OPENMP_ENABLED=yes ;;
+                    no)   OPENMP_ENABLED=no ;;
+                    *)    AC_MSG_ERROR(--enable-openmp=$enableval is invalid; choices are "yes" and "no") ;;
+                  esac],[OPENMP_ENABLED=no])
+
+if test "$OPENMP_ENABLED" = yes; then
+  AC_OPENMP
+  if test "$ac_cv_prog_cxx_openmp" = unsupported ; then
+    AC_MSG_ERROR([OpenMP support is enabled, but the C++ compiler does not support OpenMP])
+  fi
+  CXXFLAGS="$CXXFLAGS $OPENMP_CXXFLAGS"
+  LDFLAGS="$LDFLAGS $OPENMP_CXXFLAGS"
+fi
+])
@@ -68,6 +68,8 @@
 #include "ibtk/CartSideRobinPhysBdryOp.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/LocalCopyFillPattern.h"
+#include "ibtk/PerformanceTrace.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -113,8 +115,8 @@ static Timer* t_fill_data_set_physical_bcs;
 HierarchyGhostCellInterpolation::HierarchyGhostCellInterpolation()
     : d_is_initialized(false), d_homogeneous_bc(false), d_transaction_comps(), d_hierarchy(NULL), d_grid_geom(NULL),
       d_coarsest_ln(-1), d_finest_ln(-1), d_coarsen_alg(NULL), d_coarsen_strategy(NULL), d_coarsen_scheds(),
-      d_refine_alg(NULL), d_refine_strategy(NULL), d_refine_scheds(), d_cf_bdry_ops(), d_extrap_bc_ops(),
-      d_cc_robin_bc_ops(), d_sc_robin_bc_ops()
+      d_refine_alg(NULL), d_refine_strategy(NULL), d_refine_scheds(), d_local_copy_fill_patterns(), d_cf_bdry_ops(),
+      d_extrap_bc_ops(), d_cc_robin_bc_ops(), d_sc_robin_bc_ops()
 {
     // Setup Timers.
     IBTK_DO_ONCE(
@@ -230,6 +232,7 @@ void HierarchyGhostCellInterpolation::initializeOperatorState(
     d_extrap_bc_ops.resize(d_transaction_comps.size());
     d_cc_robin_bc_ops.resize(d_transaction_comps.size());
     d_sc_robin_bc_ops.resize(d_transaction_comps.size());
+    d_local_copy_fill_patterns.resize(d_transaction_comps.size());
     d_refine_alg = new RefineAlgorithm<NDIM>();
     std::vector<RefinePatchStrategy<NDIM>*> refine_patch_strategies;
     for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
@@ -294,7 +297,12 @@ void HierarchyGhostCellInterpolation::initializeOperatorState(
                           "presently supported." << std::endl);
         }
 
-        d_refine_alg->registerRefine(dst_data_idx, src_data_idx, dst_data_idx, refine_op, fill_pattern);
+        // NOTE: Same-level copies between local patches are performed directly
+        // by the fill pattern objects instead of by the communication
+        // schedules.
+        d_local_copy_fill_patterns[comp_idx] = new LocalCopyFillPattern(fill_pattern);
+        d_refine_alg->registerRefine(
+            dst_data_idx, src_data_idx, dst_data_idx, refine_op, d_local_copy_fill_patterns[comp_idx]);
 
         const std::string& phys_bdry_extrap_type = d_transaction_comps[comp_idx].d_phys_bdry_extrap_type;
         if (phys_bdry_extrap_type != "NONE")
@@ -331,7 +339,15 @@ void HierarchyGhostCellInterpolation::initializeOperatorState(
     for (int dst_ln = d_coarsest_ln; dst_ln <= d_finest_ln; ++dst_ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
+        for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+        {
+            d_local_copy_fill_patterns[comp_idx]->setTargetPatchLevel(level);
+        }
         d_refine_scheds[dst_ln] = d_refine_alg->createSchedule(level, dst_ln - 1, d_hierarchy, d_refine_strategy);
+        for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+        {
+            d_local_copy_fill_patterns[comp_idx]->clearTargetPatchLevel();
+        }
     }
 
     // Setup physical BC type.
@@ -456,7 +472,12 @@ void HierarchyGhostCellInterpolation::resetTransactionComponents(
                           "presently supported." << std::endl);
         }
 
-        d_refine_alg->registerRefine(dst_data_idx, src_data_idx, dst_data_idx, refine_op, fill_pattern);
+        // NOTE: The fill pattern objects are reused because they keep track of
+        // the copies between local patches that have been removed from the
+        // schedules.
+        d_local_copy_fill_patterns[comp_idx]->setFillPattern(fill_pattern);
+        d_refine_alg->registerRefine(
+            dst_data_idx, src_data_idx, dst_data_idx, refine_op, d_local_copy_fill_patterns[comp_idx]);
 
         const std::string& phys_bdry_extrap_type = d_transaction_comps[comp_idx].d_phys_bdry_extrap_type;
         if (d_extrap_bc_ops[comp_idx])
@@ -548,6 +569,7 @@ void HierarchyGhostCellInterpolation::deallocateOperatorState()
     delete d_refine_strategy;
     d_refine_strategy = NULL;
     d_refine_scheds.clear();
+    d_local_copy_fill_patterns.clear();
 
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
@@ -584,6 +606,11 @@ void HierarchyGhostCellInterpolation::fillData(double fill_time)
     IBTK_TIMER_START(t_fill_data_refine);
     for (int dst_ln = d_coarsest_ln; dst_ln <= d_finest_ln; ++dst_ln)
     {
+        for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+        {
+            d_local_copy_fill_patterns[comp_idx]->copyLocalData(
+                d_transaction_comps[comp_idx].d_dst_data_idx, d_transaction_comps[comp_idx].d_src_data_idx, dst_ln);
+        }
         if (d_refine_scheds[dst_ln]) d_refine_scheds[dst_ln]->fillData(fill_time);
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
         const IntVector<NDIM>& ratio = level->getRatioToCoarserLevel();
@@ -603,6 +630,28 @@ void HierarchyGhostCellInterpolation::fillData(double fill_time)
     }
     IBTK_TIMER_STOP(t_fill_data_refine);
 
+    // Record the number of ghost cells filled on each processor.
+    if (PerformanceTrace::isRecording())
+    {
+        static const int num_ghost_cells_counter =
+            PerformanceTrace::registerCounter("IBTK::HierarchyGhostCellInterpolation::ghost_cells");
+        for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+                {
+                    const int dst_data_idx = d_transaction_comps[comp_idx].d_dst_data_idx;
+                    Pointer<PatchData<NDIM> > dst_data = patch->getPatchData(dst_data_idx);
+                    PerformanceTrace::addToCounter(num_ghost_cells_counter,
+                                                   dst_data->getGhostBox().size() - dst_data->getBox().size());
+                }
+            }
+        }
+    }
+
     // Set Robin boundary conditions at physical boundaries.
     IBTK_TIMER_START(t_fill_data_set_physical_bcs);
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
@@ -49,7 +49,6 @@
 #include "Variable.h"
 #include "VariableDatabase.h"
 #include "ibtk/CartCellRobinPhysBdryOp.h"
-#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/PhysicalBoundaryUtilities.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -439,30 +438,26 @@ void CartCellRobinPhysBdryOp::fillGhostCellValuesCodim1(const int patch_data_idx
         const BoundaryBox<NDIM> trimmed_bdry_box(
             bdry_box.getBox() * bc_fill_box, bdry_box.getBoundaryType(), bdry_box.getLocationIndex());
         const Box<NDIM> bc_coef_box = PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box);
-        Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-        Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-        Pointer<ArrayData<NDIM, double> > gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
         for (int d = 0; d < patch_data_depth; ++d)
         {
             RobinBcCoefStrategy<NDIM>* bc_coef = d_bc_coefs[d];
-            ExtendedRobinBcCoefStrategy* const extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
-            if (extended_bc_coef)
+            BcCoefData& bc_coef_data = getBcCoefData(patch, patch_data_idx, bc_coef, location_index, -1, bc_coef_box);
+            if (!isBcCoefDataCurrent(bc_coef_data, bc_coef, patch, fill_time))
             {
-                extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
-                extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
+                setBcCoefData(bc_coef_data, bc_coef, patch_data_idx, var, patch, trimmed_bdry_box, fill_time);
             }
-            bc_coef->setBcCoefs(acoef_data, bcoef_data, gcoef_data, var, patch, trimmed_bdry_box, fill_time);
-            if (d_homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
-            if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+            const double* const acoef = bc_coef_data.acoef_data->getPointer();
+            const double* const bcoef = bc_coef_data.bcoef_data->getPointer();
+            const double* const gcoef = getGcoefPointer(bc_coef_data, bc_coef);
             switch (location_index)
             {
             case 0: // lower x
             case 1: // upper x
                 CC_ROBIN_PHYS_BDRY_OP_1_X_FC(patch_data->getPointer(d),
                                              patch_data_gcw,
-                                             acoef_data->getPointer(),
-                                             bcoef_data->getPointer(),
-                                             gcoef_data->getPointer(),
+                                             acoef,
+                                             bcoef,
+                                             gcoef,
                                              location_index,
                                              patch_box.lower(0),
                                              patch_box.upper(0),
@@ -485,9 +480,9 @@ void CartCellRobinPhysBdryOp::fillGhostCellValuesCodim1(const int patch_data_idx
             case 3: // upper y
                 CC_ROBIN_PHYS_BDRY_OP_1_Y_FC(patch_data->getPointer(d),
                                              patch_data_gcw,
-                                             acoef_data->getPointer(),
-                                             bcoef_data->getPointer(),
-                                             gcoef_data->getPointer(),
+                                             acoef,
+                                             bcoef,
+                                             gcoef,
                                              location_index,
                                              patch_box.lower(0),
                                              patch_box.upper(0),
@@ -511,9 +506,9 @@ void CartCellRobinPhysBdryOp::fillGhostCellValuesCodim1(const int patch_data_idx
             case 5: // upper z
                 CC_ROBIN_PHYS_BDRY_OP_1_Z_FC(patch_data->getPointer(d),
                                              patch_data_gcw,
-                                             acoef_data->getPointer(),
-                                             bcoef_data->getPointer(),
-                                             gcoef_data->getPointer(),
+                                             acoef,
+                                             bcoef,
+                                             gcoef,
                                              location_index,
                                              patch_box.lower(0),
                                              patch_box.upper(0),
@@ -53,7 +53,6 @@
 #include "VariableDatabase.h"
 #include "boost/array.hpp"
 #include "ibtk/CartSideRobinPhysBdryOp.h"
-#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/PhysicalBoundaryUtilities.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -537,28 +536,24 @@ void CartSideRobinPhysBdryOp::fillGhostCellValuesCodim1Normal(const int patch_da
         const BoundaryBox<NDIM> trimmed_bdry_box(
             bdry_box.getBox() * bc_fill_box, bdry_box.getBoundaryType(), location_index);
         const Box<NDIM> bc_coef_box = PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box);
-        Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-        Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-        Pointer<ArrayData<NDIM, double> > gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
         for (int d = 0; d < patch_data_depth; ++d)
         {
             RobinBcCoefStrategy<NDIM>* bc_coef = d_bc_coefs[NDIM * d + bdry_normal_axis];
-            ExtendedRobinBcCoefStrategy* const extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
-            if (extended_bc_coef)
+            BcCoefData& bc_coef_data = getBcCoefData(patch, patch_data_idx, bc_coef, location_index, -1, bc_coef_box);
+            if (!isBcCoefDataCurrent(bc_coef_data, bc_coef, patch, fill_time))
             {
-                extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
-                extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
+                setBcCoefData(bc_coef_data, bc_coef, patch_data_idx, var, patch, trimmed_bdry_box, fill_time);
             }
-            bc_coef->setBcCoefs(acoef_data, bcoef_data, gcoef_data, var, patch, trimmed_bdry_box, fill_time);
-            if (d_homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
-            if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+            const double* const acoef = bc_coef_data.acoef_data->getPointer();
+            const double* const bcoef = bc_coef_data.bcoef_data->getPointer();
+            const double* const gcoef = getGcoefPointer(bc_coef_data, bc_coef);
             if (location_index == 0 || location_index == 1)
             {
                 SC_ROBIN_PHYS_BDRY_OP_1_X_FC(patch_data->getPointer(bdry_normal_axis, d),
                                              patch_data_gcw,
-                                             acoef_data->getPointer(),
-                                             bcoef_data->getPointer(),
-                                             gcoef_data->getPointer(),
+                                             acoef,
+                                             bcoef,
+                                             gcoef,
                                              location_index,
                                              patch_box.lower(0),
                                              patch_box.upper(0),
@@ -581,9 +576,9 @@ void CartSideRobinPhysBdryOp::fillGhostCellValuesCodim1Normal(const int patch_da
             {
                 SC_ROBIN_PHYS_BDRY_OP_1_Y_FC(patch_data->getPointer(bdry_normal_axis, d),
                                              patch_data_gcw,
-                                             acoef_data->getPointer(),
-                                             bcoef_data->getPointer(),
-                                             gcoef_data->getPointer(),
+                                             acoef,
+                                             bcoef,
+                                             gcoef,
                                              location_index,
                                              patch_box.lower(0),
                                              patch_box.upper(0),
@@ -607,9 +602,9 @@ void CartSideRobinPhysBdryOp::fillGhostCellValuesCodim1Normal(const int patch_da
             {
                 SC_ROBIN_PHYS_BDRY_OP_1_Z_FC(patch_data->getPointer(bdry_normal_axis, d),
                                              patch_data_gcw,
-                                             acoef_data->getPointer(),
-                                             bcoef_data->getPointer(),
-                                             gcoef_data->getPointer(),
+                                             acoef,
+                                             bcoef,
+                                             gcoef,
                                              location_index,
                                              patch_box.lower(0),
                                              patch_box.upper(0),
@@ -684,6 +679,8 @@ CartSideRobinPhysBdryOp::fillGhostCellValuesCodim1Transverse(const int patch_dat
 
     // Set the boundary condition coefficients and then set the ghost cell
     // values.
+    std::vector<BcCoefData*> bc_coef_data(patch_data_depth);
+    std::vector<bool> set_bc_coef_data(patch_data_depth);
     for (int n = 0; n < n_physical_codim1_boxes; ++n)
     {
         const BoundaryBox<NDIM>& bdry_box = physical_codim1_boxes[n];
@@ -698,54 +695,64 @@ CartSideRobinPhysBdryOp::fillGhostCellValuesCodim1Transverse(const int patch_dat
             {
                 const Box<NDIM> bc_coef_box = compute_tangential_extension(
                     PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box), axis);
-                Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-                Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-                Pointer<ArrayData<NDIM, double> > gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-
-                // Temporarily reset the patch geometry object associated with
-                // the patch so that boundary conditions are set at the correct
-                // spatial locations.
-                boost::array<double, NDIM> shifted_patch_x_lower, shifted_patch_x_upper;
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    shifted_patch_x_lower[d] = patch_x_lower[d];
-                    shifted_patch_x_upper[d] = patch_x_upper[d];
-                }
-                shifted_patch_x_lower[axis] -= 0.5 * dx[axis];
-                shifted_patch_x_upper[axis] -= 0.5 * dx[axis];
-                patch.setPatchGeometry(new CartesianPatchGeometry<NDIM>(ratio_to_level_zero,
-                                                                        touches_regular_bdry,
-                                                                        touches_periodic_bdry,
-                                                                        dx,
-                                                                        shifted_patch_x_lower.data(),
-                                                                        shifted_patch_x_upper.data()));
-
-                // Set the boundary condition coefficients.
+
+                // Lookup the boundary condition coefficients, which only need
+                // to be set if cached values are not available.
+                bool set_bc_coefs = false;
                 for (int d = 0; d < patch_data_depth; ++d)
                 {
                     RobinBcCoefStrategy<NDIM>* bc_coef = d_bc_coefs[NDIM * d + axis];
-                    ExtendedRobinBcCoefStrategy* const extended_bc_coef =
-                        dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
-                    if (extended_bc_coef)
+                    bc_coef_data[d] = &getBcCoefData(patch, patch_data_idx, bc_coef, location_index, axis, bc_coef_box);
+                    set_bc_coef_data[d] = !isBcCoefDataCurrent(*bc_coef_data[d], bc_coef, patch, fill_time);
+                    set_bc_coefs = set_bc_coefs || set_bc_coef_data[d];
+                }
+                if (set_bc_coefs)
+                {
+                    // Temporarily reset the patch geometry object associated
+                    // with the patch so that boundary conditions are set at the
+                    // correct spatial locations.
+                    boost::array<double, NDIM> shifted_patch_x_lower, shifted_patch_x_upper;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        shifted_patch_x_lower[d] = patch_x_lower[d];
+                        shifted_patch_x_upper[d] = patch_x_upper[d];
+                    }
+                    shifted_patch_x_lower[axis] -= 0.5 * dx[axis];
+                    shifted_patch_x_upper[axis] -= 0.5 * dx[axis];
+                    patch.setPatchGeometry(new CartesianPatchGeometry<NDIM>(ratio_to_level_zero,
+                                                                            touches_regular_bdry,
+                                                                            touches_periodic_bdry,
+                                                                            dx,
+                                                                            shifted_patch_x_lower.data(),
+                                                                            shifted_patch_x_upper.data()));
+
+                    // Set the boundary condition coefficients.
+                    for (int d = 0; d < patch_data_depth; ++d)
                     {
-                        extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
-                        extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
+                        if (!set_bc_coef_data[d]) continue;
+                        RobinBcCoefStrategy<NDIM>* bc_coef = d_bc_coefs[NDIM * d + axis];
+                        setBcCoefData(
+                            *bc_coef_data[d], bc_coef, patch_data_idx, var, patch, trimmed_bdry_box, fill_time);
                     }
-                    bc_coef->setBcCoefs(acoef_data, bcoef_data, gcoef_data, var, patch, trimmed_bdry_box, fill_time);
-                    if (d_homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
-                    if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
 
                     // Restore the original patch geometry object.
                     patch.setPatchGeometry(pgeom);
+                }
 
-                    // Set the boundary values.
+                // Set the boundary values.
+                for (int d = 0; d < patch_data_depth; ++d)
+                {
+                    RobinBcCoefStrategy<NDIM>* bc_coef = d_bc_coefs[NDIM * d + axis];
+                    const double* const acoef = bc_coef_data[d]->acoef_data->getPointer();
+                    const double* const bcoef = bc_coef_data[d]->bcoef_data->getPointer();
+                    const double* const gcoef = getGcoefPointer(*bc_coef_data[d], bc_coef);
                     if (location_index == 0 || location_index == 1)
                     {
                         CC_ROBIN_PHYS_BDRY_OP_1_X_FC(patch_data->getPointer(axis, d),
                                                      patch_data_gcw,
-                                                     acoef_data->getPointer(),
-                                                     bcoef_data->getPointer(),
-                                                     gcoef_data->getPointer(),
+                                                     acoef,
+                                                     bcoef,
+                                                     gcoef,
                                                      location_index,
                                                      side_box[axis].lower(0),
                                                      side_box[axis].upper(0),
@@ -768,9 +775,9 @@ CartSideRobinPhysBdryOp::fillGhostCellValuesCodim1Transverse(const int patch_dat
                     {
                         CC_ROBIN_PHYS_BDRY_OP_1_Y_FC(patch_data->getPointer(axis, d),
                                                      patch_data_gcw,
-                                                     acoef_data->getPointer(),
-                                                     bcoef_data->getPointer(),
-                                                     gcoef_data->getPointer(),
+                                                     acoef,
+                                                     bcoef,
+                                                     gcoef,
                                                      location_index,
                                                      side_box[axis].lower(0),
                                                      side_box[axis].upper(0),
@@ -794,9 +801,9 @@ CartSideRobinPhysBdryOp::fillGhostCellValuesCodim1Transverse(const int patch_dat
                     {
                         CC_ROBIN_PHYS_BDRY_OP_1_Z_FC(patch_data->getPointer(axis, d),
                                                      patch_data_gcw,
-                                                     acoef_data->getPointer(),
-                                                     bcoef_data->getPointer(),
-                                                     gcoef_data->getPointer(),
+                                                     acoef,
+                                                     bcoef,
+                                                     gcoef,
                                                      location_index,
                                                      side_box[axis].lower(0),
                                                      side_box[axis].upper(0),
@@ -32,31 +32,28 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <map>
 #include <ostream>
 #include <set>
+#include <utility>
 #include <vector>
 
+#include "ArrayData.h"
+#include "BoundaryBox.h"
 #include "Box.h"
+#include "CartesianPatchGeometry.h"
 #include "ComponentSelector.h"
 #include "IntVector.h"
+#include "Patch.h"
+#include "RobinBcCoefStrategy.h"
+#include "Variable.h"
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/muParserRobinBcCoefs.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
-namespace SAMRAI
-{
-namespace hier
-{
-template <int DIM>
-class Patch;
-} // namespace hier
-namespace solv
-{
-template <int DIM>
-class RobinBcCoefStrategy;
-} // namespace solv
-} // namespace SAMRAI
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -65,7 +62,8 @@ namespace IBTK
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-RobinPhysBdryPatchStrategy::RobinPhysBdryPatchStrategy() : d_patch_data_indices(), d_bc_coefs(), d_homogeneous_bc(false)
+RobinPhysBdryPatchStrategy::RobinPhysBdryPatchStrategy()
+    : d_patch_data_indices(), d_bc_coefs(), d_homogeneous_bc(false), d_bc_coef_cache(), d_bc_coef_cache_patch_boxes()
 {
     // intentionally blank
     return;
@@ -122,6 +120,7 @@ void RobinPhysBdryPatchStrategy::setPhysicalBcCoefs(const std::vector<RobinBcCoe
     }
 #endif
     d_bc_coefs = bc_coefs;
+    clearBcCoefCache();
     return;
 } // setPhysicalBcCoefs
 
@@ -136,6 +135,13 @@ bool RobinPhysBdryPatchStrategy::getHomogeneousBc() const
     return d_homogeneous_bc;
 } // getHomogeneousBc
 
+void RobinPhysBdryPatchStrategy::clearBcCoefCache()
+{
+    d_bc_coef_cache.clear();
+    d_bc_coef_cache_patch_boxes.clear();
+    return;
+} // clearBcCoefCache
+
 void RobinPhysBdryPatchStrategy::preprocessRefine(Patch<NDIM>& /*fine*/,
                                                   const Patch<NDIM>& /*coarse*/,
                                                   const Box<NDIM>& /*fine_box*/,
@@ -164,6 +170,135 @@ void RobinPhysBdryPatchStrategy::accumulateFromPhysicalBoundaryData(Patch<NDIM>&
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+RobinPhysBdryPatchStrategy::BcCoefData&
+RobinPhysBdryPatchStrategy::getBcCoefData(const Patch<NDIM>& patch,
+                                          const int patch_data_idx,
+                                          const RobinBcCoefStrategy<NDIM>* const bc_coef,
+                                          const unsigned int location_index,
+                                          const int data_axis,
+                                          const Box<NDIM>& bc_coef_box)
+{
+    // Discard any data cached for a different patch with the same level and
+    // patch numbers, e.g., following regridding.
+    const int ln = patch.getPatchLevelNumber();
+    const int patch_num = patch.getPatchNumber();
+    const std::pair<int, int> patch_id(ln, patch_num);
+    std::map<std::pair<int, int>, Box<NDIM> >::iterator box_it = d_bc_coef_cache_patch_boxes.find(patch_id);
+    if (box_it == d_bc_coef_cache_patch_boxes.end())
+    {
+        d_bc_coef_cache_patch_boxes.insert(std::make_pair(patch_id, patch.getBox()));
+    }
+    else if (!(box_it->second == patch.getBox()))
+    {
+        for (std::map<BcCoefCacheKey, BcCoefData>::iterator it = d_bc_coef_cache.begin(); it != d_bc_coef_cache.end();)
+        {
+            if (it->first.first[0] == ln && it->first.first[1] == patch_num)
+            {
+                d_bc_coef_cache.erase(it++);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        box_it->second = patch.getBox();
+    }
+
+    // Lookup the cached data, allocating it if necessary.
+    BcCoefCacheIndex idx;
+    idx[0] = ln;
+    idx[1] = patch_num;
+    idx[2] = patch_data_idx;
+    idx[3] = static_cast<int>(location_index);
+    idx[4] = data_axis;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        idx[5 + d] = bc_coef_box.lower(d);
+        idx[5 + NDIM + d] = bc_coef_box.upper(d);
+    }
+    const BcCoefCacheKey key(idx, bc_coef);
+    std::map<BcCoefCacheKey, BcCoefData>::iterator it = d_bc_coef_cache.find(key);
+    if (it == d_bc_coef_cache.end())
+    {
+        BcCoefData bc_coef_data;
+        bc_coef_data.acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        bc_coef_data.bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        bc_coef_data.gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        bc_coef_data.dx.fill(0.0);
+        bc_coef_data.fill_time = 0.0;
+        bc_coef_data.is_set = false;
+        it = d_bc_coef_cache.insert(std::make_pair(key, bc_coef_data)).first;
+    }
+    return it->second;
+} // getBcCoefData
+
+bool RobinPhysBdryPatchStrategy::isBcCoefDataCurrent(const BcCoefData& bc_coef_data,
+                                                     const RobinBcCoefStrategy<NDIM>* const bc_coef,
+                                                     const Patch<NDIM>& patch,
+                                                     const double fill_time) const
+{
+    if (!bc_coef_data.is_set) return false;
+    const muParserRobinBcCoefs* const parser_bc_coef = dynamic_cast<const muParserRobinBcCoefs*>(bc_coef);
+    if (!parser_bc_coef) return false;
+    if (parser_bc_coef->isTimeDependent() && fill_time != bc_coef_data.fill_time) return false;
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (dx[d] != bc_coef_data.dx[d]) return false;
+    }
+    return true;
+} // isBcCoefDataCurrent
+
+void RobinPhysBdryPatchStrategy::setBcCoefData(BcCoefData& bc_coef_data,
+                                               RobinBcCoefStrategy<NDIM>* const bc_coef,
+                                               const int patch_data_idx,
+                                               const Pointer<Variable<NDIM> >& var,
+                                               const Patch<NDIM>& patch,
+                                               const BoundaryBox<NDIM>& bdry_box,
+                                               const double fill_time)
+{
+    ExtendedRobinBcCoefStrategy* const extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+    if (extended_bc_coef)
+    {
+        extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
+        extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
+    }
+    bc_coef->setBcCoefs(bc_coef_data.acoef_data,
+                        bc_coef_data.bcoef_data,
+                        bc_coef_data.gcoef_data,
+                        var,
+                        patch,
+                        bdry_box,
+                        fill_time);
+    if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        bc_coef_data.dx[d] = dx[d];
+    }
+    bc_coef_data.fill_time = fill_time;
+    bc_coef_data.is_set = true;
+    return;
+} // setBcCoefData
+
+const double* RobinPhysBdryPatchStrategy::getGcoefPointer(BcCoefData& bc_coef_data,
+                                                          const RobinBcCoefStrategy<NDIM>* const bc_coef) const
+{
+    // Extended coefficient objects set homogeneous values themselves.
+    if (!d_homogeneous_bc || dynamic_cast<const ExtendedRobinBcCoefStrategy*>(bc_coef))
+    {
+        return bc_coef_data.gcoef_data->getPointer();
+    }
+    if (!bc_coef_data.zero_gcoef_data)
+    {
+        bc_coef_data.zero_gcoef_data = new ArrayData<NDIM, double>(bc_coef_data.gcoef_data->getBox(), 1);
+        bc_coef_data.zero_gcoef_data->fillAll(0.0);
+    }
+    return bc_coef_data.zero_gcoef_data->getPointer();
+} // getGcoefPointer
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
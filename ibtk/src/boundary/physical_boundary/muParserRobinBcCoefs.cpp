@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <map>
 #include <ostream>
 #include <string>
@@ -83,7 +84,8 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
                                            Pointer<CartesianGridGeometry<NDIM> > grid_geom)
     : d_grid_geom(grid_geom), d_constants(), d_acoef_function_strings(), d_bcoef_function_strings(),
       d_gcoef_function_strings(), d_acoef_parsers(2 * NDIM), d_bcoef_parsers(2 * NDIM), d_gcoef_parsers(2 * NDIM),
-      d_parser_time(new double), d_parser_posn(new Point)
+      d_parser_time(new std::vector<double>()), d_parser_posn(new boost::array<std::vector<double>, NDIM>()),
+      d_is_time_dependent(true)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -287,19 +289,30 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         {
             (*cit)->DefineConst(map_cit->first, map_cit->second);
         }
+    }
 
-        // Variables.
-        (*cit)->DefineVar("T", d_parser_time);
-        (*cit)->DefineVar("t", d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Variables.
+    resizeParserVariables(1, 0.0);
+
+    // Determine whether any of the functions depend on time.
+    d_is_time_dependent = false;
+    for (std::vector<mu::Parser*>::const_iterator cit = all_parsers.begin(); cit != all_parsers.end(); ++cit)
+    {
+        try
         {
-            std::ostringstream stream;
-            stream << d;
-            const std::string postfix = stream.str();
-            (*cit)->DefineVar("X" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("x" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("X_" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("x_" + postfix, &d_parser_posn->data()[d]);
+            const mu::varmap_type& used_vars = (*cit)->GetUsedVar();
+            d_is_time_dependent = d_is_time_dependent || used_vars.count("t") || used_vars.count("T");
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                       << "  error: " << e.GetMsg() << "\n"
+                       << "  in:    " << e.GetExpr() << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
         }
     }
     return;
@@ -339,41 +352,48 @@ void muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_d
     TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
 
-    const mu::Parser& acoef_parser = d_acoef_parsers[location_index];
-    const mu::Parser& bcoef_parser = d_bcoef_parsers[location_index];
-    const mu::Parser& gcoef_parser = d_gcoef_parsers[location_index];
-    *d_parser_time = fill_time;
-    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+    // Set the positions of the boundary locations.
+    const unsigned int num_points = static_cast<unsigned int>(bc_coef_box.size());
+    resizeParserVariables(num_points, fill_time);
+    unsigned int k = 0;
+    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++k)
     {
         const Index<NDIM>& i = b();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             if (d != bdry_normal_axis)
             {
-                (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                (*d_parser_posn)[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
             }
             else
             {
-                (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                (*d_parser_posn)[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
             }
         }
-        try
-        {
-            if (acoef_data) (*acoef_data)(i, 0) = acoef_parser.Eval();
-            if (bcoef_data) (*bcoef_data)(i, 0) = bcoef_parser.Eval();
-            if (gcoef_data) (*gcoef_data)(i, 0) = gcoef_parser.Eval();
-        }
-        catch (mu::ParserError& e)
-        {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  error: " << e.GetMsg() << "\n"
-                       << "  in:    " << e.GetExpr() << "\n");
-        }
-        catch (...)
-        {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  unrecognized exception generated by muParser library.\n");
-        }
+    }
+
+    // Evaluate the coefficients in bulk.  The coefficient arrays store their
+    // values in the order in which the box iterator visits the boundary
+    // locations.  (The bulk evaluation interface of mu::Parser is not const.)
+    mu::Parser& acoef_parser = const_cast<mu::Parser&>(d_acoef_parsers[location_index]);
+    mu::Parser& bcoef_parser = const_cast<mu::Parser&>(d_bcoef_parsers[location_index]);
+    mu::Parser& gcoef_parser = const_cast<mu::Parser&>(d_gcoef_parsers[location_index]);
+    try
+    {
+        if (acoef_data) acoef_parser.Eval(acoef_data->getPointer(0), static_cast<int>(num_points));
+        if (bcoef_data) bcoef_parser.Eval(bcoef_data->getPointer(0), static_cast<int>(num_points));
+        if (gcoef_data) gcoef_parser.Eval(gcoef_data->getPointer(0), static_cast<int>(num_points));
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                   << "  error: " << e.GetMsg() << "\n"
+                   << "  in:    " << e.GetExpr() << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
     }
     return;
 } // setBcCoefs
@@ -383,10 +403,54 @@ IntVector<NDIM> muParserRobinBcCoefs::numberOfExtensionsFillable() const
     return EXTENSIONS_FILLABLE;
 } // numberOfExtensionsFillable
 
+bool muParserRobinBcCoefs::isTimeDependent() const
+{
+    return d_is_time_dependent;
+} // isTimeDependent
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void muParserRobinBcCoefs::resizeParserVariables(const unsigned int num_points, const double fill_time) const
+{
+    if (d_parser_time->size() < num_points)
+    {
+        // Resizing the variable arrays may move their data, and so the
+        // variables must be redefined.  (Redefining variables modifies the
+        // parsers but not the functions that they evaluate.)
+        d_parser_time->resize(num_points);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            (*d_parser_posn)[d].resize(num_points);
+        }
+        std::vector<mu::Parser*> all_parsers;
+        for (int k = 0; k < 2 * NDIM; ++k)
+        {
+            all_parsers.push_back(const_cast<mu::Parser*>(&d_acoef_parsers[k]));
+            all_parsers.push_back(const_cast<mu::Parser*>(&d_bcoef_parsers[k]));
+            all_parsers.push_back(const_cast<mu::Parser*>(&d_gcoef_parsers[k]));
+        }
+        for (std::vector<mu::Parser*>::const_iterator cit = all_parsers.begin(); cit != all_parsers.end(); ++cit)
+        {
+            (*cit)->DefineVar("T", &(*d_parser_time)[0]);
+            (*cit)->DefineVar("t", &(*d_parser_time)[0]);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                std::ostringstream stream;
+                stream << d;
+                const std::string postfix = stream.str();
+                (*cit)->DefineVar("X" + postfix, &(*d_parser_posn)[d][0]);
+                (*cit)->DefineVar("x" + postfix, &(*d_parser_posn)[d][0]);
+                (*cit)->DefineVar("X_" + postfix, &(*d_parser_posn)[d][0]);
+                (*cit)->DefineVar("x_" + postfix, &(*d_parser_posn)[d][0]);
+            }
+        }
+    }
+    std::fill(d_parser_time->begin(), d_parser_time->begin() + num_points, fill_time);
+    return;
+} // resizeParserVariables
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -85,6 +85,7 @@
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LEInteractor.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -94,6 +95,7 @@
 #include "libmesh/dof_map.h"
 #include "libmesh/elem.h"
 #include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_fe_family.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_parallel_type.h"
 #include "libmesh/enum_quadrature_type.h"
@@ -212,8 +214,126 @@ inline short int get_dirichlet_bdry_ids(const std::vector<short int>& bdry_ids)
     return dirichlet_bdry_ids;
 } // get_dirichlet_bdry_ids
 
-inline double get_elem_hmax(Elem* const elem, const boost::multi_array<double, 2>& X_node)
+// The number of reference directions for which quadrature point counts are
+// stored.
+static const int MAX_ELEM_DIM = 3;
+
+// Reference directions of the edges of tensor-product elements, in the libMesh
+// edge ordering.
+static const int QUAD_EDGE_DIRECTION[4] = { 0, 1, 0, 1 };
+static const int HEX_EDGE_DIRECTION[12] = { 0, 1, 0, 1, 2, 2, 2, 2, 0, 1, 0, 1 };
+
+// Local indices of the vertices of the edges of the supported element types,
+// in the libMesh edge ordering.  The vertices of higher-order elements are
+// numbered in the same way as those of the corresponding linear elements.
+static const unsigned int TRI_EDGE_VERTICES[3][2] = { { 0, 1 }, { 1, 2 }, { 2, 0 } };
+static const unsigned int QUAD_EDGE_VERTICES[4][2] = { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 } };
+static const unsigned int TET_EDGE_VERTICES[6][2] = { { 0, 1 }, { 1, 2 }, { 0, 2 }, { 0, 3 }, { 1, 3 }, { 2, 3 } };
+static const unsigned int HEX_EDGE_VERTICES[12][2] = { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 0, 3 }, { 0, 4 }, { 1, 5 },
+                                                       { 2, 6 }, { 3, 7 }, { 4, 5 }, { 5, 6 }, { 6, 7 }, { 4, 7 } };
+
+inline bool is_tensor_product_elem(const ElemType elem_type)
 {
+    switch (elem_type)
+    {
+    case EDGE2:
+    case EDGE3:
+    case EDGE4:
+    case QUAD4:
+    case QUAD8:
+    case QUAD9:
+    case HEX8:
+    case HEX20:
+    case HEX27:
+        return true;
+    default:
+        return false;
+    }
+} // is_tensor_product_elem
+
+inline bool is_nodal_quadrature_elem(const ElemType elem_type)
+{
+    switch (elem_type)
+    {
+    case EDGE2:
+    case TRI3:
+    case QUAD4:
+    case TET4:
+    case HEX8:
+        return true;
+    default:
+        return false;
+    }
+} // is_nodal_quadrature_elem
+
+// Compute the maximum deformed extent of the element along each of its
+// reference directions.  For elements without a tensor-product structure, the
+// maximum edge length is used for all directions.
+//
+// As in libMesh, the length of an edge is the distance between its vertices.
+// For the common element types, the edge lengths are computed directly from
+// the nodal positions.
+inline void get_elem_hmax(double* const hmax, Elem* const elem, const boost::multi_array<double, 2>& X_node)
+{
+    std::fill(hmax, hmax + MAX_ELEM_DIM, 0.0);
+    const ElemType elem_type = elem->type();
+    const unsigned int(*edge_vertices)[2] = NULL;
+    const int* edge_direction = NULL;
+    unsigned int n_edges = 0;
+    switch (elem_type)
+    {
+    case EDGE2:
+    case EDGE3:
+    case EDGE4:
+    {
+        double h_sq = 0.0;
+        for (int d = 0; d < NDIM; ++d) h_sq += (X_node[1][d] - X_node[0][d]) * (X_node[1][d] - X_node[0][d]);
+        hmax[0] = std::sqrt(h_sq);
+        return;
+    }
+    case TRI3:
+    case TRI6:
+        edge_vertices = TRI_EDGE_VERTICES;
+        n_edges = 3;
+        break;
+    case QUAD4:
+    case QUAD8:
+    case QUAD9:
+        edge_vertices = QUAD_EDGE_VERTICES;
+        edge_direction = QUAD_EDGE_DIRECTION;
+        n_edges = 4;
+        break;
+    case TET4:
+    case TET10:
+        edge_vertices = TET_EDGE_VERTICES;
+        n_edges = 6;
+        break;
+    case HEX8:
+    case HEX20:
+    case HEX27:
+        edge_vertices = HEX_EDGE_VERTICES;
+        edge_direction = HEX_EDGE_DIRECTION;
+        n_edges = 12;
+        break;
+    default:
+        break;
+    }
+    if (edge_vertices)
+    {
+        for (unsigned int e = 0; e < n_edges; ++e)
+        {
+            const unsigned int k0 = edge_vertices[e][0], k1 = edge_vertices[e][1];
+            double h_sq = 0.0;
+            for (int d = 0; d < NDIM; ++d) h_sq += (X_node[k1][d] - X_node[k0][d]) * (X_node[k1][d] - X_node[k0][d]);
+            const int axis = edge_direction ? edge_direction[e] : 0;
+            hmax[axis] = std::max(hmax[axis], std::sqrt(h_sq));
+        }
+        if (!edge_direction) std::fill(hmax + 1, hmax + MAX_ELEM_DIM, hmax[0]);
+        return;
+    }
+
+    // For other element types, temporarily move the element nodes to their
+    // deformed positions and let libMesh measure the edges.
     const unsigned int max_nodes = (elem->dim() == 3 ? 27 : 9);
     std::vector<libMesh::Point> s_node_cache(max_nodes);
     const unsigned int n_node = elem->n_nodes();
@@ -227,27 +347,304 @@ inline double get_elem_hmax(Elem* const elem, const boost::multi_array<double, 2
             X(d) = X_node[k][d];
         }
     }
-    double hmax = 0.0;
-    switch (elem->type())
+    for (unsigned int e = 0; e < elem->n_edges(); ++e)
     {
-    case EDGE2:
-    case EDGE3:
-    case EDGE4:
-        hmax = elem->hmax();
-        break;
-    default:
-        for (unsigned int e = 0; e < elem->n_edges(); ++e)
-        {
-            hmax = std::max(hmax, elem->build_edge(e)->hmax());
-        }
-        break;
+        hmax[0] = std::max(hmax[0], elem->build_edge(e)->hmax());
     }
+    std::fill(hmax + 1, hmax + MAX_ELEM_DIM, hmax[0]);
     for (unsigned int k = 0; k < n_node; ++k)
     {
         elem->point(k) = s_node_cache[k];
     }
-    return hmax;
+    return;
 } // get_elem_hmax
+
+// Compute the number of quadrature points required along each reference
+// direction of an element with the specified deformed extents to obtain the
+// requested point density.
+inline void get_elem_quad_npts(int* const npts,
+                               const double* const hmax,
+                               Elem* const elem,
+                               const double point_density,
+                               const double dx_min)
+{
+    const int min_pts = elem->default_order() == FIRST ? 1 : 2;
+    for (int axis = 0; axis < MAX_ELEM_DIM; ++axis)
+    {
+        npts[axis] = std::max(min_pts, static_cast<int>(std::ceil(point_density * hmax[axis] / dx_min)));
+    }
+    return;
+} // get_elem_quad_npts
+
+// Compute the number of quadrature points required along each reference
+// direction of the element to obtain the requested point density.
+inline void get_elem_quad_npts(int* const npts,
+                               Elem* const elem,
+                               const boost::multi_array<double, 2>& X_node,
+                               const double point_density,
+                               const double dx_min)
+{
+    double hmax[MAX_ELEM_DIM];
+    get_elem_hmax(hmax, elem, X_node);
+    get_elem_quad_npts(npts, hmax, elem, point_density, dx_min);
+    return;
+} // get_elem_quad_npts
+
+// Determine the order of the one-dimensional quadrature rule of the specified
+// type that provides the specified number of points.
+inline Order get_adaptive_quad_order(const QuadratureType type, const int npts, const std::string& caller)
+{
+    switch (type)
+    {
+    case QGAUSS:
+        return static_cast<Order>(std::min(2 * npts - 1, static_cast<int>(FORTYTHIRD)));
+    case QGRID:
+        return static_cast<Order>(npts);
+    default:
+        TBOX_ERROR(caller << ":\n"
+                          << "  adaptive quadrature rules are available only for quad_type = QGAUSS "
+                             "or QGRID\n");
+    }
+    return INVALID_ORDER;
+} // get_adaptive_quad_order
+
+// Tensor-product quadrature rule that uses a possibly different number of
+// points along each reference direction of the element.  The rule is built from
+// one-dimensional rules of the specified type.
+class QAnisotropicTensor : public QBase
+{
+public:
+    QAnisotropicTensor(const unsigned int dim, const QuadratureType type, const Order* const orders)
+        : QBase(dim, *std::max_element(orders, orders + dim)), d_type(type)
+    {
+        std::copy(orders, orders + dim, d_orders);
+        return;
+    } // QAnisotropicTensor
+
+    QuadratureType type() const
+    {
+        return d_type;
+    } // type
+
+    bool has_orders(const Order* const orders) const
+    {
+        return std::equal(orders, orders + get_dim(), d_orders);
+    } // has_orders
+
+private:
+    void init_1D(const ElemType /*elem_type*/, unsigned int p_level)
+    {
+        init_tensor_product(p_level);
+        return;
+    } // init_1D
+
+    void init_2D(const ElemType /*elem_type*/, unsigned int p_level)
+    {
+        init_tensor_product(p_level);
+        return;
+    } // init_2D
+
+    void init_3D(const ElemType /*elem_type*/, unsigned int p_level)
+    {
+        init_tensor_product(p_level);
+        return;
+    } // init_3D
+
+    void init_tensor_product(const unsigned int p_level)
+    {
+        const unsigned int dim = get_dim();
+        AutoPtr<QBase> q1D[MAX_ELEM_DIM];
+        unsigned int n_qp = 1;
+        for (unsigned int axis = 0; axis < dim; ++axis)
+        {
+            q1D[axis] = QBase::build(d_type, 1, d_orders[axis]);
+            q1D[axis]->init(EDGE2, p_level);
+            n_qp *= q1D[axis]->n_points();
+        }
+        _points.resize(n_qp);
+        _weights.resize(n_qp);
+        for (unsigned int qp = 0; qp < n_qp; ++qp)
+        {
+            _points[qp] = libMesh::Point();
+            _weights[qp] = 1.0;
+            unsigned int offset = qp;
+            for (unsigned int axis = 0; axis < dim; ++axis)
+            {
+                const unsigned int n_qp_axis = q1D[axis]->n_points();
+                const unsigned int qp_axis = offset % n_qp_axis;
+                offset /= n_qp_axis;
+                _points[qp](axis) = q1D[axis]->qp(qp_axis)(0);
+                _weights[qp] *= q1D[axis]->w(qp_axis);
+            }
+        }
+        return;
+    } // init_tensor_product
+
+    const QuadratureType d_type;
+    Order d_orders[MAX_ELEM_DIM];
+};
+
+// Nodal (lumped) quadrature rule for linear elements.  The quadrature points
+// are the element vertices, in the libMesh node ordering, so that the values of
+// the nodal basis functions at the quadrature points are the identity.
+class QNodal : public QBase
+{
+public:
+    explicit QNodal(const unsigned int dim) : QBase(dim, FIRST)
+    {
+        return;
+    } // QNodal
+
+    QuadratureType type() const
+    {
+        return QTRAP;
+    } // type
+
+private:
+    void init_1D(const ElemType elem_type, unsigned int /*p_level*/)
+    {
+        static const double x[2][1] = { { -1.0 }, { 1.0 } };
+        init_nodes(elem_type, EDGE2, 2, &x[0][0], 1.0);
+        return;
+    } // init_1D
+
+    void init_2D(const ElemType elem_type, unsigned int /*p_level*/)
+    {
+        static const double x_tri[3][2] = { { 0.0, 0.0 }, { 1.0, 0.0 }, { 0.0, 1.0 } };
+        static const double x_quad[4][2] = { { -1.0, -1.0 }, { 1.0, -1.0 }, { 1.0, 1.0 }, { -1.0, 1.0 } };
+        if (elem_type == TRI3)
+            init_nodes(elem_type, TRI3, 3, &x_tri[0][0], 1.0 / 6.0);
+        else
+            init_nodes(elem_type, QUAD4, 4, &x_quad[0][0], 1.0);
+        return;
+    } // init_2D
+
+    void init_3D(const ElemType elem_type, unsigned int /*p_level*/)
+    {
+        static const double x_tet[4][3] = {
+            { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 }
+        };
+        static const double x_hex[8][3] = { { -1.0, -1.0, -1.0 }, { 1.0, -1.0, -1.0 }, { 1.0, 1.0, -1.0 },
+                                            { -1.0, 1.0, -1.0 },  { -1.0, -1.0, 1.0 }, { 1.0, -1.0, 1.0 },
+                                            { 1.0, 1.0, 1.0 },    { -1.0, 1.0, 1.0 } };
+        if (elem_type == TET4)
+            init_nodes(elem_type, TET4, 4, &x_tet[0][0], 1.0 / 24.0);
+        else
+            init_nodes(elem_type, HEX8, 8, &x_hex[0][0], 1.0);
+        return;
+    } // init_3D
+
+    void init_nodes(const ElemType elem_type,
+                    const ElemType nodal_elem_type,
+                    const unsigned int n_node,
+                    const double* const x,
+                    const double weight)
+    {
+        if (elem_type != nodal_elem_type)
+        {
+            TBOX_ERROR("QNodal::init(): nodal quadrature is not supported for element type "
+                       << Utility::enum_to_string<ElemType>(elem_type) << "\n");
+        }
+        const unsigned int dim = get_dim();
+        _points.resize(n_node);
+        _weights.resize(n_node);
+        for (unsigned int k = 0; k < n_node; ++k)
+        {
+            _points[k] = libMesh::Point();
+            for (unsigned int d = 0; d < dim; ++d)
+            {
+                _points[k](d) = x[k * dim + d];
+            }
+            _weights[k] = weight;
+        }
+        return;
+    } // init_nodes
+};
+
+inline bool is_nodal_quadrature_rule(const QBase* const qrule)
+{
+    return dynamic_cast<const QNodal*>(qrule) != NULL;
+} // is_nodal_quadrature_rule
+
+// Update the quadrature rule for the current element.  If npts is non-NULL, it
+// provides the number of adaptive quadrature points required along each
+// reference direction of the element.
+template <class Spec>
+bool update_quadrature_rule(AutoPtr<QBase>& qrule,
+                            const Spec& spec,
+                            Elem* const elem,
+                            const int* const npts,
+                            const std::string& caller)
+{
+    const unsigned int dim = elem->dim();
+    bool qrule_needs_reinit = false;
+
+    // Use nodal quadrature for linear elements whenever the element vertices
+    // provide the requested point density.
+    bool use_nodal_quadrature = spec.use_nodal_quadrature && is_nodal_quadrature_elem(elem->type()) &&
+                                elem->p_level() == 0;
+    for (unsigned int axis = 0; npts && axis < dim; ++axis)
+    {
+        use_nodal_quadrature = use_nodal_quadrature && npts[axis] <= 2;
+    }
+    if (use_nodal_quadrature)
+    {
+        if (!is_nodal_quadrature_rule(qrule.get()) || qrule->get_dim() != dim)
+        {
+            qrule = AutoPtr<QBase>(new QNodal(dim));
+            qrule_needs_reinit = true;
+        }
+        else if (qrule->get_elem_type() != elem->type())
+        {
+            qrule_needs_reinit = true;
+        }
+        return qrule_needs_reinit;
+    }
+
+    // Determine the order of the quadrature rule along each reference
+    // direction.  Unless anisotropic rules are requested for a tensor-product
+    // element, the same order is used for all directions.
+    const QuadratureType type = spec.quad_type;
+    Order orders[MAX_ELEM_DIM];
+    std::fill(orders, orders + MAX_ELEM_DIM, spec.quad_order);
+    bool use_anisotropic_quadrature = false;
+    if (npts)
+    {
+        const int npts_max = *std::max_element(npts, npts + dim);
+        const bool anisotropic = spec.use_anisotropic_quadrature && is_tensor_product_elem(elem->type());
+        for (unsigned int axis = 0; axis < dim; ++axis)
+        {
+            orders[axis] = get_adaptive_quad_order(type, anisotropic ? npts[axis] : npts_max, caller);
+            use_anisotropic_quadrature = use_anisotropic_quadrature || orders[axis] != orders[0];
+        }
+    }
+    if (use_anisotropic_quadrature)
+    {
+        const QAnisotropicTensor* const qrule_tensor = dynamic_cast<const QAnisotropicTensor*>(qrule.get());
+        if (!qrule_tensor || qrule->type() != type || qrule->get_dim() != dim || !qrule_tensor->has_orders(orders))
+        {
+            qrule = AutoPtr<QBase>(new QAnisotropicTensor(dim, type, orders));
+            qrule_needs_reinit = true;
+        }
+        else if (qrule->get_elem_type() != elem->type() || qrule->get_p_level() != elem->p_level())
+        {
+            qrule_needs_reinit = true;
+        }
+        return qrule_needs_reinit;
+    }
+    const Order order = orders[0];
+    if (!qrule.get() || is_nodal_quadrature_rule(qrule.get()) || dynamic_cast<QAnisotropicTensor*>(qrule.get()) ||
+        qrule->type() != type || qrule->get_dim() != dim || qrule->get_order() != order)
+    {
+        qrule = QBase::build(type, dim, order);
+        qrule_needs_reinit = true;
+    }
+    else if (qrule->get_elem_type() != elem->type() || qrule->get_p_level() != elem->p_level())
+    {
+        qrule_needs_reinit = true;
+    }
+    return qrule_needs_reinit;
+} // update_quadrature_rule
 }
 
 const short int FEDataManager::ZERO_DISPLACEMENT_X_BDRY_ID = 0x100;
@@ -309,6 +706,12 @@ void FEDataManager::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balan
     return;
 } // registerLoadBalancer
 
+void FEDataManager::registerWorkloadCostModel(Pointer<WorkloadCostModel> workload_cost_model)
+{
+    d_workload_cost_model = workload_cost_model;
+    return;
+} // registerWorkloadCostModel
+
 void FEDataManager::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
 {
     // Reset the hierarchy.
@@ -389,6 +792,16 @@ void FEDataManager::reinitElementMappings()
     }
     d_system_ghost_vec.clear();
 
+    // Free the spreading scratch data, which is reallocated on demand.
+    d_spread_scratch_data_cache.deallocateScratchData();
+
+    // Discard the quadrature point counts selected for the elements, which are
+    // recomputed on demand from the current element configurations.
+    d_interp_quad_point_cache.npts.clear();
+    d_interp_quad_point_cache.max_hmax.clear();
+    d_spread_quad_point_cache.npts.clear();
+    d_spread_quad_point_cache.max_hmax.clear();
+
     // Reset the mappings between grid patches and active mesh elements.
     collectActivePatchElements(d_active_patch_elem_map, d_level_number, d_ghost_width);
 
@@ -463,8 +876,6 @@ void FEDataManager::spread(const int f_data_idx,
 {
     IBTK_TIMER_START(t_spread);
 
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
 
     // Determine the type of data centering.
@@ -476,17 +887,19 @@ void FEDataManager::spread(const int f_data_idx,
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(cc_data || sc_data);
 
-    // Make a copy of the Eulerian data.
-    const int f_copy_data_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    // If physical boundary conditions are to be applied to the spread values,
+    // accumulate those values in a persistent scratch copy of the Eulerian
+    // data.  Otherwise, spread values directly into the Eulerian data.
+    int f_spread_data_idx = f_data_idx;
+    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops;
+    if (f_phys_bdry_op)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(f_copy_data_idx);
+        f_spread_data_idx =
+            d_spread_scratch_data_cache.getScratchDataIndex(f_data_idx, d_hierarchy, d_level_number, d_level_number);
+        f_data_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
+        f_data_ops->resetLevels(d_level_number, d_level_number);
+        f_data_ops->setToScalar(f_spread_data_idx, 0.0, /*interior_only*/ false);
     }
-    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops =
-        HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
 
     // Extract the mesh.
     const MeshBase& mesh = d_es->get_mesh();
@@ -516,6 +929,10 @@ void FEDataManager::spread(const int f_data_idx,
     const std::vector<std::vector<double> >& phi_F = F_fe->get_phi();
     const std::vector<std::vector<double> >& phi_X = X_fe->get_phi();
 
+    // Nodal quadrature rules do not require the basis functions to be
+    // evaluated for Lagrange bases.
+    const bool use_nodal_basis = F_fe_type.family == LAGRANGE && X_fe_type.family == LAGRANGE;
+
     // Communicate any unsynchronized ghost data and extract the underlying
     // solution data.
     /*if (!F_vec.closed())*/ F_vec.close();
@@ -564,7 +981,7 @@ void FEDataManager::spread(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateSpreadQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
+            const bool qrule_needs_reinit = updateCachedQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
             if (qrule_needs_reinit)
             {
                 qrule->init(elem->type(), elem->p_level());
@@ -592,7 +1009,7 @@ void FEDataManager::spread(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateSpreadQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
+            const bool qrule_needs_reinit = updateCachedQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
             if (qrule_needs_reinit)
             {
                 // NOTE: Because we are only using the shape function values for
@@ -610,6 +1027,24 @@ void FEDataManager::spread(const int f_data_idx,
             const unsigned int n_qp = qrule->n_points();
             double* F_begin = &F_JxW_qp[n_vars * qp_offset];
             double* X_begin = &X_qp[NDIM * qp_offset];
+            if (use_nodal_basis && is_nodal_quadrature_rule(qrule.get()))
+            {
+                // With nodal quadrature, the quadrature points are the element
+                // nodes, and the nodal values need not be interpolated.
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    for (unsigned int i = 0; i < n_vars; ++i)
+                    {
+                        F_begin[n_vars * qp + i] = F_node[qp][i] * JxW_F[qp];
+                    }
+                    for (unsigned int i = 0; i < NDIM; ++i)
+                    {
+                        X_begin[NDIM * qp + i] = X_node[qp][i];
+                    }
+                }
+                qp_offset += n_qp;
+                continue;
+            }
             std::fill(F_begin, F_begin + n_vars * n_qp, 0.0);
             std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
             for (unsigned int k = 0; k < n_node; ++k)
@@ -636,7 +1071,7 @@ void FEDataManager::spread(const int f_data_idx,
         // NOTE: Values are spread only from those quadrature points that are
         // within the ghost cell width of the patch interior.
         const Box<NDIM> spread_box = Box<NDIM>::grow(patch->getBox(), d_ghost_width);
-        Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
+        Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_spread_data_idx);
         if (cc_data)
         {
             Pointer<CellData<NDIM, double> > f_cc_data = f_data;
@@ -649,20 +1084,13 @@ void FEDataManager::spread(const int f_data_idx,
         }
         if (f_phys_bdry_op)
         {
-            f_phys_bdry_op->setPatchDataIndex(f_data_idx);
+            f_phys_bdry_op->setPatchDataIndex(f_spread_data_idx);
             f_phys_bdry_op->accumulateFromPhysicalBoundaryData(*patch, fill_data_time, f_data->getGhostCellWidth());
         }
     }
 
     // Accumulate data.
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(f_copy_data_idx);
-    }
-    var_db->removePatchDataIndex(f_copy_data_idx);
+    if (f_phys_bdry_op) f_data_ops->add(f_data_idx, f_data_idx, f_spread_data_idx);
 
     VecRestoreArray(F_local_vec, &F_local_soln);
     VecGhostRestoreLocalForm(F_global_vec, &F_local_vec);
@@ -958,6 +1386,10 @@ void FEDataManager::interp(const int f_data_idx,
     const std::vector<std::vector<double> >& phi_F = F_fe->get_phi();
     const std::vector<std::vector<double> >& phi_X = X_fe->get_phi();
 
+    // Nodal quadrature rules do not require the basis functions to be
+    // evaluated for Lagrange bases.
+    const bool use_nodal_basis = F_fe_type.family == LAGRANGE && X_fe_type.family == LAGRANGE;
+
     // Communicate any unsynchronized ghost data and extract the underlying
     // solution data.
     for (unsigned int k = 0; k < f_refine_scheds.size(); ++k)
@@ -1005,7 +1437,7 @@ void FEDataManager::interp(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
+            const bool qrule_needs_reinit = updateCachedQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
             if (qrule_needs_reinit)
             {
                 qrule->init(elem->type(), elem->p_level());
@@ -1028,7 +1460,7 @@ void FEDataManager::interp(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
+            const bool qrule_needs_reinit = updateCachedQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
             if (qrule_needs_reinit)
             {
                 // NOTE: Because we are only using the shape function values for
@@ -1043,6 +1475,18 @@ void FEDataManager::interp(const int f_data_idx,
             const unsigned int n_node = elem->n_nodes();
             const unsigned int n_qp = qrule->n_points();
             double* X_begin = &X_qp[NDIM * qp_offset];
+            if (use_nodal_basis && is_nodal_quadrature_rule(qrule.get()))
+            {
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    for (unsigned int i = 0; i < NDIM; ++i)
+                    {
+                        X_begin[NDIM * qp + i] = X_node[qp][i];
+                    }
+                }
+                qp_offset += n_qp;
+                continue;
+            }
             std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
             for (unsigned int k = 0; k < n_node; ++k)
             {
@@ -1092,7 +1536,7 @@ void FEDataManager::interp(const int f_data_idx,
                 X_dof_map.dof_indices(elem, X_dof_indices[d], d);
             }
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-            const bool qrule_needs_reinit = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
+            const bool qrule_needs_reinit = updateCachedQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
             if (qrule_needs_reinit)
             {
                 // NOTE: Because we are only using the shape function values for
@@ -1108,9 +1552,18 @@ void FEDataManager::interp(const int f_data_idx,
             F_fe->reinit(elem);
             const unsigned int n_qp = qrule->n_points();
             const size_t n_basis = F_dof_indices[0].size();
+            const bool nodal_qrule = use_nodal_basis && is_nodal_quadrature_rule(qrule.get());
             for (unsigned int qp = 0; qp < n_qp; ++qp)
             {
                 const int idx = n_vars * (qp_offset + qp);
+                if (nodal_qrule)
+                {
+                    for (unsigned int i = 0; i < n_vars; ++i)
+                    {
+                        F_rhs_e[i](qp) += F_qp[idx + i] * JxW_F[qp];
+                    }
+                    continue;
+                }
                 for (unsigned int k = 0; k < n_basis; ++k)
                 {
                     const double p_JxW_F = phi_F[k][qp] * JxW_F[qp];
@@ -1690,39 +2143,13 @@ bool FEDataManager::updateInterpQuadratureRule(AutoPtr<QBase>& qrule,
                                                const boost::multi_array<double, 2>& X_node,
                                                const double dx_min)
 {
-    QuadratureType type = spec.quad_type;
-    unsigned int dim = elem->dim();
-    Order order = spec.quad_order;
+    int npts[MAX_ELEM_DIM];
     if (spec.use_adaptive_quadrature)
     {
-        const double hmax = get_elem_hmax(elem, X_node);
-        const int min_pts = elem->default_order() == FIRST ? 1 : 2;
-        const int npts = std::max(min_pts, static_cast<int>(std::ceil(spec.point_density * hmax / dx_min)));
-        switch (type)
-        {
-        case QGAUSS:
-            order = static_cast<Order>(std::min(2 * npts - 1, static_cast<int>(FORTYTHIRD)));
-            break;
-        case QGRID:
-            order = static_cast<Order>(npts);
-            break;
-        default:
-            TBOX_ERROR("FEDataManager::updateInterpQuadratureRule():\n"
-                       << "  adaptive quadrature rules are available only for quad_type = QGAUSS "
-                          "or QGRID\n");
-        }
-    }
-    bool qrule_needs_reinit = false;
-    if (!qrule.get() || qrule->type() != type || qrule->get_dim() != dim || qrule->get_order() != order)
-    {
-        qrule = QBase::build(type, dim, order);
-        qrule_needs_reinit = true;
+        get_elem_quad_npts(npts, elem, X_node, spec.point_density, dx_min);
     }
-    else if (qrule->get_elem_type() != elem->type() || qrule->get_p_level() != elem->p_level())
-    {
-        qrule_needs_reinit = true;
-    }
-    return qrule_needs_reinit;
+    return update_quadrature_rule(
+        qrule, spec, elem, spec.use_adaptive_quadrature ? npts : NULL, "FEDataManager::updateInterpQuadratureRule()");
 } // updateInterpQuadratureRule
 
 bool FEDataManager::updateSpreadQuadratureRule(AutoPtr<QBase>& qrule,
@@ -1731,40 +2158,79 @@ bool FEDataManager::updateSpreadQuadratureRule(AutoPtr<QBase>& qrule,
                                                const boost::multi_array<double, 2>& X_node,
                                                const double dx_min)
 {
-    QuadratureType type = spec.quad_type;
-    unsigned int dim = elem->dim();
-    Order order = spec.quad_order;
+    int npts[MAX_ELEM_DIM];
     if (spec.use_adaptive_quadrature)
     {
-        const double hmax = get_elem_hmax(elem, X_node);
-        const int min_pts = elem->default_order() == FIRST ? 1 : 2;
-        const int npts = std::max(min_pts, static_cast<int>(std::ceil(spec.point_density * hmax / dx_min)));
-        switch (type)
-        {
-        case QGAUSS:
-            order = static_cast<Order>(std::min(2 * npts - 1, static_cast<int>(FORTYTHIRD)));
-            break;
-        case QGRID:
-            order = static_cast<Order>(npts);
-            break;
-        default:
-            TBOX_ERROR("FEDataManager::updateSpreadQuadratureRule():\n"
-                       << "  adaptive quadrature rules are available only for quad_type = QGAUSS "
-                          "or QGRID\n");
-        }
+        get_elem_quad_npts(npts, elem, X_node, spec.point_density, dx_min);
     }
-    bool qrule_needs_reinit = false;
-    if (!qrule.get() || qrule->type() != type || qrule->get_dim() != dim || qrule->get_order() != order)
+    return update_quadrature_rule(
+        qrule, spec, elem, spec.use_adaptive_quadrature ? npts : NULL, "FEDataManager::updateSpreadQuadratureRule()");
+} // updateSpreadQuadratureRule
+
+bool FEDataManager::updateCachedQuadratureRule(AutoPtr<QBase>& qrule,
+                                               const FEDataManager::InterpSpec& spec,
+                                               Elem* const elem,
+                                               const boost::multi_array<double, 2>& X_node,
+                                               const double dx_min)
+{
+    if (!spec.use_adaptive_quadrature) return updateInterpQuadratureRule(qrule, spec, elem, X_node, dx_min);
+    const int* const npts =
+        getCachedQuadraturePointCounts(d_interp_quad_point_cache, elem, X_node, spec.point_density, dx_min);
+    return update_quadrature_rule(qrule, spec, elem, npts, "FEDataManager::updateInterpQuadratureRule()");
+} // updateCachedQuadratureRule
+
+bool FEDataManager::updateCachedQuadratureRule(AutoPtr<QBase>& qrule,
+                                               const FEDataManager::SpreadSpec& spec,
+                                               Elem* const elem,
+                                               const boost::multi_array<double, 2>& X_node,
+                                               const double dx_min)
+{
+    if (!spec.use_adaptive_quadrature) return updateSpreadQuadratureRule(qrule, spec, elem, X_node, dx_min);
+    const int* const npts =
+        getCachedQuadraturePointCounts(d_spread_quad_point_cache, elem, X_node, spec.point_density, dx_min);
+    return update_quadrature_rule(qrule, spec, elem, npts, "FEDataManager::updateSpreadQuadratureRule()");
+} // updateCachedQuadratureRule
+
+const int* FEDataManager::getCachedQuadraturePointCounts(QuadraturePointCache& cache,
+                                                         Elem* const elem,
+                                                         const boost::multi_array<double, 2>& X_node,
+                                                         const double point_density,
+                                                         const double dx_min)
+{
+    // Discard cached values that were computed with different parameters.
+    const size_t n_elem = d_es->get_mesh().max_elem_id();
+    if (cache.npts.size() != MAX_ELEM_DIM * n_elem || cache.point_density != point_density ||
+        cache.dx_min != dx_min)
     {
-        qrule = QBase::build(type, dim, order);
-        qrule_needs_reinit = true;
+        cache.npts.assign(MAX_ELEM_DIM * n_elem, 0);
+        cache.max_hmax.assign(MAX_ELEM_DIM * n_elem, 0.0);
+        cache.point_density = point_density;
+        cache.dx_min = dx_min;
     }
-    else if (qrule->get_elem_type() != elem->type() || qrule->get_p_level() != elem->p_level())
+
+    // The cached counts remain valid as long as the deformed extent of the
+    // element along each reference direction is still resolved by the count
+    // for that direction.  When the counts are computed, we record the largest
+    // extent in each direction that they resolve, and each direction is
+    // checked separately, so that stretching the element along one direction
+    // is detected even if it is compressed along the others.
+    int* const npts = &cache.npts[MAX_ELEM_DIM * elem->id()];
+    double* const max_hmax = &cache.max_hmax[MAX_ELEM_DIM * elem->id()];
+    double hmax[MAX_ELEM_DIM];
+    get_elem_hmax(hmax, elem, X_node);
+    bool valid = npts[0] != 0;
+    for (int axis = 0; valid && axis < MAX_ELEM_DIM; ++axis)
     {
-        qrule_needs_reinit = true;
+        valid = hmax[axis] <= max_hmax[axis];
     }
-    return qrule_needs_reinit;
-} // updateSpreadQuadratureRule
+    if (valid) return npts;
+    get_elem_quad_npts(npts, hmax, elem, point_density, dx_min);
+    for (int axis = 0; axis < MAX_ELEM_DIM; ++axis)
+    {
+        max_hmax[axis] = npts[axis] * dx_min / point_density;
+    }
+    return npts;
+} // getCachedQuadraturePointCounts
 
 void FEDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -1784,7 +2250,43 @@ void FEDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int
     {
         updateQuadPointCountData(ln, ln);
         HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, ln, ln);
-        hier_cc_data_ops.add(d_workload_idx, d_qp_count_idx, d_workload_idx);
+        if (!d_workload_cost_model)
+        {
+            hier_cc_data_ops.add(d_workload_idx, d_qp_count_idx, d_workload_idx);
+        }
+        else
+        {
+            // Each quadrature point requires one force evaluation and touches
+            // the cells in its interpolation and spreading stencils.
+            const int interp_stencil_size = LEInteractor::getStencilSize(d_default_interp_spec.kernel_fcn);
+            const int spread_stencil_size = LEInteractor::getStencilSize(d_default_spread_spec.kernel_fcn);
+            int interp_stencil_work = 1, spread_stencil_work = 1;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                interp_stencil_work *= interp_stencil_size;
+                spread_stencil_work *= spread_stencil_size;
+            }
+            const int stencil_work = interp_stencil_work + spread_stencil_work;
+            const double qp_cost =
+                d_workload_cost_model->getCost(WorkloadCostModel::INTERACTION_WORK) * static_cast<double>(stencil_work) +
+                d_workload_cost_model->getCost(WorkloadCostModel::FORCE_WORK);
+            hier_cc_data_ops.axpy(d_workload_idx, qp_cost, d_qp_count_idx, d_workload_idx);
+
+            double local_num_qp = 0.0;
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > qp_count_data = patch->getPatchData(d_qp_count_idx);
+                for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+                {
+                    local_num_qp += (*qp_count_data)(b());
+                }
+            }
+            d_workload_cost_model->addLocalWork(WorkloadCostModel::INTERACTION_WORK,
+                                                static_cast<double>(stencil_work) * local_num_qp);
+            d_workload_cost_model->addLocalWork(WorkloadCostModel::FORCE_WORK, local_num_qp);
+        }
     }
 
     IBTK_TIMER_STOP(t_update_workload_estimates);
@@ -2004,8 +2506,9 @@ FEDataManager::FEDataManager(const std::string& object_name,
     : COORDINATES_SYSTEM_NAME("coordinates system"), d_object_name(object_name),
       d_registered_for_restart(register_for_restart), d_load_balancer(NULL), d_hierarchy(NULL), d_coarsest_ln(-1),
       d_finest_ln(-1), d_default_interp_spec(default_interp_spec), d_default_spread_spec(default_spread_spec),
-      d_ghost_width(ghost_width), d_es(NULL), d_level_number(-1), d_active_patch_ghost_dofs(), d_L2_proj_solver(),
-      d_L2_proj_matrix(), d_L2_proj_matrix_diag(), d_L2_proj_quad_type(), d_L2_proj_quad_order()
+      d_ghost_width(ghost_width), d_es(NULL), d_level_number(-1), d_spread_scratch_data_cache(),
+      d_active_patch_ghost_dofs(), d_L2_proj_solver(), d_L2_proj_matrix(), d_L2_proj_matrix_diag(),
+      d_L2_proj_quad_type(), d_L2_proj_quad_order()
 {
     TBOX_ASSERT(!object_name.empty());
 
@@ -2152,7 +2655,7 @@ void FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int fi
                 }
                 get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
                 const bool qrule_needs_reinit =
-                    updateInterpQuadratureRule(qrule, d_default_interp_spec, elem, X_node, patch_dx_min);
+                    updateCachedQuadratureRule(qrule, d_default_interp_spec, elem, X_node, patch_dx_min);
                 if (qrule_needs_reinit)
                 {
                     // NOTE: We only need to reinit the FE object whenever the
@@ -32,8 +32,12 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <fcntl.h>
 #include <math.h>
 #include <stddef.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include <unistd.h>
 #include <algorithm>
 #include <limits>
 #include <map>
@@ -87,6 +91,8 @@
 #include "VisItDataWriter.h"
 #include "boost/array.hpp"
 #include "boost/multi_array.hpp"
+#include "ibtk/AsyncFileWriter.h"
+#include "ibtk/FixedSizedStream.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LData.h"
@@ -108,9 +114,13 @@
 #include "ibtk/LTransaction.h"
 #include "ibtk/ParallelSet.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/Streamable.h"
+#include "ibtk/StreamableManager.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/compiler_hints.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
 #include "petscao.h"
 #include "petscis.h"
 #include "petscsys.h"
@@ -158,8 +168,12 @@ static Timer* t_initialize_level_data;
 static Timer* t_reset_hierarchy_configuration;
 static Timer* t_apply_gradient_detector;
 static Timer* t_put_to_database;
+static Timer* t_write_lagrangian_restart_data;
+static Timer* t_read_lagrangian_restart_data;
 static Timer* t_begin_nonlocal_data_fill;
 static Timer* t_end_nonlocal_data_fill;
+static Timer* t_begin_ghost_update;
+static Timer* t_end_ghost_update;
 static Timer* t_compute_node_distribution;
 static Timer* t_compute_node_offsets;
 
@@ -169,10 +183,69 @@ static const int CFL_WIDTH = 2;
 // Version of LDataManager restart file data.
 static const int LDATA_MANAGER_VERSION = 1;
 
+// Version and file name prefix of decomposition-independent Lagrangian restart
+// files.
+static const int LAG_RESTART_FILE_VERSION = 2;
+static const std::string LAG_RESTART_FILE_PREFIX = "lag_restore.";
+
+// Helper functions to build and parse the headers of Lagrangian restart files.
+template <typename T>
+inline void append_header_value(std::vector<char>& header, const T& val)
+{
+    const char* const val_bytes = reinterpret_cast<const char*>(&val);
+    header.insert(header.end(), val_bytes, val_bytes + sizeof(T));
+    return;
+} // append_header_value
+
+template <typename T>
+inline T extract_header_value(const std::vector<char>& header, size_t& pos)
+{
+    if (pos + sizeof(T) > header.size())
+    {
+        TBOX_ERROR("LDataManager::readLagrangianRestartData():\n"
+                   << "  corrupt Lagrangian restart file header." << std::endl);
+    }
+    T val;
+    std::copy(header.begin() + pos, header.begin() + pos + sizeof(T), reinterpret_cast<char*>(&val));
+    pos += sizeof(T);
+    return val;
+} // extract_header_value
+
+inline std::string lag_restart_file_name(const std::string& dump_dirname, const int time_step_number)
+{
+    char temp_buf[128];
+    sprintf(temp_buf, "%06d", time_step_number);
+    return dump_dirname + "/" + LAG_RESTART_FILE_PREFIX + temp_buf;
+} // lag_restart_file_name
+
 inline int round(double x)
 {
     return floor(x + 0.5);
 } // round
+
+// Shift a node position read from a Lagrangian restart file into the
+// computational domain in the same manner as
+// LDataManager::beginDataRedistribution().
+inline Vector shift_restart_posn(const double* const X_real,
+                                 const double* const domain_x_lower,
+                                 const double* const domain_x_upper,
+                                 const IntVector<NDIM>& periodic_shift)
+{
+    Vector X;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        X[d] = X_real[d];
+        if (periodic_shift[d])
+        {
+            const double domain_length = domain_x_upper[d] - domain_x_lower[d];
+            while (X[d] < domain_x_lower[d]) X[d] += domain_length;
+            while (X[d] >= domain_x_upper[d]) X[d] -= domain_length;
+        }
+        X[d] = std::max(X[d], domain_x_lower[d]);
+        X[d] = std::min(X[d], domain_x_upper[d] - std::numeric_limits<double>::epsilon());
+    }
+    return X;
+} // shift_restart_posn
 }
 
 const std::string LDataManager::POSN_DATA_NAME = "X";
@@ -425,16 +498,20 @@ void LDataManager::spread(const int f_data_idx,
     {
         if (!levelContainsLagrangianData(ln)) continue;
 
-        if (F_data_ghost_node_update) F_data[ln]->beginGhostUpdate();
-        if (ds_data_ghost_node_update) ds_data[ln]->beginGhostUpdate();
+        std::vector<Pointer<LData> > ghost_update_data;
+        if (F_data_ghost_node_update) ghost_update_data.push_back(F_data[ln]);
+        if (ds_data_ghost_node_update) ghost_update_data.push_back(ds_data[ln]);
+        beginGhostUpdate(ghost_update_data, ln);
     }
     std::vector<Pointer<LData> > F_ds_data(F_data.size());
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!levelContainsLagrangianData(ln)) continue;
 
-        if (F_data_ghost_node_update) F_data[ln]->endGhostUpdate();
-        if (ds_data_ghost_node_update) ds_data[ln]->endGhostUpdate();
+        std::vector<Pointer<LData> > ghost_update_data;
+        if (F_data_ghost_node_update) ghost_update_data.push_back(F_data[ln]);
+        if (ds_data_ghost_node_update) ghost_update_data.push_back(ds_data[ln]);
+        endGhostUpdate(ghost_update_data, ln);
 
         const int depth = F_data[ln]->getDepth();
         F_ds_data[ln] = new LData("", getNumberOfLocalNodes(ln), depth, d_nonlocal_petsc_indices[ln]);
@@ -583,25 +660,38 @@ void LDataManager::spread(const int f_data_idx,
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(cc_data || ec_data || nc_data || sc_data);
 
-    // Make a copy of the Eulerian data.
-    const int f_copy_data_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    // If physical boundary conditions are to be applied to the spread values,
+    // or if spread values are to be prolonged from coarser levels, the values
+    // must be accumulated separately from the existing Eulerian data.  In this
+    // case, the Eulerian data are temporarily swapped into a persistent scratch
+    // copy.  Otherwise, values are spread directly into the Eulerian data.
+    bool use_prolongation = false;
+    for (int ln = coarsest_ln + 1; ln <= finest_ln && ln < static_cast<int>(f_prolongation_scheds.size()); ++ln)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(f_copy_data_idx);
+        use_prolongation = use_prolongation || f_prolongation_scheds[ln];
+    }
+    const bool use_copy = f_phys_bdry_op || use_prolongation;
+    int f_copy_data_idx = -1;
+    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops;
+    if (use_copy)
+    {
+        f_copy_data_idx =
+            d_spread_scratch_data_cache.getScratchDataIndex(f_data_idx, d_hierarchy, coarsest_ln, finest_ln);
+        f_data_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
+        f_data_ops->resetLevels(coarsest_ln, finest_ln);
+        f_data_ops->swapData(f_copy_data_idx, f_data_idx);
+        f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
     }
-    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops =
-        HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
 
     // Start filling Lagrangian ghost node values.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!levelContainsLagrangianData(ln)) continue;
 
-        if (F_data_ghost_node_update) F_data[ln]->beginGhostUpdate();
-        if (X_data_ghost_node_update) X_data[ln]->beginGhostUpdate();
+        std::vector<Pointer<LData> > ghost_update_data;
+        if (F_data_ghost_node_update) ghost_update_data.push_back(F_data[ln]);
+        if (X_data_ghost_node_update) ghost_update_data.push_back(X_data[ln]);
+        beginGhostUpdate(ghost_update_data, ln);
     }
 
     // Spread data from the Lagrangian mesh to the Eulerian grid.
@@ -618,8 +708,10 @@ void LDataManager::spread(const int f_data_idx,
         if (!levelContainsLagrangianData(ln)) continue;
 
         // Spread data onto the grid.
-        if (F_data_ghost_node_update) F_data[ln]->endGhostUpdate();
-        if (X_data_ghost_node_update) X_data[ln]->endGhostUpdate();
+        std::vector<Pointer<LData> > ghost_update_data;
+        if (F_data_ghost_node_update) ghost_update_data.push_back(F_data[ln]);
+        if (X_data_ghost_node_update) ghost_update_data.push_back(X_data[ln]);
+        endGhostUpdate(ghost_update_data, ln);
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
@@ -661,14 +753,11 @@ void LDataManager::spread(const int f_data_idx,
     }
 
     // Accumulate data.
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    if (use_copy)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(f_copy_data_idx);
+        f_data_ops->swapData(f_copy_data_idx, f_data_idx);
+        f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
     }
-    var_db->removePatchDataIndex(f_copy_data_idx);
 
     IBTK_TIMER_STOP(t_spread);
     return;
@@ -875,6 +964,12 @@ void LDataManager::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balanc
     return;
 } // return
 
+void LDataManager::registerWorkloadCostModel(Pointer<WorkloadCostModel> workload_cost_model)
+{
+    d_workload_cost_model = workload_cost_model;
+    return;
+} // registerWorkloadCostModel
+
 Pointer<LData> LDataManager::createLData(const std::string& quantity_name,
                                          const int level_number,
                                          const unsigned int depth,
@@ -896,6 +991,130 @@ Pointer<LData> LDataManager::createLData(const std::string& quantity_name,
     return ret_val;
 } // createLData
 
+void LDataManager::beginGhostUpdate(const std::vector<Pointer<LData> >& data, const int level_number)
+{
+    IBTK_TIMER_START(t_begin_ghost_update);
+
+    std::vector<LData*> level_data;
+    int total_depth = 0;
+    for (unsigned int k = 0; k < data.size(); ++k)
+    {
+        if (!data[k]) continue;
+#if !defined(NDEBUG)
+        TBOX_ASSERT(data[k]->getLocalNodeCount() == getNumberOfLocalNodes(level_number));
+        TBOX_ASSERT(data[k]->getNonlocalPETScIndices() == d_nonlocal_petsc_indices[level_number]);
+#endif
+        level_data.push_back(data[k].getPointer());
+        total_depth += data[k]->getDepth();
+    }
+    if (level_data.size() <= 1)
+    {
+        if (!level_data.empty()) level_data[0]->beginGhostUpdate();
+        IBTK_TIMER_STOP(t_begin_ghost_update);
+        return;
+    }
+
+    // Pack the local values of all of the quantities into a single ghosted
+    // vector and start the exchange of the ghost values.
+    int ierr;
+    Vec ghost_update_vec = getGhostUpdateVec(total_depth, level_number);
+    const unsigned int num_local_nodes = getNumberOfLocalNodes(level_number);
+    double* ghost_update_arr;
+    ierr = VecGetArray(ghost_update_vec, &ghost_update_arr);
+    IBTK_CHKERRQ(ierr);
+    int offset = 0;
+    for (unsigned int k = 0; k < level_data.size(); ++k)
+    {
+        const int depth = level_data[k]->getDepth();
+        const double* arr;
+        ierr = VecGetArrayRead(level_data[k]->getVec(), &arr);
+        IBTK_CHKERRQ(ierr);
+        for (unsigned int i = 0; i < num_local_nodes; ++i)
+        {
+            for (int d = 0; d < depth; ++d)
+            {
+                ghost_update_arr[i * total_depth + offset + d] = arr[i * depth + d];
+            }
+        }
+        ierr = VecRestoreArrayRead(level_data[k]->getVec(), &arr);
+        IBTK_CHKERRQ(ierr);
+        offset += depth;
+    }
+    ierr = VecRestoreArray(ghost_update_vec, &ghost_update_arr);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateBegin(ghost_update_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+
+    IBTK_TIMER_STOP(t_begin_ghost_update);
+    return;
+} // beginGhostUpdate
+
+void LDataManager::endGhostUpdate(const std::vector<Pointer<LData> >& data, const int level_number)
+{
+    IBTK_TIMER_START(t_end_ghost_update);
+
+    std::vector<LData*> level_data;
+    int total_depth = 0;
+    for (unsigned int k = 0; k < data.size(); ++k)
+    {
+        if (!data[k]) continue;
+        level_data.push_back(data[k].getPointer());
+        total_depth += data[k]->getDepth();
+    }
+    if (level_data.size() <= 1)
+    {
+        if (!level_data.empty()) level_data[0]->endGhostUpdate();
+        IBTK_TIMER_STOP(t_end_ghost_update);
+        return;
+    }
+
+    // Finish the exchange and unpack the ghost values of each of the
+    // quantities.
+    int ierr;
+    Vec ghost_update_vec = getGhostUpdateVec(total_depth, level_number);
+    ierr = VecGhostUpdateEnd(ghost_update_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    const unsigned int num_local_nodes = getNumberOfLocalNodes(level_number);
+    const unsigned int num_ghost_nodes = static_cast<unsigned int>(d_nonlocal_petsc_indices[level_number].size());
+    Vec ghost_update_local_vec;
+    ierr = VecGhostGetLocalForm(ghost_update_vec, &ghost_update_local_vec);
+    IBTK_CHKERRQ(ierr);
+    const double* ghost_update_arr;
+    ierr = VecGetArrayRead(ghost_update_local_vec, &ghost_update_arr);
+    IBTK_CHKERRQ(ierr);
+    int offset = 0;
+    for (unsigned int k = 0; k < level_data.size(); ++k)
+    {
+        const int depth = level_data[k]->getDepth();
+        Vec vec = level_data[k]->getVec();
+        Vec local_vec;
+        ierr = VecGhostGetLocalForm(vec, &local_vec);
+        IBTK_CHKERRQ(ierr);
+        double* arr;
+        ierr = VecGetArray(local_vec, &arr);
+        IBTK_CHKERRQ(ierr);
+        for (unsigned int i = num_local_nodes; i < num_local_nodes + num_ghost_nodes; ++i)
+        {
+            for (int d = 0; d < depth; ++d)
+            {
+                arr[i * depth + d] = ghost_update_arr[i * total_depth + offset + d];
+            }
+        }
+        ierr = VecRestoreArray(local_vec, &arr);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGhostRestoreLocalForm(vec, &local_vec);
+        IBTK_CHKERRQ(ierr);
+        offset += depth;
+    }
+    ierr = VecRestoreArrayRead(ghost_update_local_vec, &ghost_update_arr);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(ghost_update_vec, &ghost_update_local_vec);
+    IBTK_CHKERRQ(ierr);
+
+    IBTK_TIMER_STOP(t_end_ghost_update);
+    return;
+} // endGhostUpdate
+
 Point LDataManager::computeLagrangianStructureCenterOfMass(const int structure_id, const int level_number)
 {
 #if !defined(NDEBUG)
@@ -1334,6 +1553,366 @@ void LDataManager::scatterToZero(Vec& parallel_vec, Vec& sequential_vec) const
     return;
 } // scatterToZero
 
+void LDataManager::setAsynchronousLagrangianRestartWrites(const bool async_writes,
+                                                         const size_t max_pending_bytes)
+{
+    if (d_async_restart_writer) d_async_restart_writer->waitForCompletion();
+    d_async_restart_writer = async_writes ? new AsyncFileWriter(max_pending_bytes) : NULL;
+    return;
+} // setAsynchronousLagrangianRestartWrites
+
+void LDataManager::waitForLagrangianRestartWrites() const
+{
+    if (d_async_restart_writer) d_async_restart_writer->waitForCompletion();
+    return;
+} // waitForLagrangianRestartWrites
+
+void LDataManager::writeLagrangianRestartData(const std::string& dump_dirname,
+                                              const int time_step_number,
+                                              const double simulation_time) const
+{
+    IBTK_TIMER_START(t_write_lagrangian_restart_data);
+
+    int ierr;
+    const int mpi_rank = SAMRAI_MPI::getRank();
+
+    // Determine the quantities to be written.  Every process manages the same
+    // collection of LData objects, so all processes construct identical file
+    // headers.
+    std::vector<int> record_level_numbers;
+    std::vector<std::string> record_names;
+    std::vector<Pointer<LData> > record_data;
+    for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
+    {
+        if (!d_level_contains_lag_data[level_number]) continue;
+        for (std::map<std::string, Pointer<LData> >::const_iterator cit = d_lag_mesh_data[level_number].begin();
+             cit != d_lag_mesh_data[level_number].end();
+             ++cit)
+        {
+            record_level_numbers.push_back(level_number);
+            record_names.push_back(cit->first);
+            record_data.push_back(cit->second);
+        }
+    }
+    const int num_records = static_cast<int>(record_data.size());
+
+    // Build the file header.
+    std::vector<char> header;
+    append_header_value(header, LAG_RESTART_FILE_VERSION);
+    append_header_value(header, 0);
+    append_header_value(header, simulation_time);
+    append_header_value(header, num_records);
+    for (int k = 0; k < num_records; ++k)
+    {
+        append_header_value(header, record_level_numbers[k]);
+        append_header_value(header, static_cast<int>(record_data[k]->getDepth()));
+        append_header_value(header, static_cast<int>(d_num_nodes[record_level_numbers[k]]));
+        append_header_value(header, static_cast<int>(record_names[k].size()));
+        header.insert(header.end(), record_names[k].begin(), record_names[k].end());
+    }
+    const int header_size = static_cast<int>(header.size());
+    std::copy(reinterpret_cast<const char*>(&header_size),
+              reinterpret_cast<const char*>(&header_size) + sizeof(int),
+              header.begin() + sizeof(int));
+
+    // Open the shared file.  When the data are written asynchronously, the
+    // file is created by the root process and subsequently written by the
+    // background writer threads.
+    Utilities::recursiveMkdir(dump_dirname);
+    SAMRAI_MPI::barrier();
+    const std::string file_name = lag_restart_file_name(dump_dirname, time_step_number);
+    const bool async_writes = d_async_restart_writer;
+    MPI_File fh;
+    if (async_writes)
+    {
+        // Ensure that any earlier restart file has been completely written.
+        d_async_restart_writer->waitForCompletion();
+        if (mpi_rank == 0)
+        {
+            const int fd = open(file_name.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+            if (fd == -1)
+            {
+                TBOX_ERROR(d_object_name << "::writeLagrangianRestartData():\n"
+                                         << "  could not open file " << file_name << " for writing." << std::endl);
+            }
+            close(fd);
+            d_async_restart_writer->writeAt(file_name, 0, header);
+        }
+        SAMRAI_MPI::barrier();
+    }
+    else
+    {
+        if (MPI_File_open(SAMRAI_MPI::getCommunicator(),
+                          const_cast<char*>(file_name.c_str()),
+                          MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                          MPI_INFO_NULL,
+                          &fh) != MPI_SUCCESS)
+        {
+            TBOX_ERROR(d_object_name << "::writeLagrangianRestartData():\n"
+                                     << "  could not open file " << file_name << " for writing." << std::endl);
+        }
+        MPI_File_set_size(fh, 0);
+        if (mpi_rank == 0)
+        {
+            MPI_File_write_at(fh, 0, &header[0], header_size, MPI_CHAR, MPI_STATUS_IGNORE);
+        }
+    }
+
+    // Write the data in Lagrangian index order.  Each process writes one
+    // contiguous slab of nodes for each quantity.  Asynchronous writes stage a
+    // copy of the slab in host memory and return immediately.
+    MPI_Offset data_offset = header_size;
+    for (int k = 0; k < num_records; ++k)
+    {
+        const int level_number = record_level_numbers[k];
+        const int depth = static_cast<int>(record_data[k]->getDepth());
+        Vec petsc_vec = record_data[k]->getVec();
+        VecScatter vec_scatter;
+        Vec slab_vec;
+        createLagrangianSlabScatter(vec_scatter, slab_vec, petsc_vec, depth, level_number);
+        ierr = VecScatterBegin(vec_scatter, petsc_vec, slab_vec, INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScatterEnd(vec_scatter, petsc_vec, slab_vec, INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+
+        int ilo, ihi;
+        ierr = VecGetOwnershipRange(slab_vec, &ilo, &ihi);
+        IBTK_CHKERRQ(ierr);
+        double* slab_arr;
+        ierr = VecGetArray(slab_vec, &slab_arr);
+        IBTK_CHKERRQ(ierr);
+        const MPI_Offset slab_offset = data_offset + static_cast<MPI_Offset>(ilo) * sizeof(double);
+        if (async_writes)
+        {
+            if (ihi > ilo)
+            {
+                std::vector<char> slab_data(reinterpret_cast<const char*>(slab_arr),
+                                            reinterpret_cast<const char*>(slab_arr + (ihi - ilo)));
+                d_async_restart_writer->writeAt(file_name, static_cast<off_t>(slab_offset), slab_data);
+            }
+        }
+        else
+        {
+            MPI_File_write_at_all(fh, slab_offset, slab_arr, ihi - ilo, MPI_DOUBLE, MPI_STATUS_IGNORE);
+        }
+        ierr = VecRestoreArray(slab_vec, &slab_arr);
+        IBTK_CHKERRQ(ierr);
+        data_offset += static_cast<MPI_Offset>(d_num_nodes[level_number]) * depth * sizeof(double);
+
+        ierr = VecScatterDestroy(&vec_scatter);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&slab_vec);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Write the data associated with the Lagrangian nodes (e.g., force
+    // specification objects).  These data follow the LData records as the
+    // total size of the entries followed by a sequence of (level number,
+    // Lagrangian index, size, data) entries.  Each process writes the entries
+    // for its local nodes in one contiguous chunk.
+    StreamableManager* const streamable_manager = StreamableManager::getManager();
+    std::vector<char> node_data;
+    for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
+    {
+        if (!d_level_contains_lag_data[level_number]) continue;
+        const std::vector<LNode*>& local_nodes = d_lag_mesh[level_number]->getLocalNodes();
+        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+        {
+            std::vector<Pointer<Streamable> > node_data_items = (*cit)->getNodeData();
+            FixedSizedStream stream(static_cast<int>(streamable_manager->getDataStreamSize(node_data_items)));
+            streamable_manager->packStream(stream, node_data_items);
+            const char* const stream_data = static_cast<const char*>(stream.getBufferStart());
+            append_header_value(node_data, level_number);
+            append_header_value(node_data, (*cit)->getLagrangianIndex());
+            append_header_value(node_data, stream.getCurrentSize());
+            node_data.insert(node_data.end(), stream_data, stream_data + stream.getCurrentSize());
+        }
+    }
+    long long node_data_size = static_cast<long long>(node_data.size());
+    long long node_data_offset = 0;
+    long long total_node_data_size = 0;
+    MPI_Exscan(&node_data_size, &node_data_offset, 1, MPI_LONG_LONG, MPI_SUM, SAMRAI_MPI::getCommunicator());
+    MPI_Allreduce(&node_data_size, &total_node_data_size, 1, MPI_LONG_LONG, MPI_SUM, SAMRAI_MPI::getCommunicator());
+    if (mpi_rank == 0) node_data_offset = 0;
+    std::vector<char> node_data_header;
+    append_header_value(node_data_header, total_node_data_size);
+    const MPI_Offset node_data_chunk_offset = data_offset + sizeof(long long) + node_data_offset;
+    if (async_writes)
+    {
+        if (mpi_rank == 0)
+        {
+            d_async_restart_writer->writeAt(file_name, static_cast<off_t>(data_offset), node_data_header);
+        }
+        if (!node_data.empty())
+        {
+            d_async_restart_writer->writeAt(file_name, static_cast<off_t>(node_data_chunk_offset), node_data);
+        }
+    }
+    else
+    {
+        if (mpi_rank == 0)
+        {
+            MPI_File_write_at(fh, data_offset, &node_data_header[0], sizeof(long long), MPI_CHAR, MPI_STATUS_IGNORE);
+        }
+        MPI_File_write_at_all(fh,
+                              node_data_chunk_offset,
+                              node_data.empty() ? NULL : &node_data[0],
+                              static_cast<int>(node_data.size()),
+                              MPI_CHAR,
+                              MPI_STATUS_IGNORE);
+        MPI_File_close(&fh);
+    }
+
+    IBTK_TIMER_STOP(t_write_lagrangian_restart_data);
+    return;
+} // writeLagrangianRestartData
+
+double LDataManager::readLagrangianRestartData(const std::string& dump_dirname, const int time_step_number)
+{
+    IBTK_TIMER_START(t_read_lagrangian_restart_data);
+
+    int ierr;
+
+    // Ensure that any restart file that is being written has been completed.
+    waitForLagrangianRestartWrites();
+
+    // Open the shared file.
+    const std::string file_name = lag_restart_file_name(dump_dirname, time_step_number);
+    MPI_File fh;
+    if (MPI_File_open(SAMRAI_MPI::getCommunicator(),
+                      const_cast<char*>(file_name.c_str()),
+                      MPI_MODE_RDONLY,
+                      MPI_INFO_NULL,
+                      &fh) != MPI_SUCCESS)
+    {
+        TBOX_ERROR(d_object_name << "::readLagrangianRestartData():\n"
+                                 << "  could not open file " << file_name << " for reading." << std::endl);
+    }
+
+    // Read the file header.  The header is small, and so each process reads it
+    // independently.
+    int header_prefix[2];
+    MPI_File_read_at(fh, 0, header_prefix, 2, MPI_INT, MPI_STATUS_IGNORE);
+    if (header_prefix[0] != LAG_RESTART_FILE_VERSION)
+    {
+        TBOX_ERROR(d_object_name << "::readLagrangianRestartData():\n"
+                                 << "  Lagrangian restart file version different than class version." << std::endl);
+    }
+    const int header_size = header_prefix[1];
+    std::vector<char> header(header_size);
+    MPI_File_read_at(fh, 0, &header[0], header_size, MPI_CHAR, MPI_STATUS_IGNORE);
+    size_t pos = 2 * sizeof(int);
+    const double simulation_time = extract_header_value<double>(header, pos);
+    const int num_records = extract_header_value<int>(header, pos);
+
+    // Read each quantity that is also managed by this object in contiguous
+    // slabs, and scatter the values to the present owners of the nodes.
+    int num_restored_records = 0;
+    MPI_Offset data_offset = header_size;
+    for (int k = 0; k < num_records; ++k)
+    {
+        const int level_number = extract_header_value<int>(header, pos);
+        const int depth = extract_header_value<int>(header, pos);
+        const int num_nodes = extract_header_value<int>(header, pos);
+        const int name_size = extract_header_value<int>(header, pos);
+        if (pos + name_size > header.size())
+        {
+            TBOX_ERROR(d_object_name << "::readLagrangianRestartData():\n"
+                                     << "  corrupt Lagrangian restart file header." << std::endl);
+        }
+        const std::string name(header.begin() + pos, header.begin() + pos + name_size);
+        pos += name_size;
+        const MPI_Offset record_offset = data_offset;
+        data_offset += static_cast<MPI_Offset>(num_nodes) * depth * sizeof(double);
+
+        if (level_number < d_coarsest_ln || level_number > d_finest_ln) continue;
+        if (!d_level_contains_lag_data[level_number]) continue;
+        std::map<std::string, Pointer<LData> >::iterator it = d_lag_mesh_data[level_number].find(name);
+        if (it == d_lag_mesh_data[level_number].end()) continue;
+        Pointer<LData> data = it->second;
+        if (data->getDepth() != static_cast<unsigned int>(depth) ||
+            d_num_nodes[level_number] != static_cast<unsigned int>(num_nodes))
+        {
+            TBOX_ERROR(d_object_name << "::readLagrangianRestartData():\n"
+                                     << "  quantity " << name << " on level number " << level_number
+                                     << " is incompatible with the data in file " << file_name << std::endl);
+        }
+
+        Vec petsc_vec = data->getVec();
+        VecScatter vec_scatter;
+        Vec slab_vec;
+        createLagrangianSlabScatter(vec_scatter, slab_vec, petsc_vec, depth, level_number);
+        int ilo, ihi;
+        ierr = VecGetOwnershipRange(slab_vec, &ilo, &ihi);
+        IBTK_CHKERRQ(ierr);
+        double* slab_arr;
+        ierr = VecGetArray(slab_vec, &slab_arr);
+        IBTK_CHKERRQ(ierr);
+        MPI_File_read_at_all(fh,
+                             record_offset + static_cast<MPI_Offset>(ilo) * sizeof(double),
+                             slab_arr,
+                             ihi - ilo,
+                             MPI_DOUBLE,
+                             MPI_STATUS_IGNORE);
+        ierr = VecRestoreArray(slab_vec, &slab_arr);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScatterBegin(vec_scatter, slab_vec, petsc_vec, INSERT_VALUES, SCATTER_REVERSE);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScatterEnd(vec_scatter, slab_vec, petsc_vec, INSERT_VALUES, SCATTER_REVERSE);
+        IBTK_CHKERRQ(ierr);
+        data->beginGhostUpdate();
+        data->endGhostUpdate();
+        ++num_restored_records;
+
+        ierr = VecScatterDestroy(&vec_scatter);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&slab_vec);
+        IBTK_CHKERRQ(ierr);
+    }
+    MPI_File_close(&fh);
+
+    // When the initial configuration was read from this file, every quantity
+    // must be restored so that no data are left inconsistent with the restored
+    // node positions.  The cached initial configuration is no longer needed.
+    if (!d_init_restart_dirname.empty())
+    {
+        int num_managed_records = 0;
+        for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
+        {
+            if (!d_level_contains_lag_data[level_number]) continue;
+            num_managed_records += static_cast<int>(d_lag_mesh_data[level_number].size());
+        }
+        if (num_restored_records != num_managed_records)
+        {
+            TBOX_ERROR(d_object_name << "::readLagrangianRestartData():\n"
+                                     << "  file " << file_name
+                                     << " does not define all of the Lagrangian quantities managed by "
+                                     << d_object_name << "." << std::endl);
+        }
+        d_init_restart_dirname.clear();
+        d_init_restart_num = -1;
+        d_init_restart_loaded = false;
+        d_init_restart_posns.clear();
+        d_init_restart_node_data.clear();
+        d_init_restart_node_data_offsets.clear();
+    }
+
+    IBTK_TIMER_STOP(t_read_lagrangian_restart_data);
+    return simulation_time;
+} // readLagrangianRestartData
+
+void LDataManager::setInitialLagrangianRestartData(const std::string& dump_dirname, const int time_step_number)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!dump_dirname.empty());
+    TBOX_ASSERT(time_step_number >= 0);
+#endif
+    d_init_restart_dirname = dump_dirname;
+    d_init_restart_num = time_step_number;
+    d_init_restart_loaded = false;
+    return;
+} // setInitialLagrangianRestartData
+
 void LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest_ln_in)
 {
     IBTK_TIMER_START(t_begin_data_redistribution);
@@ -1681,6 +2260,8 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
     int ierr;
 
     std::vector<AO> new_ao(finest_ln + 1);
+    std::vector<bool> ordering_changed(finest_ln + 1, false);
+    std::vector<bool> ghosts_changed(finest_ln + 1, false);
 
     std::vector<std::vector<Vec> > src_vec(finest_ln + 1);
     std::vector<std::vector<Vec> > dst_vec(finest_ln + 1);
@@ -1707,10 +2288,16 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
     // used to access elements in the local form of ghosted parallel PETSc Vec
     // objects.
     //
-    // NOTE 3: The PETSc ordering is maintained so that the data corresponding
-    // to patch interiors is contiguous (as long as there are no overlapping
-    // patches).  Nodes in the ghost region of a patch will not in general be
+    // NOTE 3: Whenever nodes change processors, the local nodes are reordered
+    // by patch, so that the data corresponding to patch interiors are stored
+    // contiguously.  If no nodes change processors, the previous ordering is
+    // retained.  Nodes in the ghost region of a patch will not in general be
     // stored as contiguous data, and no attempt is made to do so.
+    //
+    // NOTE 4: If no nodes change processors, the PETSc ordering and the AO
+    // object are left unchanged, and the existing LData objects are reused.
+    // If in addition the ghost nodes are unchanged, no PETSc data need to be
+    // communicated.
 
     // In the following loop over patch levels, we first compute the new
     // distribution data (e.g., all of these indices).
@@ -1734,17 +2321,50 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
         //
         // NOTE: This process updates the local PETSc indices of the LNodeSet
         // objects contained in the current patch.
-        computeNodeDistribution(new_ao[level_number],
-                                d_local_lag_indices[level_number],
-                                d_nonlocal_lag_indices[level_number],
-                                d_local_petsc_indices[level_number],
-                                d_nonlocal_petsc_indices[level_number],
-                                d_num_nodes[level_number],
-                                d_node_offset[level_number],
-                                level_number);
+        std::vector<int> old_nonlocal_petsc_indices = d_nonlocal_petsc_indices[level_number];
+        ordering_changed[level_number] = computeNodeDistribution(new_ao[level_number],
+                                                                 d_local_lag_indices[level_number],
+                                                                 d_nonlocal_lag_indices[level_number],
+                                                                 d_local_petsc_indices[level_number],
+                                                                 d_nonlocal_petsc_indices[level_number],
+                                                                 d_num_nodes[level_number],
+                                                                 d_node_offset[level_number],
+                                                                 level_number);
+        // NOTE: The ghost node layout may change on only some processors, but
+        // the ghosted vectors are created collectively, so all processors must
+        // agree on whether to rebuild them.
+        const int local_ghosts_changed = d_nonlocal_petsc_indices[level_number] != old_nonlocal_petsc_indices ? 1 : 0;
+        ghosts_changed[level_number] = SAMRAI_MPI::maxReduction(local_ghosts_changed) != 0;
         num_local_nodes[level_number] = static_cast<int>(d_local_lag_indices[level_number].size());
         num_nonlocal_nodes[level_number] = static_cast<int>(d_nonlocal_lag_indices[level_number].size());
 
+        // When the PETSc ordering is unchanged, the existing data can be used
+        // directly, and only the ghost node layout may need to be updated.
+        if (!ordering_changed[level_number])
+        {
+            if (!ghosts_changed[level_number]) continue;
+            std::map<std::string, Pointer<LData> >::iterator it;
+            int i;
+            for (it = level_data.begin(), i = 0; it != level_data.end(); ++it, ++i)
+            {
+                Pointer<LData> data = it->second;
+                const int depth = data->getDepth();
+                src_vec[level_number][i] = data->getVec();
+                ierr = VecCreateGhostBlock(
+                    PETSC_COMM_WORLD,
+                    depth,
+                    depth * num_local_nodes[level_number],
+                    PETSC_DECIDE,
+                    num_nonlocal_nodes[level_number],
+                    num_nonlocal_nodes[level_number] > 0 ? &d_nonlocal_petsc_indices[level_number][0] : NULL,
+                    &dst_vec[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecCopy(src_vec[level_number][i], dst_vec[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+            }
+            continue;
+        }
+
         // Setup src indices.
         std::vector<int> src_inds(num_local_nodes[level_number]);
         for (int k = 0; k < num_local_nodes[level_number]; ++k)
@@ -1902,16 +2522,20 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
         std::map<std::string, Pointer<LData> >& level_data = d_lag_mesh_data[level_number];
         std::map<std::string, Pointer<LData> >::iterator it;
         int i;
+        if (!ordering_changed[level_number] && !ghosts_changed[level_number]) continue;
         for (it = level_data.begin(), i = 0; it != level_data.end(); ++it, ++i)
         {
-            ierr = VecScatterEnd(scatter[level_number][i],
-                                 src_vec[level_number][i],
-                                 dst_vec[level_number][i],
-                                 INSERT_VALUES,
-                                 SCATTER_FORWARD);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecScatterDestroy(&scatter[level_number][i]);
-            IBTK_CHKERRQ(ierr);
+            if (ordering_changed[level_number])
+            {
+                ierr = VecScatterEnd(scatter[level_number][i],
+                                     src_vec[level_number][i],
+                                     dst_vec[level_number][i],
+                                     INSERT_VALUES,
+                                     SCATTER_FORWARD);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecScatterDestroy(&scatter[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+            }
             Pointer<LData> data = it->second;
             data->resetData(dst_vec[level_number][i], d_nonlocal_petsc_indices[level_number]);
         }
@@ -1927,12 +2551,15 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
     {
         d_needs_synch[level_number] = false;
 
-        if (d_ao[level_number])
+        if (new_ao[level_number])
         {
-            ierr = AODestroy(&d_ao[level_number]);
-            IBTK_CHKERRQ(ierr);
+            if (d_ao[level_number])
+            {
+                ierr = AODestroy(&d_ao[level_number]);
+                IBTK_CHKERRQ(ierr);
+            }
+            d_ao[level_number] = new_ao[level_number];
         }
-        d_ao[level_number] = new_ao[level_number];
 
         for (std::map<int, IS>::iterator it = src_IS[level_number].begin(); it != src_IS[level_number].end(); ++it)
         {
@@ -1947,11 +2574,24 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
         }
     }
 
+    // Keep track of whether the distribution of nodes has changed on any
+    // processor.
+    int distribution_changed = 0;
+    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
+    {
+        if (ordering_changed[level_number] || ghosts_changed[level_number]) distribution_changed = 1;
+    }
+    if (SAMRAI_MPI::maxReduction(distribution_changed)) ++d_node_distribution_revision;
+
     // If a Silo data writer is registered with the manager, give it access to
     // the new application orderings.
     if (d_silo_writer)
     {
-        d_silo_writer->registerLagrangianAO(d_ao, coarsest_ln, finest_ln);
+        for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
+        {
+            if (d_level_contains_lag_data[level_number] && !ordering_changed[level_number]) continue;
+            d_silo_writer->registerLagrangianAO(d_ao[level_number], level_number);
+        }
     }
 
     IBTK_TIMER_STOP(t_end_data_redistribution);
@@ -1973,8 +2613,75 @@ void LDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int f
 #endif
 
     updateNodeCountData(coarsest_ln, finest_ln);
-    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, coarsest_ln, finest_ln);
-    hier_cc_data_ops.axpy(d_workload_idx, d_beta_work, d_node_count_idx, d_workload_idx);
+    if (!d_workload_cost_model)
+    {
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, coarsest_ln, finest_ln);
+        hier_cc_data_ops.axpy(d_workload_idx, d_beta_work, d_node_count_idx, d_workload_idx);
+        IBTK_TIMER_STOP(t_update_workload_estimates);
+        return;
+    }
+
+    // Determine the workload using the cost model.  The interaction work
+    // associated with each node is the number of cells of the patch covered by
+    // its interpolation and spreading stencils, which is attributed to the
+    // nearest cell in the patch interior.
+    const double interaction_cost = d_workload_cost_model->getCost(WorkloadCostModel::INTERACTION_WORK);
+    const double force_cost = d_workload_cost_model->getCost(WorkloadCostModel::FORCE_WORK);
+    const int stencil_size[2] = { LEInteractor::getStencilSize(d_default_interp_kernel_fcn),
+                                  LEInteractor::getStencilSize(d_default_spread_kernel_fcn) };
+    double local_interaction_work = 0.0, local_force_work = 0.0;
+    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
+    {
+        if (!d_level_contains_lag_data[level_number]) continue;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Index<NDIM>& patch_lower = patch_box.lower();
+            const Index<NDIM>& patch_upper = patch_box.upper();
+            const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            Pointer<CellData<NDIM, double> > workload_data = patch->getPatchData(d_workload_idx);
+            for (LNodeSetData::SetIterator it(*idx_data); it; it++)
+            {
+                const Index<NDIM>& i = it.getIndex();
+                int stencil_work = 0;
+                for (int k = 0; k < 2; ++k)
+                {
+                    int overlap = 1;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        const int stencil_lower = i(d) - (stencil_size[k] - 1) / 2;
+                        const int stencil_upper = stencil_lower + stencil_size[k] - 1;
+                        overlap *= std::max(
+                            std::min(stencil_upper, patch_upper(d)) - std::max(stencil_lower, patch_lower(d)) + 1, 0);
+                    }
+                    stencil_work += overlap;
+                }
+                if (stencil_work == 0) continue;
+                const LNodeSet& node_set = *it;
+                const double interaction_work = static_cast<double>(stencil_work * node_set.size());
+                double force_work = 0.0;
+                if (patch_box.contains(i))
+                {
+                    for (LNodeSet::const_iterator n = node_set.begin(); n != node_set.end(); ++n)
+                    {
+                        force_work += static_cast<double>((*n)->getNodeData().size());
+                    }
+                }
+                Index<NDIM> i_interior;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    i_interior(d) = std::max(patch_lower(d), std::min(i(d), patch_upper(d)));
+                }
+                (*workload_data)(i_interior) += interaction_cost * interaction_work + force_cost * force_work;
+                local_interaction_work += interaction_work;
+                local_force_work += force_work;
+            }
+        }
+    }
+    d_workload_cost_model->addLocalWork(WorkloadCostModel::INTERACTION_WORK, local_interaction_work);
+    d_workload_cost_model->addLocalWork(WorkloadCostModel::FORCE_WORK, local_force_work);
 
     IBTK_TIMER_STOP(t_update_workload_estimates);
     return;
@@ -2140,13 +2847,29 @@ void LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> >
     {
         int ierr;
 
+        // When the initial configuration is read from a Lagrangian restart
+        // file, the nodes are distributed according to their positions in
+        // that file instead of by the Lagrangian initialization object.
+        const bool init_from_restart = !d_init_restart_dirname.empty();
+        if (init_from_restart && !d_init_restart_loaded) loadInitialLagrangianRestartData();
+
         // 1. Determine the number of local (on processor) nodes to be allocated
         //    on the patch level and allocate space for the local and non-local
         //    index data.
         const unsigned int num_global_nodes = d_lag_init->computeGlobalNodeCountOnPatchLevel(
             hierarchy, level_number, init_data_time, can_be_refined, initial_time);
-        const unsigned int num_local_nodes = d_lag_init->computeLocalNodeCountOnPatchLevel(
-            hierarchy, level_number, init_data_time, can_be_refined, initial_time);
+        if (init_from_restart && (level_number >= static_cast<int>(d_init_restart_posns.size()) ||
+                                  d_init_restart_posns[level_number].size() != NDIM * num_global_nodes))
+        {
+            TBOX_ERROR(d_object_name << "::initializeLevelData():\n"
+                                     << "  the Lagrangian restart data are incompatible with the initial "
+                                        "configuration on level number "
+                                     << level_number << "." << std::endl);
+        }
+        const unsigned int num_local_nodes =
+            init_from_restart ? computeInitialRestartLocalNodeCount(hierarchy, level_number) :
+                                d_lag_init->computeLocalNodeCountOnPatchLevel(
+                                    hierarchy, level_number, init_data_time, can_be_refined, initial_time);
         const unsigned int sum_num_local_nodes =
             static_cast<unsigned int>(SAMRAI_MPI::sumReduction(static_cast<int>(num_local_nodes)));
         if (num_global_nodes != sum_num_local_nodes)
@@ -2204,17 +2927,19 @@ void LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> >
         static const unsigned int global_index_offset = 0;
         static const unsigned int local_index_offset = 0;
         const unsigned int num_initialized_local_nodes =
-            d_lag_init->initializeDataOnPatchLevel(d_lag_node_index_current_idx,
-                                                   global_index_offset,
-                                                   local_index_offset,
-                                                   d_lag_mesh_data[level_number][POSN_DATA_NAME],
-                                                   d_lag_mesh_data[level_number][VEL_DATA_NAME],
-                                                   hierarchy,
-                                                   level_number,
-                                                   init_data_time,
-                                                   can_be_refined,
-                                                   initial_time,
-                                                   this);
+            init_from_restart ?
+                initializeInitialRestartDataOnPatchLevel(hierarchy, level_number) :
+                d_lag_init->initializeDataOnPatchLevel(d_lag_node_index_current_idx,
+                                                       global_index_offset,
+                                                       local_index_offset,
+                                                       d_lag_mesh_data[level_number][POSN_DATA_NAME],
+                                                       d_lag_mesh_data[level_number][VEL_DATA_NAME],
+                                                       hierarchy,
+                                                       level_number,
+                                                       init_data_time,
+                                                       can_be_refined,
+                                                       initial_time,
+                                                       this);
 
         ierr = VecCopy(d_lag_mesh_data[level_number][POSN_DATA_NAME]->getVec(),
                        d_lag_mesh_data[level_number][INIT_POSN_DATA_NAME]->getVec());
@@ -2301,6 +3026,7 @@ void LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> >
                                num_local_nodes > 0 ? &d_local_petsc_indices[level_number][0] : NULL,
                                &d_ao[level_number]);
         IBTK_CHKERRQ(ierr);
+        ++d_node_distribution_revision;
     }
 
     // If a Silo data writer is registered with the manager, give it access to
@@ -2370,6 +3096,9 @@ void LDataManager::resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<
         d_node_count_coarsen_scheds[level_number] = d_node_count_coarsen_alg->createSchedule(coarser_level, level);
     }
 
+    // Deallocate any spreading scratch data; it is reallocated on demand.
+    d_spread_scratch_data_cache.deallocateScratchData();
+
     IBTK_TIMER_STOP(t_reset_hierarchy_configuration);
     return;
 } // resetHierarchyConfiguration
@@ -2389,7 +3118,14 @@ void LDataManager::applyGradientDetector(const Pointer<BasePatchHierarchy<NDIM>
     TBOX_ASSERT(hierarchy->getPatchLevel(level_number));
 #endif
 
-    if (initial_time)
+    if (initial_time && !d_init_restart_dirname.empty())
+    {
+        // Tag cells for refinement based on the configuration of the
+        // Lagrangian structure that is read from the restart file.
+        if (!d_init_restart_loaded) loadInitialLagrangianRestartData();
+        tagCellsFromInitialRestartData(hierarchy, level_number, tag_index);
+    }
+    else if (initial_time)
     {
         // Tag cells for refinement based on the initial configuration of the
         // Lagrangian structure.
@@ -2602,13 +3338,17 @@ LDataManager::LDataManager(const std::string& object_name,
       d_coarsest_ln(-1), d_finest_ln(-1), d_visit_writer(NULL), d_silo_writer(NULL), d_load_balancer(NULL),
       d_lag_init(NULL), d_level_contains_lag_data(), d_lag_node_index_var(NULL), d_lag_node_index_current_idx(-1),
       d_lag_node_index_scratch_idx(-1), d_beta_work(1.0), d_workload_var(NULL), d_workload_idx(-1),
-      d_output_workload(false), d_node_count_var(NULL), d_node_count_idx(-1), d_output_node_count(false),
+      d_output_workload(false), d_workload_cost_model(NULL), d_node_count_var(NULL), d_node_count_idx(-1), d_output_node_count(false),
       d_default_interp_kernel_fcn(default_interp_kernel_fcn), d_default_spread_kernel_fcn(default_spread_kernel_fcn),
       d_ghost_width(ghost_width), d_lag_node_index_bdry_fill_alg(NULL), d_lag_node_index_bdry_fill_scheds(),
       d_node_count_coarsen_alg(NULL), d_node_count_coarsen_scheds(), d_current_context(NULL), d_scratch_context(NULL),
-      d_current_data(), d_scratch_data(), d_lag_mesh(), d_lag_mesh_data(), d_needs_synch(true), d_ao(), d_num_nodes(),
+      d_current_data(), d_scratch_data(), d_lag_mesh(), d_lag_mesh_data(), d_needs_synch(true), d_ao(),
+      d_node_distribution_revision(0), d_async_restart_writer(NULL), d_init_restart_dirname(), d_init_restart_num(-1),
+      d_init_restart_loaded(false), d_init_restart_posns(), d_init_restart_node_data(),
+      d_init_restart_node_data_offsets(), d_num_nodes(),
       d_node_offset(), d_local_lag_indices(), d_nonlocal_lag_indices(), d_local_petsc_indices(),
-      d_nonlocal_petsc_indices()
+      d_nonlocal_petsc_indices(), d_spread_scratch_data_cache(), d_ghost_update_vecs(),
+      d_ghost_update_vecs_revision()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -2689,9 +3429,15 @@ LDataManager::LDataManager(const std::string& object_name,
             TimerManager::getManager()->getTimer("IBTK::LDataManager::resetHierarchyConfiguration()");
         t_apply_gradient_detector = TimerManager::getManager()->getTimer("IBTK::LDataManager::applyGradientDetector()");
         t_put_to_database = TimerManager::getManager()->getTimer("IBTK::LDataManager::putToDatabase()");
+        t_write_lagrangian_restart_data =
+            TimerManager::getManager()->getTimer("IBTK::LDataManager::writeLagrangianRestartData()");
+        t_read_lagrangian_restart_data =
+            TimerManager::getManager()->getTimer("IBTK::LDataManager::readLagrangianRestartData()");
         t_begin_nonlocal_data_fill =
             TimerManager::getManager()->getTimer("IBTK::LDataManager::beginNonlocalDataFill()");
         t_end_nonlocal_data_fill = TimerManager::getManager()->getTimer("IBTK::LDataManager::endNonlocalDataFill()");
+        t_begin_ghost_update = TimerManager::getManager()->getTimer("IBTK::LDataManager::beginGhostUpdate()");
+        t_end_ghost_update = TimerManager::getManager()->getTimer("IBTK::LDataManager::endGhostUpdate()");
         t_compute_node_distribution =
             TimerManager::getManager()->getTimer("IBTK::LDataManager::computeNodeDistribution()");
         t_compute_node_offsets = TimerManager::getManager()->getTimer("IBTK::LDataManager::computeNodeOffsets()"););
@@ -2710,6 +3456,12 @@ LDataManager::~LDataManager()
             IBTK_CHKERRQ(ierr);
         }
     }
+
+    // Destroy the vectors used to perform batched ghost value updates.
+    for (int level_number = 0; level_number < static_cast<int>(d_ghost_update_vecs.size()); ++level_number)
+    {
+        clearGhostUpdateVecs(level_number);
+    }
     return;
 } // ~LDataManager
 
@@ -2786,6 +3538,320 @@ void LDataManager::scatterData(Vec& lagrangian_vec, Vec& petsc_vec, const int le
     return;
 } // scatterData
 
+void LDataManager::createLagrangianSlabScatter(VecScatter& vec_scatter,
+                                               Vec& slab_vec,
+                                               Vec petsc_vec,
+                                               const int depth,
+                                               const int level_number) const
+{
+    int ierr;
+
+    // Assign a contiguous range of Lagrangian indices to each process.
+    const int mpi_size = SAMRAI_MPI::getNodes();
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int num_nodes = static_cast<int>(d_num_nodes[level_number]);
+    const int slab_size = num_nodes / mpi_size + (mpi_rank < num_nodes % mpi_size ? 1 : 0);
+    const int slab_first = mpi_rank * (num_nodes / mpi_size) + std::min(mpi_rank, num_nodes % mpi_size);
+
+    // Determine the PETSc indices corresponding to the Lagrangian indices in
+    // the slab.
+    std::vector<int> slab_idxs(slab_size);
+    for (int k = 0; k < slab_size; ++k)
+    {
+        slab_idxs[k] = slab_first + k;
+    }
+    mapLagrangianToPETSc(slab_idxs, level_number);
+
+    IS petsc_is;
+    ierr = ISCreateBlock(
+        PETSC_COMM_WORLD, depth, slab_size, (slab_idxs.empty() ? NULL : &slab_idxs[0]), PETSC_COPY_VALUES, &petsc_is);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecCreateMPI(PETSC_COMM_WORLD, depth * slab_size, PETSC_DETERMINE, &slab_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterCreate(petsc_vec, petsc_is, slab_vec, NULL, &vec_scatter);
+    IBTK_CHKERRQ(ierr);
+    ierr = ISDestroy(&petsc_is);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // createLagrangianSlabScatter
+
+void LDataManager::loadInitialLagrangianRestartData()
+{
+    // Open the shared file.  The initial configuration is reconstructed
+    // independently on each process, and so each process reads the node
+    // positions and node data for all levels.
+    const std::string file_name = lag_restart_file_name(d_init_restart_dirname, d_init_restart_num);
+    MPI_File fh;
+    if (MPI_File_open(SAMRAI_MPI::getCommunicator(),
+                      const_cast<char*>(file_name.c_str()),
+                      MPI_MODE_RDONLY,
+                      MPI_INFO_NULL,
+                      &fh) != MPI_SUCCESS)
+    {
+        TBOX_ERROR(d_object_name << "::loadInitialLagrangianRestartData():\n"
+                                 << "  could not open file " << file_name << " for reading." << std::endl);
+    }
+
+    // Read the file header.
+    int header_prefix[2];
+    MPI_File_read_at(fh, 0, header_prefix, 2, MPI_INT, MPI_STATUS_IGNORE);
+    if (header_prefix[0] != LAG_RESTART_FILE_VERSION)
+    {
+        TBOX_ERROR(d_object_name << "::loadInitialLagrangianRestartData():\n"
+                                 << "  Lagrangian restart file version different than class version." << std::endl);
+    }
+    const int header_size = header_prefix[1];
+    std::vector<char> header(header_size);
+    MPI_File_read_at(fh, 0, &header[0], header_size, MPI_CHAR, MPI_STATUS_IGNORE);
+    size_t pos = 2 * sizeof(int);
+    extract_header_value<double>(header, pos);
+    const int num_records = extract_header_value<int>(header, pos);
+
+    // Read the node positions.
+    d_init_restart_posns.clear();
+    MPI_Offset data_offset = header_size;
+    for (int k = 0; k < num_records; ++k)
+    {
+        const int level_number = extract_header_value<int>(header, pos);
+        const int depth = extract_header_value<int>(header, pos);
+        const int num_nodes = extract_header_value<int>(header, pos);
+        const int name_size = extract_header_value<int>(header, pos);
+        if (pos + name_size > header.size())
+        {
+            TBOX_ERROR(d_object_name << "::loadInitialLagrangianRestartData():\n"
+                                     << "  corrupt Lagrangian restart file header." << std::endl);
+        }
+        const std::string name(header.begin() + pos, header.begin() + pos + name_size);
+        pos += name_size;
+        const MPI_Offset record_offset = data_offset;
+        data_offset += static_cast<MPI_Offset>(num_nodes) * depth * sizeof(double);
+        if (name != POSN_DATA_NAME) continue;
+        if (level_number >= static_cast<int>(d_init_restart_posns.size()))
+        {
+            d_init_restart_posns.resize(level_number + 1);
+        }
+        d_init_restart_posns[level_number].resize(num_nodes * NDIM);
+        MPI_File_read_at(fh,
+                         record_offset,
+                         num_nodes > 0 ? &d_init_restart_posns[level_number][0] : NULL,
+                         num_nodes * NDIM,
+                         MPI_DOUBLE,
+                         MPI_STATUS_IGNORE);
+    }
+
+    // Read the node data, and index the entries by level number and
+    // Lagrangian index.
+    long long node_data_size = 0;
+    MPI_File_read_at(fh, data_offset, &node_data_size, sizeof(long long), MPI_CHAR, MPI_STATUS_IGNORE);
+    d_init_restart_node_data.resize(node_data_size);
+    MPI_File_read_at(fh,
+                     data_offset + sizeof(long long),
+                     node_data_size > 0 ? &d_init_restart_node_data[0] : NULL,
+                     static_cast<int>(node_data_size),
+                     MPI_CHAR,
+                     MPI_STATUS_IGNORE);
+    MPI_File_close(&fh);
+
+    d_init_restart_node_data_offsets.resize(d_init_restart_posns.size());
+    for (unsigned int level_number = 0; level_number < d_init_restart_posns.size(); ++level_number)
+    {
+        d_init_restart_node_data_offsets[level_number].assign(d_init_restart_posns[level_number].size() / NDIM,
+                                                             std::numeric_limits<size_t>::max());
+    }
+    pos = 0;
+    while (pos < d_init_restart_node_data.size())
+    {
+        const int level_number = extract_header_value<int>(d_init_restart_node_data, pos);
+        const int lag_idx = extract_header_value<int>(d_init_restart_node_data, pos);
+        const size_t entry_offset = pos;
+        const int data_size = extract_header_value<int>(d_init_restart_node_data, pos);
+        if (level_number < 0 || level_number >= static_cast<int>(d_init_restart_node_data_offsets.size()) ||
+            lag_idx < 0 || lag_idx >= static_cast<int>(d_init_restart_node_data_offsets[level_number].size()) ||
+            pos + data_size > d_init_restart_node_data.size())
+        {
+            TBOX_ERROR(d_object_name << "::loadInitialLagrangianRestartData():\n"
+                                     << "  corrupt node data in file " << file_name << std::endl);
+        }
+        d_init_restart_node_data_offsets[level_number][lag_idx] = entry_offset;
+        pos += data_size;
+    }
+    d_init_restart_loaded = true;
+    return;
+} // loadInitialLagrangianRestartData
+
+void LDataManager::getInitialRestartPatchNodes(std::vector<int>& patch_lag_idxs,
+                                               const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                               const Pointer<Patch<NDIM> > patch,
+                                               const int level_number) const
+{
+    patch_lag_idxs.clear();
+    if (level_number >= static_cast<int>(d_init_restart_posns.size())) return;
+
+    // Shift the nodes into the computational domain as in
+    // beginDataRedistribution() and find the nodes that are owned by the
+    // patch.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const double* const domain_x_lower = grid_geom->getXLower();
+    const double* const domain_x_upper = grid_geom->getXUpper();
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift();
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+    const std::vector<double>& posns = d_init_restart_posns[level_number];
+    const int num_nodes = static_cast<int>(posns.size() / NDIM);
+    for (int lag_idx = 0; lag_idx < num_nodes; ++lag_idx)
+    {
+        const Vector X = shift_restart_posn(&posns[NDIM * lag_idx], domain_x_lower, domain_x_upper, periodic_shift);
+        const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(X,
+                                                                 patch_geom->getXLower(),
+                                                                 patch_geom->getXUpper(),
+                                                                 patch_geom->getDx(),
+                                                                 patch_box.lower(),
+                                                                 patch_box.upper());
+        if (patch_box.contains(idx)) patch_lag_idxs.push_back(lag_idx);
+    }
+    return;
+} // getInitialRestartPatchNodes
+
+unsigned int LDataManager::computeInitialRestartLocalNodeCount(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                                const int level_number) const
+{
+    unsigned int num_local_nodes = 0;
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    std::vector<int> patch_lag_idxs;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        getInitialRestartPatchNodes(patch_lag_idxs, hierarchy, level->getPatch(p()), level_number);
+        num_local_nodes += patch_lag_idxs.size();
+    }
+    return num_local_nodes;
+} // computeInitialRestartLocalNodeCount
+
+unsigned int LDataManager::initializeInitialRestartDataOnPatchLevel(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                                     const int level_number)
+{
+    StreamableManager* const streamable_manager = StreamableManager::getManager();
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const double* const domain_x_lower = grid_geom->getXLower();
+    const double* const domain_x_upper = grid_geom->getXUpper();
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift();
+    const std::vector<double>& posns = d_init_restart_posns[level_number];
+    const std::vector<size_t>& node_data_offsets = d_init_restart_node_data_offsets[level_number];
+
+    Pointer<LData> X_data = d_lag_mesh_data[level_number][POSN_DATA_NAME];
+    Pointer<LData> U_data = d_lag_mesh_data[level_number][VEL_DATA_NAME];
+    boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+    boost::multi_array_ref<double, 2>& U_array = *U_data->getLocalFormVecArray();
+    int local_idx = -1;
+    unsigned int local_node_count = 0;
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    std::vector<int> patch_lag_idxs;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+        const double* const patch_dx = patch_geom->getDx();
+        Pointer<LNodeSetData> index_data = patch->getPatchData(d_lag_node_index_current_idx);
+
+        getInitialRestartPatchNodes(patch_lag_idxs, hierarchy, patch, level_number);
+        local_node_count += patch_lag_idxs.size();
+        for (std::vector<int>::const_iterator cit = patch_lag_idxs.begin(); cit != patch_lag_idxs.end(); ++cit)
+        {
+            const int lag_idx = *cit;
+            const int local_petsc_idx = ++local_idx;
+            const int global_petsc_idx = local_petsc_idx + d_node_offset[level_number];
+
+            // Get the coordinates and periodic shifters of the present node.
+            Vector X_real;
+            for (unsigned int d = 0; d < NDIM; ++d) X_real[d] = posns[NDIM * lag_idx + d];
+            const Vector X = shift_restart_posn(&posns[NDIM * lag_idx], domain_x_lower, domain_x_upper, periodic_shift);
+            const Vector periodic_displacement = X_real - X;
+            IntVector<NDIM> periodic_offset;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                periodic_offset[d] = round(periodic_displacement[d] / patch_dx[d]);
+            }
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X_array[local_petsc_idx][d] = X[d];
+                U_array[local_petsc_idx][d] = 0.0;
+            }
+
+            // Restore the data associated with the present node.
+            std::vector<Pointer<Streamable> > node_data;
+            if (node_data_offsets[lag_idx] != std::numeric_limits<size_t>::max())
+            {
+                size_t pos = node_data_offsets[lag_idx];
+                const int data_size = extract_header_value<int>(d_init_restart_node_data, pos);
+                FixedSizedStream stream(&d_init_restart_node_data[pos], data_size);
+                streamable_manager->unpackStream(stream, IntVector<NDIM>(0), node_data);
+                for (std::vector<Pointer<Streamable> >::iterator it = node_data.begin(); it != node_data.end(); ++it)
+                {
+                    (*it)->registerPeriodicShift(periodic_offset, periodic_displacement);
+                }
+            }
+
+            // Add the node to the LNodeSet associated with the Cartesian grid
+            // cell in which it is located.
+            const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(X,
+                                                                     patch_geom->getXLower(),
+                                                                     patch_geom->getXUpper(),
+                                                                     patch_dx,
+                                                                     patch_box.lower(),
+                                                                     patch_box.upper());
+            if (!index_data->isElement(idx))
+            {
+                index_data->appendItemPointer(idx, new LNodeSet());
+            }
+            LNodeSet* const node_set = index_data->getItem(idx);
+            node_set->push_back(new LNode(
+                lag_idx, global_petsc_idx, local_petsc_idx, periodic_offset, periodic_displacement, node_data));
+        }
+    }
+    X_data->restoreArrays();
+    U_data->restoreArrays();
+    return local_node_count;
+} // initializeInitialRestartDataOnPatchLevel
+
+void LDataManager::tagCellsFromInitialRestartData(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                  const int level_number,
+                                                  const int tag_index) const
+{
+    // Tag cells for refinement wherever there are nodes that are assigned to
+    // the finer levels of the patch hierarchy.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const double* const domain_x_lower = grid_geom->getXLower();
+    const double* const domain_x_upper = grid_geom->getXUpper();
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift();
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    std::vector<int> patch_lag_idxs;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+        Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(tag_index);
+        for (int ln = level_number + 1; ln < static_cast<int>(d_init_restart_posns.size()); ++ln)
+        {
+            const std::vector<double>& posns = d_init_restart_posns[ln];
+            getInitialRestartPatchNodes(patch_lag_idxs, hierarchy, patch, ln);
+            for (std::vector<int>::const_iterator cit = patch_lag_idxs.begin(); cit != patch_lag_idxs.end(); ++cit)
+            {
+                const Vector X =
+                    shift_restart_posn(&posns[NDIM * (*cit)], domain_x_lower, domain_x_upper, periodic_shift);
+                const CellIndex<NDIM> i = IndexUtilities::getCellIndex(X,
+                                                                       patch_geom->getXLower(),
+                                                                       patch_geom->getXUpper(),
+                                                                       patch_geom->getDx(),
+                                                                       patch_box.lower(),
+                                                                       patch_box.upper());
+                (*tag_data)(i) = 1;
+            }
+        }
+    }
+    return;
+} // tagCellsFromInitialRestartData
+
 void LDataManager::beginNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_in)
 {
     IBTK_TIMER_START(t_begin_nonlocal_data_fill);
@@ -2800,11 +3866,14 @@ void LDataManager::beginNonlocalDataFill(const int coarsest_ln_in, const int fin
 
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
-        std::map<std::string, Pointer<LData> >& level_data = d_lag_mesh_data[level_number];
-        for (std::map<std::string, Pointer<LData> >::iterator it = level_data.begin(); it != level_data.end(); ++it)
+        std::vector<Pointer<LData> > level_data;
+        for (std::map<std::string, Pointer<LData> >::iterator it = d_lag_mesh_data[level_number].begin();
+             it != d_lag_mesh_data[level_number].end();
+             ++it)
         {
-            it->second->beginGhostUpdate();
+            level_data.push_back(it->second);
         }
+        beginGhostUpdate(level_data, level_number);
     }
 
     IBTK_TIMER_STOP(t_begin_nonlocal_data_fill);
@@ -2825,18 +3894,66 @@ void LDataManager::endNonlocalDataFill(const int coarsest_ln_in, const int fines
 
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
-        std::map<std::string, Pointer<LData> >& level_data = d_lag_mesh_data[level_number];
-        for (std::map<std::string, Pointer<LData> >::iterator it = level_data.begin(); it != level_data.end(); ++it)
+        std::vector<Pointer<LData> > level_data;
+        for (std::map<std::string, Pointer<LData> >::iterator it = d_lag_mesh_data[level_number].begin();
+             it != d_lag_mesh_data[level_number].end();
+             ++it)
         {
-            it->second->endGhostUpdate();
+            level_data.push_back(it->second);
         }
+        endGhostUpdate(level_data, level_number);
     }
 
     IBTK_TIMER_STOP(t_end_nonlocal_data_fill);
     return;
 } // endNonlocalDataFill
 
-void LDataManager::computeNodeDistribution(AO& ao,
+Vec LDataManager::getGhostUpdateVec(const int total_depth, const int level_number)
+{
+    if (level_number >= static_cast<int>(d_ghost_update_vecs.size()))
+    {
+        d_ghost_update_vecs.resize(level_number + 1);
+        d_ghost_update_vecs_revision.resize(level_number + 1, -1);
+    }
+    if (d_ghost_update_vecs_revision[level_number] != d_node_distribution_revision)
+    {
+        clearGhostUpdateVecs(level_number);
+        d_ghost_update_vecs_revision[level_number] = d_node_distribution_revision;
+    }
+    Vec& ghost_update_vec = d_ghost_update_vecs[level_number][total_depth];
+    if (!ghost_update_vec)
+    {
+        std::vector<int>& nonlocal_petsc_indices = d_nonlocal_petsc_indices[level_number];
+        const int ierr = VecCreateGhostBlock(PETSC_COMM_WORLD,
+                                             total_depth,
+                                             total_depth * getNumberOfLocalNodes(level_number),
+                                             PETSC_DECIDE,
+                                             static_cast<int>(nonlocal_petsc_indices.size()),
+                                             nonlocal_petsc_indices.empty() ? NULL : &nonlocal_petsc_indices[0],
+                                             &ghost_update_vec);
+        IBTK_CHKERRQ(ierr);
+    }
+    return ghost_update_vec;
+} // getGhostUpdateVec
+
+void LDataManager::clearGhostUpdateVecs(const int level_number)
+{
+    if (level_number >= static_cast<int>(d_ghost_update_vecs.size())) return;
+    for (std::map<int, Vec>::iterator it = d_ghost_update_vecs[level_number].begin();
+         it != d_ghost_update_vecs[level_number].end();
+         ++it)
+    {
+        if (it->second)
+        {
+            const int ierr = VecDestroy(&it->second);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    d_ghost_update_vecs[level_number].clear();
+    return;
+} // clearGhostUpdateVecs
+
+bool LDataManager::computeNodeDistribution(AO& ao,
                                            std::vector<int>& local_lag_indices,
                                            std::vector<int>& nonlocal_lag_indices,
                                            std::vector<int>& local_petsc_indices,
@@ -2851,10 +3968,26 @@ void LDataManager::computeNodeDistribution(AO& ao,
     TBOX_ASSERT(level_number >= d_coarsest_ln && level_number <= d_finest_ln);
 #endif
 
-    local_lag_indices.clear();
-    nonlocal_lag_indices.clear();
+    // Keep track of the previous distribution of nodes.  If no nodes change
+    // owner, the previous ordering is retained so that the PETSc ordering and
+    // the AO object need not be recomputed.
+    std::vector<int> old_local_lag_indices, old_nonlocal_lag_indices;
+    old_local_lag_indices.swap(local_lag_indices);
+    old_nonlocal_lag_indices.swap(nonlocal_lag_indices);
     local_petsc_indices.clear();
     nonlocal_petsc_indices.clear();
+    std::vector<std::pair<int, int> > old_local_order(old_local_lag_indices.size());
+    for (unsigned int k = 0; k < old_local_lag_indices.size(); ++k)
+    {
+        old_local_order[k] = std::make_pair(old_local_lag_indices[k], k);
+    }
+    std::sort(old_local_order.begin(), old_local_order.end());
+    std::vector<std::pair<int, int> > old_nonlocal_order(old_nonlocal_lag_indices.size());
+    for (unsigned int k = 0; k < old_nonlocal_lag_indices.size(); ++k)
+    {
+        old_nonlocal_order[k] = std::make_pair(old_nonlocal_lag_indices[k], k);
+    }
+    std::sort(old_nonlocal_order.begin(), old_nonlocal_order.end());
 
     // Determine the Lagrangian IDs of all of the Lagrangian nodes on the
     // specified level of the patch hierarchy.
@@ -2871,10 +4004,10 @@ void LDataManager::computeNodeDistribution(AO& ao,
     // Non-local nodes ONLY appear in ghost cells for on processor patches.
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
 
-    // Collect the local nodes and assign local indices to the local nodes.
-    unsigned int local_offset = 0;
-    std::map<int, int> lag_idx_to_petsc_idx;
-#if 1
+    // Collect the local nodes in patch order, and determine whether the set of
+    // local nodes has changed on any processor.
+    std::vector<LNode*> local_nodes;
+    std::vector<std::pair<int, LNode*> > retained_local_nodes;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         const Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -2884,63 +4017,105 @@ void LDataManager::computeNodeDistribution(AO& ao,
         {
             LNode* const node_idx = *it;
             const int lag_idx = node_idx->getLagrangianIndex();
-            local_lag_indices.push_back(lag_idx);
-            const int petsc_idx = local_offset++;
-            node_idx->setLocalPETScIndex(petsc_idx);
-            lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
+            local_nodes.push_back(node_idx);
+            std::vector<std::pair<int, int> >::const_iterator old_it = std::lower_bound(
+                old_local_order.begin(), old_local_order.end(), std::make_pair(lag_idx, -1));
+            if (old_it != old_local_order.end() && old_it->first == lag_idx)
+            {
+                retained_local_nodes.push_back(std::make_pair(old_it->second, node_idx));
+            }
         }
     }
-#else
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    const bool local_nodes_unchanged = local_nodes.size() == old_local_lag_indices.size() &&
+                                       retained_local_nodes.size() == local_nodes.size();
+    const int local_nodes_changed = local_nodes_unchanged ? 0 : 1;
+    const bool ordering_changed = !d_ao[level_number] || SAMRAI_MPI::maxReduction(local_nodes_changed) != 0;
+
+    // Assign local indices to the local nodes.  When the ordering changes, the
+    // nodes are ordered by patch, so that the data corresponding to each patch
+    // interior is stored contiguously.  Otherwise, the previous ordering is
+    // retained.
+    if (!ordering_changed)
     {
-        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-        for (Box<NDIM>::Iterator b(patch_box); b; b++)
+        std::sort(retained_local_nodes.begin(), retained_local_nodes.end());
+        for (unsigned int k = 0; k < retained_local_nodes.size(); ++k)
         {
-            const Index<NDIM>& i = b();
-            if (!idx_data->isElement(i)) continue;
-            const LNodeSet* const node_set = idx_data->getItem(i);
-            for (LNodeSet::const_iterator node_it = node_set->begin(); node_it != node_set->end(); ++node_it)
-            {
-                LNode* const node_idx = *node_it;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                local_lag_indices.push_back(lag_idx);
-                const int petsc_idx = local_offset++;
-                node_idx->setLocalPETScIndex(petsc_idx);
-                lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
-            }
+            local_nodes[k] = retained_local_nodes[k].second;
         }
     }
-#endif
+    unsigned int local_offset = 0;
+    std::map<int, int> lag_idx_to_petsc_idx;
+    local_lag_indices.reserve(local_nodes.size());
+    for (unsigned int k = 0; k < local_nodes.size(); ++k)
+    {
+        LNode* const node_idx = local_nodes[k];
+        const int lag_idx = node_idx->getLagrangianIndex();
+        local_lag_indices.push_back(lag_idx);
+        const int petsc_idx = local_offset++;
+        node_idx->setLocalPETScIndex(petsc_idx);
+        lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
+    }
 
-    // Determine the Lagrangian indices of the nonlocal nodes.
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    // Determine the Lagrangian indices of the nonlocal nodes.  When the
+    // ordering changes, these are ordered by first appearance in the patch
+    // ghost regions; otherwise, nodes that were already nonlocal retain their
+    // previous relative ordering, followed by new nonlocal nodes.
+    std::vector<std::pair<int, int> > retained_nonlocal_lag_indices;
+    std::vector<int> new_nonlocal_lag_indices;
+    for (int pass = 0; pass < 2; ++pass)
     {
-        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-        BoxList<NDIM> ghost_boxes = idx_data->getGhostBox();
-        ghost_boxes.removeIntersections(patch_box);
-        for (BoxList<NDIM>::Iterator bl(ghost_boxes); bl; bl++)
+        if (pass == 1)
         {
-            for (LNodeSetData::DataIterator it = idx_data->data_begin(bl()); it != idx_data->data_end(); ++it)
+            std::sort(retained_nonlocal_lag_indices.begin(), retained_nonlocal_lag_indices.end());
+            nonlocal_lag_indices.reserve(retained_nonlocal_lag_indices.size() + new_nonlocal_lag_indices.size());
+            for (unsigned int k = 0; k < retained_nonlocal_lag_indices.size(); ++k)
             {
-                LNode* const node_idx = *it;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                std::map<int, int>::const_iterator idx_it = lag_idx_to_petsc_idx.find(lag_idx);
-                if (idx_it == lag_idx_to_petsc_idx.end())
+                nonlocal_lag_indices.push_back(retained_nonlocal_lag_indices[k].second);
+            }
+            nonlocal_lag_indices.insert(
+                nonlocal_lag_indices.end(), new_nonlocal_lag_indices.begin(), new_nonlocal_lag_indices.end());
+            for (unsigned int k = 0; k < nonlocal_lag_indices.size(); ++k)
+            {
+                lag_idx_to_petsc_idx[nonlocal_lag_indices[k]] = local_offset++;
+            }
+        }
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            BoxList<NDIM> ghost_boxes = idx_data->getGhostBox();
+            ghost_boxes.removeIntersections(patch_box);
+            for (BoxList<NDIM>::Iterator bl(ghost_boxes); bl; bl++)
+            {
+                for (LNodeSetData::DataIterator it = idx_data->data_begin(bl()); it != idx_data->data_end(); ++it)
                 {
+                    LNode* const node_idx = *it;
+                    const int lag_idx = node_idx->getLagrangianIndex();
+                    if (pass == 1)
+                    {
+                        node_idx->setLocalPETScIndex(lag_idx_to_petsc_idx[lag_idx]);
+                        continue;
+                    }
+                    if (lag_idx_to_petsc_idx.find(lag_idx) != lag_idx_to_petsc_idx.end()) continue;
+
                     // This is the first time we have encountered this index; it
                     // must be a nonlocal index.
-                    nonlocal_lag_indices.push_back(lag_idx);
-                    const int petsc_idx = local_offset++;
-                    node_idx->setLocalPETScIndex(petsc_idx);
-                    lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
-                }
-                else
-                {
-                    node_idx->setLocalPETScIndex(idx_it->second);
+                    lag_idx_to_petsc_idx[lag_idx] = -1;
+                    std::vector<std::pair<int, int> >::const_iterator old_it = std::lower_bound(
+                        old_nonlocal_order.begin(), old_nonlocal_order.end(), std::make_pair(lag_idx, -1));
+                    if (ordering_changed)
+                    {
+                        new_nonlocal_lag_indices.push_back(lag_idx);
+                    }
+                    else if (old_it != old_nonlocal_order.end() && old_it->first == lag_idx)
+                    {
+                        retained_nonlocal_lag_indices.push_back(std::make_pair(old_it->second, lag_idx));
+                    }
+                    else
+                    {
+                        new_nonlocal_lag_indices.push_back(lag_idx);
+                    }
                 }
             }
         }
@@ -2963,14 +4138,12 @@ void LDataManager::computeNodeDistribution(AO& ao,
                    << "  num_nonlocal_nodes = " << num_nonlocal_nodes << "\n");
     }
 
-    computeNodeOffsets(num_nodes, node_offset, num_local_nodes);
-
-    // Determine the PETSc ordering and setup the new AO object.
-    const int num_proc_nodes = num_local_nodes + num_nonlocal_nodes;
-
-    std::vector<int> node_indices;
-    node_indices.reserve(num_proc_nodes);
-    node_indices.insert(node_indices.end(), local_lag_indices.begin(), local_lag_indices.end());
+    // The global PETSc ordering, and hence the AO object, needs to be
+    // recomputed only if the local nodes have changed on some processor.
+    if (ordering_changed)
+    {
+        computeNodeOffsets(num_nodes, node_offset, num_local_nodes);
+    }
 
     local_petsc_indices.resize(num_local_nodes);
     for (unsigned int k = 0; k < num_local_nodes; ++k)
@@ -2978,37 +4151,31 @@ void LDataManager::computeNodeDistribution(AO& ao,
         local_petsc_indices[k] = node_offset + k;
     }
 
-    if (ao)
+    if (ordering_changed)
     {
-        ierr = AODestroy(&ao);
+        if (ao)
+        {
+            ierr = AODestroy(&ao);
+            IBTK_CHKERRQ(ierr);
+        }
+
+        ierr = AOCreateMapping(PETSC_COMM_WORLD,
+                               num_local_nodes,
+                               num_local_nodes > 0 ? &local_lag_indices[0] : NULL,
+                               num_local_nodes > 0 ? &local_petsc_indices[0] : NULL,
+                               &ao);
         IBTK_CHKERRQ(ierr);
     }
 
-    ierr = AOCreateMapping(PETSC_COMM_WORLD,
-                           num_local_nodes,
-                           num_local_nodes > 0 ? &node_indices[0] : NULL,
-                           num_local_nodes > 0 ? &local_petsc_indices[0] : NULL,
-                           &ao);
+    // Determine the global PETSc indices of the ghost nodes.  The global PETSc
+    // indices of the local nodes are known without consulting the AO object.
+    nonlocal_petsc_indices = nonlocal_lag_indices;
+    ierr = AOApplicationToPetsc(
+        ordering_changed ? ao : d_ao[level_number],
+        (num_nonlocal_nodes > 0 ? static_cast<int>(num_nonlocal_nodes) : static_cast<int>(s_ao_dummy.size())),
+        (num_nonlocal_nodes > 0 ? &nonlocal_petsc_indices[0] : &s_ao_dummy[0]));
     IBTK_CHKERRQ(ierr);
 
-    // Determine the PETSc local to global mapping (including PETSc Vec ghost
-    // indices).
-    //
-    // NOTE: After this operation, data stored in node_indices are in the global
-    // PETSc ordering.
-    node_indices.reserve(node_indices.size() + nonlocal_lag_indices.size());
-    node_indices.insert(node_indices.end(), nonlocal_lag_indices.begin(), nonlocal_lag_indices.end());
-    ierr = AOApplicationToPetsc(ao,
-                                (num_proc_nodes > 0 ? num_proc_nodes : static_cast<int>(s_ao_dummy.size())),
-                                (num_proc_nodes > 0 ? &node_indices[0] : &s_ao_dummy[0]));
-    IBTK_CHKERRQ(ierr);
-
-    // Keep track of the global PETSc indices of the ghost nodes.
-    nonlocal_petsc_indices.clear();
-    nonlocal_petsc_indices.reserve(num_nonlocal_nodes);
-    nonlocal_petsc_indices.insert(
-        nonlocal_petsc_indices.end(), node_indices.begin() + num_local_nodes, node_indices.end());
-
     // Store the global PETSc index in the local LNode objects.
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
@@ -3018,12 +4185,15 @@ void LDataManager::computeNodeDistribution(AO& ao,
         for (LNodeSetData::DataIterator it = idx_data->data_begin(ghost_box); it != idx_data->data_end(); ++it)
         {
             LNode* const node_idx = *it;
-            node_idx->setGlobalPETScIndex(node_indices[node_idx->getLocalPETScIndex()]);
+            const unsigned int local_petsc_idx = node_idx->getLocalPETScIndex();
+            node_idx->setGlobalPETScIndex(local_petsc_idx < num_local_nodes ?
+                                              local_petsc_indices[local_petsc_idx] :
+                                              nonlocal_petsc_indices[local_petsc_idx - num_local_nodes]);
         }
     }
 
     IBTK_TIMER_STOP(t_compute_node_distribution);
-    return;
+    return ordering_changed;
 } // computeNodeDistribution
 
 void
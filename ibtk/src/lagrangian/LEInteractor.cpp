@@ -59,6 +59,7 @@
 #include "ibtk/LEInteractor.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LSet.h"
+#include "ibtk/PerformanceTrace.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Database.h"
@@ -2426,6 +2427,9 @@ void LEInteractor::interpolate(double* const Q_data,
     }
     if (local_indices.empty()) return;
     const int local_indices_size = static_cast<int>(local_indices.size());
+    static const int num_markers_counter =
+        PerformanceTrace::registerCounter("IBTK::LEInteractor::interpolate::markers");
+    PerformanceTrace::addToCounter(num_markers_counter, local_indices_size);
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
     if (interp_fcn == "PIECEWISE_CONSTANT")
@@ -2745,6 +2749,11 @@ void LEInteractor::spread(double* const q_data,
     }
     if (local_indices.empty()) return;
     const int local_indices_size = static_cast<int>(local_indices.size());
+    static const int num_markers_counter = PerformanceTrace::registerCounter("IBTK::LEInteractor::spread::markers");
+    static const int num_bytes_counter = PerformanceTrace::registerCounter("IBTK::LEInteractor::spread::bytes");
+    PerformanceTrace::addToCounter(num_markers_counter, local_indices_size);
+    PerformanceTrace::addToCounter(num_bytes_counter,
+                                   static_cast<double>(local_indices_size) * q_depth * sizeof(double));
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
     if (spread_fcn == "PIECEWISE_CONSTANT")
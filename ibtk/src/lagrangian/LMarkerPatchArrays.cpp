@@ -0,0 +1,252 @@
+// Filename: LMarkerPatchArrays.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include "Box.h"
+#include "CartesianPatchGeometry.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "ibtk/IndexUtilities.h"
+#include "ibtk/LMarker.h"
+#include "ibtk/LMarkerPatchArrays.h"
+#include "ibtk/LMarkerSet.h"
+#include "ibtk/LMarkerSetData.h"
+#include "ibtk/LSet.h"
+#include "ibtk/LSetData.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LMarkerPatchArrays::LMarkerPatchArrays() : d_marks(), d_idxs(), d_X(), d_U()
+{
+    // intentionally blank
+    return;
+} // LMarkerPatchArrays
+
+LMarkerPatchArrays::~LMarkerPatchArrays()
+{
+    // intentionally blank
+    return;
+} // ~LMarkerPatchArrays
+
+void LMarkerPatchArrays::collectMarkers(Pointer<LMarkerSetData> mark_data, const Box<NDIM>& box)
+{
+    // Determine the nonempty marker sets within the box, sorted by cell.
+    std::vector<std::pair<int, const LMarkerSet*> > mark_sets;
+    unsigned int num_marks = 0;
+    for (LMarkerSetData::SetIterator it(*mark_data); it; it++)
+    {
+        const Index<NDIM>& i = it.getIndex();
+        if (!box.contains(i)) continue;
+        const LMarkerSet& mark_set = it.getItem();
+        mark_sets.push_back(std::make_pair(box.offset(i), &mark_set));
+        num_marks += static_cast<unsigned int>(mark_set.size());
+    }
+    std::sort(mark_sets.begin(), mark_sets.end());
+
+    // Copy the marker data into contiguous arrays.
+    d_marks.resize(num_marks);
+    d_idxs.resize(num_marks);
+    d_X.resize(NDIM * num_marks);
+    d_U.resize(NDIM * num_marks);
+    unsigned int k = 0;
+    for (unsigned int n = 0; n < mark_sets.size(); ++n)
+    {
+        const LMarkerSet& mark_set = *mark_sets[n].second;
+        for (LMarkerSet::const_iterator cit = mark_set.begin(); cit != mark_set.end(); ++cit, ++k)
+        {
+            const LMarkerSet::value_type& mark = *cit;
+            d_marks[k] = mark;
+            d_idxs[k] = mark->getIndex();
+            const Point& X = mark->getPosition();
+            const Vector& U = mark->getVelocity();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_X[NDIM * k + d] = X[d];
+                d_U[NDIM * k + d] = U[d];
+            }
+        }
+    }
+    return;
+} // collectMarkers
+
+void LMarkerPatchArrays::resetMarkerPositions()
+{
+    const int num_marks = static_cast<int>(d_marks.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int k = 0; k < num_marks; ++k)
+    {
+        Point& X = d_marks[k]->getPosition();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X[d] = d_X[NDIM * k + d];
+        }
+    }
+    return;
+} // resetMarkerPositions
+
+void LMarkerPatchArrays::resetMarkerVelocities()
+{
+    const int num_marks = static_cast<int>(d_marks.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int k = 0; k < num_marks; ++k)
+    {
+        Vector& U = d_marks[k]->getVelocity();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            U[d] = d_U[NDIM * k + d];
+        }
+    }
+    return;
+} // resetMarkerVelocities
+
+unsigned int LMarkerPatchArrays::assignMarkersToCells(Pointer<LMarkerSetData> mark_data,
+                                                      Pointer<Patch<NDIM> > patch) const
+{
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+    const Index<NDIM>& patch_lower = patch_box.lower();
+    const Index<NDIM>& patch_upper = patch_box.upper();
+    const double* const patchXLower = patch_geom->getXLower();
+    const double* const patchXUpper = patch_geom->getXUpper();
+    const double* const patchDx = patch_geom->getDx();
+
+    // Determine the cells that contain the markers that are owned by the patch.
+    const int num_marks = static_cast<int>(d_marks.size());
+    std::vector<Index<NDIM> > mark_cells(num_marks);
+    std::vector<std::pair<int, int> > cell_offsets;
+    cell_offsets.reserve(num_marks);
+    for (int k = 0; k < num_marks; ++k)
+    {
+        const IntVector<NDIM>& offset = d_marks[k]->getPeriodicOffset();
+        Point X_shifted;
+        bool patch_owns_mark_at_loc = true;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X_shifted[d] = d_X[NDIM * k + d] + static_cast<double>(offset(d)) * patchDx[d];
+            patch_owns_mark_at_loc =
+                patch_owns_mark_at_loc && (patchXLower[d] <= X_shifted[d]) && (X_shifted[d] < patchXUpper[d]);
+        }
+        if (!patch_owns_mark_at_loc) continue;
+        mark_cells[k] =
+            IndexUtilities::getCellIndex(X_shifted, patchXLower, patchXUpper, patchDx, patch_lower, patch_upper);
+        cell_offsets.push_back(std::make_pair(patch_box.offset(mark_cells[k]), k));
+    }
+
+    // Sort the markers by cell (preserving their relative order within each
+    // cell) and insert each group of markers into the corresponding set.
+    std::sort(cell_offsets.begin(), cell_offsets.end());
+    const unsigned int num_assigned_marks = static_cast<unsigned int>(cell_offsets.size());
+    for (unsigned int begin = 0, end = 0; begin < num_assigned_marks; begin = end)
+    {
+        while (end < num_assigned_marks && cell_offsets[end].first == cell_offsets[begin].first) ++end;
+        const Index<NDIM>& i = mark_cells[cell_offsets[begin].second];
+        if (!mark_data->isElement(i))
+        {
+            mark_data->appendItemPointer(i, new LMarkerSet());
+        }
+        LMarkerSet::DataSet& mark_set = mark_data->getItem(i)->getDataSet();
+        mark_set.reserve(mark_set.size() + (end - begin));
+        for (unsigned int n = begin; n < end; ++n)
+        {
+            mark_set.push_back(d_marks[cell_offsets[n].second]);
+        }
+    }
+    return num_assigned_marks;
+} // assignMarkersToCells
+
+void LMarkerPatchArrays::writeData(std::ostream& os) const
+{
+    const int num_marks = static_cast<int>(d_marks.size());
+    os.write(reinterpret_cast<const char*>(&num_marks), sizeof(int));
+    if (num_marks == 0) return;
+    os.write(reinterpret_cast<const char*>(&d_idxs[0]), num_marks * sizeof(int));
+    os.write(reinterpret_cast<const char*>(&d_X[0]), NDIM * num_marks * sizeof(double));
+    os.write(reinterpret_cast<const char*>(&d_U[0]), NDIM * num_marks * sizeof(double));
+    return;
+} // writeData
+
+unsigned int LMarkerPatchArrays::getNumberOfMarkers() const
+{
+    return static_cast<unsigned int>(d_marks.size());
+} // getNumberOfMarkers
+
+const std::vector<int>& LMarkerPatchArrays::getIndices() const
+{
+    return d_idxs;
+} // getIndices
+
+std::vector<double>& LMarkerPatchArrays::getPositions()
+{
+    return d_X;
+} // getPositions
+
+const std::vector<double>& LMarkerPatchArrays::getPositions() const
+{
+    return d_X;
+} // getPositions
+
+std::vector<double>& LMarkerPatchArrays::getVelocities()
+{
+    return d_U;
+} // getVelocities
+
+const std::vector<double>& LMarkerPatchArrays::getVelocities() const
+{
+    return d_U;
+} // getVelocities
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
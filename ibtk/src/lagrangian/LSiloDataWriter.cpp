@@ -77,9 +77,8 @@ namespace IBTK
 
 namespace
 {
-// The rank of the root MPI process and the MPI tag number.
+// The rank of the root MPI process.
 static const int SILO_MPI_ROOT = 0;
-static const int SILO_MPI_TAG = 0;
 
 // The name of the Silo dumps and database filenames.
 static const int SILO_NAME_BUFSIZE = 128;
@@ -638,8 +637,9 @@ LSiloDataWriter::LSiloDataWriter(const std::string& object_name,
       d_ucd_mesh_edge_maps(d_finest_ln + 1), d_coords_data(d_finest_ln + 1, Pointer<LData>(NULL)),
       d_nvars(d_finest_ln + 1, 0), d_var_names(d_finest_ln + 1), d_var_start_depths(d_finest_ln + 1),
       d_var_plot_depths(d_finest_ln + 1), d_var_depths(d_finest_ln + 1), d_var_data(d_finest_ln + 1),
-      d_ao(d_finest_ln + 1), d_build_vec_scatters(d_finest_ln + 1), d_src_vec(d_finest_ln + 1),
-      d_dst_vec(d_finest_ln + 1), d_vec_scatter(d_finest_ln + 1)
+      d_ao(d_finest_ln + 1), d_build_vec_scatters(d_finest_ln + 1), d_src_is_idxs(d_finest_ln + 1),
+      d_packed_depth(d_finest_ln + 1, 0), d_src_vec(d_finest_ln + 1, NULL), d_dst_vec(d_finest_ln + 1, NULL),
+      d_vec_scatter(d_finest_ln + 1, NULL)
 {
 #if defined(IBTK_HAVE_SILO)
 // intentionally blank
@@ -668,27 +668,9 @@ LSiloDataWriter::~LSiloDataWriter()
     }
 
     // Destroy any remaining PETSc objects.
-    int ierr;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        for (std::map<int, Vec>::iterator it = d_dst_vec[ln].begin(); it != d_dst_vec[ln].end(); ++it)
-        {
-            Vec& v = it->second;
-            if (v)
-            {
-                ierr = VecDestroy(&v);
-                IBTK_CHKERRQ(ierr);
-            }
-        }
-        for (std::map<int, VecScatter>::iterator it = d_vec_scatter[ln].begin(); it != d_vec_scatter[ln].end(); ++it)
-        {
-            VecScatter& vs = it->second;
-            if (vs)
-            {
-                ierr = VecScatterDestroy(&vs);
-                IBTK_CHKERRQ(ierr);
-            }
-        }
+        destroyVecScatters(ln);
     }
     return;
 } // ~LSiloDataWriter
@@ -714,49 +696,14 @@ void LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
     }
 #endif
     // Destroy any unneeded PETSc objects.
-    int ierr;
     for (int ln = std::max(d_coarsest_ln, 0); (ln <= d_finest_ln) && (ln < coarsest_ln); ++ln)
     {
-        for (std::map<int, Vec>::iterator it = d_dst_vec[ln].begin(); it != d_dst_vec[ln].end(); ++it)
-        {
-            Vec& v = it->second;
-            if (v)
-            {
-                ierr = VecDestroy(&v);
-                IBTK_CHKERRQ(ierr);
-            }
-        }
-        for (std::map<int, VecScatter>::iterator it = d_vec_scatter[ln].begin(); it != d_vec_scatter[ln].end(); ++it)
-        {
-            VecScatter& vs = it->second;
-            if (vs)
-            {
-                ierr = VecScatterDestroy(&vs);
-                IBTK_CHKERRQ(ierr);
-            }
-        }
+        destroyVecScatters(ln);
     }
 
     for (int ln = finest_ln + 1; ln <= d_finest_ln; ++ln)
     {
-        for (std::map<int, Vec>::iterator it = d_dst_vec[ln].begin(); it != d_dst_vec[ln].end(); ++it)
-        {
-            Vec& v = it->second;
-            if (v)
-            {
-                ierr = VecDestroy(&v);
-                IBTK_CHKERRQ(ierr);
-            }
-        }
-        for (std::map<int, VecScatter>::iterator it = d_vec_scatter[ln].begin(); it != d_vec_scatter[ln].end(); ++it)
-        {
-            VecScatter& vs = it->second;
-            if (vs)
-            {
-                ierr = VecScatterDestroy(&vs);
-                IBTK_CHKERRQ(ierr);
-            }
-        }
+        destroyVecScatters(ln);
     }
 
     // Reset the level numbers.
@@ -797,9 +744,11 @@ void LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
 
     d_ao.resize(d_finest_ln + 1);
     d_build_vec_scatters.resize(d_finest_ln + 1);
-    d_src_vec.resize(d_finest_ln + 1);
-    d_dst_vec.resize(d_finest_ln + 1);
-    d_vec_scatter.resize(d_finest_ln + 1);
+    d_src_is_idxs.resize(d_finest_ln + 1);
+    d_packed_depth.resize(d_finest_ln + 1, 0);
+    d_src_vec.resize(d_finest_ln + 1, NULL);
+    d_dst_vec.resize(d_finest_ln + 1, NULL);
+    d_vec_scatter.resize(d_finest_ln + 1, NULL);
     return;
 } // resetLevels
 
@@ -1189,10 +1138,13 @@ void LSiloDataWriter::writePlotData(const int time_step_number, const double sim
     const int mpi_rank = SAMRAI_MPI::getRank();
     const int mpi_nodes = SAMRAI_MPI::getNodes();
 
-    // Construct the VecScatter objects required to write the plot data.
+    // Construct the VecScatter objects required to write the plot data.  The
+    // objects are rebuilt only if the AO has changed or if variables have been
+    // registered since they were last built.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        if (d_build_vec_scatters[ln])
+        if (!d_coords_data[ln]) continue;
+        if (d_build_vec_scatters[ln] || d_packed_depth[ln] != getPackedDepth(ln))
         {
             buildVecScatters(d_ao[ln], ln);
         }
@@ -1226,45 +1178,70 @@ void LSiloDataWriter::writePlotData(const int time_step_number, const double sim
     {
         if (d_coords_data[ln])
         {
-            // Scatter the data from "global" to "local" form.
-            Vec local_X_vec;
-            ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
+            // Pack the coordinate and variable data into a single vector and
+            // scatter the packed data from "global" to "local" form.
+            const int packed_depth = d_packed_depth[ln];
+            const int num_local_nodes = static_cast<int>(d_coords_data[ln]->getLocalNodeCount());
+            double* src_arr;
+            ierr = VecGetArray(d_src_vec[ln], &src_arr);
             IBTK_CHKERRQ(ierr);
-
-            Vec global_X_vec = d_coords_data[ln]->getVec();
-            ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+            int packed_offset = 0;
+            for (int k = -1; k < d_nvars[ln]; ++k)
+            {
+                Pointer<LData> data = (k == -1 ? d_coords_data[ln] : d_var_data[ln][k]);
+                const int depth = (k == -1 ? NDIM : d_var_depths[ln][k]);
+                const double* data_arr;
+                ierr = VecGetArrayRead(data->getVec(), &data_arr);
+                IBTK_CHKERRQ(ierr);
+                for (int i = 0; i < num_local_nodes; ++i)
+                {
+                    for (int d = 0; d < depth; ++d)
+                    {
+                        src_arr[i * packed_depth + packed_offset + d] = data_arr[i * depth + d];
+                    }
+                }
+                ierr = VecRestoreArrayRead(data->getVec(), &data_arr);
+                IBTK_CHKERRQ(ierr);
+                packed_offset += depth;
+            }
+            ierr = VecRestoreArray(d_src_vec[ln], &src_arr);
             IBTK_CHKERRQ(ierr);
-            ierr = VecScatterEnd(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+            ierr = VecScatterBegin(d_vec_scatter[ln], d_src_vec[ln], d_dst_vec[ln], INSERT_VALUES, SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
-
-            double* local_X_arr;
-            ierr = VecGetArray(local_X_vec, &local_X_arr);
+            ierr = VecScatterEnd(d_vec_scatter[ln], d_src_vec[ln], d_dst_vec[ln], INSERT_VALUES, SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
 
-            std::vector<Vec> local_v_vecs;
-            std::vector<double*> local_v_arrs;
+            // Unpack the local data so that the values of each quantity are
+            // stored contiguously.
+            const int num_plot_nodes = static_cast<int>(d_src_is_idxs[ln].size());
+            std::vector<double> local_X;
+            std::vector<std::vector<double> > local_v(d_nvars[ln]);
+            const double* dst_arr;
+            ierr = VecGetArrayRead(d_dst_vec[ln], &dst_arr);
+            IBTK_CHKERRQ(ierr);
+            packed_offset = 0;
+            for (int k = -1; k < d_nvars[ln]; ++k)
+            {
+                std::vector<double>& vals = (k == -1 ? local_X : local_v[k]);
+                const int depth = (k == -1 ? NDIM : d_var_depths[ln][k]);
+                vals.resize(depth * num_plot_nodes);
+                for (int i = 0; i < num_plot_nodes; ++i)
+                {
+                    for (int d = 0; d < depth; ++d)
+                    {
+                        vals[i * depth + d] = dst_arr[i * packed_depth + packed_offset + d];
+                    }
+                }
+                packed_offset += depth;
+            }
+            ierr = VecRestoreArrayRead(d_dst_vec[ln], &dst_arr);
+            IBTK_CHKERRQ(ierr);
 
+            const double* const local_X_arr = local_X.empty() ? NULL : &local_X[0];
+            std::vector<const double*> local_v_arrs(d_nvars[ln]);
             for (int v = 0; v < d_nvars[ln]; ++v)
             {
-                const int var_depth = d_var_depths[ln][v];
-                Vec local_v_vec;
-                ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vec);
-                IBTK_CHKERRQ(ierr);
-
-                Vec global_v_vec = d_var_data[ln][v]->getVec();
-                ierr = VecScatterBegin(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecScatterEnd(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-
-                double* local_v_arr;
-                ierr = VecGetArray(local_v_vec, &local_v_arr);
-                IBTK_CHKERRQ(ierr);
-
-                local_v_vecs.push_back(local_v_vec);
-                local_v_arrs.push_back(local_v_arr);
+                local_v_arrs[v] = local_v[v].empty() ? NULL : &local_v[v][0];
             }
 
             // Keep track of the current offset in the local Vec data.
@@ -1439,280 +1416,169 @@ void LSiloDataWriter::writePlotData(const int time_step_number, const double sim
 
                 offset += ntot;
             }
-
-            // Clean up allocated data.
-            ierr = VecRestoreArray(local_X_vec, &local_X_arr);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecDestroy(&local_X_vec);
-            IBTK_CHKERRQ(ierr);
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                ierr = VecRestoreArray(local_v_vecs[v], &local_v_arrs[v]);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecDestroy(&local_v_vecs[v]);
-                IBTK_CHKERRQ(ierr);
-            }
         }
     }
 
     DBClose(dbfile);
 
-    // Send data to the root MPI process required to create the multimesh and
-    // multivar objects.
-    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
-    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
-    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
-    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
-        ucd_mesh_names_per_proc;
-
-    if (mpi_rank == SILO_MPI_ROOT)
-    {
-        nclouds_per_proc.resize(d_finest_ln + 1);
-        nblocks_per_proc.resize(d_finest_ln + 1);
-        nmbs_per_proc.resize(d_finest_ln + 1);
-        nucd_meshes_per_proc.resize(d_finest_ln + 1);
-        meshtypes_per_proc.resize(d_finest_ln + 1);
-        vartypes_per_proc.resize(d_finest_ln + 1);
-        mb_nblocks_per_proc.resize(d_finest_ln + 1);
-        multimeshtypes_per_proc.resize(d_finest_ln + 1);
-        multivartypes_per_proc.resize(d_finest_ln + 1);
-        cloud_names_per_proc.resize(d_finest_ln + 1);
-        block_names_per_proc.resize(d_finest_ln + 1);
-        mb_names_per_proc.resize(d_finest_ln + 1);
-        ucd_mesh_names_per_proc.resize(d_finest_ln + 1);
-    }
-
+    // Gather the data required to create the multimesh and multivar objects on
+    // the root MPI process.  The metadata for all levels are packed into a
+    // compact integer table and a buffer of null-terminated names on each
+    // process, and the tables are gathered via a fixed number of collective
+    // operations, independent of the number of processes and meshes.
+    std::vector<int> local_table;
+    std::string local_names;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        if (mpi_rank == SILO_MPI_ROOT)
+        local_table.push_back(d_nclouds[ln]);
+        for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
         {
-            nclouds_per_proc[ln].resize(mpi_nodes);
-            nblocks_per_proc[ln].resize(mpi_nodes);
-            nmbs_per_proc[ln].resize(mpi_nodes);
-            nucd_meshes_per_proc[ln].resize(mpi_nodes);
-            meshtypes_per_proc[ln].resize(mpi_nodes);
-            vartypes_per_proc[ln].resize(mpi_nodes);
-            mb_nblocks_per_proc[ln].resize(mpi_nodes);
-            multimeshtypes_per_proc[ln].resize(mpi_nodes);
-            multivartypes_per_proc[ln].resize(mpi_nodes);
-            cloud_names_per_proc[ln].resize(mpi_nodes);
-            block_names_per_proc[ln].resize(mpi_nodes);
-            mb_names_per_proc[ln].resize(mpi_nodes);
-            ucd_mesh_names_per_proc[ln].resize(mpi_nodes);
+            local_names.append(d_cloud_names[ln][cloud].c_str(), d_cloud_names[ln][cloud].size() + 1);
         }
 
-        // Set the values for the root process.
-        if (mpi_rank == SILO_MPI_ROOT)
+        local_table.push_back(d_nblocks[ln]);
+        for (int block = 0; block < d_nblocks[ln]; ++block)
         {
-            nclouds_per_proc[ln][mpi_rank] = d_nclouds[ln];
-            nblocks_per_proc[ln][mpi_rank] = d_nblocks[ln];
-            nmbs_per_proc[ln][mpi_rank] = d_nmbs[ln];
-            nucd_meshes_per_proc[ln][mpi_rank] = d_nucd_meshes[ln];
-            meshtypes_per_proc[ln][mpi_rank] = meshtype[ln];
-            vartypes_per_proc[ln][mpi_rank] = vartype[ln];
-            mb_nblocks_per_proc[ln][mpi_rank] = d_mb_nblocks[ln];
-            multimeshtypes_per_proc[ln][mpi_rank] = multimeshtype[ln];
-            multivartypes_per_proc[ln][mpi_rank] = multivartype[ln];
-            cloud_names_per_proc[ln][mpi_rank] = d_cloud_names[ln];
-            block_names_per_proc[ln][mpi_rank] = d_block_names[ln];
-            mb_names_per_proc[ln][mpi_rank] = d_mb_names[ln];
-            ucd_mesh_names_per_proc[ln][mpi_rank] = d_ucd_mesh_names[ln];
+            const bool have_type = block < static_cast<int>(meshtype[ln].size());
+            local_table.push_back(have_type ? meshtype[ln][block] : static_cast<int>(DB_QUAD_CURV));
+            local_table.push_back(have_type ? vartype[ln][block] : static_cast<int>(DB_QUADVAR));
+            local_names.append(d_block_names[ln][block].c_str(), d_block_names[ln][block].size() + 1);
         }
 
-        // Get the values for the non-root processes.
-        int one = 1;
-        for (int proc = 0; proc < mpi_nodes; ++proc)
+        local_table.push_back(d_nmbs[ln]);
+        for (int mb = 0; mb < d_nmbs[ln]; ++mb)
         {
-            // Skip the root process; we already have those values.
-            if (proc == SILO_MPI_ROOT)
+            local_table.push_back(d_mb_nblocks[ln][mb]);
+            for (int block = 0; block < d_mb_nblocks[ln][mb]; ++block)
             {
-                proc += 1;
-                if (proc >= mpi_nodes) break;
+                const bool have_type = mb < static_cast<int>(multimeshtype[ln].size()) &&
+                                       block < static_cast<int>(multimeshtype[ln][mb].size());
+                local_table.push_back(have_type ? multimeshtype[ln][mb][block] : static_cast<int>(DB_QUAD_CURV));
+                local_table.push_back(have_type ? multivartype[ln][mb][block] : static_cast<int>(DB_QUADVAR));
             }
+            local_names.append(d_mb_names[ln][mb].c_str(), d_mb_names[ln][mb].size() + 1);
+        }
 
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nclouds[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nclouds_per_proc[ln][proc], one, proc, false);
-            }
+        local_table.push_back(d_nucd_meshes[ln]);
+        for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+        {
+            local_names.append(d_ucd_mesh_names[ln][mesh].c_str(), d_ucd_mesh_names[ln][mesh].size() + 1);
+        }
+    }
 
-            if (mpi_rank == proc && d_nclouds[ln] > 0)
-            {
-                int num_bytes;
-                for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
-                {
-                    num_bytes = static_cast<int>((d_cloud_names[ln][cloud].size() + 1) * sizeof(char));
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::sendBytes(
-                        static_cast<const void*>(d_cloud_names[ln][cloud].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nclouds_per_proc[ln][proc] > 0)
-            {
-                cloud_names_per_proc[ln][proc].resize(nclouds_per_proc[ln][proc]);
+    int local_sizes[2] = { static_cast<int>(local_table.size()), static_cast<int>(local_names.size()) };
+    std::vector<int> sizes(mpi_rank == SILO_MPI_ROOT ? 2 * mpi_nodes : 2, 0);
+    MPI_Gather(local_sizes, 2, MPI_INT, &sizes[0], 2, MPI_INT, SILO_MPI_ROOT, SAMRAI_MPI::commWorld);
 
-                int num_bytes;
-                char* name;
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                {
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    name = new char[num_bytes / sizeof(char)];
-                    SAMRAI_MPI::recvBytes(static_cast<void*>(name), num_bytes);
-                    cloud_names_per_proc[ln][proc][cloud].assign(name);
-                    delete[] name;
-                }
-            }
+    std::vector<int> table_counts, table_displs, names_counts, names_displs;
+    int table_size = 0, names_size = 0;
+    if (mpi_rank == SILO_MPI_ROOT)
+    {
+        table_counts.resize(mpi_nodes);
+        table_displs.resize(mpi_nodes);
+        names_counts.resize(mpi_nodes);
+        names_displs.resize(mpi_nodes);
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            table_counts[proc] = sizes[2 * proc];
+            table_displs[proc] = table_size;
+            table_size += table_counts[proc];
+            names_counts[proc] = sizes[2 * proc + 1];
+            names_displs[proc] = names_size;
+            names_size += names_counts[proc];
+        }
+    }
+    std::vector<int> table(std::max(table_size, 1));
+    std::vector<char> names(std::max(names_size, 1));
+    local_table.push_back(0);
+    local_names.push_back('\0');
+    MPI_Gatherv(&local_table[0],
+                local_sizes[0],
+                MPI_INT,
+                &table[0],
+                mpi_rank == SILO_MPI_ROOT ? &table_counts[0] : NULL,
+                mpi_rank == SILO_MPI_ROOT ? &table_displs[0] : NULL,
+                MPI_INT,
+                SILO_MPI_ROOT,
+                SAMRAI_MPI::commWorld);
+    MPI_Gatherv(const_cast<char*>(local_names.data()),
+                local_sizes[1],
+                MPI_CHAR,
+                &names[0],
+                mpi_rank == SILO_MPI_ROOT ? &names_counts[0] : NULL,
+                mpi_rank == SILO_MPI_ROOT ? &names_displs[0] : NULL,
+                MPI_CHAR,
+                SILO_MPI_ROOT,
+                SAMRAI_MPI::commWorld);
+
+    // Unpack the gathered metadata on the root MPI process.
+    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
+    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
+    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
+    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
+        ucd_mesh_names_per_proc;
 
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nblocks[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nblocks_per_proc[ln][proc], one, proc, false);
-            }
+    if (mpi_rank == SILO_MPI_ROOT)
+    {
+        nclouds_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes, 0));
+        nblocks_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes, 0));
+        nmbs_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes, 0));
+        nucd_meshes_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes, 0));
+        meshtypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<int> >(mpi_nodes));
+        vartypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<int> >(mpi_nodes));
+        mb_nblocks_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<int> >(mpi_nodes));
+        multimeshtypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::vector<int> > >(mpi_nodes));
+        multivartypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::vector<int> > >(mpi_nodes));
+        cloud_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
+        block_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
+        mb_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
+        ucd_mesh_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
 
-            if (mpi_rank == proc && d_nblocks[ln] > 0)
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            const int* t = &table[table_displs[proc]];
+            const char* n = &names[names_displs[proc]];
+            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
             {
-                SAMRAI_MPI::send(&meshtype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
-                SAMRAI_MPI::send(&vartype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
-
-                int num_bytes;
-                for (int block = 0; block < d_nblocks[ln]; ++block)
+                nclouds_per_proc[ln][proc] = *t++;
+                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
                 {
-                    num_bytes = static_cast<int>((d_block_names[ln][block].size() + 1) * sizeof(char));
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::sendBytes(
-                        static_cast<const void*>(d_block_names[ln][block].c_str()), num_bytes, SILO_MPI_ROOT);
+                    cloud_names_per_proc[ln][proc].push_back(n);
+                    n += cloud_names_per_proc[ln][proc].back().size() + 1;
                 }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nblocks_per_proc[ln][proc] > 0)
-            {
-                meshtypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                vartypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                block_names_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
 
-                SAMRAI_MPI::recv(&meshtypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
-                SAMRAI_MPI::recv(&vartypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
-
-                int num_bytes;
-                char* name;
+                nblocks_per_proc[ln][proc] = *t++;
                 for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
                 {
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    name = new char[num_bytes / sizeof(char)];
-                    SAMRAI_MPI::recvBytes(static_cast<void*>(name), num_bytes);
-                    block_names_per_proc[ln][proc][block].assign(name);
-                    delete[] name;
+                    meshtypes_per_proc[ln][proc].push_back(*t++);
+                    vartypes_per_proc[ln][proc].push_back(*t++);
+                    block_names_per_proc[ln][proc].push_back(n);
+                    n += block_names_per_proc[ln][proc].back().size() + 1;
                 }
-            }
 
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nmbs[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nmbs_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nmbs[ln] > 0)
-            {
-                SAMRAI_MPI::send(&d_mb_nblocks[ln][0], d_nmbs[ln], SILO_MPI_ROOT, false);
-
-                int num_bytes;
-                for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-                {
-                    SAMRAI_MPI::send(&multimeshtype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::send(&multivartype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-
-                    num_bytes = static_cast<int>(d_mb_names[ln][mb].size()) + 1;
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-
-                    const void* mb_name_ptr = d_mb_names[ln][mb].c_str();
-                    MPI_Send(const_cast<void*>(mb_name_ptr),
-                             num_bytes,
-                             MPI_CHAR,
-                             SILO_MPI_ROOT,
-                             SILO_MPI_TAG,
-                             SAMRAI_MPI::commWorld);
-                    const int tree = SAMRAI_MPI::getTreeDepth();
-                    SAMRAI_MPI::updateOutgoingStatistics(tree, num_bytes * sizeof(char));
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nmbs_per_proc[ln][proc] > 0)
-            {
+                nmbs_per_proc[ln][proc] = *t++;
                 mb_nblocks_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
                 multimeshtypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
                 multivartypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                mb_names_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-
-                SAMRAI_MPI::recv(&mb_nblocks_per_proc[ln][proc][0], nmbs_per_proc[ln][proc], proc, false);
-
-                int num_bytes;
-                char* name;
                 for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
                 {
-                    multimeshtypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
-                    multivartypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
-
-                    SAMRAI_MPI::recv(
-                        &multimeshtypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
-                    SAMRAI_MPI::recv(
-                        &multivartypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
-
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    name = new char[num_bytes];
-
-                    MPI_Status status;
-                    MPI_Recv(name, num_bytes, MPI_CHAR, proc, SILO_MPI_TAG, SAMRAI_MPI::commWorld, &status);
-                    const int tree = SAMRAI_MPI::getTreeDepth();
-                    SAMRAI_MPI::updateIncomingStatistics(tree, num_bytes * sizeof(char));
-
-                    mb_names_per_proc[ln][proc][mb].assign(name);
-                    delete[] name;
+                    mb_nblocks_per_proc[ln][proc][mb] = *t++;
+                    for (int block = 0; block < mb_nblocks_per_proc[ln][proc][mb]; ++block)
+                    {
+                        multimeshtypes_per_proc[ln][proc][mb].push_back(*t++);
+                        multivartypes_per_proc[ln][proc][mb].push_back(*t++);
+                    }
+                    mb_names_per_proc[ln][proc].push_back(n);
+                    n += mb_names_per_proc[ln][proc].back().size() + 1;
                 }
-            }
 
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nucd_meshes[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nucd_meshes_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nucd_meshes[ln] > 0)
-            {
-                int num_bytes;
-                for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
-                {
-                    num_bytes = static_cast<int>((d_ucd_mesh_names[ln][mesh].size() + 1) * sizeof(char));
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::sendBytes(
-                        static_cast<const void*>(d_ucd_mesh_names[ln][mesh].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nucd_meshes_per_proc[ln][proc] > 0)
-            {
-                ucd_mesh_names_per_proc[ln][proc].resize(nucd_meshes_per_proc[ln][proc]);
-                int num_bytes;
-                char* name;
+                nucd_meshes_per_proc[ln][proc] = *t++;
                 for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
                 {
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    name = new char[num_bytes / sizeof(char)];
-                    SAMRAI_MPI::recvBytes(static_cast<void*>(name), num_bytes);
-                    ucd_mesh_names_per_proc[ln][proc][mesh].assign(name);
-                    delete[] name;
+                    ucd_mesh_names_per_proc[ln][proc].push_back(n);
+                    n += ucd_mesh_names_per_proc[ln][proc].back().size() + 1;
                 }
             }
-
-            SAMRAI_MPI::barrier();
         }
     }
 
@@ -2166,40 +2032,29 @@ void LSiloDataWriter::buildVecScatters(AO& ao, const int level_number)
 
     // Setup the IS data used to generate the VecScatters that redistribute the
     // distributed data into local marker clouds, local logically Cartesian
-    // blocks, and local UCD meshes.
-    std::vector<int> ref_is_idxs;
-    for (int cloud = 0; cloud < d_nclouds[level_number]; ++cloud)
+    // blocks, and local UCD meshes.  These indices only change when the AO
+    // changes.
+    std::vector<int>& ref_is_idxs = d_src_is_idxs[level_number];
+    if (d_build_vec_scatters[level_number])
     {
-        const int nmarks = d_cloud_nmarks[level_number][cloud];
-        const int first_lag_idx = d_cloud_first_lag_idx[level_number][cloud];
-        ref_is_idxs.reserve(ref_is_idxs.size() + nmarks);
-
-        for (int idx = first_lag_idx; idx < first_lag_idx + nmarks; ++idx)
+        ref_is_idxs.clear();
+        for (int cloud = 0; cloud < d_nclouds[level_number]; ++cloud)
         {
-            ref_is_idxs.push_back(idx);
-        }
-    }
+            const int nmarks = d_cloud_nmarks[level_number][cloud];
+            const int first_lag_idx = d_cloud_first_lag_idx[level_number][cloud];
+            ref_is_idxs.reserve(ref_is_idxs.size() + nmarks);
 
-    for (int block = 0; block < d_nblocks[level_number]; ++block)
-    {
-        const IntVector<NDIM>& nelem = d_block_nelems[level_number][block];
-        const int ntot = nelem.getProduct();
-        const int first_lag_idx = d_block_first_lag_idx[level_number][block];
-        ref_is_idxs.reserve(ref_is_idxs.size() + ntot);
-
-        for (int idx = first_lag_idx; idx < first_lag_idx + ntot; ++idx)
-        {
-            ref_is_idxs.push_back(idx);
+            for (int idx = first_lag_idx; idx < first_lag_idx + nmarks; ++idx)
+            {
+                ref_is_idxs.push_back(idx);
+            }
         }
-    }
 
-    for (int mb = 0; mb < d_nmbs[level_number]; ++mb)
-    {
-        for (int block = 0; block < d_mb_nblocks[level_number][mb]; ++block)
+        for (int block = 0; block < d_nblocks[level_number]; ++block)
         {
-            const IntVector<NDIM>& nelem = d_mb_nelems[level_number][mb][block];
+            const IntVector<NDIM>& nelem = d_block_nelems[level_number][block];
             const int ntot = nelem.getProduct();
-            const int first_lag_idx = d_mb_first_lag_idx[level_number][mb][block];
+            const int first_lag_idx = d_block_first_lag_idx[level_number][block];
             ref_is_idxs.reserve(ref_is_idxs.size() + ntot);
 
             for (int idx = first_lag_idx; idx < first_lag_idx + ntot; ++idx)
@@ -2207,77 +2062,100 @@ void LSiloDataWriter::buildVecScatters(AO& ao, const int level_number)
                 ref_is_idxs.push_back(idx);
             }
         }
-    }
-
-    for (int mesh = 0; mesh < d_nucd_meshes[level_number]; ++mesh)
-    {
-        ref_is_idxs.insert(ref_is_idxs.end(),
-                           d_ucd_mesh_vertices[level_number][mesh].begin(),
-                           d_ucd_mesh_vertices[level_number][mesh].end());
-    }
-
-    // Map Lagrangian indices to PETSc indices.
-    std::vector<int> ao_dummy(1, -1);
-    ierr = AOApplicationToPetsc(
-        ao,
-        (!ref_is_idxs.empty() ? static_cast<int>(ref_is_idxs.size()) : static_cast<int>(ao_dummy.size())),
-        (!ref_is_idxs.empty() ? &ref_is_idxs[0] : &ao_dummy[0]));
-    IBTK_CHKERRQ(ierr);
 
-    // Setup IS indices for all necessary data depths.
-    std::map<int, std::vector<int> > src_is_idxs;
+        for (int mb = 0; mb < d_nmbs[level_number]; ++mb)
+        {
+            for (int block = 0; block < d_mb_nblocks[level_number][mb]; ++block)
+            {
+                const IntVector<NDIM>& nelem = d_mb_nelems[level_number][mb][block];
+                const int ntot = nelem.getProduct();
+                const int first_lag_idx = d_mb_first_lag_idx[level_number][mb][block];
+                ref_is_idxs.reserve(ref_is_idxs.size() + ntot);
 
-    src_is_idxs[NDIM] = ref_is_idxs;
-    d_src_vec[level_number][NDIM] = d_coords_data[level_number]->getVec();
+                for (int idx = first_lag_idx; idx < first_lag_idx + ntot; ++idx)
+                {
+                    ref_is_idxs.push_back(idx);
+                }
+            }
+        }
 
-    for (int v = 0; v < d_nvars[level_number]; ++v)
-    {
-        const int var_depth = d_var_depths[level_number][v];
-        if (src_is_idxs.find(var_depth) == src_is_idxs.end())
+        for (int mesh = 0; mesh < d_nucd_meshes[level_number]; ++mesh)
         {
-            src_is_idxs[var_depth] = ref_is_idxs;
-            d_src_vec[level_number][var_depth] = d_var_data[level_number][v]->getVec();
+            ref_is_idxs.insert(ref_is_idxs.end(),
+                               d_ucd_mesh_vertices[level_number][mesh].begin(),
+                               d_ucd_mesh_vertices[level_number][mesh].end());
         }
+
+        // Map Lagrangian indices to PETSc indices.
+        std::vector<int> ao_dummy(1, -1);
+        ierr = AOApplicationToPetsc(
+            ao,
+            (!ref_is_idxs.empty() ? static_cast<int>(ref_is_idxs.size()) : static_cast<int>(ao_dummy.size())),
+            (!ref_is_idxs.empty() ? &ref_is_idxs[0] : &ao_dummy[0]));
+        IBTK_CHKERRQ(ierr);
     }
 
-    // Create the VecScatters to scatter data from the global PETSc Vec to
-    // contiguous local subgrids.  VecScatter objects are individually created
-    // for data depths as necessary.
-    for (std::map<int, std::vector<int> >::iterator it = src_is_idxs.begin(); it != src_is_idxs.end(); ++it)
-    {
-        const int depth = it->first;
-        const std::vector<int>& idxs = it->second;
-        const int idxs_sz = static_cast<int>(idxs.size());
+    // Create the VecScatter to scatter the packed coordinate and variable data
+    // from the global PETSc Vec to contiguous local subgrids.
+    destroyVecScatters(level_number);
+    const int depth = getPackedDepth(level_number);
+    const int num_local_nodes = static_cast<int>(d_coords_data[level_number]->getLocalNodeCount());
+    const int idxs_sz = static_cast<int>(ref_is_idxs.size());
+    d_packed_depth[level_number] = depth;
 
-        IS src_is;
-        ierr = ISCreateBlock(
-            PETSC_COMM_WORLD, depth, idxs_sz, (idxs.empty() ? NULL : &idxs[0]), PETSC_COPY_VALUES, &src_is);
-        IBTK_CHKERRQ(ierr);
+    IS src_is;
+    ierr = ISCreateBlock(
+        PETSC_COMM_WORLD, depth, idxs_sz, (ref_is_idxs.empty() ? NULL : &ref_is_idxs[0]), PETSC_COPY_VALUES, &src_is);
+    IBTK_CHKERRQ(ierr);
 
-        Vec& src_vec = d_src_vec[level_number][depth];
-        Vec& dst_vec = d_dst_vec[level_number][depth];
-        if (dst_vec)
-        {
-            ierr = VecDestroy(&dst_vec);
-            IBTK_CHKERRQ(ierr);
-        }
-        ierr = VecCreateMPI(PETSC_COMM_WORLD, depth * idxs_sz, PETSC_DETERMINE, &dst_vec);
-        IBTK_CHKERRQ(ierr);
+    Vec& src_vec = d_src_vec[level_number];
+    ierr = VecCreateMPI(PETSC_COMM_WORLD, depth * num_local_nodes, PETSC_DETERMINE, &src_vec);
+    IBTK_CHKERRQ(ierr);
 
-        VecScatter& vec_scatter = d_vec_scatter[level_number][depth];
-        if (vec_scatter)
-        {
-            ierr = VecScatterDestroy(&vec_scatter);
-            IBTK_CHKERRQ(ierr);
-        }
-        ierr = VecScatterCreate(src_vec, src_is, dst_vec, NULL, &vec_scatter);
-        IBTK_CHKERRQ(ierr);
+    Vec& dst_vec = d_dst_vec[level_number];
+    ierr = VecCreateMPI(PETSC_COMM_WORLD, depth * idxs_sz, PETSC_DETERMINE, &dst_vec);
+    IBTK_CHKERRQ(ierr);
+
+    VecScatter& vec_scatter = d_vec_scatter[level_number];
+    ierr = VecScatterCreate(src_vec, src_is, dst_vec, NULL, &vec_scatter);
+    IBTK_CHKERRQ(ierr);
 
-        ierr = ISDestroy(&src_is);
+    ierr = ISDestroy(&src_is);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // buildVecScatters
+
+void LSiloDataWriter::destroyVecScatters(const int level_number)
+{
+    int ierr;
+    if (d_src_vec[level_number])
+    {
+        ierr = VecDestroy(&d_src_vec[level_number]);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_dst_vec[level_number])
+    {
+        ierr = VecDestroy(&d_dst_vec[level_number]);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_vec_scatter[level_number])
+    {
+        ierr = VecScatterDestroy(&d_vec_scatter[level_number]);
         IBTK_CHKERRQ(ierr);
     }
+    d_packed_depth[level_number] = 0;
     return;
-} // buildVecScatters
+} // destroyVecScatters
+
+int LSiloDataWriter::getPackedDepth(const int level_number) const
+{
+    int depth = NDIM;
+    for (int v = 0; v < d_nvars[level_number]; ++v)
+    {
+        depth += d_var_depths[level_number][v];
+    }
+    return depth;
+} // getPackedDepth
 
 void LSiloDataWriter::getFromRestart()
 {
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -139,6 +140,30 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+inline bool patch_is_larger(const Pointer<Patch<NDIM> >& patch1, const Pointer<Patch<NDIM> >& patch2)
+{
+    return patch1->getBox().size() > patch2->getBox().size();
+} // patch_is_larger
+
+// Collect the local patches of a level ordered by decreasing number of cells.
+// When the patch loops are threaded, dynamically scheduled threads then start
+// with the most expensive patches, which evens out the load.  Only operations
+// that touch patch-local data may be performed inside the threaded loops.
+void get_local_patches(Pointer<PatchLevel<NDIM> > level, std::vector<Pointer<Patch<NDIM> > >& patches)
+{
+    patches.clear();
+    patches.reserve(level->getNumberOfPatches());
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        patches.push_back(level->getPatch(p()));
+    }
+    std::stable_sort(patches.begin(), patches.end(), patch_is_larger);
+    return;
+} // get_local_patches
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 HierarchyMathOps::HierarchyMathOps(const std::string& name,
@@ -153,7 +178,7 @@ HierarchyMathOps::HierarchyMathOps(const std::string& name,
       d_os_var(new OutersideVariable<NDIM, double>(d_object_name + "::scratch_os")), d_fc_idx(-1), d_sc_idx(-1),
       d_of_idx(-1), d_os_idx(-1), d_coarsen_op_name(coarsen_op_name), d_of_coarsen_op(), d_os_coarsen_op(),
       d_of_coarsen_alg(), d_os_coarsen_alg(), d_of_coarsen_scheds(), d_os_coarsen_scheds(), d_hier_cc_data_ops(),
-      d_hier_fc_data_ops(), d_hier_sc_data_ops(), d_patch_math_ops(), d_context(),
+      d_hier_fc_data_ops(), d_hier_sc_data_ops(), d_patch_math_ops(), d_use_threaded_patch_loops(false), d_context(),
       d_wgt_cc_var(new CellVariable<NDIM, double>(d_object_name + "::wgt_cc", 1)),
       d_wgt_fc_var(new FaceVariable<NDIM, double>(d_object_name + "::wgt_fc", 1)),
       d_wgt_sc_var(new SideVariable<NDIM, double>(d_object_name + "::wgt_sc", 1)), d_wgt_cc_idx(-1), d_wgt_fc_idx(-1),
@@ -586,6 +611,17 @@ void HierarchyMathOps::setCoarsenOperatorName(const std::string& coarsen_op_name
     return;
 } // setCoarsenOperatorName
 
+void HierarchyMathOps::setUseThreadedPatchLoops(const bool use_threaded_patch_loops)
+{
+    d_use_threaded_patch_loops = use_threaded_patch_loops;
+    return;
+} // setUseThreadedPatchLoops
+
+PatchMathOps& HierarchyMathOps::getPatchMathOps()
+{
+    return d_patch_math_ops;
+} // getPatchMathOps
+
 void HierarchyMathOps::curl(const int dst_idx,
                             const Pointer<CellVariable<NDIM, double> > /*dst_var*/,
                             const int src_idx,
@@ -601,9 +637,15 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -639,9 +681,15 @@ void HierarchyMathOps::curl(const int dst_idx,
             {
                 Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                std::vector<Pointer<Patch<NDIM> > > patches;
+                get_local_patches(level, patches);
+                const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+                for (int k = 0; k < num_patches; ++k)
                 {
-                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<Patch<NDIM> > patch = patches[k];
 
                     Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
                     Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(d_sc_idx);
@@ -784,9 +832,15 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -811,9 +865,15 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -838,9 +898,15 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -865,9 +931,15 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -900,9 +972,15 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -935,9 +1013,15 @@ void HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -971,9 +1055,15 @@ void HierarchyMathOps::rot(int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1007,9 +1097,15 @@ void HierarchyMathOps::rot(int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1043,9 +1139,15 @@ void HierarchyMathOps::rot(int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<EdgeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1079,9 +1181,15 @@ void HierarchyMathOps::rot(int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1113,9 +1221,15 @@ void HierarchyMathOps::div(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete divergence.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1190,11 +1304,16 @@ void HierarchyMathOps::div(const int dst_idx,
             level->allocatePatchData(d_of_idx);
         }
 
-        // Compute the discrete divergence and extract data on the coarse-fine
-        // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        // Compute the discrete divergence.
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1202,9 +1321,16 @@ void HierarchyMathOps::div(const int dst_idx,
                 (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
 
             d_patch_math_ops.div(dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src2_depth);
+        }
 
-            if ((ln > d_coarsest_ln) && src1_cf_bdry_synch)
+        // Extract data on the coarse-fine interface.  This is done serially
+        // because the patch data copy operations are not thread safe.
+        if ((ln > d_coarsest_ln) && src1_cf_bdry_synch)
+        {
+            for (int k = 0; k < num_patches; ++k)
             {
+                Pointer<Patch<NDIM> > patch = patches[k];
+                Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*src1_data);
             }
@@ -1247,11 +1373,16 @@ void HierarchyMathOps::div(const int dst_idx,
             level->allocatePatchData(d_os_idx);
         }
 
-        // Compute the discrete divergence and extract data on the coarse-fine
-        // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        // Compute the discrete divergence.
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1259,9 +1390,16 @@ void HierarchyMathOps::div(const int dst_idx,
                 (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
 
             d_patch_math_ops.div(dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src2_depth);
+        }
 
-            if ((ln > d_coarsest_ln) && src1_cf_bdry_synch)
+        // Extract data on the coarse-fine interface.  This is done serially
+        // because the patch data copy operations are not thread safe.
+        if ((ln > d_coarsest_ln) && src1_cf_bdry_synch)
+        {
+            for (int k = 0; k < num_patches; ++k)
             {
+                Pointer<Patch<NDIM> > patch = patches[k];
+                Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*src1_data);
             }
@@ -1298,9 +1436,15 @@ void HierarchyMathOps::grad(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete gradient.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1408,11 +1552,16 @@ void HierarchyMathOps::grad(const int dst_idx,
             level->allocatePatchData(d_of_idx);
         }
 
-        // Compute the discrete gradient and extract data on the coarse-fine
-        // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        // Compute the discrete gradient.
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1420,9 +1569,16 @@ void HierarchyMathOps::grad(const int dst_idx,
                 (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
 
             d_patch_math_ops.grad(dst_data, alpha, src1_data, beta, src2_data, patch, src1_depth);
+        }
 
-            if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        // Extract data on the coarse-fine interface.  This is done serially
+        // because the patch data copy operations are not thread safe.
+        if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        {
+            for (int k = 0; k < num_patches; ++k)
             {
+                Pointer<Patch<NDIM> > patch = patches[k];
+                Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*dst_data);
             }
@@ -1466,11 +1622,16 @@ void HierarchyMathOps::grad(const int dst_idx,
             level->allocatePatchData(d_os_idx);
         }
 
-        // Compute the discrete gradient and extract data on the coarse-fine
-        // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        // Compute the discrete gradient.
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1478,9 +1639,16 @@ void HierarchyMathOps::grad(const int dst_idx,
                 (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
 
             d_patch_math_ops.grad(dst_data, alpha, src1_data, beta, src2_data, patch, src1_depth);
+        }
 
-            if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        // Extract data on the coarse-fine interface.  This is done serially
+        // because the patch data copy operations are not thread safe.
+        if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        {
+            for (int k = 0; k < num_patches; ++k)
             {
+                Pointer<Patch<NDIM> > patch = patches[k];
+                Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*dst_data);
             }
@@ -1883,18 +2051,31 @@ void HierarchyMathOps::interp(const int dst_idx,
             level->allocatePatchData(d_of_idx);
         }
 
-        // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        // Interpolate the data.
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch);
+        }
 
-            if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
+        // Extract data on the coarse-fine interface.  This is done serially
+        // because the patch data copy operations are not thread safe.
+        if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
+        {
+            for (int k = 0; k < num_patches; ++k)
             {
+                Pointer<Patch<NDIM> > patch = patches[k];
+                Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*src_data);
             }
@@ -1930,18 +2111,31 @@ void HierarchyMathOps::interp(const int dst_idx,
             level->allocatePatchData(d_os_idx);
         }
 
-        // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        // Interpolate the data.
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch);
+        }
 
-            if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
+        // Extract data on the coarse-fine interface.  This is done serially
+        // because the patch data copy operations are not thread safe.
+        if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
+        {
+            for (int k = 0; k < num_patches; ++k)
             {
+                Pointer<Patch<NDIM> > patch = patches[k];
+                Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*src_data);
             }
@@ -1977,18 +2171,31 @@ void HierarchyMathOps::interp(const int dst_idx,
             level->allocatePatchData(d_of_idx);
         }
 
-        // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        // Interpolate the data.
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch);
+        }
 
-            if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        // Extract data on the coarse-fine interface.  This is done serially
+        // because the patch data copy operations are not thread safe.
+        if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        {
+            for (int k = 0; k < num_patches; ++k)
             {
+                Pointer<Patch<NDIM> > patch = patches[k];
+                Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*dst_data);
             }
@@ -2027,18 +2234,31 @@ void HierarchyMathOps::interp(const int dst_idx,
             level->allocatePatchData(d_os_idx);
         }
 
-        // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        // Interpolate the data.
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch);
+        }
 
-            if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        // Extract data on the coarse-fine interface.  This is done serially
+        // because the patch data copy operations are not thread safe.
+        if ((ln > d_coarsest_ln) && dst_cf_bdry_synch)
+        {
+            for (int k = 0; k < num_patches; ++k)
             {
+                Pointer<Patch<NDIM> > patch = patches[k];
+                Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*dst_data);
             }
@@ -2118,9 +2338,15 @@ void HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete Laplacian.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2346,9 +2572,15 @@ void HierarchyMathOps::laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2432,9 +2664,15 @@ void HierarchyMathOps::vc_laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > coef_data = patch->getPatchData(coef_idx);
@@ -2497,9 +2735,15 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2531,9 +2775,15 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2576,9 +2826,15 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2619,9 +2875,15 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2653,9 +2915,15 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2698,9 +2966,15 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2741,9 +3015,15 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2775,9 +3055,15 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2820,9 +3106,15 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2863,9 +3155,15 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2897,9 +3195,15 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2942,9 +3246,15 @@ void HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2978,9 +3288,15 @@ void HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -3000,9 +3316,15 @@ void HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -3022,9 +3344,15 @@ void HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -3044,9 +3372,15 @@ void HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -3066,9 +3400,15 @@ void HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -3088,9 +3428,15 @@ void HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        get_local_patches(level, patches);
+        const int num_patches = static_cast<int>(patches.size());
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -32,8 +32,13 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <ostream>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -123,6 +128,7 @@
 #define LAPLACE_ADD_FC IBTK_FC_FUNC(laplaceadd3d, LAPLACEADD3D)
 #define DAMPED_LAPLACE_FC IBTK_FC_FUNC(dampedlaplace3d, DAMPEDLAPLACE3D)
 #define DAMPED_LAPLACE_ADD_FC IBTK_FC_FUNC(dampedlaplaceadd3d, DAMPEDLAPLACEADD3D)
+#define LAPLACE_TILE_FC IBTK_FC_FUNC(laplacetile3d, LAPLACETILE3D)
 
 #define MULTIPLY1_FC IBTK_FC_FUNC(multiply13d, MULTIPLY13D)
 #define MULTIPLY_ADD1_FC IBTK_FC_FUNC(multiplyadd13d, MULTIPLYADD13D)
@@ -250,6 +256,29 @@ void DAMPED_LAPLACE_ADD_FC(double* F,
 #endif
                            const double* dx);
 
+#if (NDIM == 3)
+void LAPLACE_TILE_FC(double* F,
+                     const int& F_gcw,
+                     const double& alpha,
+                     const double& beta,
+                     const double* U,
+                     const int& U_gcw,
+                     const double& gamma,
+                     const double* V,
+                     const int& V_gcw,
+                     const int& ilower0,
+                     const int& iupper0,
+                     const int& ilower1,
+                     const int& iupper1,
+                     const int& ilower2,
+                     const int& iupper2,
+                     const int& jlower1,
+                     const int& jupper1,
+                     const int& jlower2,
+                     const int& jupper2,
+                     const double* dx);
+#endif
+
 void C_TO_C_CURL_FC(double* W,
                     const int& W_gcw,
                     const double* U,
@@ -1173,9 +1202,95 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+#if (NDIM == 3)
+// Size (in bytes) of the cache in which the tiled kernels try to keep the
+// stencil working set when the tile width is selected automatically.
+static const int TILE_CACHE_SIZE = 256 * 1024;
+
+// Computes F = alpha div grad U + beta U + gamma V on box by sweeping over
+// tiles that span the full extent of box in the unit-stride direction.
+void laplace_tiled(double* const F,
+                   const int F_ghosts,
+                   const double alpha,
+                   const double beta,
+                   const double* const U,
+                   const int U_ghosts,
+                   const double gamma,
+                   const double* const V,
+                   const int V_ghosts,
+                   const Box<NDIM>& box,
+                   const double* const dx,
+                   const int tile_width,
+                   const bool use_threads)
+{
+    const int n0 = box.numberCells(0) + 2 * std::max(F_ghosts, U_ghosts);
+    const int n1 = box.numberCells(1);
+    const int n2 = box.numberCells(2);
+
+    // When the tile width is not specified, choose it so that the three planes
+    // of U and the plane of F that are touched while sweeping a tile fit in
+    // cache.
+    int w1 = tile_width;
+    if (w1 <= 0) w1 = TILE_CACHE_SIZE / (4 * n0 * static_cast<int>(sizeof(double)));
+    w1 = std::max(1, std::min(w1, n1));
+    const int num_tiles1 = (n1 + w1 - 1) / w1;
+
+    // When threads are used, also split the patch along the slowest direction
+    // so that there are enough tiles to keep all of the threads busy.  Tiles
+    // are not threaded when this function is itself called from within a
+    // parallel region (e.g., a threaded patch loop in HierarchyMathOps), so
+    // that OpenMP parallel regions are never nested.
+    bool threaded = use_threads;
+    int num_tiles2 = 1;
+#if defined(_OPENMP)
+    threaded = threaded && !omp_in_parallel();
+    if (threaded) num_tiles2 = std::min(n2, (omp_get_max_threads() + num_tiles1 - 1) / num_tiles1);
+#endif
+    const int w2 = (n2 + num_tiles2 - 1) / num_tiles2;
+    num_tiles2 = (n2 + w2 - 1) / w2;
+
+    const int num_tiles = num_tiles1 * num_tiles2;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) if (threaded)
+#endif
+    for (int t = 0; t < num_tiles; ++t)
+    {
+        const int jlower1 = box.lower(1) + (t % num_tiles1) * w1;
+        const int jupper1 = std::min(jlower1 + w1 - 1, box.upper(1));
+        const int jlower2 = box.lower(2) + (t / num_tiles1) * w2;
+        const int jupper2 = std::min(jlower2 + w2 - 1, box.upper(2));
+        LAPLACE_TILE_FC(F,
+                        F_ghosts,
+                        alpha,
+                        beta,
+                        U,
+                        U_ghosts,
+                        gamma,
+                        V,
+                        V_ghosts,
+                        box.lower(0),
+                        box.upper(0),
+                        box.lower(1),
+                        box.upper(1),
+                        box.lower(2),
+                        box.upper(2),
+                        jlower1,
+                        jupper1,
+                        jlower2,
+                        jupper2,
+                        dx);
+    }
+    NULL_USE(threaded);
+    return;
+} // laplace_tiled
+#endif
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-PatchMathOps::PatchMathOps()
+PatchMathOps::PatchMathOps() : d_use_tiled_kernels(false), d_tile_width(0), d_use_threaded_tiles(false)
 {
     // intentionally blank
     return;
@@ -1187,6 +1302,24 @@ PatchMathOps::~PatchMathOps()
     return;
 } // ~PatchMathOps
 
+void PatchMathOps::setUseTiledKernels(const bool use_tiled_kernels)
+{
+    d_use_tiled_kernels = use_tiled_kernels;
+    return;
+} // setUseTiledKernels
+
+void PatchMathOps::setTileWidth(const int tile_width)
+{
+    d_tile_width = tile_width;
+    return;
+} // setTileWidth
+
+void PatchMathOps::setUseThreadedTiles(const bool use_threaded_tiles)
+{
+    d_use_threaded_tiles = use_threaded_tiles;
+    return;
+} // setUseThreadedTiles
+
 void PatchMathOps::curl(Pointer<CellData<NDIM, double> > dst,
                         const Pointer<CellData<NDIM, double> > src,
                         const Pointer<Patch<NDIM> > patch) const
@@ -3596,6 +3729,25 @@ void PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
 
     if (!src2 || (gamma == 0.0))
     {
+#if (NDIM == 3)
+        if (d_use_tiled_kernels)
+        {
+            laplace_tiled(F,
+                          F_ghosts,
+                          alpha,
+                          beta,
+                          U,
+                          U_ghosts,
+                          0.0,
+                          U,
+                          U_ghosts,
+                          patch_box,
+                          dx,
+                          d_tile_width,
+                          d_use_threaded_tiles);
+            return;
+        }
+#endif
         if (beta == 0.0)
         {
             LAPLACE_FC(F,
@@ -3649,6 +3801,25 @@ void PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
             TBOX_ERROR("PatchMathOps::laplace():\n"
                        << "  dst, src1, and src2 must all live on the same patch" << std::endl);
         }
+#endif
+#if (NDIM == 3)
+        if (d_use_tiled_kernels)
+        {
+            laplace_tiled(F,
+                          F_ghosts,
+                          alpha,
+                          beta,
+                          U,
+                          U_ghosts,
+                          gamma,
+                          V,
+                          V_ghosts,
+                          patch_box,
+                          dx,
+                          d_tile_width,
+                          d_use_threaded_tiles);
+            return;
+        }
 #endif
         if (beta == 0.0)
         {
@@ -3784,6 +3955,25 @@ void PatchMathOps::laplace(Pointer<SideData<NDIM, double> > dst,
             }
             iupper[d] += 1;
 
+#if (NDIM == 3)
+            if (d_use_tiled_kernels)
+            {
+                laplace_tiled(F[d],
+                              F_ghosts,
+                              alpha,
+                              beta,
+                              U[d],
+                              U_ghosts,
+                              0.0,
+                              U[d],
+                              U_ghosts,
+                              SideGeometry<NDIM>::toSideBox(patch_box, d),
+                              dx,
+                              d_tile_width,
+                              d_use_threaded_tiles);
+                continue;
+            }
+#endif
             if (beta == 0.0)
             {
                 LAPLACE_FC(F[d],
@@ -3853,6 +4043,25 @@ void PatchMathOps::laplace(Pointer<SideData<NDIM, double> > dst,
             }
             iupper[d] += 1;
 
+#if (NDIM == 3)
+            if (d_use_tiled_kernels)
+            {
+                laplace_tiled(F[d],
+                              F_ghosts,
+                              alpha,
+                              beta,
+                              U[d],
+                              U_ghosts,
+                              gamma,
+                              V[d],
+                              V_ghosts,
+                              SideGeometry<NDIM>::toSideBox(patch_box, d),
+                              dx,
+                              d_tile_width,
+                              d_use_threaded_tiles);
+                continue;
+            }
+#endif
             if (beta == 0.0)
             {
                 LAPLACE_ADD_FC(F[d],
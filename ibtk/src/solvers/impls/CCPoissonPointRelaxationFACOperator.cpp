@@ -80,6 +80,7 @@
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/PatchMathOps.h"
 #include "ibtk/PoissonFACPreconditionerStrategy.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
@@ -374,6 +375,16 @@ void CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, dou
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
+    // Collect the local patches in the order in which they are indexed by the
+    // cached patch data.  When the patches are smoothed independently (i.e.,
+    // when values are not exchanged between local patches and the PETSc
+    // smoothers are not used), the patches may be smoothed concurrently.
+    std::vector<Pointer<Patch<NDIM> > > patches;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++) patches.push_back(level->getPatch(p()));
+    const int num_patches = static_cast<int>(patches.size());
+    const bool use_threads = d_use_threaded_patch_loops && !update_local_data && !d_using_petsc_smoothers;
+    NULL_USE(use_threads);
+
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
     {
@@ -443,10 +454,12 @@ void CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, dou
         }
 
         // Smooth the error on the patches.
-        int patch_counter = 0;
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) if (use_threads)
+#endif
+        for (int patch_counter = 0; patch_counter < num_patches; ++patch_counter)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patches[patch_counter];
             Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
             Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
 #if !defined(NDEBUG)
@@ -673,6 +686,11 @@ void CCPoissonPointRelaxationFACOperator::computeResidual(SAMRAIVectorReal<NDIM,
         stream << d_object_name << "::hier_math_ops_" << finest_level_num;
         d_level_math_ops[finest_level_num] =
             new HierarchyMathOps(stream.str(), d_hierarchy, coarsest_level_num, finest_level_num);
+        PatchMathOps& patch_math_ops = d_level_math_ops[finest_level_num]->getPatchMathOps();
+        patch_math_ops.setUseTiledKernels(d_use_tiled_kernels);
+        patch_math_ops.setTileWidth(d_tile_width);
+        patch_math_ops.setUseThreadedTiles(d_use_threaded_tiles);
+        d_level_math_ops[finest_level_num]->setUseThreadedPatchLoops(d_use_threaded_patch_loops);
     }
     d_level_math_ops[finest_level_num]->laplace(
         res_idx, res_var, d_poisson_spec, sol_idx, sol_var, NULL, d_solution_time);
@@ -32,9 +32,13 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <math.h>
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
@@ -44,10 +48,15 @@
 #include "ibtk/FACPreconditionerStrategy.h"
 #include "ibtk/GeneralSolver.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/PerformanceTrace.h"
 #include "ibtk/ibtk_enums.h"
+#include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Database.h"
+#include "tbox/PIO.h"
 #include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -56,6 +65,26 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Create a vector that shares the patch data of vec on the specified range of
+// levels.
+Pointer<SAMRAIVectorReal<NDIM, double> >
+get_level_range_vector(const SAMRAIVectorReal<NDIM, double>& vec, const int coarsest_ln, const int finest_ln)
+{
+    std::ostringstream name_str;
+    name_str << vec.getName() << "::levels_" << coarsest_ln << "_" << finest_ln;
+    Pointer<SAMRAIVectorReal<NDIM, double> > level_vec =
+        new SAMRAIVectorReal<NDIM, double>(name_str.str(), vec.getPatchHierarchy(), coarsest_ln, finest_ln);
+    for (int comp = 0; comp < vec.getNumberOfComponents(); ++comp)
+    {
+        level_vec->addComponent(
+            vec.getComponentVariable(comp), vec.getComponentDescriptorIndex(comp), vec.getControlVolumeIndex(comp));
+    }
+    return level_vec;
+} // get_level_range_vector
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FACPreconditioner::FACPreconditioner(const std::string& object_name,
@@ -63,7 +92,11 @@ FACPreconditioner::FACPreconditioner(const std::string& object_name,
                                      tbox::Pointer<tbox::Database> input_db,
                                      const std::string& /*default_options_prefix*/)
     : d_fac_strategy(fac_strategy), d_hierarchy(NULL), d_coarsest_ln(0), d_finest_ln(0), d_cycle_type(V_CYCLE),
-      d_num_pre_sweeps(0), d_num_post_sweeps(2), d_f(), d_r()
+      d_num_pre_sweeps(0), d_num_post_sweeps(2), d_f(), d_r(), d_enable_fmg(false), d_num_fmg_cycles(1), d_fmg_u(),
+      d_enable_adaptive_sweeps(false), d_adaptive_sweeps_target_reduction(0.1), d_min_num_post_sweeps(1),
+      d_max_num_post_sweeps(8), d_level_num_post_sweeps(), d_level_pending_num_post_sweeps(), d_monitor_interval(10),
+      d_num_applications(0), d_monitor_cycle(false), d_level_r(), d_level_entry_residual_norm(),
+      d_level_log_reduction_sum(), d_level_residual_reduction(), d_level_num_monitored_visits(), d_level_timers()
 {
     // Setup default options.
     GeneralSolver::init(object_name, /*homogeneous_bc*/ true);
@@ -107,6 +140,10 @@ void FACPreconditioner::setTimeInterval(const double current_time, const double
 {
     LinearSolver::setTimeInterval(current_time, new_time);
     d_fac_strategy->setTimeInterval(current_time, new_time);
+
+    // Begin using the numbers of post-smoothing sweeps selected by adaptive
+    // smoothing.
+    d_level_num_post_sweeps = d_level_pending_num_post_sweeps;
     return;
 } // setTimeInterval
 
@@ -120,6 +157,17 @@ bool FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVec
     d_fac_strategy->allocateScratchData();
     if (d_f) d_f->allocateVectorData();
     if (d_r) d_r->allocateVectorData();
+    if (d_fmg_u) d_fmg_u->allocateVectorData();
+
+    // Determine whether to measure the residual reduction on each level.
+    d_monitor_cycle = !d_level_r.empty() && (d_enable_adaptive_sweeps || PerformanceTrace::isRecording()) &&
+                      d_num_applications % d_monitor_interval == 0;
+    ++d_num_applications;
+    if (d_monitor_cycle)
+    {
+        std::fill(d_level_log_reduction_sum.begin(), d_level_log_reduction_sum.end(), 0.0);
+        std::fill(d_level_num_monitored_visits.begin(), d_level_num_monitored_visits.end(), 0);
+    }
 
     // Set the initial guess to equal zero.
     u.setToScalar(0.0, /*interior_only*/ false);
@@ -130,8 +178,12 @@ bool FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVec
     // start modifying the solution vector u.
     d_recompute_residual = false;
 
-    // Apply a single FAC cycle.
-    if (d_cycle_type == V_CYCLE && d_num_pre_sweeps == 0)
+    // Apply a single FMG or FAC cycle.
+    if (d_enable_fmg)
+    {
+        FMGCycle(u, f);
+    }
+    else if (d_cycle_type == V_CYCLE && d_num_pre_sweeps == 0)
     {
         // V-cycle MG without presmoothing keeps the residual equal to the
         // initial right-hand-side vector f, so we can simply use that vector
@@ -142,28 +194,22 @@ bool FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVec
     {
         d_f->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&f, false), false);
         d_r->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&f, false), false);
-        switch (d_cycle_type)
-        {
-        case V_CYCLE:
-            FACVCycle(u, *d_f, d_finest_ln);
-            break;
-        case W_CYCLE:
-            FACWCycle(u, *d_f, d_finest_ln);
-            break;
-        case F_CYCLE:
-            FACFCycle(u, *d_f, d_finest_ln);
-            break;
-        default:
-            TBOX_ERROR(d_object_name << "::solveSystem():\n"
-                                     << "  unrecognized FAC cycle type: " << enum_to_string<MGCycleType>(d_cycle_type)
-                                     << "." << std::endl);
-        }
+        FACCycle(u, *d_f, d_finest_ln);
+    }
+
+    // Update the number of smoothing sweeps using the measured residual
+    // reductions.
+    if (d_monitor_cycle)
+    {
+        updateMonitoredLevels();
+        d_monitor_cycle = false;
     }
 
     // Deallocate scratch data.
     d_fac_strategy->deallocateScratchData();
     if (d_f) d_f->deallocateVectorData();
     if (d_r) d_r->deallocateVectorData();
+    if (d_fmg_u) d_fmg_u->deallocateVectorData();
 
     // Deallocate the solver, when necessary.
     if (deallocate_after_solve) deallocateSolverState();
@@ -192,11 +238,42 @@ void FACPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, doubl
     d_fac_strategy->initializeOperatorState(solution, rhs);
 
     // Create temporary vectors.
-    if (!(d_cycle_type == V_CYCLE && d_num_pre_sweeps == 0))
+    const bool monitor_levels = d_enable_adaptive_sweeps || PerformanceTrace::isEnabled();
+    if (!(d_cycle_type == V_CYCLE && d_num_pre_sweeps == 0) || d_enable_fmg || monitor_levels)
     {
         d_f = rhs.cloneVector("");
         d_r = rhs.cloneVector("");
     }
+    if (d_enable_fmg)
+    {
+        d_fmg_u = solution.cloneVector("");
+    }
+
+    // Setup per-level data.  The number of post-smoothing sweeps selected by
+    // adaptive smoothing is retained for levels that continue to exist, and
+    // any pending selections are applied.
+    d_level_pending_num_post_sweeps.resize(d_finest_ln + 1, d_num_post_sweeps);
+    d_level_num_post_sweeps = d_level_pending_num_post_sweeps;
+    d_level_entry_residual_norm.assign(d_finest_ln + 1, 0.0);
+    d_level_log_reduction_sum.assign(d_finest_ln + 1, 0.0);
+    d_level_residual_reduction.assign(d_finest_ln + 1, -1.0);
+    d_level_num_monitored_visits.assign(d_finest_ln + 1, 0);
+    if (monitor_levels)
+    {
+        d_level_r.resize(d_finest_ln + 1);
+        for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+        {
+            d_level_r[ln] = get_level_range_vector(*d_r, ln, ln);
+        }
+    }
+    d_level_timers.resize(d_finest_ln + 1, NULL);
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (d_level_timers[ln]) continue;
+        std::ostringstream timer_name;
+        timer_name << d_object_name << "::level_" << ln;
+        d_level_timers[ln] = TimerManager::getManager()->getTimer(timer_name.str());
+    }
 
     // Indicate the operator is initialized.
     d_is_initialized = true;
@@ -220,6 +297,14 @@ void FACPreconditioner::deallocateSolverState()
         d_r.setNull();
     }
 
+    if (d_fmg_u)
+    {
+        d_fmg_u->freeVectorComponents();
+        d_fmg_u.setNull();
+    }
+
+    d_level_r.clear();
+
     // Deallocate operator state.
     d_fac_strategy->deallocateOperatorState();
 
@@ -273,6 +358,8 @@ int FACPreconditioner::getNumPreSmoothingSweeps() const
 void FACPreconditioner::setNumPostSmoothingSweeps(int num_post_sweeps)
 {
     d_num_post_sweeps = num_post_sweeps;
+    std::fill(d_level_num_post_sweeps.begin(), d_level_num_post_sweeps.end(), d_num_post_sweeps);
+    std::fill(d_level_pending_num_post_sweeps.begin(), d_level_pending_num_post_sweeps.end(), d_num_post_sweeps);
     return;
 } // setNumPostSmoothingSweeps
 
@@ -281,6 +368,98 @@ int FACPreconditioner::getNumPostSmoothingSweeps() const
     return d_num_post_sweeps;
 } // getNumPostSmoothingSweeps
 
+int FACPreconditioner::getNumPostSmoothingSweeps(const int level_num) const
+{
+    if (level_num < static_cast<int>(d_level_num_post_sweeps.size())) return d_level_num_post_sweeps[level_num];
+    return d_num_post_sweeps;
+} // getNumPostSmoothingSweeps
+
+void FACPreconditioner::setFullMultigridEnabled(const bool enable_fmg)
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::setFullMultigridEnabled():\n"
+                                 << "  cannot be called while solver state is initialized" << std::endl);
+    }
+    d_enable_fmg = enable_fmg;
+    return;
+} // setFullMultigridEnabled
+
+bool FACPreconditioner::getFullMultigridEnabled() const
+{
+    return d_enable_fmg;
+} // getFullMultigridEnabled
+
+void FACPreconditioner::setNumFullMultigridCycles(const int num_fmg_cycles)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_fmg_cycles >= 1);
+#endif
+    d_num_fmg_cycles = num_fmg_cycles;
+    return;
+} // setNumFullMultigridCycles
+
+int FACPreconditioner::getNumFullMultigridCycles() const
+{
+    return d_num_fmg_cycles;
+} // getNumFullMultigridCycles
+
+void FACPreconditioner::setAdaptiveSweepsEnabled(const bool enable_adaptive_sweeps)
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::setAdaptiveSweepsEnabled():\n"
+                                 << "  cannot be called while solver state is initialized" << std::endl);
+    }
+    d_enable_adaptive_sweeps = enable_adaptive_sweeps;
+    if (!d_enable_adaptive_sweeps)
+    {
+        std::fill(d_level_num_post_sweeps.begin(), d_level_num_post_sweeps.end(), d_num_post_sweeps);
+        std::fill(d_level_pending_num_post_sweeps.begin(), d_level_pending_num_post_sweeps.end(), d_num_post_sweeps);
+    }
+    return;
+} // setAdaptiveSweepsEnabled
+
+bool FACPreconditioner::getAdaptiveSweepsEnabled() const
+{
+    return d_enable_adaptive_sweeps;
+} // getAdaptiveSweepsEnabled
+
+void FACPreconditioner::setAdaptiveSweepsTargetReduction(const double target_reduction)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(target_reduction > 0.0 && target_reduction < 1.0);
+#endif
+    d_adaptive_sweeps_target_reduction = target_reduction;
+    return;
+} // setAdaptiveSweepsTargetReduction
+
+void FACPreconditioner::setAdaptiveSweepsLimits(const int min_num_post_sweeps, const int max_num_post_sweeps)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(min_num_post_sweeps >= 0);
+    TBOX_ASSERT(min_num_post_sweeps <= max_num_post_sweeps);
+#endif
+    d_min_num_post_sweeps = min_num_post_sweeps;
+    d_max_num_post_sweeps = max_num_post_sweeps;
+    return;
+} // setAdaptiveSweepsLimits
+
+void FACPreconditioner::setMonitorInterval(const int monitor_interval)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(monitor_interval >= 1);
+#endif
+    d_monitor_interval = monitor_interval;
+    return;
+} // setMonitorInterval
+
+double FACPreconditioner::getResidualReduction(const int level_num) const
+{
+    if (level_num < static_cast<int>(d_level_residual_reduction.size())) return d_level_residual_reduction[level_num];
+    return -1.0;
+} // getResidualReduction
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void FACPreconditioner::FACVCycleNoPreSmoothing(SAMRAIVectorReal<NDIM, double>& u,
@@ -290,26 +469,39 @@ void FACPreconditioner::FACVCycleNoPreSmoothing(SAMRAIVectorReal<NDIM, double>&
     if (level_num == d_coarsest_ln)
     {
         // Solve Au = f on the coarsest level.
+        IBTK_TIMER_START(d_level_timers[level_num]);
         d_fac_strategy->solveCoarsestLevel(u, f, level_num);
+        IBTK_TIMER_STOP(d_level_timers[level_num]);
     }
     else
     {
+        beginLevelVisit(u, f, level_num);
+        IBTK_TIMER_START(d_level_timers[level_num]);
+
         // Restrict the residual to the next coarser level.
         d_fac_strategy->restrictResidual(f, f, level_num - 1);
 
+        IBTK_TIMER_STOP(d_level_timers[level_num]);
+
         // Recursively call the FAC algorithm.
         FACVCycleNoPreSmoothing(u, f, level_num - 1);
 
+        IBTK_TIMER_START(d_level_timers[level_num]);
+
         // Prolong the error from the next coarser level.  Because we did not
         // perform any presmoothing, we do not need to correct the solution on
         // the current level.
         d_fac_strategy->prolongError(u, u, level_num);
 
         // Smooth error on the current level.
-        if (d_num_post_sweeps > 0)
+        const int num_post_sweeps = d_level_num_post_sweeps[level_num];
+        if (num_post_sweeps > 0)
         {
-            d_fac_strategy->smoothError(u, f, level_num, d_num_post_sweeps, false, true);
+            d_fac_strategy->smoothError(u, f, level_num, num_post_sweeps, false, true);
         }
+
+        IBTK_TIMER_STOP(d_level_timers[level_num]);
+        endLevelVisit(u, f, level_num);
     }
     return;
 } // FACVCycleNoPreSmoothing
@@ -319,11 +511,16 @@ void FACPreconditioner::FACVCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
     if (level_num == d_coarsest_ln)
     {
         // Solve Au = f on the coarsest level.
+        IBTK_TIMER_START(d_level_timers[level_num]);
         d_fac_strategy->solveCoarsestLevel(u, f, level_num);
         d_recompute_residual = true;
+        IBTK_TIMER_STOP(d_level_timers[level_num]);
     }
     else
     {
+        beginLevelVisit(u, f, level_num);
+        IBTK_TIMER_START(d_level_timers[level_num]);
+
         // Smooth the error on the current level.
         if (d_num_pre_sweeps > 0)
         {
@@ -343,19 +540,27 @@ void FACPreconditioner::FACVCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
             d_fac_strategy->restrictResidual(f, f, level_num - 1);
         }
 
+        IBTK_TIMER_STOP(d_level_timers[level_num]);
+
         // Recursively call the FAC algorithm.
         FACVCycle(u, f, level_num - 1);
 
+        IBTK_TIMER_START(d_level_timers[level_num]);
+
         // Prolong the error from the next coarser level and correct the
         // solution on level.
         d_fac_strategy->prolongErrorAndCorrect(u, u, level_num);
 
         // Smooth error on level.
-        if (d_num_post_sweeps > 0)
+        const int num_post_sweeps = d_level_num_post_sweeps[level_num];
+        if (num_post_sweeps > 0)
         {
-            d_fac_strategy->smoothError(u, f, level_num, d_num_post_sweeps, false, true);
+            d_fac_strategy->smoothError(u, f, level_num, num_post_sweeps, false, true);
             d_recompute_residual = true;
         }
+
+        IBTK_TIMER_STOP(d_level_timers[level_num]);
+        endLevelVisit(u, f, level_num);
     }
     return;
 } // FACVCycle
@@ -365,11 +570,16 @@ void FACPreconditioner::FACWCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
     if (level_num == d_coarsest_ln)
     {
         // Solve Au = f on the coarsest level.
+        IBTK_TIMER_START(d_level_timers[level_num]);
         d_fac_strategy->solveCoarsestLevel(u, f, level_num);
         d_recompute_residual = true;
+        IBTK_TIMER_STOP(d_level_timers[level_num]);
     }
     else
     {
+        beginLevelVisit(u, f, level_num);
+        IBTK_TIMER_START(d_level_timers[level_num]);
+
         // Smooth the error on the current level.
         if (d_num_pre_sweeps > 0)
         {
@@ -389,20 +599,28 @@ void FACPreconditioner::FACWCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
             d_fac_strategy->restrictResidual(f, f, level_num - 1);
         }
 
+        IBTK_TIMER_STOP(d_level_timers[level_num]);
+
         // Recursively call the FAC algorithm.
         FACWCycle(u, f, level_num - 1);
         FACWCycle(u, f, level_num - 1);
 
+        IBTK_TIMER_START(d_level_timers[level_num]);
+
         // Prolong the error from the next coarser level and correct the
         // solution on level.
         d_fac_strategy->prolongErrorAndCorrect(u, u, level_num);
 
         // Smooth error on level.
-        if (d_num_post_sweeps > 0)
+        const int num_post_sweeps = d_level_num_post_sweeps[level_num];
+        if (num_post_sweeps > 0)
         {
-            d_fac_strategy->smoothError(u, f, level_num, d_num_post_sweeps, false, true);
+            d_fac_strategy->smoothError(u, f, level_num, num_post_sweeps, false, true);
             d_recompute_residual = true;
         }
+
+        IBTK_TIMER_STOP(d_level_timers[level_num]);
+        endLevelVisit(u, f, level_num);
     }
     return;
 } // FACWCycle
@@ -412,11 +630,16 @@ void FACPreconditioner::FACFCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
     if (level_num == d_coarsest_ln)
     {
         // Solve Au = f on the coarsest level.
+        IBTK_TIMER_START(d_level_timers[level_num]);
         d_fac_strategy->solveCoarsestLevel(u, f, level_num);
         d_recompute_residual = true;
+        IBTK_TIMER_STOP(d_level_timers[level_num]);
     }
     else
     {
+        beginLevelVisit(u, f, level_num);
+        IBTK_TIMER_START(d_level_timers[level_num]);
+
         // Smooth the error on the current level.
         if (d_num_pre_sweeps > 0)
         {
@@ -436,26 +659,194 @@ void FACPreconditioner::FACFCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVecto
             d_fac_strategy->restrictResidual(f, f, level_num - 1);
         }
 
+        IBTK_TIMER_STOP(d_level_timers[level_num]);
+
         // Recursively call the FAC algorithm.
         FACWCycle(u, f, level_num - 1);
         FACVCycle(u, f, level_num - 1);
 
+        IBTK_TIMER_START(d_level_timers[level_num]);
+
         // Prolong the error from the next coarser level and correct the
         // solution on level.
         d_fac_strategy->prolongErrorAndCorrect(u, u, level_num);
 
         // Smooth error on level.
-        if (d_num_post_sweeps > 0)
+        const int num_post_sweeps = d_level_num_post_sweeps[level_num];
+        if (num_post_sweeps > 0)
         {
-            d_fac_strategy->smoothError(u, f, level_num, d_num_post_sweeps, false, true);
+            d_fac_strategy->smoothError(u, f, level_num, num_post_sweeps, false, true);
             d_recompute_residual = true;
         }
+
+        IBTK_TIMER_STOP(d_level_timers[level_num]);
+        endLevelVisit(u, f, level_num);
     }
     return;
 } // FACFCycle
 
+void FACPreconditioner::FACCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<NDIM, double>& f, int level_num)
+{
+    switch (d_cycle_type)
+    {
+    case V_CYCLE:
+        // When u is zero and f is the residual, a V-cycle without presmoothing
+        // can use f for the residual in the FAC algorithm.
+        if (d_num_pre_sweeps == 0 && !d_recompute_residual)
+        {
+            FACVCycleNoPreSmoothing(u, f, level_num);
+        }
+        else
+        {
+            FACVCycle(u, f, level_num);
+        }
+        break;
+    case W_CYCLE:
+        FACWCycle(u, f, level_num);
+        break;
+    case F_CYCLE:
+        FACFCycle(u, f, level_num);
+        break;
+    default:
+        TBOX_ERROR(d_object_name << "::FACCycle():\n"
+                                 << "  unrecognized FAC cycle type: " << enum_to_string<MGCycleType>(d_cycle_type)
+                                 << "." << std::endl);
+    }
+    return;
+} // FACCycle
+
+void FACPreconditioner::FMGCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<NDIM, double>& f)
+{
+    // Restrict the right-hand side to all coarser levels.
+    for (int ln = d_finest_ln - 1; ln >= d_coarsest_ln; --ln)
+    {
+        d_fac_strategy->restrictResidual(f, f, ln);
+    }
+
+    // Solve Au = f on the coarsest level.
+    d_fmg_u->setToScalar(0.0, /*interior_only*/ false);
+    IBTK_TIMER_START(d_level_timers[d_coarsest_ln]);
+    d_fac_strategy->solveCoarsestLevel(*d_fmg_u, f, d_coarsest_ln);
+    IBTK_TIMER_STOP(d_level_timers[d_coarsest_ln]);
+
+    // Interpolate the approximate solution to each successively finer level,
+    // and improve it by applying FAC cycles to the residual equation on the
+    // composite grid that ends at that level.  The error is computed in u,
+    // which remains zero on the finer levels.
+    for (int ln = d_coarsest_ln + 1; ln <= d_finest_ln; ++ln)
+    {
+        d_fac_strategy->prolongError(*d_fmg_u, *d_fmg_u, ln);
+        Pointer<SAMRAIVectorReal<NDIM, double> > fmg_u = get_level_range_vector(*d_fmg_u, d_coarsest_ln, ln);
+        Pointer<SAMRAIVectorReal<NDIM, double> > e = get_level_range_vector(u, d_coarsest_ln, ln);
+        Pointer<SAMRAIVectorReal<NDIM, double> > r = get_level_range_vector(*d_r, d_coarsest_ln, ln);
+        Pointer<SAMRAIVectorReal<NDIM, double> > g = get_level_range_vector(*d_f, d_coarsest_ln, ln);
+        for (int k = 0; k < d_num_fmg_cycles; ++k)
+        {
+            // Compute the composite-grid residual one pair of levels at a
+            // time.  Working from finer to coarser levels ensures that the
+            // residual on each level is computed using the next coarser level
+            // to determine coarse-fine interface values.
+            for (int residual_ln = ln; residual_ln > d_coarsest_ln; --residual_ln)
+            {
+                d_fac_strategy->computeResidual(*d_r, *d_fmg_u, f, residual_ln - 1, residual_ln);
+            }
+            g->copyVector(r, /*interior_only*/ false);
+
+            // Apply an FAC cycle to the residual equation and correct the
+            // approximate solution.
+            e->setToScalar(0.0, /*interior_only*/ false);
+            d_recompute_residual = false;
+            FACCycle(u, *d_f, ln);
+            fmg_u->add(fmg_u, e);
+        }
+    }
+
+    // Return the approximate solution in u.
+    u.copyVector(d_fmg_u, /*interior_only*/ false);
+    return;
+} // FMGCycle
+
+void FACPreconditioner::beginLevelVisit(SAMRAIVectorReal<NDIM, double>& u,
+                                        SAMRAIVectorReal<NDIM, double>& f,
+                                        const int level_num)
+{
+    if (!d_monitor_cycle) return;
+    d_fac_strategy->computeResidual(*d_r, u, f, level_num - 1, level_num);
+    d_level_entry_residual_norm[level_num] = d_level_r[level_num]->L2Norm();
+    return;
+} // beginLevelVisit
+
+void FACPreconditioner::endLevelVisit(SAMRAIVectorReal<NDIM, double>& u,
+                                      SAMRAIVectorReal<NDIM, double>& f,
+                                      const int level_num)
+{
+    if (!d_monitor_cycle) return;
+    d_fac_strategy->computeResidual(*d_r, u, f, level_num - 1, level_num);
+    const double entry_residual_norm = d_level_entry_residual_norm[level_num];
+    const double exit_residual_norm = d_level_r[level_num]->L2Norm();
+    if (entry_residual_norm > 0.0 && exit_residual_norm > 0.0)
+    {
+        d_level_log_reduction_sum[level_num] += log(exit_residual_norm / entry_residual_norm);
+        d_level_num_monitored_visits[level_num] += 1;
+    }
+    return;
+} // endLevelVisit
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void FACPreconditioner::updateMonitoredLevels()
+{
+    for (int ln = d_coarsest_ln + 1; ln <= d_finest_ln; ++ln)
+    {
+        const int num_visits = d_level_num_monitored_visits[ln];
+        if (num_visits == 0) continue;
+
+        // Determine the mean residual reduction per visit to this level.
+        const double reduction = exp(d_level_log_reduction_sum[ln] / static_cast<double>(num_visits));
+        d_level_residual_reduction[ln] = reduction;
+        if (PerformanceTrace::isRecording())
+        {
+            std::ostringstream counter_name;
+            counter_name << d_object_name << "::level_" << ln;
+            const int reduction_counter =
+                PerformanceTrace::registerCounter(counter_name.str() + "::residual_reduction");
+            const int num_cycles_counter =
+                PerformanceTrace::registerCounter(counter_name.str() + "::num_monitored_cycles");
+            PerformanceTrace::addToCounter(reduction_counter, reduction);
+            PerformanceTrace::addToCounter(num_cycles_counter, 1.0);
+        }
+
+        // Select the number of post-smoothing sweeps that would obtain the
+        // target reduction, assuming that each sweep reduces the residual by
+        // the same factor.  The new number of sweeps is not employed until
+        // the next outer solve begins.
+        if (d_enable_adaptive_sweeps)
+        {
+            const int num_sweeps = d_level_num_post_sweeps[ln];
+            int new_num_sweeps;
+            if (num_sweeps == 0 || reduction >= 1.0)
+            {
+                new_num_sweeps = num_sweeps + 1;
+            }
+            else
+            {
+                new_num_sweeps = static_cast<int>(
+                    ceil(static_cast<double>(num_sweeps) * log(d_adaptive_sweeps_target_reduction) / log(reduction)));
+            }
+            d_level_pending_num_post_sweeps[ln] =
+                std::max(d_min_num_post_sweeps, std::min(d_max_num_post_sweeps, new_num_sweeps));
+        }
+
+        if (d_enable_logging)
+        {
+            plog << d_object_name << "::solveSystem(): level " << ln << " residual reduction = " << reduction
+                 << ", num_post_sweeps = " << d_level_num_post_sweeps[ln]
+                 << ", next num_post_sweeps = " << d_level_pending_num_post_sweeps[ln] << "\n";
+        }
+    }
+    return;
+} // updateMonitoredLevels
+
 void FACPreconditioner::getFromInput(tbox::Pointer<tbox::Database> db)
 {
     if (!db) return;
@@ -463,6 +854,19 @@ void FACPreconditioner::getFromInput(tbox::Pointer<tbox::Database> db)
     if (db->keyExists("cycle_type")) setMGCycleType(string_to_enum<MGCycleType>(db->getString("cycle_type")));
     if (db->keyExists("num_pre_sweeps")) setNumPreSmoothingSweeps(db->getInteger("num_pre_sweeps"));
     if (db->keyExists("num_post_sweeps")) setNumPostSmoothingSweeps(db->getInteger("num_post_sweeps"));
+    if (db->keyExists("enable_fmg")) setFullMultigridEnabled(db->getBool("enable_fmg"));
+    if (db->keyExists("num_fmg_cycles")) setNumFullMultigridCycles(db->getInteger("num_fmg_cycles"));
+    if (db->keyExists("enable_adaptive_sweeps")) setAdaptiveSweepsEnabled(db->getBool("enable_adaptive_sweeps"));
+    if (db->keyExists("adaptive_sweeps_target_reduction"))
+        setAdaptiveSweepsTargetReduction(db->getDouble("adaptive_sweeps_target_reduction"));
+    if (db->keyExists("min_num_post_sweeps") || db->keyExists("max_num_post_sweeps"))
+    {
+        int min_num_post_sweeps = d_min_num_post_sweeps, max_num_post_sweeps = d_max_num_post_sweeps;
+        if (db->keyExists("min_num_post_sweeps")) min_num_post_sweeps = db->getInteger("min_num_post_sweeps");
+        if (db->keyExists("max_num_post_sweeps")) max_num_post_sweeps = db->getInteger("max_num_post_sweeps");
+        setAdaptiveSweepsLimits(min_num_post_sweeps, max_num_post_sweeps);
+    }
+    if (db->keyExists("monitor_interval")) setMonitorInterval(db->getInteger("monitor_interval"));
     if (db->keyExists("enable_logging")) setLoggingEnabled(db->getBool("enable_logging"));
     return;
 } // getFromInput
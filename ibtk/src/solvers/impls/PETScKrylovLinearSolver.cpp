@@ -43,7 +43,9 @@
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
+#include "VariableDatabase.h"
 #include "ibtk/GeneralSolver.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/KrylovLinearSolver.h"
@@ -53,6 +55,7 @@
 #include "ibtk/PETScMatLOWrapper.h"
 #include "ibtk/PETScPCLSWrapper.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
+#include "ibtk/PerformanceTrace.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "mpi.h"
@@ -66,6 +69,7 @@
 #include "tbox/Database.h"
 #include "tbox/PIO.h"
 #include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
@@ -83,6 +87,42 @@ namespace
 static Timer* t_solve_system;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+
+// Relative tolerance used to detect linearly dependent recycled vectors.
+static const double RECYCLE_DEPENDENCE_TOL = 1.0e-8;
+
+// Clone and allocate a vector used to store recycled subspace data.
+Pointer<SAMRAIVectorReal<NDIM, double> > allocate_recycled_vector(const SAMRAIVectorReal<NDIM, double>& x,
+                                                                  const std::string& name)
+{
+    Pointer<SAMRAIVectorReal<NDIM, double> > vec = x.cloneVector(name);
+    vec->allocateVectorData();
+    return vec;
+} // allocate_recycled_vector
+
+// Free a vector used to store recycled subspace data.  Unlike
+// SAMRAIVectorReal::freeVectorComponents(), this function can be used after the
+// patch hierarchy configuration has changed.
+void free_recycled_vector(Pointer<SAMRAIVectorReal<NDIM, double> >& vec)
+{
+    if (!vec) return;
+    Pointer<PatchHierarchy<NDIM> > hierarchy = vec->getPatchHierarchy();
+    const int coarsest_ln = vec->getCoarsestLevelNumber();
+    const int finest_ln = std::min(vec->getFinestLevelNumber(), hierarchy->getFinestLevelNumber());
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (int comp = 0; comp < vec->getNumberOfComponents(); ++comp)
+    {
+        const int data_idx = vec->getComponentDescriptorIndex(comp);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            if (level->checkAllocated(data_idx)) level->deallocatePatchData(data_idx);
+        }
+        var_db->removePatchDataIndex(data_idx);
+    }
+    vec.setNull();
+    return;
+} // free_recycled_vector
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -95,7 +135,8 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
       d_options_prefix(default_options_prefix), d_petsc_comm(petsc_comm), d_petsc_ksp(NULL), d_petsc_mat(NULL),
       d_petsc_nullsp(NULL), d_managing_petsc_ksp(true), d_user_provided_mat(false), d_user_provided_pc(false),
       d_nullspace_constant_vec(NULL), d_petsc_nullspace_constant_vec(NULL), d_petsc_nullspace_basis_vecs(),
-      d_solver_has_attached_nullspace(false)
+      d_solver_has_attached_nullspace(false), d_recycle_subspace_size(0), d_recycle_subspace_needs_reset(false),
+      d_recycle_U(), d_recycle_C(), d_recycle_u_new(), d_recycle_c_new(), d_recycle_x0(), d_recycle_r()
 {
     // Setup default values.
     GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
@@ -117,6 +158,8 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
         if (input_db->keyExists("ksp_type")) d_ksp_type = input_db->getString("ksp_type");
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
+        if (input_db->keyExists("recycle_subspace_size"))
+            setRecycledSubspaceSize(input_db->getInteger("recycle_subspace_size"));
         if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
     }
 
@@ -130,7 +173,8 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
       d_petsc_comm(PETSC_COMM_WORLD), d_petsc_ksp(petsc_ksp), d_petsc_mat(NULL), d_petsc_nullsp(NULL),
       d_managing_petsc_ksp(false), d_user_provided_mat(false), d_user_provided_pc(false),
       d_nullspace_constant_vec(NULL), d_petsc_nullspace_constant_vec(NULL), d_petsc_nullspace_basis_vecs(),
-      d_solver_has_attached_nullspace(false)
+      d_solver_has_attached_nullspace(false), d_recycle_subspace_size(0), d_recycle_subspace_needs_reset(false),
+      d_recycle_U(), d_recycle_C(), d_recycle_u_new(), d_recycle_c_new(), d_recycle_x0(), d_recycle_r()
 {
     GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
     if (d_petsc_ksp) resetWrappedKSP(d_petsc_ksp);
@@ -141,6 +185,7 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
 PETScKrylovLinearSolver::~PETScKrylovLinearSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    clearRecycledSubspace();
 
     // Delete allocated PETSc solver components.
     int ierr;
@@ -171,6 +216,51 @@ void PETScKrylovLinearSolver::setOptionsPrefix(const std::string& options_prefix
     return;
 } // setOptionsPrefix
 
+void PETScKrylovLinearSolver::setRecycledSubspaceSize(const int recycle_subspace_size)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(recycle_subspace_size >= 0);
+#endif
+    d_recycle_subspace_size = recycle_subspace_size;
+    if (d_recycle_subspace_size == 0)
+    {
+        clearRecycledSubspace();
+    }
+    else
+    {
+        while (static_cast<int>(d_recycle_U.size()) > d_recycle_subspace_size)
+        {
+            free_recycled_vector(d_recycle_U.front());
+            free_recycled_vector(d_recycle_C.front());
+            d_recycle_U.erase(d_recycle_U.begin());
+            d_recycle_C.erase(d_recycle_C.begin());
+        }
+    }
+    return;
+} // setRecycledSubspaceSize
+
+int PETScKrylovLinearSolver::getRecycledSubspaceSize() const
+{
+    return d_recycle_subspace_size;
+} // getRecycledSubspaceSize
+
+void PETScKrylovLinearSolver::clearRecycledSubspace()
+{
+    for (unsigned int k = 0; k < d_recycle_U.size(); ++k)
+    {
+        free_recycled_vector(d_recycle_U[k]);
+        free_recycled_vector(d_recycle_C[k]);
+    }
+    d_recycle_U.clear();
+    d_recycle_C.clear();
+    d_recycle_subspace_needs_reset = false;
+    free_recycled_vector(d_recycle_u_new);
+    free_recycled_vector(d_recycle_c_new);
+    free_recycled_vector(d_recycle_x0);
+    free_recycled_vector(d_recycle_r);
+    return;
+} // clearRecycledSubspace
+
 const KSP& PETScKrylovLinearSolver::getPETScKSP() const
 {
     return d_petsc_ksp;
@@ -218,6 +308,7 @@ bool PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAM
     TBOX_ASSERT(d_petsc_ksp);
 #endif
     resetKSPOptions();
+    if (d_recycle_subspace_needs_reset) resetRecycledSubspace();
 
     // Allocate scratch data.
     if (d_b) d_b->allocateVectorData();
@@ -236,16 +327,36 @@ bool PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAM
         PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_b, d_b);
         d_A->setHomogeneousBc(true);
     }
+    PetscBool initial_guess_nonzero = PETSC_FALSE;
+    if (d_recycle_subspace_size > 0)
+    {
+        ierr = KSPGetInitialGuessNonzero(d_petsc_ksp, &initial_guess_nonzero);
+        IBTK_CHKERRQ(ierr);
+        projectInitialGuess(x, d_homogeneous_bc ? b : *d_b);
+    }
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(d_petsc_x));
     IBTK_CHKERRQ(ierr);
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(d_petsc_b));
     IBTK_CHKERRQ(ierr);
     ierr = KSPSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
     IBTK_CHKERRQ(ierr);
+    if (d_recycle_subspace_size > 0)
+    {
+        // Restore the initial guess option, which is modified by
+        // projectInitialGuess().
+        ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, initial_guess_nonzero);
+        IBTK_CHKERRQ(ierr);
+    }
     ierr = KSPGetIterationNumber(d_petsc_ksp, &d_current_iterations);
     IBTK_CHKERRQ(ierr);
     ierr = KSPGetResidualNorm(d_petsc_ksp, &d_current_residual_norm);
     IBTK_CHKERRQ(ierr);
+    if (PerformanceTrace::isRecording())
+    {
+        PerformanceTrace::addToCounter(PerformanceTrace::registerCounter(d_object_name + "::iterations"),
+                                       d_current_iterations);
+    }
+    if (d_recycle_subspace_size > 0) updateRecycledSubspace(x);
     d_A->setHomogeneousBc(d_homogeneous_bc);
 
     // Determine the convergence reason.
@@ -380,6 +491,12 @@ void PETScKrylovLinearSolver::initializeSolverState(const SAMRAIVectorReal<NDIM,
     // Configure the nullspace object.
     resetKSPNullspace();
 
+    // Discard the recycled subspace if it is no longer valid; otherwise, mark
+    // it to be updated at the next solve to correspond to the (possibly
+    // modified) linear operator.
+    if (d_recycle_x0 && !recycledSubspaceIsValid(x)) clearRecycledSubspace();
+    d_recycle_subspace_needs_reset = d_recycle_subspace_size > 0 && !d_recycle_U.empty();
+
     // Indicate that the solver is initialized.
     d_reinitializing_solver = false;
     d_is_initialized = true;
@@ -772,6 +889,170 @@ void PETScKrylovLinearSolver::deallocateNullspaceData()
     return;
 } // deallocateNullspaceData
 
+bool PETScKrylovLinearSolver::recycledSubspaceIsValid(const SAMRAIVectorReal<NDIM, double>& x) const
+{
+    if (!d_recycle_x0) return false;
+    const SAMRAIVectorReal<NDIM, double>& y = *d_recycle_x0;
+    Pointer<PatchHierarchy<NDIM> > hierarchy = y.getPatchHierarchy();
+    if (hierarchy != x.getPatchHierarchy()) return false;
+    if (y.getCoarsestLevelNumber() != x.getCoarsestLevelNumber()) return false;
+    if (y.getFinestLevelNumber() != x.getFinestLevelNumber()) return false;
+    if (y.getFinestLevelNumber() > hierarchy->getFinestLevelNumber()) return false;
+    if (y.getNumberOfComponents() != x.getNumberOfComponents()) return false;
+    for (int comp = 0; comp < y.getNumberOfComponents(); ++comp)
+    {
+        if (y.getComponentVariable(comp) != x.getComponentVariable(comp)) return false;
+        const int data_idx = y.getComponentDescriptorIndex(comp);
+        for (int ln = y.getCoarsestLevelNumber(); ln <= y.getFinestLevelNumber(); ++ln)
+        {
+            // Patch data are deallocated when a level is regenerated, so this
+            // detects changes to the patch hierarchy configuration.
+            if (!hierarchy->getPatchLevel(ln)->checkAllocated(data_idx)) return false;
+        }
+    }
+    return true;
+} // recycledSubspaceIsValid
+
+void PETScKrylovLinearSolver::resetRecycledSubspace()
+{
+    if (d_recycle_U.empty()) return;
+
+    // Recompute C = A*U using the current linear operator and re-orthonormalize
+    // the recycled vectors.
+    std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > recycle_U, recycle_C;
+    recycle_U.swap(d_recycle_U);
+    recycle_C.swap(d_recycle_C);
+    d_A->setHomogeneousBc(true);
+    Pointer<SAMRAIVectorReal<NDIM, double> > u_new = d_recycle_u_new, c_new = d_recycle_c_new;
+    for (unsigned int k = 0; k < recycle_U.size(); ++k)
+    {
+        d_recycle_u_new = recycle_U[k];
+        d_recycle_c_new = recycle_C[k];
+        d_A->apply(*d_recycle_u_new, *d_recycle_c_new);
+        if (!appendRecycledVector())
+        {
+            free_recycled_vector(d_recycle_u_new);
+            free_recycled_vector(d_recycle_c_new);
+        }
+    }
+    d_recycle_u_new = u_new;
+    d_recycle_c_new = c_new;
+    d_recycle_subspace_needs_reset = false;
+    d_A->setHomogeneousBc(d_homogeneous_bc);
+    return;
+} // resetRecycledSubspace
+
+void PETScKrylovLinearSolver::projectInitialGuess(SAMRAIVectorReal<NDIM, double>& x,
+                                                  SAMRAIVectorReal<NDIM, double>& b)
+{
+    if (!d_recycle_x0)
+    {
+        d_recycle_x0 = allocate_recycled_vector(x, d_object_name + "::recycle_x0");
+        d_recycle_r = allocate_recycled_vector(x, d_object_name + "::recycle_r");
+    }
+    if (!d_recycle_u_new)
+    {
+        d_recycle_u_new = allocate_recycled_vector(x, d_object_name + "::recycle_u");
+        d_recycle_c_new = allocate_recycled_vector(x, d_object_name + "::recycle_c");
+    }
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_ptr(&x, false);
+    if (!d_initial_guess_nonzero) x.setToScalar(0.0);
+
+    // Minimize the initial residual over the recycled subspace: because the
+    // columns of C = A*U are orthonormal, x0 <- x0 + U*C^T*(b - A*x0) ensures
+    // that the initial residual is orthogonal to span(C).
+    const int num_vecs = static_cast<int>(d_recycle_U.size());
+    if (num_vecs > 0)
+    {
+        d_A->apply(x, *d_recycle_r);
+        d_recycle_r->subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&b, false), d_recycle_r);
+        std::vector<double> alpha(num_vecs);
+        for (int k = 0; k < num_vecs; ++k)
+        {
+            alpha[k] = d_recycle_C[k]->dot(d_recycle_r, /*local_only*/ true);
+        }
+        SAMRAI_MPI::sumReduction(&alpha[0], num_vecs);
+        for (int k = 0; k < num_vecs; ++k)
+        {
+            x.axpy(alpha[k], d_recycle_U[k], x_ptr);
+        }
+    }
+    d_recycle_x0->copyVector(x_ptr);
+
+    // The projected initial guess is generally nonzero.  The initial guess
+    // option is restored by solveSystem() once the solve is complete.
+    if (!d_initial_guess_nonzero)
+    {
+        int ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // projectInitialGuess
+
+void PETScKrylovLinearSolver::updateRecycledSubspace(SAMRAIVectorReal<NDIM, double>& x)
+{
+    // Add the correction computed by the Krylov method to the recycled
+    // subspace.
+    d_recycle_u_new->subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false), d_recycle_x0);
+    d_A->apply(*d_recycle_u_new, *d_recycle_c_new);
+    if (!appendRecycledVector()) return;
+
+    // Drop the oldest vectors when the subspace exceeds its maximum size,
+    // reusing their storage for subsequent candidate vectors.
+    if (static_cast<int>(d_recycle_U.size()) > d_recycle_subspace_size)
+    {
+        d_recycle_u_new = d_recycle_U.front();
+        d_recycle_c_new = d_recycle_C.front();
+        d_recycle_U.erase(d_recycle_U.begin());
+        d_recycle_C.erase(d_recycle_C.begin());
+    }
+    else
+    {
+        d_recycle_u_new = allocate_recycled_vector(x, d_object_name + "::recycle_u");
+        d_recycle_c_new = allocate_recycled_vector(x, d_object_name + "::recycle_c");
+    }
+    return;
+} // updateRecycledSubspace
+
+bool PETScKrylovLinearSolver::appendRecycledVector()
+{
+    // Orthogonalize c_new against the columns of C using two passes of
+    // classical Gram-Schmidt, applying the same transformation to u_new so that
+    // the relation C = A*U is maintained.
+    const double c_norm_initial = d_recycle_c_new->L2Norm();
+    const int num_vecs = static_cast<int>(d_recycle_C.size());
+    if (num_vecs > 0)
+    {
+        std::vector<double> beta(num_vecs);
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            for (int k = 0; k < num_vecs; ++k)
+            {
+                beta[k] = d_recycle_C[k]->dot(d_recycle_c_new, /*local_only*/ true);
+            }
+            SAMRAI_MPI::sumReduction(&beta[0], num_vecs);
+            for (int k = 0; k < num_vecs; ++k)
+            {
+                d_recycle_c_new->axpy(-beta[k], d_recycle_C[k], d_recycle_c_new);
+                d_recycle_u_new->axpy(-beta[k], d_recycle_U[k], d_recycle_u_new);
+            }
+        }
+    }
+    const double c_norm = d_recycle_c_new->L2Norm();
+
+    // Reject the candidate vectors if they are (numerically) linearly
+    // dependent upon the recycled subspace.
+    if (!(c_norm_initial > 0.0) || c_norm <= RECYCLE_DEPENDENCE_TOL * c_norm_initial) return false;
+
+    d_recycle_c_new->scale(1.0 / c_norm, d_recycle_c_new);
+    d_recycle_u_new->scale(1.0 / c_norm, d_recycle_u_new);
+    d_recycle_U.push_back(d_recycle_u_new);
+    d_recycle_C.push_back(d_recycle_c_new);
+    d_recycle_u_new.setNull();
+    d_recycle_c_new.setNull();
+    return true;
+} // appendRecycledVector
+
 PetscErrorCode PETScKrylovLinearSolver::MatVecMult_SAMRAI(Mat A, Vec x, Vec y)
 {
     int ierr;
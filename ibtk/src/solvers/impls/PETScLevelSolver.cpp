@@ -76,7 +76,7 @@ static Timer* t_deallocate_solver_state;
 
 PETScLevelSolver::PETScLevelSolver()
     : d_hierarchy(), d_level_num(-1), d_ksp_type(KSPGMRES), d_options_prefix(""), d_petsc_ksp(NULL), d_petsc_mat(NULL),
-      d_petsc_x(NULL), d_petsc_b(NULL)
+      d_petsc_pc(NULL), d_petsc_nullsp(NULL), d_petsc_x(NULL), d_petsc_b(NULL), d_reuse_petsc_objects(false)
 {
     // Setup default options.
     d_max_iterations = 10000;
@@ -102,6 +102,7 @@ PETScLevelSolver::~PETScLevelSolver()
         TBOX_ERROR(d_object_name << "::~PETScLevelSolver()\n"
                                  << "  subclass must call deallocateSolverState in subclass destructor" << std::endl);
     }
+    deallocatePETScObjects();
     return;
 } // ~PETScLevelSolver
 
@@ -241,10 +242,14 @@ void PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double
     // Perform specialized operations to initialize solver state();
     initializeSolverStateSpecialized(x, b);
 
-    // Setup PETSc objects.
+    // Setup PETSc objects.  The KSP object is retained when the subclass reuses
+    // the PETSc objects from a previous initialization.
     int ierr;
-    ierr = KSPCreate(PETSC_COMM_WORLD, &d_petsc_ksp);
-    IBTK_CHKERRQ(ierr);
+    if (!d_petsc_ksp)
+    {
+        ierr = KSPCreate(PETSC_COMM_WORLD, &d_petsc_ksp);
+        IBTK_CHKERRQ(ierr);
+    }
     ierr = KSPSetOperators(d_petsc_ksp, d_petsc_mat, d_petsc_pc, d_petsc_ksp_ops_flag);
     IBTK_CHKERRQ(ierr);
     ierr = KSPSetType(d_petsc_ksp, d_ksp_type.c_str());
@@ -256,6 +261,12 @@ void PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double
     }
     ierr = KSPSetFromOptions(d_petsc_ksp);
     IBTK_CHKERRQ(ierr);
+    if (d_petsc_nullsp)
+    {
+        ierr = MatNullSpaceDestroy(&d_petsc_nullsp);
+        IBTK_CHKERRQ(ierr);
+        d_petsc_nullsp = NULL;
+    }
     if (d_nullspace_contains_constant_vec || !d_nullspace_basis_vecs.empty()) setupNullspace();
 
     // Indicate that the solver is initialized.
@@ -274,31 +285,9 @@ void PETScLevelSolver::deallocateSolverState()
     // Perform specialized operations to deallocate solver state.
     deallocateSolverStateSpecialized();
 
-    // Deallocate PETSc objects.
-    int ierr;
-    ierr = KSPDestroy(&d_petsc_ksp);
-    IBTK_CHKERRQ(ierr);
-    if (d_petsc_mat != d_petsc_pc)
-    {
-        ierr = MatDestroy(&d_petsc_pc);
-        IBTK_CHKERRQ(ierr);
-    }
-    ierr = MatDestroy(&d_petsc_mat);
-    IBTK_CHKERRQ(ierr);
-    if (d_nullspace_contains_constant_vec || !d_nullspace_basis_vecs.empty())
-    {
-        ierr = MatNullSpaceDestroy(&d_petsc_nullsp);
-        IBTK_CHKERRQ(ierr);
-    }
-    ierr = VecDestroy(&d_petsc_x);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecDestroy(&d_petsc_b);
-    IBTK_CHKERRQ(ierr);
-
-    d_petsc_ksp = NULL;
-    d_petsc_mat = NULL;
-    d_petsc_x = NULL;
-    d_petsc_b = NULL;
+    // Deallocate PETSc objects, unless they are to be reused by a subsequent
+    // call to initializeSolverState().
+    if (!d_reuse_petsc_objects) deallocatePETScObjects();
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -326,6 +315,49 @@ void PETScLevelSolver::init(Pointer<Database> input_db, const std::string& defau
     return;
 } // init
 
+void PETScLevelSolver::deallocatePETScObjects()
+{
+    int ierr;
+    if (d_petsc_ksp)
+    {
+        ierr = KSPDestroy(&d_petsc_ksp);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_petsc_pc && d_petsc_pc != d_petsc_mat)
+    {
+        ierr = MatDestroy(&d_petsc_pc);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_petsc_mat)
+    {
+        ierr = MatDestroy(&d_petsc_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_petsc_nullsp)
+    {
+        ierr = MatNullSpaceDestroy(&d_petsc_nullsp);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_petsc_x)
+    {
+        ierr = VecDestroy(&d_petsc_x);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_petsc_b)
+    {
+        ierr = VecDestroy(&d_petsc_b);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    d_petsc_ksp = NULL;
+    d_petsc_mat = NULL;
+    d_petsc_pc = NULL;
+    d_petsc_nullsp = NULL;
+    d_petsc_x = NULL;
+    d_petsc_b = NULL;
+    return;
+} // deallocatePETScObjects
+
 void PETScLevelSolver::setupNullspace()
 {
     int ierr;
@@ -36,6 +36,7 @@
 #include <stddef.h>
 #include <algorithm>
 #include <ostream>
+#include <vector>
 
 #include "ibtk/PETScMultiVec.h"
 #include "ibtk/ibtk_utilities.h"
@@ -55,13 +56,52 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+struct Vec_MultiVecPool
+{
+    PetscInt num_refs;             // the number of vector objects that share the pool
+    std::vector<Vec*> free_arrays; // arrays of component vector objects that are available for reuse
+};
+
 struct Vec_MultiVec
 {
-    PetscInt n;           // the number of component vector objects
-    Vec* array;           // the array  of component vector objects
-    Vec* array_allocated; // if the array was allocated by PetscMalloc, this is its pointer
+    PetscInt n;             // the number of component vector objects
+    Vec* array;             // the array  of component vector objects
+    Vec* array_allocated;   // if the array was allocated by PetscMalloc, this is its pointer
+    Vec_MultiVecPool* pool; // the pool shared by this vector and all vectors duplicated from it
 };
 
+#undef __FUNCT__
+#define __FUNCT__ "VecMultiVecHasLocalOps_Private"
+bool VecMultiVecHasLocalOps_Private(const Vec_MultiVec* mv)
+{
+    bool has_local_ops = true;
+    for (PetscInt k = 0; k < mv->n && has_local_ops; ++k)
+    {
+        const _VecOps* ops = mv->array[k]->ops;
+        has_local_ops = ops->dot_local && ops->tdot_local && ops->norm_local && ops->mdot_local && ops->mtdot_local;
+    }
+    return has_local_ops;
+} // VecMultiVecHasLocalOps_Private
+
+#undef __FUNCT__
+#define __FUNCT__ "VecMultiVecAllreduce_Private"
+PetscErrorCode VecMultiVecAllreduce_Private(Vec v, PetscScalar* vals, PetscInt n, MPI_Op op)
+{
+    PetscErrorCode ierr;
+    MPI_Comm comm;
+    ierr = PetscObjectGetComm(reinterpret_cast<PetscObject>(v), &comm);
+    CHKERRQ(ierr);
+    ierr = MPI_Allreduce(MPI_IN_PLACE, vals, n, MPIU_SCALAR, op, comm);
+    CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+} // VecMultiVecAllreduce_Private
+
+PetscErrorCode VecDot_local_MultiVec(Vec x, Vec y, PetscScalar* val);
+PetscErrorCode VecTDot_local_MultiVec(Vec x, Vec y, PetscScalar* val);
+PetscErrorCode VecNorm_local_MultiVec(Vec x, NormType type, PetscScalar* val);
+PetscErrorCode VecMDot_local_MultiVec(Vec x, PetscInt nv, const Vec* y, PetscScalar* val);
+PetscErrorCode VecMTDot_local_MultiVec(Vec x, PetscInt nv, const Vec* y, PetscScalar* val);
+
 #undef __FUNCT__
 #define __FUNCT__ "VecDuplicate_MultiVec"
 PetscErrorCode VecDuplicate_MultiVec(Vec v, Vec* newv)
@@ -75,12 +115,27 @@ PetscErrorCode VecDuplicate_MultiVec(Vec v, Vec* newv)
 #endif
     PetscErrorCode ierr;
     Vec* newvarray;
-    ierr = PetscMalloc(mv->n * sizeof(Vec), &newvarray);
-    CHKERRQ(ierr);
-    for (PetscInt k = 0; k < mv->n; ++k)
+    if (!mv->pool->free_arrays.empty())
     {
-        ierr = VecDuplicate(mv->array[k], &newvarray[k]);
+        // Reuse component vectors that were released by a previously
+        // destroyed duplicate.
+        newvarray = mv->pool->free_arrays.back();
+        mv->pool->free_arrays.pop_back();
+        for (PetscInt k = 0; k < mv->n; ++k)
+        {
+            ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(newvarray[k]));
+            CHKERRQ(ierr);
+        }
+    }
+    else
+    {
+        ierr = PetscMalloc(mv->n * sizeof(Vec), &newvarray);
         CHKERRQ(ierr);
+        for (PetscInt k = 0; k < mv->n; ++k)
+        {
+            ierr = VecDuplicate(mv->array[k], &newvarray[k]);
+            CHKERRQ(ierr);
+        }
     }
     MPI_Comm comm;
     ierr = PetscObjectGetComm((PetscObject)v, &comm);
@@ -92,6 +147,9 @@ PetscErrorCode VecDuplicate_MultiVec(Vec v, Vec* newv)
     TBOX_ASSERT(mnewv);
 #endif
     mnewv->array_allocated = newvarray;
+    delete mnewv->pool;
+    mnewv->pool = mv->pool;
+    mnewv->pool->num_refs += 1;
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(*newv));
     CHKERRQ(ierr);
     PetscFunctionReturn(0);
@@ -113,6 +171,16 @@ PetscErrorCode VecDot_MultiVec(Vec x, Vec y, PetscScalar* val)
     TBOX_ASSERT(mx->n == my->n);
 #endif
     PetscErrorCode ierr;
+    if (VecMultiVecHasLocalOps_Private(mx))
+    {
+        // Combine the local contributions of all components in a single
+        // reduction.
+        ierr = VecDot_local_MultiVec(x, y, val);
+        CHKERRQ(ierr);
+        ierr = VecMultiVecAllreduce_Private(x, val, 1, MPI_SUM);
+        CHKERRQ(ierr);
+        PetscFunctionReturn(0);
+    }
     *val = 0.0;
     for (PetscInt k = 0; k < mx->n; ++k)
     {
@@ -136,6 +204,20 @@ PetscErrorCode VecMDot_MultiVec(Vec x, PetscInt nv, const Vec* y, PetscScalar* v
     }
 #endif
     PetscErrorCode ierr;
+    Vec_MultiVec* mx = static_cast<Vec_MultiVec*>(x->data);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mx);
+#endif
+    if (VecMultiVecHasLocalOps_Private(mx))
+    {
+        // Compute all of the local products before performing a single
+        // reduction.
+        ierr = VecMDot_local_MultiVec(x, nv, y, val);
+        CHKERRQ(ierr);
+        ierr = VecMultiVecAllreduce_Private(x, val, nv, MPI_SUM);
+        CHKERRQ(ierr);
+        PetscFunctionReturn(0);
+    }
     for (PetscInt i = 0; i < nv; ++i)
     {
         ierr = VecDot_MultiVec(x, y[i], &val[i]);
@@ -156,6 +238,38 @@ PetscErrorCode VecNorm_MultiVec(Vec x, NormType type, PetscScalar* val)
     TBOX_ASSERT(mx);
 #endif
     PetscErrorCode ierr;
+    if (VecMultiVecHasLocalOps_Private(mx))
+    {
+        // Combine the local contributions of all components in a single
+        // reduction.
+        ierr = VecNorm_local_MultiVec(x, type, val);
+        CHKERRQ(ierr);
+        if (type == NORM_1)
+        {
+            ierr = VecMultiVecAllreduce_Private(x, val, 1, MPI_SUM);
+            CHKERRQ(ierr);
+        }
+        else if (type == NORM_2)
+        {
+            *val = (*val) * (*val);
+            ierr = VecMultiVecAllreduce_Private(x, val, 1, MPI_SUM);
+            CHKERRQ(ierr);
+            *val = sqrt(*val);
+        }
+        else if (type == NORM_INFINITY)
+        {
+            ierr = VecMultiVecAllreduce_Private(x, val, 1, MPI_MAX);
+            CHKERRQ(ierr);
+        }
+        else if (type == NORM_1_AND_2)
+        {
+            val[1] = val[1] * val[1];
+            ierr = VecMultiVecAllreduce_Private(x, val, 2, MPI_SUM);
+            CHKERRQ(ierr);
+            val[1] = sqrt(val[1]);
+        }
+        PetscFunctionReturn(0);
+    }
     if (type == NORM_1)
     {
         *val = 0.0;
@@ -216,6 +330,14 @@ PetscErrorCode VecTDot_MultiVec(Vec x, Vec y, PetscScalar* val)
     TBOX_ASSERT(mx->n == my->n);
 #endif
     PetscErrorCode ierr;
+    if (VecMultiVecHasLocalOps_Private(mx))
+    {
+        ierr = VecTDot_local_MultiVec(x, y, val);
+        CHKERRQ(ierr);
+        ierr = VecMultiVecAllreduce_Private(x, val, 1, MPI_SUM);
+        CHKERRQ(ierr);
+        PetscFunctionReturn(0);
+    }
     *val = 0.0;
     for (PetscInt k = 0; k < mx->n; ++k)
     {
@@ -239,6 +361,20 @@ PetscErrorCode VecMTDot_MultiVec(Vec x, PetscInt nv, const Vec* y, PetscScalar*
     }
 #endif
     PetscErrorCode ierr;
+    Vec_MultiVec* mx = static_cast<Vec_MultiVec*>(x->data);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mx);
+#endif
+    if (VecMultiVecHasLocalOps_Private(mx))
+    {
+        // Compute all of the local products before performing a single
+        // reduction.
+        ierr = VecMTDot_local_MultiVec(x, nv, y, val);
+        CHKERRQ(ierr);
+        ierr = VecMultiVecAllreduce_Private(x, val, nv, MPI_SUM);
+        CHKERRQ(ierr);
+        PetscFunctionReturn(0);
+    }
     for (PetscInt i = 0; i < nv; ++i)
     {
         ierr = VecTDot_MultiVec(x, y[i], &val[i]);
@@ -407,11 +543,25 @@ PetscErrorCode VecMAXPY_MultiVec(Vec y, PetscInt nv, const PetscScalar* alpha, V
     {
         TBOX_ASSERT(x[i]);
     }
+#endif
+    Vec_MultiVec* my = static_cast<Vec_MultiVec*>(y->data);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(my);
 #endif
     PetscErrorCode ierr;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::vector<Vec> component_x(nv);
+    for (PetscInt k = 0; k < my->n && nv > 0; ++k)
     {
-        ierr = VecAXPY_MultiVec(y, alpha[i], x[i]);
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            Vec_MultiVec* mx = static_cast<Vec_MultiVec*>(x[i]->data);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(mx);
+            TBOX_ASSERT(my->n == mx->n);
+#endif
+            component_x[i] = mx->array[k];
+        }
+        ierr = VecMAXPY(my->array[k], nv, alpha, &component_x[0]);
         CHKERRQ(ierr);
     }
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
@@ -676,13 +826,25 @@ PetscErrorCode VecDestroy_MultiVec(Vec v)
 #if !defined(NDEBUG)
         TBOX_ASSERT(mv->array_allocated == mv->array);
 #endif
-        for (PetscInt k = 0; k < mv->n; ++k)
+        // Return the component vectors to the pool so that they may be reused
+        // by subsequent duplicates.
+        mv->pool->free_arrays.push_back(mv->array_allocated);
+    }
+    mv->pool->num_refs -= 1;
+    if (mv->pool->num_refs == 0)
+    {
+        for (unsigned int l = 0; l < mv->pool->free_arrays.size(); ++l)
         {
-            ierr = VecDestroy(&mv->array_allocated[k]);
+            Vec* array = mv->pool->free_arrays[l];
+            for (PetscInt k = 0; k < mv->n; ++k)
+            {
+                ierr = VecDestroy(&array[k]);
+                CHKERRQ(ierr);
+            }
+            ierr = PetscFree(array);
             CHKERRQ(ierr);
         }
-        ierr = PetscFree(mv->array_allocated);
-        CHKERRQ(ierr);
+        delete mv->pool;
     }
     ierr = PetscFree(mv);
     CHKERRQ(ierr);
@@ -741,7 +903,7 @@ PetscErrorCode VecTDot_local_MultiVec(Vec x, Vec y, PetscScalar* val)
     {
 #if !defined(NDEBUG)
         TBOX_ASSERT(mx->array[k]->ops->tdot_local);
-        TBOX_ASSERT(mx->array[k]->ops->tdot_local == my->array[k]->ops->dot_local);
+        TBOX_ASSERT(mx->array[k]->ops->tdot_local == my->array[k]->ops->tdot_local);
 #endif
         PetscScalar component_val;
         ierr = (*mx->array[k]->ops->tdot_local)(mx->array[k], my->array[k], &component_val);
@@ -808,10 +970,20 @@ PetscErrorCode VecNorm_local_MultiVec(Vec x, NormType type, PetscScalar* val)
     }
     else if (type == NORM_1_AND_2)
     {
-        ierr = VecNorm_local_MultiVec(x, NORM_1, &val[0]);
-        CHKERRQ(ierr);
-        ierr = VecNorm_local_MultiVec(x, NORM_2, &val[1]);
-        CHKERRQ(ierr);
+        val[0] = 0.0;
+        val[1] = 0.0;
+        for (PetscInt k = 0; k < mx->n; ++k)
+        {
+#if !defined(NDEBUG)
+            TBOX_ASSERT(mx->array[k]->ops->norm_local);
+#endif
+            PetscScalar component_val[2];
+            ierr = (*mx->array[k]->ops->norm_local)(mx->array[k], type, component_val);
+            CHKERRQ(ierr);
+            val[0] += component_val[0];
+            val[1] += component_val[1] * component_val[1];
+        }
+        val[1] = sqrt(val[1]);
     }
     PetscFunctionReturn(0);
 } // VecNorm_local_MultiVec
@@ -826,12 +998,38 @@ PetscErrorCode VecMDot_local_MultiVec(Vec x, PetscInt nv, const Vec* y, PetscSca
     {
         TBOX_ASSERT(y[i]);
     }
+#endif
+    Vec_MultiVec* mx = static_cast<Vec_MultiVec*>(x->data);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mx);
 #endif
     PetscErrorCode ierr;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::fill(val, val + nv, 0.0);
+    std::vector<Vec> component_y(nv);
+    std::vector<PetscScalar> component_val(nv);
+    for (PetscInt k = 0; k < mx->n; ++k)
     {
-        ierr = VecDot_local_MultiVec(x, y[i], &val[i]);
-        CHKERRQ(ierr);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(mx->array[k]->ops->mdot_local);
+#endif
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            Vec_MultiVec* my = static_cast<Vec_MultiVec*>(y[i]->data);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(my);
+            TBOX_ASSERT(mx->n == my->n);
+#endif
+            component_y[i] = my->array[k];
+        }
+        if (nv > 0)
+        {
+            ierr = (*mx->array[k]->ops->mdot_local)(mx->array[k], nv, &component_y[0], &component_val[0]);
+            CHKERRQ(ierr);
+        }
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] += component_val[i];
+        }
     }
     PetscFunctionReturn(0);
 } // VecMDot_local_MultiVec
@@ -846,12 +1044,38 @@ PetscErrorCode VecMTDot_local_MultiVec(Vec x, PetscInt nv, const Vec* y, PetscSc
     {
         TBOX_ASSERT(y[i]);
     }
+#endif
+    Vec_MultiVec* mx = static_cast<Vec_MultiVec*>(x->data);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mx);
 #endif
     PetscErrorCode ierr;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::fill(val, val + nv, 0.0);
+    std::vector<Vec> component_y(nv);
+    std::vector<PetscScalar> component_val(nv);
+    for (PetscInt k = 0; k < mx->n; ++k)
     {
-        ierr = VecTDot_local_MultiVec(x, y[i], &val[i]);
-        CHKERRQ(ierr);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(mx->array[k]->ops->mtdot_local);
+#endif
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            Vec_MultiVec* my = static_cast<Vec_MultiVec*>(y[i]->data);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(my);
+            TBOX_ASSERT(mx->n == my->n);
+#endif
+            component_y[i] = my->array[k];
+        }
+        if (nv > 0)
+        {
+            ierr = (*mx->array[k]->ops->mtdot_local)(mx->array[k], nv, &component_y[0], &component_val[0]);
+            CHKERRQ(ierr);
+        }
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] += component_val[i];
+        }
     }
     PetscFunctionReturn(0);
 } // VecMTDot_local_MultiVec
@@ -890,8 +1114,25 @@ PetscErrorCode VecDotNorm2_MultiVec(Vec s, Vec t, PetscScalar* dp, PetscScalar*
 #if !defined(NDEBUG)
     TBOX_ASSERT(s);
     TBOX_ASSERT(t);
+#endif
+    Vec_MultiVec* ms = static_cast<Vec_MultiVec*>(s->data);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(ms);
 #endif
     PetscErrorCode ierr;
+    if (VecMultiVecHasLocalOps_Private(ms))
+    {
+        PetscScalar val[2];
+        ierr = VecDot_local_MultiVec(s, t, &val[0]);
+        CHKERRQ(ierr);
+        ierr = VecDot_local_MultiVec(t, t, &val[1]);
+        CHKERRQ(ierr);
+        ierr = VecMultiVecAllreduce_Private(s, val, 2, MPI_SUM);
+        CHKERRQ(ierr);
+        *dp = val[0];
+        *nm = val[1];
+        PetscFunctionReturn(0);
+    }
     ierr = VecDot_MultiVec(s, t, dp);
     CHKERRQ(ierr);
     ierr = VecDot_MultiVec(t, t, nm);
@@ -951,6 +1192,8 @@ PetscErrorCode VecCreateMultiVec(MPI_Comm comm, PetscInt n, Vec vv[], Vec* v)
     mv->n = n;
     mv->array = vv;
     mv->array_allocated = NULL;
+    mv->pool = new Vec_MultiVecPool();
+    mv->pool->num_refs = 1;
     (*v)->data = mv;
     (*v)->petscnative = PETSC_FALSE;
     (*v)->map->n = 0;
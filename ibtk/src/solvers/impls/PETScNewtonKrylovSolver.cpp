@@ -52,6 +52,7 @@
 #include "ibtk/PETScSAMRAIVectorReal.h"
 #include "ibtk/PETScSNESFunctionGOWrapper.h"
 #include "ibtk/PETScSNESJacobianJOWrapper.h"
+#include "ibtk/PerformanceTrace.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "mpi.h"
@@ -237,6 +238,13 @@ bool PETScNewtonKrylovSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAM
     IBTK_CHKERRQ(ierr);
     ierr = SNESGetFunctionNorm(d_petsc_snes, &d_current_residual_norm);
     IBTK_CHKERRQ(ierr);
+    if (PerformanceTrace::isRecording())
+    {
+        PerformanceTrace::addToCounter(PerformanceTrace::registerCounter(d_object_name + "::iterations"),
+                                       d_current_iterations);
+        PerformanceTrace::addToCounter(PerformanceTrace::registerCounter(d_object_name + "::linear_iterations"),
+                                       d_current_linear_iterations);
+    }
 
     // Determine the convergence reason.
     SNESConvergedReason reason;
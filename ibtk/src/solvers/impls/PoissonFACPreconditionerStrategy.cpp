@@ -65,6 +65,7 @@
 #include "ibtk/FACPreconditionerStrategy.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/LocalCopyFillPattern.h"
 #include "ibtk/PoissonFACPreconditionerStrategy.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
@@ -108,11 +109,13 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
       d_prolongation_method("DEFAULT"), d_restriction_method("DEFAULT"), d_coarse_solver_type("DEFAULT"),
       d_coarse_solver_default_options_prefix(default_options_prefix + "_coarse"),
       d_coarse_solver_rel_residual_tol(1.0e-5), d_coarse_solver_abs_residual_tol(1.0e-50),
-      d_coarse_solver_max_iterations(10), d_context(NULL), d_bc_op(NULL), d_cf_bdry_op(), d_op_stencil_fill_pattern(),
+      d_coarse_solver_max_iterations(10), d_use_tiled_kernels(false), d_tile_width(0), d_use_threaded_tiles(false),
+      d_use_threaded_patch_loops(false), d_context(NULL), d_bc_op(NULL), d_cf_bdry_op(), d_op_stencil_fill_pattern(),
       d_prolongation_refine_operator(), d_prolongation_refine_patch_strategy(), d_prolongation_refine_algorithm(),
       d_prolongation_refine_schedules(), d_restriction_coarsen_operator(), d_restriction_coarsen_algorithm(),
       d_restriction_coarsen_schedules(), d_ghostfill_nocoarse_refine_algorithm(),
-      d_ghostfill_nocoarse_refine_schedules(), d_synch_refine_algorithm(), d_synch_refine_schedules()
+      d_ghostfill_nocoarse_refine_schedules(), d_ghostfill_nocoarse_fill_pattern(), d_synch_refine_algorithm(),
+      d_synch_refine_schedules(), d_synch_local_copy_fill_pattern()
 {
     // Initialize the Poisson specifications.
     d_poisson_spec.setCZero();
@@ -142,6 +145,11 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
             d_coarse_solver_abs_residual_tol = input_db->getDouble("coarse_solver_abs_residual_tol");
         if (input_db->keyExists("coarse_solver_max_iterations"))
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
+        if (input_db->keyExists("use_tiled_kernels")) d_use_tiled_kernels = input_db->getBool("use_tiled_kernels");
+        if (input_db->keyExists("tile_width")) d_tile_width = input_db->getInteger("tile_width");
+        if (input_db->keyExists("use_threaded_tiles")) d_use_threaded_tiles = input_db->getBool("use_threaded_tiles");
+        if (input_db->keyExists("use_threaded_patch_loops"))
+            d_use_threaded_patch_loops = input_db->getBool("use_threaded_patch_loops");
     }
 
     // Setup scratch variables.
@@ -415,10 +423,20 @@ void PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVecto
     d_prolongation_refine_algorithm->registerRefine(
         d_scratch_idx, sol_idx, d_scratch_idx, d_prolongation_refine_operator, d_op_stencil_fill_pattern);
     d_restriction_coarsen_algorithm->registerCoarsen(d_scratch_idx, rhs_idx, d_restriction_coarsen_operator);
+    // NOTE: The same-level schedules are set up so that copies between local
+    // patches are performed directly by the fill pattern objects.  These
+    // objects persist when the operator is reinitialized, because they keep
+    // track of the copies for levels whose schedules are not regenerated.
+    if (!d_ghostfill_nocoarse_fill_pattern)
+        d_ghostfill_nocoarse_fill_pattern = new LocalCopyFillPattern(d_op_stencil_fill_pattern);
+    d_ghostfill_nocoarse_fill_pattern->setFillPattern(d_op_stencil_fill_pattern);
+    if (!d_synch_local_copy_fill_pattern)
+        d_synch_local_copy_fill_pattern = new LocalCopyFillPattern(d_synch_fill_pattern);
+    d_synch_local_copy_fill_pattern->setFillPattern(d_synch_fill_pattern);
     d_ghostfill_nocoarse_refine_algorithm->registerRefine(
-        sol_idx, sol_idx, sol_idx, Pointer<RefineOperator<NDIM> >(), d_op_stencil_fill_pattern);
+        sol_idx, sol_idx, sol_idx, Pointer<RefineOperator<NDIM> >(), d_ghostfill_nocoarse_fill_pattern);
     d_synch_refine_algorithm->registerRefine(
-        sol_idx, sol_idx, sol_idx, Pointer<RefineOperator<NDIM> >(), d_synch_fill_pattern);
+        sol_idx, sol_idx, sol_idx, Pointer<RefineOperator<NDIM> >(), d_synch_local_copy_fill_pattern);
 
     for (int dst_ln = std::max(d_coarsest_ln + 1, coarsest_reset_ln - 1); dst_ln <= finest_reset_ln; ++dst_ln)
     {
@@ -438,9 +456,14 @@ void PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVecto
 
     for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
     {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        d_ghostfill_nocoarse_fill_pattern->setTargetPatchLevel(level);
         d_ghostfill_nocoarse_refine_schedules[ln] =
-            d_ghostfill_nocoarse_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(ln), d_bc_op.getPointer());
-        d_synch_refine_schedules[ln] = d_synch_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(ln));
+            d_ghostfill_nocoarse_refine_algorithm->createSchedule(level, d_bc_op.getPointer());
+        d_ghostfill_nocoarse_fill_pattern->clearTargetPatchLevel();
+        d_synch_local_copy_fill_pattern->setTargetPatchLevel(level);
+        d_synch_refine_schedules[ln] = d_synch_refine_algorithm->createSchedule(level);
+        d_synch_local_copy_fill_pattern->clearTargetPatchLevel();
     }
 
     // Indicate that the operator is initialized.
@@ -503,9 +526,11 @@ void PoissonFACPreconditionerStrategy::deallocateOperatorState()
 
         d_ghostfill_nocoarse_refine_algorithm.setNull();
         d_ghostfill_nocoarse_refine_schedules.resize(0);
+        d_ghostfill_nocoarse_fill_pattern.setNull();
 
         d_synch_refine_algorithm.setNull();
         d_synch_refine_schedules.resize(0);
+        d_synch_local_copy_fill_pattern.setNull();
     }
 
     // Clear the "reset level" range.
@@ -588,8 +613,10 @@ void PoissonFACPreconditionerStrategy::xeqScheduleGhostFillNoCoarse(const int ds
         }
     }
     RefineAlgorithm<NDIM> refiner;
-    refiner.registerRefine(dst_idx, dst_idx, dst_idx, Pointer<RefineOperator<NDIM> >(), d_op_stencil_fill_pattern);
+    refiner.registerRefine(
+        dst_idx, dst_idx, dst_idx, Pointer<RefineOperator<NDIM> >(), d_ghostfill_nocoarse_fill_pattern);
     refiner.resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
+    d_ghostfill_nocoarse_fill_pattern->copyLocalData(dst_idx, dst_ln);
     d_ghostfill_nocoarse_refine_schedules[dst_ln]->fillData(d_solution_time);
     d_ghostfill_nocoarse_refine_algorithm->resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
     for (unsigned int k = 0; k < d_bc_coefs.size(); ++k)
@@ -603,8 +630,10 @@ void PoissonFACPreconditionerStrategy::xeqScheduleGhostFillNoCoarse(const int ds
 void PoissonFACPreconditionerStrategy::xeqScheduleDataSynch(const int dst_idx, const int dst_ln)
 {
     RefineAlgorithm<NDIM> refiner;
-    refiner.registerRefine(dst_idx, dst_idx, dst_idx, Pointer<RefineOperator<NDIM> >(), d_synch_fill_pattern);
+    refiner.registerRefine(
+        dst_idx, dst_idx, dst_idx, Pointer<RefineOperator<NDIM> >(), d_synch_local_copy_fill_pattern);
     refiner.resetSchedule(d_synch_refine_schedules[dst_ln]);
+    d_synch_local_copy_fill_pattern->copyLocalData(dst_idx, dst_ln);
     d_synch_refine_schedules[dst_ln]->fillData(d_solution_time);
     d_synch_refine_algorithm->resetSchedule(d_synch_refine_schedules[dst_ln]);
     return;
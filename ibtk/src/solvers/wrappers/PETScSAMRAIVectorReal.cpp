@@ -34,11 +34,23 @@
 
 #include <math.h>
 #include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
 #include <ostream>
+#include <vector>
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
 #include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideGeometry.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/NormOps.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
@@ -100,6 +112,27 @@ static Timer* t_vec_m_t_dot_local;
 static Timer* t_vec_max_pointwise_divide;
 static Timer* t_vec_dot_norm2;
 
+// Return the offset of the specified index in an array whose index space is
+// given by array_box.
+inline int array_offset(const Box<NDIM>& array_box, const hier::Index<NDIM>& i)
+{
+    int offset = 0, stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - array_box.lower(d)) * stride;
+        stride *= array_box.numberCells(d);
+    }
+    return offset;
+} // array_offset
+
+// WARNING: This function will sort the input vector in ascending order.
+inline double accurate_sum(std::vector<double>& vec)
+{
+    if (vec.empty()) return 0.0;
+    std::sort(vec.begin(), vec.end(), std::less<double>());
+    return std::accumulate(vec.begin(), vec.end(), 0.0);
+} // accurate_sum
+
 // Static functions for linkage with PETSc solver package routines.  These
 // functions are intended to match those in the PETSc _VecOps structure.
 
@@ -118,62 +151,6 @@ PetscErrorCode VecDot_SAMRAI(Vec x, Vec y, PetscScalar* val)
     PetscFunctionReturn(0);
 } // VecDot
 
-PetscErrorCode VecMDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
-{
-    IBTK_TIMER_START(t_vec_m_dot);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        TBOX_ASSERT(y[i]);
-    }
-#endif
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
-    SAMRAI_MPI::sumReduction(val, nv);
-    IBTK_TIMER_STOP(t_vec_m_dot);
-    PetscFunctionReturn(0);
-} // VecMDot
-
-PetscErrorCode VecNorm_SAMRAI(Vec x, NormType type, PetscScalar* val)
-{
-    IBTK_TIMER_START(t_vec_norm);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-#endif
-    if (type == NORM_1)
-    {
-        *val = NormOps::L1Norm(PSVR_CAST2(x));
-    }
-    else if (type == NORM_2)
-    {
-        *val = NormOps::L2Norm(PSVR_CAST2(x));
-    }
-    else if (type == NORM_INFINITY)
-    {
-        *val = NormOps::maxNorm(PSVR_CAST2(x));
-    }
-    else if (type == NORM_1_AND_2)
-    {
-        static const bool local_only = true;
-        val[0] = NormOps::L1Norm(PSVR_CAST2(x), local_only);
-        val[1] = NormOps::L2Norm(PSVR_CAST2(x), local_only);
-        val[1] = val[1] * val[1];
-        SAMRAI_MPI::sumReduction(val, 2);
-        val[1] = std::sqrt(val[1]);
-    }
-    else
-    {
-        TBOX_ERROR("PETScSAMRAIVectorReal::norm()\n"
-                   << "  vector norm type " << static_cast<int>(type) << " unsupported" << std::endl);
-    }
-    IBTK_TIMER_STOP(t_vec_norm);
-    PetscFunctionReturn(0);
-} // VecNorm
-
 PetscErrorCode VecTDot_SAMRAI(Vec x, Vec y, PetscScalar* val)
 {
     IBTK_TIMER_START(t_vec_t_dot);
@@ -292,138 +269,6 @@ PetscErrorCode VecAXPY_SAMRAI(Vec y, PetscScalar alpha, Vec x)
     PetscFunctionReturn(0);
 } // VecAXPY
 
-PetscErrorCode VecAXPBY_SAMRAI(Vec y, PetscScalar alpha, PetscScalar beta, Vec x)
-{
-    IBTK_TIMER_START(t_vec_axpby);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-    TBOX_ASSERT(y);
-#endif
-    static const bool interior_only = false;
-    if (MathUtilities<double>::equalEps(alpha, 1.0) && MathUtilities<double>::equalEps(beta, 1.0))
-    {
-        PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(beta, 1.0))
-    {
-        PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(alpha, 1.0))
-    {
-        PSVR_CAST2(y)->axpy(beta, PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
-    }
-    else
-    {
-        PSVR_CAST2(y)->linearSum(alpha, PSVR_CAST2(x), beta, PSVR_CAST2(y), interior_only);
-    }
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
-    IBTK_CHKERRQ(ierr);
-    IBTK_TIMER_STOP(t_vec_axpby);
-    PetscFunctionReturn(0);
-} // VecAXPBY
-
-PetscErrorCode VecMAXPY_SAMRAI(Vec y, PetscInt nv, const PetscScalar* alpha, Vec* x)
-{
-    IBTK_TIMER_START(t_vec_maxpy);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(y);
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        TBOX_ASSERT(x[i]);
-    }
-#endif
-    static const bool interior_only = false;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        if (MathUtilities<double>::equalEps(alpha[i], 1.0))
-        {
-            PSVR_CAST2(y)->add(PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
-        }
-        else if (MathUtilities<double>::equalEps(alpha[i], -1.0))
-        {
-            PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x[i]), interior_only);
-        }
-        else
-        {
-            PSVR_CAST2(y)->axpy(alpha[i], PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
-        }
-    }
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
-    IBTK_CHKERRQ(ierr);
-    IBTK_TIMER_STOP(t_vec_maxpy);
-    PetscFunctionReturn(0);
-} // VecMAXPY
-
-PetscErrorCode VecAYPX_SAMRAI(Vec y, const PetscScalar alpha, Vec x)
-{
-    IBTK_TIMER_START(t_vec_aypx);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-    TBOX_ASSERT(y);
-#endif
-    static const bool interior_only = false;
-    if (MathUtilities<double>::equalEps(alpha, 1.0))
-    {
-        PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(alpha, -1.0))
-    {
-        PSVR_CAST2(y)->subtract(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else
-    {
-        PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
-    }
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
-    IBTK_CHKERRQ(ierr);
-    IBTK_TIMER_STOP(t_vec_aypx);
-    PetscFunctionReturn(0);
-} // VecAYPX
-
-PetscErrorCode VecWAXPY_SAMRAI(Vec w, PetscScalar alpha, Vec x, Vec y)
-{
-    IBTK_TIMER_START(t_vec_waxpy);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-    TBOX_ASSERT(y);
-    TBOX_ASSERT(w);
-#endif
-    static const bool interior_only = false;
-    if (MathUtilities<double>::equalEps(alpha, 1.0))
-    {
-        PSVR_CAST2(w)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(alpha, -1.0))
-    {
-        PSVR_CAST2(w)->subtract(PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
-    }
-    else
-    {
-        PSVR_CAST2(w)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(w));
-    IBTK_CHKERRQ(ierr);
-    IBTK_TIMER_STOP(t_vec_waxpy);
-    PetscFunctionReturn(0);
-} // VecWAXPY
-
-PetscErrorCode VecAXPBYPCZ_SAMRAI(Vec z, PetscScalar alpha, PetscScalar beta, PetscScalar gamma, Vec x, Vec y)
-{
-    IBTK_TIMER_START(t_vec_axpbypcz);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-    TBOX_ASSERT(y);
-    TBOX_ASSERT(z);
-#endif
-    static const bool interior_only = false;
-    PSVR_CAST2(z)->linearSum(alpha, PSVR_CAST2(x), gamma, PSVR_CAST2(z), interior_only);
-    PSVR_CAST2(z)->axpy(beta, PSVR_CAST2(y), PSVR_CAST2(z), interior_only);
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(z));
-    IBTK_CHKERRQ(ierr);
-    IBTK_TIMER_STOP(t_vec_axpbypcz);
-    PetscFunctionReturn(0);
-} // VecAXPBYPCZ
-
 PetscErrorCode VecPointwiseMult_SAMRAI(Vec w, Vec x, Vec y)
 {
     IBTK_TIMER_START(t_vec_pointwise_mult);
@@ -519,137 +364,32 @@ PetscErrorCode VecSetRandom_SAMRAI(Vec x, PetscRandom rctx)
     PetscFunctionReturn(0);
 } // VecSetRandom
 
-PetscErrorCode VecDot_local_SAMRAI(Vec x, Vec y, PetscScalar* val)
-{
-    IBTK_TIMER_START(t_vec_dot_local);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-    TBOX_ASSERT(y);
-#endif
-    static const bool local_only = true;
-    *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y), local_only);
-    IBTK_TIMER_STOP(t_vec_dot_local);
-    PetscFunctionReturn(0);
-} // VecDot_local
-
-PetscErrorCode VecTDot_local_SAMRAI(Vec x, Vec y, PetscScalar* val)
+PetscErrorCode VecMaxPointwiseDivide_SAMRAI(Vec x, Vec y, PetscScalar* max)
 {
-    IBTK_TIMER_START(t_vec_t_dot_local);
+    IBTK_TIMER_START(t_vec_max_pointwise_divide);
 #if !defined(NDEBUG)
     TBOX_ASSERT(x);
     TBOX_ASSERT(y);
 #endif
-    static const bool local_only = true;
-    *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y), local_only);
-    IBTK_TIMER_STOP(t_vec_t_dot_local);
+    *max = PSVR_CAST2(x)->maxPointwiseDivide(PSVR_CAST2(y));
+    IBTK_TIMER_STOP(t_vec_max_pointwise_divide);
     PetscFunctionReturn(0);
-} // VecTDot_local
+} // VecMaxPointwiseDivide
+}
 
-PetscErrorCode VecNorm_local_SAMRAI(Vec x, NormType type, PetscScalar* val)
-{
-    IBTK_TIMER_START(t_vec_norm_local);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-#endif
-    static const bool local_only = true;
-    if (type == NORM_1)
-    {
-        *val = NormOps::L1Norm(PSVR_CAST2(x), local_only);
-    }
-    else if (type == NORM_2)
-    {
-        *val = NormOps::L2Norm(PSVR_CAST2(x), local_only);
-    }
-    else if (type == NORM_INFINITY)
-    {
-        *val = NormOps::maxNorm(PSVR_CAST2(x), local_only);
-    }
-    else if (type == NORM_1_AND_2)
-    {
-        val[0] = NormOps::L1Norm(PSVR_CAST2(x), local_only);
-        val[1] = NormOps::L2Norm(PSVR_CAST2(x), local_only);
-    }
-    else
-    {
-        TBOX_ERROR("PETScSAMRAIVectorReal::norm()\n"
-                   << "  vector norm type " << static_cast<int>(type) << " unsupported" << std::endl);
-    }
-    IBTK_TIMER_STOP(t_vec_norm_local);
-    PetscFunctionReturn(0);
-} // VecNorm_local
+/////////////////////////////// PUBLIC ///////////////////////////////////////
 
-PetscErrorCode VecMDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
-{
-    IBTK_TIMER_START(t_vec_m_dot_local);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        TBOX_ASSERT(y[i]);
-    }
-#endif
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
-    IBTK_TIMER_STOP(t_vec_m_dot_local);
-    PetscFunctionReturn(0);
-} // VecMDot_local
+/////////////////////////////// PROTECTED ////////////////////////////////////
 
-PetscErrorCode VecMTDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
-{
-    IBTK_TIMER_START(t_vec_m_t_dot_local);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        TBOX_ASSERT(y[i]);
-    }
-#endif
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
-    IBTK_TIMER_STOP(t_vec_m_t_dot_local);
-    PetscFunctionReturn(0);
-} // VecMTDot_local
-
-PetscErrorCode VecMaxPointwiseDivide_SAMRAI(Vec x, Vec y, PetscScalar* max)
-{
-    IBTK_TIMER_START(t_vec_max_pointwise_divide);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(x);
-    TBOX_ASSERT(y);
-#endif
-    *max = PSVR_CAST2(x)->maxPointwiseDivide(PSVR_CAST2(y));
-    IBTK_TIMER_STOP(t_vec_max_pointwise_divide);
-    PetscFunctionReturn(0);
-} // VecMaxPointwiseDivide
-
-PetscErrorCode VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscScalar* nm)
-{
-    IBTK_TIMER_START(t_vec_dot_norm2);
-#if !defined(NDEBUG)
-    TBOX_ASSERT(s);
-    TBOX_ASSERT(t);
-#endif
-    *dp = PSVR_CAST2(s)->dot(PSVR_CAST2(t));
-    *nm = PSVR_CAST2(t)->dot(PSVR_CAST2(t));
-    IBTK_TIMER_STOP(t_vec_dot_norm2);
-    PetscFunctionReturn(0);
-} // VecDotNorm2_SAMRAI
-}
-
-/////////////////////////////// PUBLIC ///////////////////////////////////////
-
-/////////////////////////////// PROTECTED ////////////////////////////////////
-
-PETScSAMRAIVectorReal::PETScSAMRAIVectorReal(Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > samrai_vector,
-                                             bool vector_created_via_duplicate,
-                                             MPI_Comm comm)
-    : d_samrai_vector(samrai_vector), d_vector_created_via_duplicate(vector_created_via_duplicate)
+PETScSAMRAIVectorReal::PETScSAMRAIVectorReal(Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > samrai_vector,
+                                             bool vector_created_via_duplicate,
+                                             MPI_Comm comm)
+    : d_samrai_vector(samrai_vector),
+      d_vector_created_via_duplicate(vector_created_via_duplicate),
+      d_array_spans(),
+      d_array_span_levels(),
+      d_array_span_patch_data(),
+      d_array_spans_usable(false)
 {
     // Setup Timers.
     IBTK_DO_ONCE(
@@ -697,8 +437,8 @@ PETScSAMRAIVectorReal::PETScSAMRAIVectorReal(Pointer<SAMRAIVectorReal<NDIM, Pets
                  DvOps.duplicatevecs = VecDuplicateVecs_Default;
                  DvOps.destroyvecs = VecDestroyVecs_Default;
                  DvOps.dot = VecDot_SAMRAI;
-                 DvOps.mdot = VecMDot_SAMRAI;
-                 DvOps.norm = VecNorm_SAMRAI;
+                 DvOps.mdot = PETScSAMRAIVectorReal::VecMDot_SAMRAI;
+                 DvOps.norm = PETScSAMRAIVectorReal::VecNorm_SAMRAI;
                  DvOps.tdot = VecTDot_SAMRAI;
                  DvOps.mtdot = VecMTDot_SAMRAI;
                  DvOps.scale = VecScale_SAMRAI;
@@ -706,11 +446,11 @@ PETScSAMRAIVectorReal::PETScSAMRAIVectorReal(Pointer<SAMRAIVectorReal<NDIM, Pets
                  DvOps.set = VecSet_SAMRAI;
                  DvOps.swap = VecSwap_SAMRAI;
                  DvOps.axpy = VecAXPY_SAMRAI;
-                 DvOps.axpby = VecAXPBY_SAMRAI;
-                 DvOps.maxpy = VecMAXPY_SAMRAI;
-                 DvOps.aypx = VecAYPX_SAMRAI;
-                 DvOps.waxpy = VecWAXPY_SAMRAI;
-                 DvOps.axpbypcz = VecAXPBYPCZ_SAMRAI;
+                 DvOps.axpby = PETScSAMRAIVectorReal::VecAXPBY_SAMRAI;
+                 DvOps.maxpy = PETScSAMRAIVectorReal::VecMAXPY_SAMRAI;
+                 DvOps.aypx = PETScSAMRAIVectorReal::VecAYPX_SAMRAI;
+                 DvOps.waxpy = PETScSAMRAIVectorReal::VecWAXPY_SAMRAI;
+                 DvOps.axpbypcz = PETScSAMRAIVectorReal::VecAXPBYPCZ_SAMRAI;
                  DvOps.pointwisemult = VecPointwiseMult_SAMRAI;
                  DvOps.pointwisedivide = VecPointwiseDivide_SAMRAI;
                  DvOps.getsize = VecGetSize_SAMRAI;
@@ -719,13 +459,13 @@ PETScSAMRAIVectorReal::PETScSAMRAIVectorReal(Pointer<SAMRAIVectorReal<NDIM, Pets
                  DvOps.min = VecMin_SAMRAI;
                  DvOps.setrandom = VecSetRandom_SAMRAI;
                  DvOps.destroy = PETScSAMRAIVectorReal::VecDestroy_SAMRAI;
-                 DvOps.dot_local = VecDot_local_SAMRAI;
-                 DvOps.tdot_local = VecTDot_local_SAMRAI;
-                 DvOps.norm_local = VecNorm_local_SAMRAI;
-                 DvOps.mdot_local = VecMDot_local_SAMRAI;
-                 DvOps.mtdot_local = VecMTDot_local_SAMRAI;
+                 DvOps.dot_local = PETScSAMRAIVectorReal::VecDot_local_SAMRAI;
+                 DvOps.tdot_local = PETScSAMRAIVectorReal::VecTDot_local_SAMRAI;
+                 DvOps.norm_local = PETScSAMRAIVectorReal::VecNorm_local_SAMRAI;
+                 DvOps.mdot_local = PETScSAMRAIVectorReal::VecMDot_local_SAMRAI;
+                 DvOps.mtdot_local = PETScSAMRAIVectorReal::VecMTDot_local_SAMRAI;
                  DvOps.maxpointwisedivide = VecMaxPointwiseDivide_SAMRAI;
-                 DvOps.dotnorm2 = VecDotNorm2_SAMRAI;);
+                 DvOps.dotnorm2 = PETScSAMRAIVectorReal::VecDotNorm2_SAMRAI;);
     ierr = PetscMemcpy(d_petsc_vector->ops, &DvOps, sizeof(DvOps));
     IBTK_CHKERRQ(ierr);
 
@@ -801,6 +541,699 @@ PetscErrorCode PETScSAMRAIVectorReal::VecDestroy_SAMRAI(Vec v)
     PetscFunctionReturn(0);
 } // VecDestroy
 
+PetscErrorCode PETScSAMRAIVectorReal::VecMDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
+{
+    IBTK_TIMER_START(t_vec_m_dot);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        TBOX_ASSERT(y[i]);
+    }
+#endif
+    computeLocalDotProducts(x, nv, y, val);
+    SAMRAI_MPI::sumReduction(val, nv);
+    IBTK_TIMER_STOP(t_vec_m_dot);
+    PetscFunctionReturn(0);
+} // VecMDot
+
+PetscErrorCode PETScSAMRAIVectorReal::VecNorm_SAMRAI(Vec x, NormType type, PetscScalar* val)
+{
+    IBTK_TIMER_START(t_vec_norm);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+#endif
+    if (type == NORM_1)
+    {
+        *val = NormOps::L1Norm(PSVR_CAST2(x));
+    }
+    else if (type == NORM_2)
+    {
+        *val = NormOps::L2Norm(PSVR_CAST2(x));
+    }
+    else if (type == NORM_INFINITY)
+    {
+        *val = NormOps::maxNorm(PSVR_CAST2(x));
+    }
+    else if (type == NORM_1_AND_2)
+    {
+        computeLocalNorms1And2Squared(x, val);
+        SAMRAI_MPI::sumReduction(val, 2);
+        val[1] = std::sqrt(val[1]);
+    }
+    else
+    {
+        TBOX_ERROR("PETScSAMRAIVectorReal::norm()\n"
+                   << "  vector norm type " << static_cast<int>(type) << " unsupported" << std::endl);
+    }
+    IBTK_TIMER_STOP(t_vec_norm);
+    PetscFunctionReturn(0);
+} // VecNorm
+
+PetscErrorCode PETScSAMRAIVectorReal::VecAXPBY_SAMRAI(Vec y, PetscScalar alpha, PetscScalar beta, Vec x)
+{
+    IBTK_TIMER_START(t_vec_axpby);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+    TBOX_ASSERT(y);
+#endif
+    static const bool interior_only = false;
+    if (haveMatchingArraySpans(y, x))
+    {
+        const std::vector<ArraySpan>& y_spans = PSVR_CAST1(y)->d_array_spans;
+        const std::vector<ArraySpan>& x_spans = PSVR_CAST1(x)->d_array_spans;
+        for (unsigned int k = 0; k < y_spans.size(); ++k)
+        {
+            PetscScalar* const y_data = y_spans[k].data;
+            const PetscScalar* const x_data = x_spans[k].data;
+            const int size = y_spans[k].size;
+            for (int j = 0; j < size; ++j) y_data[j] = alpha * x_data[j] + beta * y_data[j];
+        }
+    }
+    else if (MathUtilities<double>::equalEps(alpha, 1.0) && MathUtilities<double>::equalEps(beta, 1.0))
+    {
+        PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+    }
+    else if (MathUtilities<double>::equalEps(beta, 1.0))
+    {
+        PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+    }
+    else if (MathUtilities<double>::equalEps(alpha, 1.0))
+    {
+        PSVR_CAST2(y)->axpy(beta, PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+    }
+    else
+    {
+        PSVR_CAST2(y)->linearSum(alpha, PSVR_CAST2(x), beta, PSVR_CAST2(y), interior_only);
+    }
+    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
+    IBTK_CHKERRQ(ierr);
+    IBTK_TIMER_STOP(t_vec_axpby);
+    PetscFunctionReturn(0);
+} // VecAXPBY
+
+PetscErrorCode PETScSAMRAIVectorReal::VecMAXPY_SAMRAI(Vec y, PetscInt nv, const PetscScalar* alpha, Vec* x)
+{
+    IBTK_TIMER_START(t_vec_maxpy);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(y);
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        TBOX_ASSERT(x[i]);
+    }
+#endif
+    static const bool interior_only = false;
+    bool use_array_spans = PSVR_CAST1(y)->updateArraySpans();
+    for (PetscInt i = 0; i < nv && use_array_spans; ++i)
+    {
+        use_array_spans = haveMatchingArraySpans(y, x[i]);
+    }
+    if (use_array_spans)
+    {
+        // Accumulate up to four of the updates per pass over y, which limits
+        // the number of concurrent memory streams while reducing the number of
+        // times that y is read and written.
+        static const PetscInt MAX_FUSED = 4;
+        const std::vector<ArraySpan>& y_spans = PSVR_CAST1(y)->d_array_spans;
+        for (unsigned int k = 0; k < y_spans.size(); ++k)
+        {
+            PetscScalar* const y_data = y_spans[k].data;
+            const int size = y_spans[k].size;
+            for (PetscInt i = 0; i < nv; i += MAX_FUSED)
+            {
+                const PetscInt m = std::min(nv - i, MAX_FUSED);
+                const PetscScalar* x_data[MAX_FUSED] = { NULL, NULL, NULL, NULL };
+                for (PetscInt l = 0; l < m; ++l)
+                {
+                    x_data[l] = PSVR_CAST1(x[i + l])->d_array_spans[k].data;
+                }
+                const PetscScalar* const a = alpha + i;
+                switch (m)
+                {
+                case 4:
+                    for (int j = 0; j < size; ++j)
+                    {
+                        y_data[j] += a[0] * x_data[0][j] + a[1] * x_data[1][j] + a[2] * x_data[2][j] +
+                                     a[3] * x_data[3][j];
+                    }
+                    break;
+                case 3:
+                    for (int j = 0; j < size; ++j)
+                    {
+                        y_data[j] += a[0] * x_data[0][j] + a[1] * x_data[1][j] + a[2] * x_data[2][j];
+                    }
+                    break;
+                case 2:
+                    for (int j = 0; j < size; ++j)
+                    {
+                        y_data[j] += a[0] * x_data[0][j] + a[1] * x_data[1][j];
+                    }
+                    break;
+                default:
+                    for (int j = 0; j < size; ++j)
+                    {
+                        y_data[j] += a[0] * x_data[0][j];
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            if (MathUtilities<double>::equalEps(alpha[i], 1.0))
+            {
+                PSVR_CAST2(y)->add(PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+            }
+            else if (MathUtilities<double>::equalEps(alpha[i], -1.0))
+            {
+                PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x[i]), interior_only);
+            }
+            else
+            {
+                PSVR_CAST2(y)->axpy(alpha[i], PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+            }
+        }
+    }
+    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
+    IBTK_CHKERRQ(ierr);
+    IBTK_TIMER_STOP(t_vec_maxpy);
+    PetscFunctionReturn(0);
+} // VecMAXPY
+
+PetscErrorCode PETScSAMRAIVectorReal::VecAYPX_SAMRAI(Vec y, const PetscScalar alpha, Vec x)
+{
+    IBTK_TIMER_START(t_vec_aypx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+    TBOX_ASSERT(y);
+#endif
+    static const bool interior_only = false;
+    if (haveMatchingArraySpans(y, x))
+    {
+        const std::vector<ArraySpan>& y_spans = PSVR_CAST1(y)->d_array_spans;
+        const std::vector<ArraySpan>& x_spans = PSVR_CAST1(x)->d_array_spans;
+        for (unsigned int k = 0; k < y_spans.size(); ++k)
+        {
+            PetscScalar* const y_data = y_spans[k].data;
+            const PetscScalar* const x_data = x_spans[k].data;
+            const int size = y_spans[k].size;
+            for (int j = 0; j < size; ++j) y_data[j] = x_data[j] + alpha * y_data[j];
+        }
+    }
+    else if (MathUtilities<double>::equalEps(alpha, 1.0))
+    {
+        PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+    }
+    else if (MathUtilities<double>::equalEps(alpha, -1.0))
+    {
+        PSVR_CAST2(y)->subtract(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+    }
+    else
+    {
+        PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+    }
+    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
+    IBTK_CHKERRQ(ierr);
+    IBTK_TIMER_STOP(t_vec_aypx);
+    PetscFunctionReturn(0);
+} // VecAYPX
+
+PetscErrorCode PETScSAMRAIVectorReal::VecWAXPY_SAMRAI(Vec w, PetscScalar alpha, Vec x, Vec y)
+{
+    IBTK_TIMER_START(t_vec_waxpy);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+    TBOX_ASSERT(y);
+    TBOX_ASSERT(w);
+#endif
+    static const bool interior_only = false;
+    if (haveMatchingArraySpans(w, x) && haveMatchingArraySpans(w, y))
+    {
+        const std::vector<ArraySpan>& w_spans = PSVR_CAST1(w)->d_array_spans;
+        const std::vector<ArraySpan>& x_spans = PSVR_CAST1(x)->d_array_spans;
+        const std::vector<ArraySpan>& y_spans = PSVR_CAST1(y)->d_array_spans;
+        for (unsigned int k = 0; k < w_spans.size(); ++k)
+        {
+            PetscScalar* const w_data = w_spans[k].data;
+            const PetscScalar* const x_data = x_spans[k].data;
+            const PetscScalar* const y_data = y_spans[k].data;
+            const int size = w_spans[k].size;
+            for (int j = 0; j < size; ++j) w_data[j] = alpha * x_data[j] + y_data[j];
+        }
+    }
+    else if (MathUtilities<double>::equalEps(alpha, 1.0))
+    {
+        PSVR_CAST2(w)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+    }
+    else if (MathUtilities<double>::equalEps(alpha, -1.0))
+    {
+        PSVR_CAST2(w)->subtract(PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+    }
+    else
+    {
+        PSVR_CAST2(w)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+    }
+    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(w));
+    IBTK_CHKERRQ(ierr);
+    IBTK_TIMER_STOP(t_vec_waxpy);
+    PetscFunctionReturn(0);
+} // VecWAXPY
+
+PetscErrorCode PETScSAMRAIVectorReal::VecAXPBYPCZ_SAMRAI(Vec z,
+                                                         PetscScalar alpha,
+                                                         PetscScalar beta,
+                                                         PetscScalar gamma,
+                                                         Vec x,
+                                                         Vec y)
+{
+    IBTK_TIMER_START(t_vec_axpbypcz);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+    TBOX_ASSERT(y);
+    TBOX_ASSERT(z);
+#endif
+    static const bool interior_only = false;
+    if (haveMatchingArraySpans(z, x) && haveMatchingArraySpans(z, y))
+    {
+        const std::vector<ArraySpan>& z_spans = PSVR_CAST1(z)->d_array_spans;
+        const std::vector<ArraySpan>& x_spans = PSVR_CAST1(x)->d_array_spans;
+        const std::vector<ArraySpan>& y_spans = PSVR_CAST1(y)->d_array_spans;
+        for (unsigned int k = 0; k < z_spans.size(); ++k)
+        {
+            PetscScalar* const z_data = z_spans[k].data;
+            const PetscScalar* const x_data = x_spans[k].data;
+            const PetscScalar* const y_data = y_spans[k].data;
+            const int size = z_spans[k].size;
+            for (int j = 0; j < size; ++j) z_data[j] = alpha * x_data[j] + beta * y_data[j] + gamma * z_data[j];
+        }
+    }
+    else
+    {
+        PSVR_CAST2(z)->linearSum(alpha, PSVR_CAST2(x), gamma, PSVR_CAST2(z), interior_only);
+        PSVR_CAST2(z)->axpy(beta, PSVR_CAST2(y), PSVR_CAST2(z), interior_only);
+    }
+    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(z));
+    IBTK_CHKERRQ(ierr);
+    IBTK_TIMER_STOP(t_vec_axpbypcz);
+    PetscFunctionReturn(0);
+} // VecAXPBYPCZ
+
+PetscErrorCode PETScSAMRAIVectorReal::VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscScalar* nm)
+{
+    IBTK_TIMER_START(t_vec_dot_norm2);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(s);
+    TBOX_ASSERT(t);
+#endif
+    PetscScalar val[2] = { 0.0, 0.0 };
+    if (haveMatchingArraySpans(s, t))
+    {
+        const std::vector<ArraySpan>& s_spans = PSVR_CAST1(s)->d_array_spans;
+        const std::vector<ArraySpan>& t_spans = PSVR_CAST1(t)->d_array_spans;
+        for (unsigned int k = 0; k < s_spans.size(); ++k)
+        {
+            const ArraySpan& s_span = s_spans[k];
+            const ArraySpan& t_span = t_spans[k];
+            const int depth_stride = s_span.array_box.size();
+            const int n = s_span.row_length;
+            for (unsigned int r = 0; r < s_span.data_row_offsets.size(); ++r)
+            {
+                const double* const w_s = s_span.cvol ? s_span.cvol + s_span.cvol_row_offsets[r] : NULL;
+                const double* const w_t = t_span.cvol ? t_span.cvol + t_span.cvol_row_offsets[r] : NULL;
+                for (int d = 0; d < s_span.depth; ++d)
+                {
+                    const int offset = d * depth_stride + s_span.data_row_offsets[r];
+                    const PetscScalar* const s_row = s_span.data + offset;
+                    const PetscScalar* const t_row = t_span.data + offset;
+                    for (int j = 0; j < n; ++j)
+                    {
+                        val[0] += (w_s ? w_s[j] : 1.0) * s_row[j] * t_row[j];
+                        val[1] += (w_t ? w_t[j] : 1.0) * t_row[j] * t_row[j];
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        static const bool local_only = true;
+        val[0] = PSVR_CAST2(s)->dot(PSVR_CAST2(t), local_only);
+        val[1] = PSVR_CAST2(t)->dot(PSVR_CAST2(t), local_only);
+    }
+    SAMRAI_MPI::sumReduction(val, 2);
+    *dp = val[0];
+    *nm = val[1];
+    IBTK_TIMER_STOP(t_vec_dot_norm2);
+    PetscFunctionReturn(0);
+} // VecDotNorm2
+
+PetscErrorCode PETScSAMRAIVectorReal::VecDot_local_SAMRAI(Vec x, Vec y, PetscScalar* val)
+{
+    IBTK_TIMER_START(t_vec_dot_local);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+    TBOX_ASSERT(y);
+#endif
+    computeLocalDotProducts(x, 1, &y, val);
+    IBTK_TIMER_STOP(t_vec_dot_local);
+    PetscFunctionReturn(0);
+} // VecDot_local
+
+PetscErrorCode PETScSAMRAIVectorReal::VecTDot_local_SAMRAI(Vec x, Vec y, PetscScalar* val)
+{
+    IBTK_TIMER_START(t_vec_t_dot_local);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+    TBOX_ASSERT(y);
+#endif
+    computeLocalDotProducts(x, 1, &y, val);
+    IBTK_TIMER_STOP(t_vec_t_dot_local);
+    PetscFunctionReturn(0);
+} // VecTDot_local
+
+PetscErrorCode PETScSAMRAIVectorReal::VecNorm_local_SAMRAI(Vec x, NormType type, PetscScalar* val)
+{
+    IBTK_TIMER_START(t_vec_norm_local);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+#endif
+    static const bool local_only = true;
+    if (type == NORM_1)
+    {
+        *val = NormOps::L1Norm(PSVR_CAST2(x), local_only);
+    }
+    else if (type == NORM_2)
+    {
+        *val = NormOps::L2Norm(PSVR_CAST2(x), local_only);
+    }
+    else if (type == NORM_INFINITY)
+    {
+        *val = NormOps::maxNorm(PSVR_CAST2(x), local_only);
+    }
+    else if (type == NORM_1_AND_2)
+    {
+        computeLocalNorms1And2Squared(x, val);
+        val[1] = std::sqrt(val[1]);
+    }
+    else
+    {
+        TBOX_ERROR("PETScSAMRAIVectorReal::norm()\n"
+                   << "  vector norm type " << static_cast<int>(type) << " unsupported" << std::endl);
+    }
+    IBTK_TIMER_STOP(t_vec_norm_local);
+    PetscFunctionReturn(0);
+} // VecNorm_local
+
+PetscErrorCode PETScSAMRAIVectorReal::VecMDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
+{
+    IBTK_TIMER_START(t_vec_m_dot_local);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        TBOX_ASSERT(y[i]);
+    }
+#endif
+    computeLocalDotProducts(x, nv, y, val);
+    IBTK_TIMER_STOP(t_vec_m_dot_local);
+    PetscFunctionReturn(0);
+} // VecMDot_local
+
+PetscErrorCode PETScSAMRAIVectorReal::VecMTDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
+{
+    IBTK_TIMER_START(t_vec_m_t_dot_local);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        TBOX_ASSERT(y[i]);
+    }
+#endif
+    computeLocalDotProducts(x, nv, y, val);
+    IBTK_TIMER_STOP(t_vec_m_t_dot_local);
+    PetscFunctionReturn(0);
+} // VecMTDot_local
+
+void PETScSAMRAIVectorReal::computeLocalDotProducts(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
+{
+    bool use_array_spans = PSVR_CAST1(x)->updateArraySpans();
+    for (PetscInt i = 0; i < nv && use_array_spans; ++i)
+    {
+        use_array_spans = haveMatchingArraySpans(x, y[i]);
+    }
+    if (use_array_spans)
+    {
+        // Compute all of the dot products in a single pass over the data, so
+        // that each row of x is loaded only once.
+        std::fill(val, val + nv, 0.0);
+        const std::vector<ArraySpan>& x_spans = PSVR_CAST1(x)->d_array_spans;
+        std::vector<const PetscScalar*> y_data(nv);
+        for (unsigned int k = 0; k < x_spans.size(); ++k)
+        {
+            const ArraySpan& span = x_spans[k];
+            for (PetscInt i = 0; i < nv; ++i)
+            {
+                y_data[i] = PSVR_CAST1(y[i])->d_array_spans[k].data;
+            }
+            const int depth_stride = span.array_box.size();
+            const int n = span.row_length;
+            for (unsigned int r = 0; r < span.data_row_offsets.size(); ++r)
+            {
+                const double* const w = span.cvol ? span.cvol + span.cvol_row_offsets[r] : NULL;
+                for (int d = 0; d < span.depth; ++d)
+                {
+                    const int offset = d * depth_stride + span.data_row_offsets[r];
+                    const PetscScalar* const x_row = span.data + offset;
+                    for (PetscInt i = 0; i < nv; ++i)
+                    {
+                        const PetscScalar* const y_row = y_data[i] + offset;
+                        PetscScalar sum = 0.0;
+                        if (w)
+                        {
+                            for (int j = 0; j < n; ++j) sum += w[j] * x_row[j] * y_row[j];
+                        }
+                        else
+                        {
+                            for (int j = 0; j < n; ++j) sum += x_row[j] * y_row[j];
+                        }
+                        val[i] += sum;
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
+    }
+    return;
+} // computeLocalDotProducts
+
+void PETScSAMRAIVectorReal::computeLocalNorms1And2Squared(Vec x, PetscScalar* val)
+{
+    if (PSVR_CAST1(x)->updateArraySpans())
+    {
+        // Compute both norms in a single pass over the data.  As in class
+        // NormOps, the contributions of the individual arrays are summed in
+        // ascending order.
+        const std::vector<ArraySpan>& x_spans = PSVR_CAST1(x)->d_array_spans;
+        std::vector<double> L1_norm_local_array(x_spans.size(), 0.0);
+        std::vector<double> L2_norm_squared_local_array(x_spans.size(), 0.0);
+        for (unsigned int k = 0; k < x_spans.size(); ++k)
+        {
+            const ArraySpan& span = x_spans[k];
+            const int depth_stride = span.array_box.size();
+            const int n = span.row_length;
+            double L1_sum = 0.0, L2_sum = 0.0;
+            for (unsigned int r = 0; r < span.data_row_offsets.size(); ++r)
+            {
+                const double* const w = span.cvol ? span.cvol + span.cvol_row_offsets[r] : NULL;
+                for (int d = 0; d < span.depth; ++d)
+                {
+                    const PetscScalar* const x_row = span.data + d * depth_stride + span.data_row_offsets[r];
+                    if (w)
+                    {
+                        for (int j = 0; j < n; ++j)
+                        {
+                            L1_sum += w[j] * std::abs(x_row[j]);
+                            L2_sum += w[j] * x_row[j] * x_row[j];
+                        }
+                    }
+                    else
+                    {
+                        for (int j = 0; j < n; ++j)
+                        {
+                            L1_sum += std::abs(x_row[j]);
+                            L2_sum += x_row[j] * x_row[j];
+                        }
+                    }
+                }
+            }
+            L1_norm_local_array[k] = L1_sum;
+            L2_norm_squared_local_array[k] = L2_sum;
+        }
+        val[0] = accurate_sum(L1_norm_local_array);
+        val[1] = accurate_sum(L2_norm_squared_local_array);
+    }
+    else
+    {
+        static const bool local_only = true;
+        val[0] = NormOps::L1Norm(PSVR_CAST2(x), local_only);
+        val[1] = NormOps::L2Norm(PSVR_CAST2(x), local_only);
+        val[1] = val[1] * val[1];
+    }
+    return;
+} // computeLocalNorms1And2Squared
+
+PETScSAMRAIVectorReal::ArraySpan PETScSAMRAIVectorReal::buildArraySpan(ArrayData<NDIM, PetscScalar>& data,
+                                                                       const ArrayData<NDIM, double>* cvol,
+                                                                       const Box<NDIM>& interior_box)
+{
+    ArraySpan span;
+    span.data = data.getPointer();
+    span.depth = data.getDepth();
+    span.array_box = data.getBox();
+    span.size = span.depth * span.array_box.size();
+    span.cvol = cvol ? cvol->getPointer() : NULL;
+    const Box<NDIM> box = interior_box * span.array_box;
+    span.row_length = box.empty() ? 0 : box.numberCells(0);
+    if (box.empty()) return span;
+
+    // Each row of the box is contiguous in memory.
+    Box<NDIM> row_box = box;
+    row_box.upper(0) = row_box.lower(0);
+    for (Box<NDIM>::Iterator b(row_box); b; b++)
+    {
+        const hier::Index<NDIM>& i = b();
+        span.data_row_offsets.push_back(array_offset(span.array_box, i));
+        if (cvol) span.cvol_row_offsets.push_back(array_offset(cvol->getBox(), i));
+    }
+    return span;
+} // buildArraySpan
+
+PETScSAMRAIVectorReal::ArraySpanKey PETScSAMRAIVectorReal::buildArraySpanKey(PatchData<NDIM>* data)
+{
+    ArraySpanKey key;
+    key.patch_data = data;
+    key.storage = NULL;
+    if (!data) return key;
+    key.ghost_box = data->getGhostBox();
+    CellData<NDIM, PetscScalar>* const data_cc = dynamic_cast<CellData<NDIM, PetscScalar>*>(data);
+    SideData<NDIM, PetscScalar>* const data_sc = dynamic_cast<SideData<NDIM, PetscScalar>*>(data);
+    if (data_cc)
+    {
+        key.storage = data_cc->getPointer();
+    }
+    else if (data_sc)
+    {
+        key.storage = data_sc->getPointer(0);
+    }
+    return key;
+} // buildArraySpanKey
+
+bool PETScSAMRAIVectorReal::updateArraySpans()
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = d_samrai_vector->getPatchHierarchy();
+    const int coarsest_ln = d_samrai_vector->getCoarsestLevelNumber();
+    const int finest_ln = d_samrai_vector->getFinestLevelNumber();
+    const int ncomp = d_samrai_vector->getNumberOfComponents();
+
+    // Determine whether the patch levels are the ones for which the spans were
+    // built.  Levels are replaced whenever the hierarchy is regridded.
+    std::vector<const PatchLevel<NDIM>*> levels;
+    levels.reserve(finest_ln - coarsest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        levels.push_back(hierarchy->getPatchLevel(ln).getPointer());
+    }
+    bool cache_is_current = levels == d_array_span_levels;
+
+    // Collect the patch data that store the vector and determine whether the
+    // cached spans still refer to them.  The cache does not hold references to
+    // the patch data, so the address of the data array is also compared to
+    // detect patch data that have been reallocated at the same address.
+    std::vector<ArraySpanKey> keys;
+    keys.reserve(d_array_span_patch_data.size());
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        const int data_idx = d_samrai_vector->getComponentDescriptorIndex(comp);
+        const int cvol_idx = d_samrai_vector->getControlVolumeIndex(comp);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                keys.push_back(buildArraySpanKey(patch->getPatchData(data_idx).getPointer()));
+                keys.push_back(buildArraySpanKey(cvol_idx >= 0 ? patch->getPatchData(cvol_idx).getPointer() : NULL));
+            }
+        }
+    }
+    cache_is_current = cache_is_current && keys.size() == d_array_span_patch_data.size();
+    for (unsigned int k = 0; k < keys.size() && cache_is_current; ++k)
+    {
+        const ArraySpanKey& key = keys[k];
+        const ArraySpanKey& cached_key = d_array_span_patch_data[k];
+        cache_is_current = key.patch_data == cached_key.patch_data && key.storage == cached_key.storage &&
+                           key.ghost_box == cached_key.ghost_box;
+    }
+    if (cache_is_current) return d_array_spans_usable;
+
+    // Rebuild the spans.  Only cell- and side-centered data are supported.
+    d_array_span_levels.swap(levels);
+    d_array_span_patch_data.swap(keys);
+    d_array_spans.clear();
+    d_array_spans_usable = true;
+    for (unsigned int k = 0; k < d_array_span_patch_data.size() && d_array_spans_usable; k += 2)
+    {
+        PatchData<NDIM>* const data = d_array_span_patch_data[k].patch_data;
+        PatchData<NDIM>* const cvol = d_array_span_patch_data[k + 1].patch_data;
+        CellData<NDIM, PetscScalar>* const data_cc = dynamic_cast<CellData<NDIM, PetscScalar>*>(data);
+        SideData<NDIM, PetscScalar>* const data_sc = dynamic_cast<SideData<NDIM, PetscScalar>*>(data);
+        CellData<NDIM, double>* const cvol_cc = dynamic_cast<CellData<NDIM, double>*>(cvol);
+        SideData<NDIM, double>* const cvol_sc = dynamic_cast<SideData<NDIM, double>*>(cvol);
+        if (data_cc && (!cvol || cvol_cc))
+        {
+            d_array_spans.push_back(buildArraySpan(
+                data_cc->getArrayData(), cvol_cc ? &cvol_cc->getArrayData() : NULL, data_cc->getBox()));
+        }
+        else if (data_sc && (!cvol || cvol_sc) && data_sc->getDirectionVector() == IntVector<NDIM>(1))
+        {
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                d_array_spans.push_back(buildArraySpan(data_sc->getArrayData(axis),
+                                                       cvol_sc ? &cvol_sc->getArrayData(axis) : NULL,
+                                                       SideGeometry<NDIM>::toSideBox(data_sc->getBox(), axis)));
+            }
+        }
+        else
+        {
+            d_array_spans_usable = false;
+        }
+    }
+    if (!d_array_spans_usable) d_array_spans.clear();
+    return d_array_spans_usable;
+} // updateArraySpans
+
+bool PETScSAMRAIVectorReal::haveMatchingArraySpans(Vec v1, Vec v2)
+{
+    if (!PSVR_CAST1(v1)->updateArraySpans() || !PSVR_CAST1(v2)->updateArraySpans()) return false;
+    const std::vector<ArraySpan>& spans1 = PSVR_CAST1(v1)->d_array_spans;
+    const std::vector<ArraySpan>& spans2 = PSVR_CAST1(v2)->d_array_spans;
+    if (spans1.size() != spans2.size()) return false;
+    for (unsigned int k = 0; k < spans1.size(); ++k)
+    {
+        if (spans1[k].depth != spans2[k].depth || !(spans1[k].array_box == spans2[k].array_box)) return false;
+    }
+    return true;
+} // haveMatchingArraySpans
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -42,6 +42,7 @@
 #include "VisItDataWriter.h"
 #include "ibtk/AppInitializer.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/PerformanceTrace.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
 #include "tbox/Database.h"
@@ -423,11 +424,32 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         }
         TimerManager::createManager(timer_manager_db);
     }
+
+    // Configure performance trace options.
+    int trace_interval = 0;
+    if (main_db->keyExists("trace_interval"))
+    {
+        trace_interval = main_db->getInteger("trace_interval");
+    }
+    if (trace_interval > 0)
+    {
+        std::string trace_dirname = "trace";
+        if (main_db->keyExists("trace_dirname"))
+        {
+            trace_dirname = main_db->getString("trace_dirname");
+        }
+        if (trace_dirname.empty())
+        {
+            TBOX_ERROR("AppInitializer::AppInitializer(): trace_interval > 0, but `trace_dirname' is empty\n");
+        }
+        PerformanceTrace::enable(trace_dirname, trace_interval);
+    }
     return;
 } // AppInitializer
 
 AppInitializer::~AppInitializer()
 {
+    PerformanceTrace::disable();
     InputManager::freeManager();
     return;
 } // ~AppInitializer
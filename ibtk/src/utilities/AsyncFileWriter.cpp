@@ -0,0 +1,221 @@
+// Filename: AsyncFileWriter.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <deque>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ibtk/AsyncFileWriter.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+AsyncFileWriter::AsyncFileWriter(const size_t max_pending_bytes)
+    : d_requests(), d_num_pending_requests(0), d_num_pending_bytes(0), d_max_pending_bytes(max_pending_bytes),
+      d_thread(), d_mutex(), d_request_cond(), d_progress_cond(), d_thread_started(false), d_shutdown(false),
+      d_error_message()
+{
+    pthread_mutex_init(&d_mutex, NULL);
+    pthread_cond_init(&d_request_cond, NULL);
+    pthread_cond_init(&d_progress_cond, NULL);
+    return;
+} // AsyncFileWriter
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+    pthread_mutex_lock(&d_mutex);
+    d_shutdown = true;
+    pthread_cond_signal(&d_request_cond);
+    pthread_mutex_unlock(&d_mutex);
+    if (d_thread_started) pthread_join(d_thread, NULL);
+    pthread_cond_destroy(&d_progress_cond);
+    pthread_cond_destroy(&d_request_cond);
+    pthread_mutex_destroy(&d_mutex);
+    return;
+} // ~AsyncFileWriter
+
+void AsyncFileWriter::writeAt(const std::string& file_name, const off_t offset, std::vector<char>& data)
+{
+    WriteRequest* request = new WriteRequest();
+    request->file_name = file_name;
+    request->offset = offset;
+    request->data.swap(data);
+    const size_t num_bytes = request->data.size();
+
+    pthread_mutex_lock(&d_mutex);
+    checkErrors();
+
+    // Start the background thread the first time that it is needed.
+    if (!d_thread_started)
+    {
+        if (pthread_create(&d_thread, NULL, AsyncFileWriter::runWriterThread, this) != 0)
+        {
+            TBOX_ERROR("AsyncFileWriter::writeAt():\n"
+                       << "  could not create background writer thread." << std::endl);
+        }
+        d_thread_started = true;
+    }
+
+    // Wait until enough of the previously submitted data have been written.
+    while (d_max_pending_bytes > 0 && d_num_pending_bytes > 0 && d_num_pending_bytes + num_bytes > d_max_pending_bytes)
+    {
+        pthread_cond_wait(&d_progress_cond, &d_mutex);
+    }
+    checkErrors();
+
+    d_requests.push_back(request);
+    ++d_num_pending_requests;
+    d_num_pending_bytes += num_bytes;
+    pthread_cond_signal(&d_request_cond);
+    pthread_mutex_unlock(&d_mutex);
+    return;
+} // writeAt
+
+void AsyncFileWriter::waitForCompletion()
+{
+    pthread_mutex_lock(&d_mutex);
+    while (d_num_pending_requests > 0)
+    {
+        pthread_cond_wait(&d_progress_cond, &d_mutex);
+    }
+    checkErrors();
+    pthread_mutex_unlock(&d_mutex);
+    return;
+} // waitForCompletion
+
+size_t AsyncFileWriter::getNumPendingBytes()
+{
+    pthread_mutex_lock(&d_mutex);
+    const size_t num_pending_bytes = d_num_pending_bytes;
+    pthread_mutex_unlock(&d_mutex);
+    return num_pending_bytes;
+} // getNumPendingBytes
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void* AsyncFileWriter::runWriterThread(void* writer)
+{
+    static_cast<AsyncFileWriter*>(writer)->processRequests();
+    return NULL;
+} // runWriterThread
+
+void AsyncFileWriter::processRequests()
+{
+    pthread_mutex_lock(&d_mutex);
+    while (true)
+    {
+        while (d_requests.empty() && !d_shutdown)
+        {
+            pthread_cond_wait(&d_request_cond, &d_mutex);
+        }
+        if (d_requests.empty()) break;
+        WriteRequest* request = d_requests.front();
+        d_requests.pop_front();
+        pthread_mutex_unlock(&d_mutex);
+
+        // Write the data without holding the lock.
+        std::string error_message;
+        const int fd = open(request->file_name.c_str(), O_WRONLY);
+        if (fd == -1)
+        {
+            error_message = "could not open file " + request->file_name + ": " + strerror(errno);
+        }
+        else
+        {
+            size_t num_written = 0;
+            while (num_written < request->data.size())
+            {
+                const ssize_t n = pwrite(fd,
+                                         &request->data[num_written],
+                                         request->data.size() - num_written,
+                                         request->offset + static_cast<off_t>(num_written));
+                if (n == -1 && errno == EINTR) continue;
+                if (n <= 0)
+                {
+                    error_message = "could not write file " + request->file_name + ": " + strerror(errno);
+                    break;
+                }
+                num_written += static_cast<size_t>(n);
+            }
+            if (close(fd) == -1 && error_message.empty())
+            {
+                error_message = "could not close file " + request->file_name + ": " + strerror(errno);
+            }
+        }
+        const size_t num_bytes = request->data.size();
+        delete request;
+
+        pthread_mutex_lock(&d_mutex);
+        if (!error_message.empty()) d_error_message += "  " + error_message + "\n";
+        --d_num_pending_requests;
+        d_num_pending_bytes -= num_bytes;
+        pthread_cond_broadcast(&d_progress_cond);
+    }
+    pthread_mutex_unlock(&d_mutex);
+    return;
+} // processRequests
+
+void AsyncFileWriter::checkErrors()
+{
+    if (!d_error_message.empty())
+    {
+        const std::string error_message = d_error_message;
+        d_error_message.clear();
+        pthread_mutex_unlock(&d_mutex);
+        TBOX_ERROR("AsyncFileWriter:\n" << error_message << std::endl);
+    }
+    return;
+} // checkErrors
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
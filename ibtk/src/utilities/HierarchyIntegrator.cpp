@@ -77,6 +77,8 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/PatchMathOps.h"
+#include "ibtk/PerformanceTrace.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -149,6 +151,10 @@ HierarchyIntegrator::HierarchyIntegrator(const std::string& object_name,
     d_manage_hier_math_ops = true;
     d_tag_buffer.resizeArray(1);
     d_tag_buffer[0] = 0;
+    d_use_tiled_kernels = false;
+    d_tile_width = 0;
+    d_use_threaded_tiles = false;
+    d_use_threaded_patch_loops = false;
 
     // Initialize object with data read from the input and restart databases.
     const bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -315,6 +321,9 @@ void HierarchyIntegrator::advanceHierarchy(double dt)
         plog << d_object_name << "::advanceHierarchy(): time interval = [" << current_time << "," << new_time
              << "], dt = " << dt << "\n";
 
+    // Indicate the start of the time step to the performance trace.
+    PerformanceTrace::beginTimestep(d_integrator_step, current_time);
+
     // Regrid the patch hierarchy.
     if (atRegridPoint())
     {
@@ -380,6 +389,9 @@ void HierarchyIntegrator::advanceHierarchy(double dt)
 
     // Reset the regrid indicator.
     d_at_regrid_time_step = false;
+
+    // Indicate the end of the time step to the performance trace.
+    PerformanceTrace::endTimestep();
     return;
 } // advanceHierarchy
 
@@ -1420,6 +1432,11 @@ Pointer<HierarchyMathOps> HierarchyIntegrator::buildHierarchyMathOps(Pointer<Pat
         if (!d_hier_math_ops)
         {
             d_hier_math_ops = new HierarchyMathOps(d_object_name + "::HierarchyMathOps", hierarchy);
+            PatchMathOps& patch_math_ops = d_hier_math_ops->getPatchMathOps();
+            patch_math_ops.setUseTiledKernels(d_use_tiled_kernels);
+            patch_math_ops.setTileWidth(d_tile_width);
+            patch_math_ops.setUseThreadedTiles(d_use_threaded_tiles);
+            d_hier_math_ops->setUseThreadedPatchLoops(d_use_threaded_patch_loops);
         }
         d_manage_hier_math_ops = true;
     }
@@ -1470,6 +1487,10 @@ void HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restar
     if (db->keyExists("enable_logging")) d_enable_logging = db->getBool("enable_logging");
     if (db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = db->getString("bdry_extrap_type");
     if (db->keyExists("tag_buffer")) d_tag_buffer = db->getIntegerArray("tag_buffer");
+    if (db->keyExists("use_tiled_kernels")) d_use_tiled_kernels = db->getBool("use_tiled_kernels");
+    if (db->keyExists("tile_width")) d_tile_width = db->getInteger("tile_width");
+    if (db->keyExists("use_threaded_tiles")) d_use_threaded_tiles = db->getBool("use_threaded_tiles");
+    if (db->keyExists("use_threaded_patch_loops")) d_use_threaded_patch_loops = db->getBool("use_threaded_patch_loops");
     return;
 } // getFromInput
 
@@ -35,10 +35,13 @@
 #include <math.h>
 #include <stddef.h>
 #include <algorithm>
+#include <fstream>
+#include <iomanip>
 #include <ios>
 #include <iosfwd>
 #include <istream>
 #include <limits>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -68,6 +71,7 @@
 #include "ibtk/LEInteractor.h"
 #include "ibtk/LMarker.h"
 #include "ibtk/LMarkerCoarsen.h"
+#include "ibtk/LMarkerPatchArrays.h"
 #include "ibtk/LMarkerRefine.h"
 #include "ibtk/LMarkerSet.h"
 #include "ibtk/LMarkerSetData.h"
@@ -279,16 +283,20 @@ void LMarkerUtilities::eulerStep(const int mark_current_idx,
             Pointer<LMarkerSetData> mark_current_data = patch->getPatchData(mark_current_idx);
             Pointer<LMarkerSetData> mark_new_data = patch->getPatchData(mark_new_idx);
 
-            const unsigned int num_patch_marks = countMarkersOnPatch(mark_current_data);
+            // Collect the local marker data at time n and the corresponding
+            // markers at time n+1.
+            LMarkerPatchArrays mark_current_arrays, mark_new_arrays;
+            mark_current_arrays.collectMarkers(mark_current_data, patch_box);
+            mark_new_arrays.collectMarkers(mark_new_data, patch_box);
+            const int num_patch_marks = static_cast<int>(mark_current_arrays.getNumberOfMarkers());
 #if !defined(NDEBUG)
-            TBOX_ASSERT(num_patch_marks == countMarkersOnPatch(mark_new_data));
+            TBOX_ASSERT(num_patch_marks == static_cast<int>(mark_new_arrays.getNumberOfMarkers()));
 #endif
-            // Collect the local marker positions at time n.
-            std::vector<double> X_mark_current;
-            collectMarkerPositionsOnPatch(X_mark_current, mark_current_data);
+            const std::vector<double>& X_mark_current = mark_current_arrays.getPositions();
+            std::vector<double>& U_mark_current = mark_current_arrays.getVelocities();
+            std::vector<double>& X_mark_new = mark_new_arrays.getPositions();
 
             // Compute U_mark(n) = u(X_mark(n),n).
-            std::vector<double> U_mark_current(X_mark_current.size());
             if (is_cc_data)
                 LEInteractor::interpolate(
                     U_mark_current, NDIM, X_mark_current, NDIM, u_cc_current_data, patch, patch_box, weighting_fcn);
@@ -297,8 +305,10 @@ void LMarkerUtilities::eulerStep(const int mark_current_idx,
                     U_mark_current, NDIM, X_mark_current, NDIM, u_sc_current_data, patch, patch_box, weighting_fcn);
 
             // Compute X_mark(n+1) = X_mark(n) + dt*U_mark(n).
-            std::vector<double> X_mark_new(X_mark_current.size());
-            for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+            for (int k = 0; k < NDIM * num_patch_marks; ++k)
             {
                 X_mark_new[k] = X_mark_current[k] + dt * U_mark_current[k];
             }
@@ -309,8 +319,8 @@ void LMarkerUtilities::eulerStep(const int mark_current_idx,
 
             // Store the local marker velocities at at time n, and the marker
             // positions at time n+1.
-            resetMarkerVelocitiesOnPatch(U_mark_current, mark_current_data);
-            resetMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            mark_current_arrays.resetMarkerVelocities();
+            mark_new_arrays.resetMarkerPositions();
         }
     }
     return;
@@ -342,20 +352,24 @@ void LMarkerUtilities::midpointStep(const int mark_current_idx,
             Pointer<LMarkerSetData> mark_current_data = patch->getPatchData(mark_current_idx);
             Pointer<LMarkerSetData> mark_new_data = patch->getPatchData(mark_new_idx);
 
-            const unsigned int num_patch_marks = countMarkersOnPatch(mark_current_data);
-#if !defined(NDEBUG)
-            TBOX_ASSERT(num_patch_marks == countMarkersOnPatch(mark_new_data));
-#endif
             // Collect the local marker positions at time n and predicted marker
             // positions at time n+1.
-            std::vector<double> X_mark_current;
-            collectMarkerPositionsOnPatch(X_mark_current, mark_current_data);
-            std::vector<double> X_mark_new;
-            collectMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            LMarkerPatchArrays mark_current_arrays, mark_new_arrays;
+            mark_current_arrays.collectMarkers(mark_current_data, patch_box);
+            mark_new_arrays.collectMarkers(mark_new_data, patch_box);
+            const int num_patch_marks = static_cast<int>(mark_current_arrays.getNumberOfMarkers());
+#if !defined(NDEBUG)
+            TBOX_ASSERT(num_patch_marks == static_cast<int>(mark_new_arrays.getNumberOfMarkers()));
+#endif
+            const std::vector<double>& X_mark_current = mark_current_arrays.getPositions();
+            std::vector<double>& X_mark_new = mark_new_arrays.getPositions();
 
             // Set X(n+1/2) = 0.5*(X(n)+X(n+1)).
             std::vector<double> X_mark_half(NDIM * num_patch_marks);
-            for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+            for (int k = 0; k < NDIM * num_patch_marks; ++k)
             {
                 X_mark_half[k] = 0.5 * (X_mark_current[k] + X_mark_new[k]);
             }
@@ -370,7 +384,10 @@ void LMarkerUtilities::midpointStep(const int mark_current_idx,
                     U_mark_half, NDIM, X_mark_half, NDIM, u_sc_half_data, patch, patch_box, weighting_fcn);
 
             // Compute X_mark(n+1) = X_mark(n) + dt*U_mark(n+1/2).
-            for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+            for (int k = 0; k < NDIM * num_patch_marks; ++k)
             {
                 X_mark_new[k] = X_mark_current[k] + dt * U_mark_half[k];
             }
@@ -380,7 +397,7 @@ void LMarkerUtilities::midpointStep(const int mark_current_idx,
             preventMarkerEscape(X_mark_new, hierarchy->getGridGeometry());
 
             // Store the local marker positions at time n+1.
-            resetMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            mark_new_arrays.resetMarkerPositions();
         }
     }
     return;
@@ -412,23 +429,21 @@ void LMarkerUtilities::trapezoidalStep(const int mark_current_idx,
             Pointer<LMarkerSetData> mark_current_data = patch->getPatchData(mark_current_idx);
             Pointer<LMarkerSetData> mark_new_data = patch->getPatchData(mark_new_idx);
 
-            const unsigned int num_patch_marks = countMarkersOnPatch(mark_current_data);
+            // Collect the local marker positions and velocities at time n and
+            // predicted marker positions at time n+1.
+            LMarkerPatchArrays mark_current_arrays, mark_new_arrays;
+            mark_current_arrays.collectMarkers(mark_current_data, patch_box);
+            mark_new_arrays.collectMarkers(mark_new_data, patch_box);
+            const int num_patch_marks = static_cast<int>(mark_current_arrays.getNumberOfMarkers());
 #if !defined(NDEBUG)
-            TBOX_ASSERT(num_patch_marks == countMarkersOnPatch(mark_new_data));
+            TBOX_ASSERT(num_patch_marks == static_cast<int>(mark_new_arrays.getNumberOfMarkers()));
 #endif
-            // Collect the local marker positions at time n and predicted marker
-            // positions at time n+1.
-            std::vector<double> X_mark_current;
-            collectMarkerPositionsOnPatch(X_mark_current, mark_current_data);
-            std::vector<double> X_mark_new;
-            collectMarkerPositionsOnPatch(X_mark_new, mark_new_data);
-
-            // Collect the local marker velocities at time n.
-            std::vector<double> U_mark_current;
-            collectMarkerVelocitiesOnPatch(U_mark_current, mark_current_data);
+            const std::vector<double>& X_mark_current = mark_current_arrays.getPositions();
+            const std::vector<double>& U_mark_current = mark_current_arrays.getVelocities();
+            std::vector<double>& X_mark_new = mark_new_arrays.getPositions();
+            std::vector<double>& U_mark_new = mark_new_arrays.getVelocities();
 
             // Compute U_mark(n+1/) = u(X_mark(n+1/2),n+1/2).
-            std::vector<double> U_mark_new(X_mark_new.size());
             if (is_cc_data)
                 LEInteractor::interpolate(
                     U_mark_new, NDIM, X_mark_new, NDIM, u_cc_new_data, patch, patch_box, weighting_fcn);
@@ -438,13 +453,19 @@ void LMarkerUtilities::trapezoidalStep(const int mark_current_idx,
 
             // Set U(n+1/2) = 0.5*(U(n)+U(n+1)).
             std::vector<double> U_mark_half(NDIM * num_patch_marks);
-            for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+            for (int k = 0; k < NDIM * num_patch_marks; ++k)
             {
                 U_mark_half[k] = 0.5 * (U_mark_current[k] + U_mark_new[k]);
             }
 
             // Compute X_mark(n+1) = X_mark(n) + dt*U_mark(n+1/2).
-            for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+            for (int k = 0; k < NDIM * num_patch_marks; ++k)
             {
                 X_mark_new[k] = X_mark_current[k] + dt * U_mark_half[k];
             }
@@ -455,8 +476,8 @@ void LMarkerUtilities::trapezoidalStep(const int mark_current_idx,
 
             // Store the local marker velocities at at time n, and the marker
             // positions at time n+1.
-            resetMarkerVelocitiesOnPatch(U_mark_new, mark_new_data);
-            resetMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            mark_new_arrays.resetMarkerVelocities();
+            mark_new_arrays.resetMarkerPositions();
         }
     }
     return;
@@ -553,50 +574,11 @@ void LMarkerUtilities::collectMarkersOnPatchHierarchy(const int mark_idx, Pointe
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-
-        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-        const Index<NDIM>& patch_lower = patch_box.lower();
-        const Index<NDIM>& patch_upper = patch_box.upper();
-        const double* const patchXLower = patch_geom->getXLower();
-        const double* const patchXUpper = patch_geom->getXUpper();
-        const double* const patchDx = patch_geom->getDx();
-
         Pointer<LMarkerSetData> mark_data = patch->getPatchData(mark_idx);
         Pointer<LMarkerSetData> mark_data_new = new LMarkerSetData(mark_data->getBox(), mark_data->getGhostCellWidth());
-        for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getGhostBox());
-             it != mark_data->data_end();
-             ++it)
-        {
-            const LMarkerSet::value_type& mark = *it;
-            const Point& X = mark->getPosition();
-            const IntVector<NDIM>& offset = mark->getPeriodicOffset();
-            Point X_shifted;
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                X_shifted[d] = X[d] + static_cast<double>(offset(d)) * patchDx[d];
-            }
-            const bool patch_owns_mark_at_new_loc =
-                ((patchXLower[0] <= X_shifted[0]) && (X_shifted[0] < patchXUpper[0]))
-#if (NDIM > 1)
-                && ((patchXLower[1] <= X_shifted[1]) && (X_shifted[1] < patchXUpper[1]))
-#if (NDIM > 2)
-                && ((patchXLower[2] <= X_shifted[2]) && (X_shifted[2] < patchXUpper[2]))
-#endif
-#endif
-                ;
-            if (patch_owns_mark_at_new_loc)
-            {
-                const Index<NDIM> i = IndexUtilities::getCellIndex(
-                    X_shifted, patchXLower, patchXUpper, patchDx, patch_lower, patch_upper);
-                if (!mark_data_new->isElement(i))
-                {
-                    mark_data_new->appendItemPointer(i, new LMarkerSet());
-                }
-                LMarkerSet& new_mark_set = *(mark_data_new->getItem(i));
-                new_mark_set.push_back(mark);
-            }
-        }
+        LMarkerPatchArrays mark_arrays;
+        mark_arrays.collectMarkers(mark_data, mark_data->getGhostBox());
+        mark_arrays.assignMarkersToCells(mark_data_new, patch);
 
         // Swap the old and new patch data pointers.
         patch->setPatchData(mark_idx, mark_data_new);
@@ -753,6 +735,38 @@ unsigned int LMarkerUtilities::countMarkers(const int mark_idx,
     return static_cast<unsigned int>(SAMRAI_MPI::sumReduction(static_cast<int>(num_marks)));
 } // countMarkers
 
+void LMarkerUtilities::writeMarkerData(const std::string& file_name,
+                                       const int mark_idx,
+                                       Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                       const int coarsest_ln_in,
+                                       const int finest_ln_in)
+{
+    const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
+    const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    std::ostringstream proc_file_name;
+    proc_file_name << file_name << ".proc_" << std::setfill('0') << std::setw(4) << SAMRAI_MPI::getRank();
+    std::ofstream file_stream(proc_file_name.str().c_str(), std::ios::out | std::ios::binary);
+    if (!file_stream)
+    {
+        TBOX_ERROR("LMarkerUtilities::writeMarkerData():\n  Unable to open file " << proc_file_name.str() << "\n");
+    }
+    static const int ndim = NDIM;
+    file_stream.write(reinterpret_cast<const char*>(&ndim), sizeof(int));
+    LMarkerPatchArrays mark_arrays;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LMarkerSetData> mark_data = patch->getPatchData(mark_idx);
+            mark_arrays.collectMarkers(mark_data, patch->getBox());
+            mark_arrays.writeData(file_stream);
+        }
+    }
+    return;
+} // writeMarkerData
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -771,73 +785,6 @@ unsigned int LMarkerUtilities::countMarkersOnPatch(Pointer<LMarkerSetData> mark_
     return num_marks;
 } // countMarkersOnPatch
 
-void LMarkerUtilities::collectMarkerPositionsOnPatch(std::vector<double>& X_mark, Pointer<LMarkerSetData> mark_data)
-{
-    X_mark.resize(NDIM * countMarkersOnPatch(mark_data));
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
-    {
-        const LMarkerSet::value_type& mark = *it;
-        const Point& X = mark->getPosition();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            X_mark[NDIM * k + d] = X[d];
-        }
-    }
-    return;
-} // collectMarkerPositionsOnPatch
-
-void LMarkerUtilities::resetMarkerPositionsOnPatch(const std::vector<double>& X_mark, Pointer<LMarkerSetData> mark_data)
-{
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
-    {
-        const LMarkerSet::value_type& mark = *it;
-        Point& X = mark->getPosition();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            X[d] = X_mark[NDIM * k + d];
-        }
-    }
-    return;
-} // resetMarkerPositionsOnPatch
-
-void LMarkerUtilities::collectMarkerVelocitiesOnPatch(std::vector<double>& U_mark, Pointer<LMarkerSetData> mark_data)
-{
-    U_mark.resize(NDIM * countMarkersOnPatch(mark_data));
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
-    {
-        const LMarkerSet::value_type& mark = *it;
-        const Vector& U = mark->getVelocity();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            U_mark[NDIM * k + d] = U[d];
-        }
-    }
-    return;
-} // collectMarkerVelocitiesOnPatch
-
-void LMarkerUtilities::resetMarkerVelocitiesOnPatch(const std::vector<double>& U_mark,
-                                                    Pointer<LMarkerSetData> mark_data)
-{
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
-    {
-        const LMarkerSet::value_type& mark = *it;
-        Vector& U = mark->getVelocity();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            U[d] = U_mark[NDIM * k + d];
-        }
-    }
-    return;
-} // resetMarkerVelocitiesOnPatch
-
 void LMarkerUtilities::preventMarkerEscape(std::vector<double>& X_mark, Pointer<CartesianGridGeometry<NDIM> > grid_geom)
 {
     const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift();
@@ -845,7 +792,11 @@ void LMarkerUtilities::preventMarkerEscape(std::vector<double>& X_mark, Pointer<
     static const double edge_tol = sqrt(std::numeric_limits<double>::epsilon());
     const double* const x_lower = grid_geom->getXLower();
     const double* const x_upper = grid_geom->getXUpper();
-    for (unsigned int k = 0; k < X_mark.size() / NDIM; ++k)
+    const int num_marks = static_cast<int>(X_mark.size() / NDIM);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int k = 0; k < num_marks; ++k)
     {
         double* const X = &X_mark[NDIM * k];
         for (unsigned int d = 0; d < NDIM; ++d)
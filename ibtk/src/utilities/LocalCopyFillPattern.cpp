@@ -0,0 +1,488 @@
+// Filename: LocalCopyFillPattern.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ArrayData.h"
+#include "Box.h"
+#include "BoxGeometry.h"
+#include "BoxList.h"
+#include "BoxOverlap.h"
+#include "CellData.h"
+#include "CellGeometry.h"
+#include "CellOverlap.h"
+#include "EdgeGeometry.h"
+#include "FaceGeometry.h"
+#include "IntVector.h"
+#include "NodeGeometry.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
+#include "PatchLevel.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "SideOverlap.h"
+#include "boost/array.hpp"
+#include "ibtk/LocalCopyFillPattern.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+static const std::string PATTERN_NAME = "LOCAL_COPY_FILL_PATTERN";
+
+// Counter used to give each fill pattern object a distinct name.
+static int s_num_instances = 0;
+
+inline boost::array<int, 2 * NDIM> get_box_key(const Box<NDIM>& box)
+{
+    boost::array<int, 2 * NDIM> key;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        key[d] = box.lower()(d);
+        key[NDIM + d] = box.upper()(d);
+    }
+    return key;
+} // get_box_key
+
+inline bool get_geometry_box(Box<NDIM>& box, const BoxGeometry<NDIM>& geometry)
+{
+    if (const CellGeometry<NDIM>* cc_geometry = dynamic_cast<const CellGeometry<NDIM>*>(&geometry))
+    {
+        box = cc_geometry->getBox();
+        return true;
+    }
+    if (const SideGeometry<NDIM>* sc_geometry = dynamic_cast<const SideGeometry<NDIM>*>(&geometry))
+    {
+        box = sc_geometry->getBox();
+        return true;
+    }
+    if (const NodeGeometry<NDIM>* nc_geometry = dynamic_cast<const NodeGeometry<NDIM>*>(&geometry))
+    {
+        box = nc_geometry->getBox();
+        return true;
+    }
+    if (const EdgeGeometry<NDIM>* ec_geometry = dynamic_cast<const EdgeGeometry<NDIM>*>(&geometry))
+    {
+        box = ec_geometry->getBox();
+        return true;
+    }
+    if (const FaceGeometry<NDIM>* fc_geometry = dynamic_cast<const FaceGeometry<NDIM>*>(&geometry))
+    {
+        box = fc_geometry->getBox();
+        return true;
+    }
+    return false;
+} // get_geometry_box
+
+inline void copy_block(double* const dst,
+                       const double* const src,
+                       const int* const extent,
+                       const int* const dst_stride,
+                       const int* const src_stride)
+{
+#if (NDIM == 2)
+    for (int j = 0; j < extent[1]; ++j)
+    {
+        const double* const src_row = src + j * src_stride[1];
+        std::copy(src_row, src_row + extent[0], dst + j * dst_stride[1]);
+    }
+#endif
+#if (NDIM == 3)
+    for (int k = 0; k < extent[2]; ++k)
+    {
+        for (int j = 0; j < extent[1]; ++j)
+        {
+            const double* const src_row = src + j * src_stride[1] + k * src_stride[2];
+            std::copy(src_row, src_row + extent[0], dst + j * dst_stride[1] + k * dst_stride[2]);
+        }
+    }
+#endif
+    return;
+} // copy_block
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LocalCopyFillPattern::LocalCopyFillPattern(Pointer<VariableFillPattern<NDIM> > fill_pattern)
+    : d_fill_pattern(), d_pattern_name(PATTERN_NAME), d_instance_num(s_num_instances++), d_stencil_width(0),
+      d_levels(), d_local_copies(), d_target_level(), d_target_level_num(-1), d_target_local_patch_nums(),
+      d_copy_plans()
+{
+    setFillPattern(fill_pattern);
+    return;
+} // LocalCopyFillPattern
+
+LocalCopyFillPattern::~LocalCopyFillPattern()
+{
+    // intentionally blank
+    return;
+} // ~LocalCopyFillPattern
+
+void LocalCopyFillPattern::setFillPattern(Pointer<VariableFillPattern<NDIM> > fill_pattern)
+{
+    // NOTE: SAMRAI computes overlaps only once for all items of a schedule that
+    // have equivalent fill patterns.  Because each object records its own
+    // overlaps, each object must have a distinct name.
+    d_fill_pattern = fill_pattern;
+    std::ostringstream pattern_name;
+    pattern_name << PATTERN_NAME << "_" << d_instance_num;
+    if (d_fill_pattern) pattern_name << "_" << d_fill_pattern->getPatternName();
+    d_pattern_name = pattern_name.str();
+    return;
+} // setFillPattern
+
+void LocalCopyFillPattern::setTargetPatchLevel(Pointer<PatchLevel<NDIM> > level)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level);
+#endif
+    const int level_num = level->getLevelNumber();
+    d_levels[level_num] = level;
+    d_local_copies[level_num].clear();
+    d_copy_plans.erase(level_num);
+    d_target_level = level;
+    d_target_level_num = -1;
+    d_target_local_patch_nums.clear();
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        d_target_local_patch_nums[get_box_key(patch->getBox())] = p();
+    }
+    return;
+} // setTargetPatchLevel
+
+void LocalCopyFillPattern::clearTargetPatchLevel()
+{
+    d_target_level.setNull();
+    d_target_level_num = -1;
+    d_target_local_patch_nums.clear();
+    return;
+} // clearTargetPatchLevel
+
+void LocalCopyFillPattern::clearLocalCopies()
+{
+    clearTargetPatchLevel();
+    d_levels.clear();
+    d_local_copies.clear();
+    d_copy_plans.clear();
+    return;
+} // clearLocalCopies
+
+void LocalCopyFillPattern::copyLocalData(const int data_idx, const int level_num)
+{
+    copyLocalData(data_idx, data_idx, level_num);
+    return;
+} // copyLocalData
+
+void LocalCopyFillPattern::copyLocalData(const int dst_data_idx, const int src_data_idx, const int level_num)
+{
+    std::map<int, std::vector<LocalCopy> >::const_iterator local_copies_it = d_local_copies.find(level_num);
+    if (local_copies_it == d_local_copies.end() || local_copies_it->second.empty()) return;
+    const std::vector<LocalCopy>& local_copies = local_copies_it->second;
+    Pointer<PatchLevel<NDIM> > level = d_levels[level_num];
+
+    // Compile the copies for these patch data indices if necessary.
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = level->getPatchDescriptor();
+    const PatchDataFactory<NDIM>* const dst_factory = patch_descriptor->getPatchDataFactory(dst_data_idx).getPointer();
+    const PatchDataFactory<NDIM>* const src_factory = patch_descriptor->getPatchDataFactory(src_data_idx).getPointer();
+    const std::pair<int, int> data_idxs(dst_data_idx, src_data_idx);
+    std::map<std::pair<int, int>, CopyPlan>& plans = d_copy_plans[level_num];
+    std::map<std::pair<int, int>, CopyPlan>::const_iterator plan_it = plans.find(data_idxs);
+    if (plan_it == plans.end() || plan_it->second.dst_factory != dst_factory ||
+        plan_it->second.src_factory != src_factory)
+    {
+        compileLocalCopies(dst_data_idx, src_data_idx, level_num);
+        plan_it = plans.find(data_idxs);
+    }
+    const CopyPlan& plan = plan_it->second;
+
+    // Perform the copies.  A patch is not copied onto itself when the source
+    // and destination data are the same.
+    for (unsigned int k = 0; k < local_copies.size(); ++k)
+    {
+        const LocalCopy& local_copy = local_copies[k];
+        if (dst_data_idx == src_data_idx && local_copy.dst_patch_num == local_copy.src_patch_num &&
+            local_copy.src_offset == IntVector<NDIM>(0))
+        {
+            continue;
+        }
+        Pointer<PatchData<NDIM> > dst_data = level->getPatch(local_copy.dst_patch_num)->getPatchData(dst_data_idx);
+        Pointer<PatchData<NDIM> > src_data = level->getPatch(local_copy.src_patch_num)->getPatchData(src_data_idx);
+        if (!plan.copy_arrays)
+        {
+            dst_data->copy(*src_data, *local_copy.overlap);
+            continue;
+        }
+        SideData<NDIM, double>* dst_sc_data = NULL;
+        SideData<NDIM, double>* src_sc_data = NULL;
+        CellData<NDIM, double>* dst_cc_data = NULL;
+        CellData<NDIM, double>* src_cc_data = NULL;
+        if (plan.side_data)
+        {
+            dst_sc_data = static_cast<SideData<NDIM, double>*>(dst_data.getPointer());
+            src_sc_data = static_cast<SideData<NDIM, double>*>(src_data.getPointer());
+        }
+        else
+        {
+            dst_cc_data = static_cast<CellData<NDIM, double>*>(dst_data.getPointer());
+            src_cc_data = static_cast<CellData<NDIM, double>*>(src_data.getPointer());
+        }
+        const std::vector<CopyBlock>& blocks = plan.blocks[k];
+        for (std::vector<CopyBlock>::const_iterator cit = blocks.begin(); cit != blocks.end(); ++cit)
+        {
+            const CopyBlock& block = *cit;
+            ArrayData<NDIM, double>& dst_array =
+                plan.side_data ? dst_sc_data->getArrayData(block.array_num) : dst_cc_data->getArrayData();
+            const ArrayData<NDIM, double>& src_array =
+                plan.side_data ? src_sc_data->getArrayData(block.array_num) : src_cc_data->getArrayData();
+            for (int depth = 0; depth < dst_array.getDepth(); ++depth)
+            {
+                copy_block(dst_array.getPointer(depth) + block.dst_offset,
+                           src_array.getPointer(depth) + block.src_offset,
+                           block.extent,
+                           block.dst_stride,
+                           block.src_stride);
+            }
+        }
+    }
+    return;
+} // copyLocalData
+
+Pointer<BoxOverlap<NDIM> > LocalCopyFillPattern::calculateOverlap(const BoxGeometry<NDIM>& dst_geometry,
+                                                                  const BoxGeometry<NDIM>& src_geometry,
+                                                                  const Box<NDIM>& dst_patch_box,
+                                                                  const Box<NDIM>& src_mask,
+                                                                  const bool overwrite_interior,
+                                                                  const IntVector<NDIM>& src_offset) const
+{
+    Pointer<BoxOverlap<NDIM> > overlap =
+        d_fill_pattern ?
+            d_fill_pattern->calculateOverlap(
+                dst_geometry, src_geometry, dst_patch_box, src_mask, overwrite_interior, src_offset) :
+            dst_geometry.calculateOverlap(src_geometry, src_mask, overwrite_interior, src_offset);
+    if (recordLocalCopy(dst_geometry, src_geometry, overlap, src_offset))
+    {
+        return dst_geometry.calculateOverlap(src_geometry, Box<NDIM>(), overwrite_interior, src_offset);
+    }
+    return overlap;
+} // calculateOverlap
+
+Pointer<BoxOverlap<NDIM> > LocalCopyFillPattern::calculateOverlapOnLevel(const BoxGeometry<NDIM>& dst_geometry,
+                                                                         const BoxGeometry<NDIM>& src_geometry,
+                                                                         const Box<NDIM>& dst_patch_box,
+                                                                         const Box<NDIM>& src_mask,
+                                                                         const bool overwrite_interior,
+                                                                         const IntVector<NDIM>& src_offset,
+                                                                         const int dst_level_num,
+                                                                         const int src_level_num) const
+{
+    Pointer<BoxOverlap<NDIM> > overlap =
+        d_fill_pattern ? d_fill_pattern->calculateOverlapOnLevel(dst_geometry,
+                                                                 src_geometry,
+                                                                 dst_patch_box,
+                                                                 src_mask,
+                                                                 overwrite_interior,
+                                                                 src_offset,
+                                                                 dst_level_num,
+                                                                 src_level_num) :
+                         dst_geometry.calculateOverlap(src_geometry, src_mask, overwrite_interior, src_offset);
+    if (dst_level_num == src_level_num && d_target_level && dst_level_num == d_target_level->getLevelNumber() &&
+        recordLocalCopy(dst_geometry, src_geometry, overlap, src_offset))
+    {
+        return dst_geometry.calculateOverlap(src_geometry, Box<NDIM>(), overwrite_interior, src_offset);
+    }
+    return overlap;
+} // calculateOverlapOnLevel
+
+void LocalCopyFillPattern::setTargetPatchLevelNumber(const int level_num)
+{
+    d_target_level_num = level_num;
+    if (d_fill_pattern) d_fill_pattern->setTargetPatchLevelNumber(level_num);
+    return;
+} // setTargetPatchLevelNumber
+
+IntVector<NDIM>& LocalCopyFillPattern::getStencilWidth()
+{
+    return d_fill_pattern ? d_fill_pattern->getStencilWidth() : d_stencil_width;
+} // getStencilWidth
+
+const std::string& LocalCopyFillPattern::getPatternName() const
+{
+    return d_pattern_name;
+} // getPatternName
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+bool LocalCopyFillPattern::recordLocalCopy(const BoxGeometry<NDIM>& dst_geometry,
+                                           const BoxGeometry<NDIM>& src_geometry,
+                                           Pointer<BoxOverlap<NDIM> > overlap,
+                                           const IntVector<NDIM>& src_offset) const
+{
+    if (!d_target_level || !overlap || overlap->isOverlapEmpty()) return false;
+
+    // Overlaps are recorded only while SAMRAI is generating the transactions
+    // for the target level (and not, e.g., for a temporary coarser level).
+    if (d_target_level_num >= 0 && d_target_level_num != d_target_level->getLevelNumber()) return false;
+    Box<NDIM> dst_box, src_box;
+    if (!get_geometry_box(dst_box, dst_geometry) || !get_geometry_box(src_box, src_geometry)) return false;
+    std::map<boost::array<int, 2 * NDIM>, int>::const_iterator dst_it =
+        d_target_local_patch_nums.find(get_box_key(dst_box));
+    std::map<boost::array<int, 2 * NDIM>, int>::const_iterator src_it =
+        d_target_local_patch_nums.find(get_box_key(src_box));
+    if (dst_it == d_target_local_patch_nums.end() || src_it == d_target_local_patch_nums.end()) return false;
+    LocalCopy local_copy;
+    local_copy.dst_patch_num = dst_it->second;
+    local_copy.src_patch_num = src_it->second;
+    local_copy.overlap = overlap;
+    local_copy.src_offset = src_offset;
+    d_local_copies[d_target_level->getLevelNumber()].push_back(local_copy);
+    return true;
+} // recordLocalCopy
+
+void LocalCopyFillPattern::compileLocalCopies(const int dst_data_idx, const int src_data_idx, const int level_num)
+{
+    Pointer<PatchLevel<NDIM> > level = d_levels[level_num];
+    const std::vector<LocalCopy>& local_copies = d_local_copies[level_num];
+    CopyPlan& plan = d_copy_plans[level_num][std::make_pair(dst_data_idx, src_data_idx)];
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = level->getPatchDescriptor();
+    plan.dst_factory = patch_descriptor->getPatchDataFactory(dst_data_idx).getPointer();
+    plan.src_factory = patch_descriptor->getPatchDataFactory(src_data_idx).getPointer();
+    plan.copy_arrays = true;
+    plan.side_data = false;
+    plan.blocks.assign(local_copies.size(), std::vector<CopyBlock>());
+    if (local_copies.empty()) return;
+
+    // Direct array copies are used only for double-precision cell- and
+    // side-centered data.
+    {
+        const LocalCopy& local_copy = local_copies.front();
+        Pointer<Patch<NDIM> > patch = level->getPatch(local_copy.dst_patch_num);
+        Pointer<CellData<NDIM, double> > dst_cc_data = patch->getPatchData(dst_data_idx);
+        Pointer<CellData<NDIM, double> > src_cc_data = patch->getPatchData(src_data_idx);
+        Pointer<SideData<NDIM, double> > dst_sc_data = patch->getPatchData(dst_data_idx);
+        Pointer<SideData<NDIM, double> > src_sc_data = patch->getPatchData(src_data_idx);
+        Pointer<CellOverlap<NDIM> > cc_overlap = local_copy.overlap;
+        Pointer<SideOverlap<NDIM> > sc_overlap = local_copy.overlap;
+        plan.copy_arrays = (dst_cc_data && src_cc_data && cc_overlap) || (dst_sc_data && src_sc_data && sc_overlap);
+        plan.side_data = dst_sc_data;
+    }
+    if (!plan.copy_arrays) return;
+
+    for (unsigned int k = 0; k < local_copies.size(); ++k)
+    {
+        const LocalCopy& local_copy = local_copies[k];
+        Pointer<PatchData<NDIM> > dst_data = level->getPatch(local_copy.dst_patch_num)->getPatchData(dst_data_idx);
+        Pointer<PatchData<NDIM> > src_data = level->getPatch(local_copy.src_patch_num)->getPatchData(src_data_idx);
+        const int n_arrays = plan.side_data ? NDIM : 1;
+        for (int array_num = 0; array_num < n_arrays; ++array_num)
+        {
+            const ArrayData<NDIM, double>* dst_array;
+            const ArrayData<NDIM, double>* src_array;
+            const BoxList<NDIM>* overlap_boxes;
+            if (plan.side_data)
+            {
+                Pointer<SideData<NDIM, double> > dst_sc_data = dst_data;
+                Pointer<SideData<NDIM, double> > src_sc_data = src_data;
+                Pointer<SideOverlap<NDIM> > sc_overlap = local_copy.overlap;
+                dst_array = &dst_sc_data->getArrayData(array_num);
+                src_array = &src_sc_data->getArrayData(array_num);
+                overlap_boxes = &sc_overlap->getDestinationBoxList(array_num);
+            }
+            else
+            {
+                Pointer<CellData<NDIM, double> > dst_cc_data = dst_data;
+                Pointer<CellData<NDIM, double> > src_cc_data = src_data;
+                Pointer<CellOverlap<NDIM> > cc_overlap = local_copy.overlap;
+                dst_array = &dst_cc_data->getArrayData();
+                src_array = &src_cc_data->getArrayData();
+                overlap_boxes = &cc_overlap->getDestinationBoxList();
+            }
+#if !defined(NDEBUG)
+            TBOX_ASSERT(dst_array->getDepth() == src_array->getDepth());
+#endif
+            const Box<NDIM>& dst_ghost_box = dst_array->getBox();
+            const Box<NDIM>& src_ghost_box = src_array->getBox();
+            for (BoxList<NDIM>::Iterator b(*overlap_boxes); b; b++)
+            {
+                const Box<NDIM>& box = b();
+                if (box.empty()) continue;
+#if !defined(NDEBUG)
+                const Box<NDIM> src_box = Box<NDIM>::shift(box, -local_copy.src_offset);
+                TBOX_ASSERT(box * dst_ghost_box == box);
+                TBOX_ASSERT(src_box * src_ghost_box == src_box);
+#endif
+                CopyBlock block;
+                block.array_num = array_num;
+                block.dst_offset = 0;
+                block.src_offset = 0;
+                int dst_stride = 1, src_stride = 1;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    block.extent[d] = box.numberCells(d);
+                    block.dst_stride[d] = dst_stride;
+                    block.src_stride[d] = src_stride;
+                    block.dst_offset += (box.lower()(d) - dst_ghost_box.lower()(d)) * dst_stride;
+                    block.src_offset +=
+                        (box.lower()(d) - local_copy.src_offset(d) - src_ghost_box.lower()(d)) * src_stride;
+                    dst_stride *= dst_ghost_box.numberCells(d);
+                    src_stride *= src_ghost_box.numberCells(d);
+                }
+                plan.blocks[k].push_back(block);
+            }
+        }
+    }
+    return;
+} // compileLocalCopies
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,237 @@
+// Filename: PerformanceTrace.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibtk/PerformanceTrace.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+void write_json_string(std::ostream& os, const std::string& str)
+{
+    os << '"';
+    for (std::string::const_iterator it = str.begin(); it != str.end(); ++it)
+    {
+        if (*it == '"' || *it == '\\') os << '\\';
+        os << *it;
+    }
+    os << '"';
+    return;
+} // write_json_string
+}
+
+bool PerformanceTrace::s_is_enabled = false;
+bool PerformanceTrace::s_is_recording = false;
+int PerformanceTrace::s_sampling_interval = 1;
+int PerformanceTrace::s_step_num = -1;
+int PerformanceTrace::s_step_depth = 0;
+double PerformanceTrace::s_step_time = 0.0;
+double PerformanceTrace::s_step_start_time = 0.0;
+std::ofstream* PerformanceTrace::s_trace_stream = NULL;
+std::map<const Timer*, int> PerformanceTrace::s_timer_map;
+std::vector<PerformanceTrace::TimerRecord> PerformanceTrace::s_timer_records;
+std::map<std::string, int> PerformanceTrace::s_counter_map;
+std::vector<std::string> PerformanceTrace::s_counter_names;
+std::vector<double> PerformanceTrace::s_counter_values;
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void PerformanceTrace::enable(const std::string& dirname, const int sampling_interval)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(sampling_interval > 0);
+#endif
+    if (s_is_enabled) disable();
+    Utilities::recursiveMkdir(dirname);
+    std::ostringstream file_name;
+    file_name << dirname << "/trace." << std::setw(5) << std::setfill('0') << SAMRAI_MPI::getRank() << ".jsonl";
+    s_trace_stream = new std::ofstream(file_name.str().c_str(), std::ios::out | std::ios::trunc);
+    if (!s_trace_stream->good())
+    {
+        TBOX_ERROR("PerformanceTrace::enable():\n"
+                   << "  unable to open trace file " << file_name.str() << std::endl);
+    }
+    s_sampling_interval = sampling_interval;
+    s_is_enabled = true;
+    return;
+} // enable
+
+void PerformanceTrace::disable()
+{
+    if (!s_is_enabled) return;
+    s_is_enabled = false;
+    s_is_recording = false;
+    s_step_depth = 0;
+    delete s_trace_stream;
+    s_trace_stream = NULL;
+    return;
+} // disable
+
+void PerformanceTrace::beginTimestep(const int step_num, const double time)
+{
+    if (!s_is_enabled || s_step_depth++ > 0) return;
+    s_step_num = step_num;
+    s_step_time = time;
+    s_step_start_time = MPI_Wtime();
+    s_is_recording = (step_num % s_sampling_interval) == 0;
+    return;
+} // beginTimestep
+
+void PerformanceTrace::endTimestep()
+{
+    if (!s_is_enabled || --s_step_depth > 0) return;
+    if (s_is_recording)
+    {
+        // Charge any running timers for the time elapsed so far.
+        const double end_time = MPI_Wtime();
+        for (std::vector<TimerRecord>::iterator it = s_timer_records.begin(); it != s_timer_records.end(); ++it)
+        {
+            if (it->depth > 0) it->elapsed_time += end_time - it->start_time;
+        }
+        writeTimestep(end_time - s_step_start_time);
+    }
+    for (std::vector<TimerRecord>::iterator it = s_timer_records.begin(); it != s_timer_records.end(); ++it)
+    {
+        it->elapsed_time = 0.0;
+        it->num_calls = 0;
+        it->depth = 0;
+    }
+    s_counter_values.assign(s_counter_values.size(), 0.0);
+    s_is_recording = false;
+    return;
+} // endTimestep
+
+void PerformanceTrace::startTimer(const Timer* const timer)
+{
+    if (!s_is_recording) return;
+    std::map<const Timer*, int>::const_iterator it = s_timer_map.find(timer);
+    int timer_id;
+    if (it == s_timer_map.end())
+    {
+        timer_id = static_cast<int>(s_timer_records.size());
+        s_timer_map.insert(std::make_pair(timer, timer_id));
+        TimerRecord record;
+        record.name = timer->getName();
+        record.elapsed_time = 0.0;
+        record.start_time = 0.0;
+        record.num_calls = 0;
+        record.depth = 0;
+        s_timer_records.push_back(record);
+    }
+    else
+    {
+        timer_id = it->second;
+    }
+    TimerRecord& record = s_timer_records[timer_id];
+    if (record.depth++ == 0) record.start_time = MPI_Wtime();
+    ++record.num_calls;
+    return;
+} // startTimer
+
+void PerformanceTrace::stopTimer(const Timer* const timer)
+{
+    if (!s_is_recording) return;
+    std::map<const Timer*, int>::const_iterator it = s_timer_map.find(timer);
+    if (it == s_timer_map.end()) return;
+    TimerRecord& record = s_timer_records[it->second];
+    if (record.depth == 0) return;
+    if (--record.depth == 0) record.elapsed_time += MPI_Wtime() - record.start_time;
+    return;
+} // stopTimer
+
+int PerformanceTrace::registerCounter(const std::string& name)
+{
+    std::map<std::string, int>::const_iterator it = s_counter_map.find(name);
+    if (it != s_counter_map.end()) return it->second;
+    const int counter_id = static_cast<int>(s_counter_names.size());
+    s_counter_map.insert(std::make_pair(name, counter_id));
+    s_counter_names.push_back(name);
+    s_counter_values.push_back(0.0);
+    return counter_id;
+} // registerCounter
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void PerformanceTrace::writeTimestep(const double wall_time)
+{
+    std::ostream& os = *s_trace_stream;
+    os << std::setprecision(9);
+    os << "{\"step\": " << s_step_num << ", \"time\": " << s_step_time << ", \"rank\": " << SAMRAI_MPI::getRank()
+       << ", \"wall\": " << wall_time << ", \"timers\": {";
+    bool first_entry = true;
+    for (std::vector<TimerRecord>::const_iterator it = s_timer_records.begin(); it != s_timer_records.end(); ++it)
+    {
+        if (it->num_calls == 0 && it->elapsed_time == 0.0) continue;
+        if (!first_entry) os << ", ";
+        write_json_string(os, it->name);
+        os << ": [" << it->elapsed_time << ", " << it->num_calls << "]";
+        first_entry = false;
+    }
+    os << "}, \"counters\": {";
+    first_entry = true;
+    for (unsigned int k = 0; k < s_counter_names.size(); ++k)
+    {
+        if (s_counter_values[k] == 0.0) continue;
+        if (!first_entry) os << ", ";
+        write_json_string(os, s_counter_names[k]);
+        os << ": " << s_counter_values[k];
+        first_entry = false;
+    }
+    os << "}}\n";
+    os.flush();
+    return;
+} // writeTimestep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,128 @@
+// Filename: ScratchDataIndexCache.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "Variable.h"
+#include "VariableDatabase.h"
+#include "ibtk/ScratchDataIndexCache.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+ScratchDataIndexCache::ScratchDataIndexCache() : d_hierarchy(NULL), d_scratch_data_idxs()
+{
+    // intentionally blank
+    return;
+} // ScratchDataIndexCache
+
+ScratchDataIndexCache::~ScratchDataIndexCache()
+{
+    clear();
+    return;
+} // ~ScratchDataIndexCache
+
+int ScratchDataIndexCache::getScratchDataIndex(const int data_idx,
+                                               Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                               const int coarsest_ln,
+                                               const int finest_ln)
+{
+    d_hierarchy = hierarchy;
+    int scratch_data_idx;
+    std::map<int, int>::const_iterator cit = d_scratch_data_idxs.find(data_idx);
+    if (cit != d_scratch_data_idxs.end())
+    {
+        scratch_data_idx = cit->second;
+    }
+    else
+    {
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<hier::Variable<NDIM> > var;
+        var_db->mapIndexToVariable(data_idx, var);
+        scratch_data_idx = var_db->registerClonedPatchDataIndex(var, data_idx);
+        d_scratch_data_idxs[data_idx] = scratch_data_idx;
+    }
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(scratch_data_idx)) level->allocatePatchData(scratch_data_idx);
+    }
+    return scratch_data_idx;
+} // getScratchDataIndex
+
+void ScratchDataIndexCache::deallocateScratchData()
+{
+    if (!d_hierarchy) return;
+    for (std::map<int, int>::const_iterator cit = d_scratch_data_idxs.begin(); cit != d_scratch_data_idxs.end();
+         ++cit)
+    {
+        for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (level->checkAllocated(cit->second)) level->deallocatePatchData(cit->second);
+        }
+    }
+    return;
+} // deallocateScratchData
+
+void ScratchDataIndexCache::clear()
+{
+    deallocateScratchData();
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (std::map<int, int>::const_iterator cit = d_scratch_data_idxs.begin(); cit != d_scratch_data_idxs.end();
+         ++cit)
+    {
+        var_db->removePatchDataIndex(cit->second);
+    }
+    d_scratch_data_idxs.clear();
+    d_hierarchy.setNull();
+    return;
+} // clear
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -52,6 +52,7 @@
 #include "VariableDatabase.h"
 #include "VariableFillPattern.h"
 #include "ibtk/CartSideDoubleCubicCoarsen.h"
+#include "ibtk/LocalCopyFillPattern.h"
 #include "ibtk/SideDataSynchronization.h"
 #include "ibtk/SideSynchCopyFillPattern.h"
 #include "ibtk/ibtk_utilities.h"
@@ -78,7 +79,7 @@ namespace IBTK
 
 SideDataSynchronization::SideDataSynchronization()
     : d_is_initialized(false), d_transaction_comps(), d_coarsest_ln(-1), d_finest_ln(-1), d_coarsen_alg(NULL),
-      d_coarsen_scheds(), d_refine_alg(NULL), d_refine_scheds()
+      d_coarsen_scheds(), d_refine_alg(NULL), d_refine_scheds(), d_local_copy_fill_patterns()
 {
     // intentionally blank
     return;
@@ -155,7 +156,11 @@ void SideDataSynchronization::initializeOperatorState(
     }
 
     // Setup cached refine algorithms and schedules.
+    //
+    // NOTE: Copies between local patches are performed directly by the fill
+    // pattern objects instead of by the communication schedules.
     d_refine_alg = new RefineAlgorithm<NDIM>();
+    d_local_copy_fill_patterns.resize(d_transaction_comps.size());
     for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
     {
         const int data_idx = d_transaction_comps[comp_idx].d_data_idx;
@@ -168,19 +173,27 @@ void SideDataSynchronization::initializeOperatorState(
                        << "  only double-precision side-centered data is supported." << std::endl);
         }
         Pointer<RefineOperator<NDIM> > refine_op = NULL;
-        Pointer<VariableFillPattern<NDIM> > fill_pattern = new SideSynchCopyFillPattern();
+        d_local_copy_fill_patterns[comp_idx] = new LocalCopyFillPattern(new SideSynchCopyFillPattern());
         d_refine_alg->registerRefine(data_idx, // destination
                                      data_idx, // source
                                      data_idx, // temporary work space
                                      refine_op,
-                                     fill_pattern);
+                                     d_local_copy_fill_patterns[comp_idx]);
     }
 
     d_refine_scheds.resize(d_finest_ln + 1);
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+        {
+            d_local_copy_fill_patterns[comp_idx]->setTargetPatchLevel(level);
+        }
         d_refine_scheds[ln] = d_refine_alg->createSchedule(level);
+        for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+        {
+            d_local_copy_fill_patterns[comp_idx]->clearTargetPatchLevel();
+        }
     }
 
     // Indicate the operator is initialized.
@@ -254,6 +267,9 @@ void SideDataSynchronization::resetTransactionComponents(
     }
 
     // Reset cached refine algorithms and schedules.
+    //
+    // NOTE: The fill pattern objects are reused because they keep track of the
+    // copies between local patches that have been removed from the schedules.
     d_refine_alg = new RefineAlgorithm<NDIM>();
     for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
     {
@@ -267,12 +283,11 @@ void SideDataSynchronization::resetTransactionComponents(
                        << "  only double-precision side-centered data is supported." << std::endl);
         }
         Pointer<RefineOperator<NDIM> > refine_op = NULL;
-        Pointer<VariableFillPattern<NDIM> > fill_pattern = new SideSynchCopyFillPattern();
         d_refine_alg->registerRefine(data_idx, // destination
                                      data_idx, // source
                                      data_idx, // temporary work space
                                      refine_op,
-                                     fill_pattern);
+                                     d_local_copy_fill_patterns[comp_idx]);
     }
 
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
@@ -292,6 +307,7 @@ void SideDataSynchronization::deallocateOperatorState()
 
     d_refine_alg.setNull();
     d_refine_scheds.clear();
+    d_local_copy_fill_patterns.clear();
 
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
@@ -308,6 +324,10 @@ void SideDataSynchronization::synchronizeData(const double fill_time)
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Synchronize data on the current level.
+        for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+        {
+            d_local_copy_fill_patterns[comp_idx]->copyLocalData(d_transaction_comps[comp_idx].d_data_idx, ln);
+        }
         d_refine_scheds[ln]->fillData(fill_time);
 
         // When appropriate, coarsen data from the current level to the next
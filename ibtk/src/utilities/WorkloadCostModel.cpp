@@ -0,0 +1,287 @@
+// Filename: WorkloadCostModel.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+
+#include "Box.h"
+#include "CellData.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "ibtk/WorkloadCostModel.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Version of WorkloadCostModel restart file data.
+static const int WORKLOAD_COST_MODEL_VERSION = 1;
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+WorkloadCostModel::WorkloadCostModel(const std::string& object_name,
+                                     Pointer<Database> input_db,
+                                     const bool register_for_restart)
+    : d_object_name(object_name), d_registered_for_restart(register_for_restart), d_enable_calibration(true),
+      d_enable_logging(false), d_relaxation_factor(0.5), d_elapsed_step_time(0.0), d_step_start_time(0.0),
+      d_num_steps(0)
+{
+    d_cost[EULERIAN_WORK] = 1.0;
+    d_cost[INTERACTION_WORK] = 0.01;
+    d_cost[FORCE_WORK] = 0.1;
+    if (input_db)
+    {
+        if (input_db->keyExists("interaction_cost")) d_cost[INTERACTION_WORK] = input_db->getDouble("interaction_cost");
+        if (input_db->keyExists("force_cost")) d_cost[FORCE_WORK] = input_db->getDouble("force_cost");
+        if (input_db->keyExists("relaxation_factor")) d_relaxation_factor = input_db->getDouble("relaxation_factor");
+        if (input_db->keyExists("enable_calibration")) d_enable_calibration = input_db->getBool("enable_calibration");
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    }
+    if (d_relaxation_factor <= 0.0 || d_relaxation_factor > 1.0)
+    {
+        TBOX_ERROR(d_object_name << "::WorkloadCostModel():\n"
+                                 << "  relaxation_factor must be in the range (0,1]" << std::endl);
+    }
+    if (d_registered_for_restart)
+    {
+        RestartManager::getManager()->registerRestartItem(d_object_name, this);
+    }
+
+    // The calibrated cost coefficients stored in the restart file take
+    // precedence over the initial values provided in the input database.
+    const bool from_restart = RestartManager::getManager()->isFromRestart();
+    if (from_restart) getFromRestart();
+    for (int k = 0; k < NUM_WORK_TYPES; ++k)
+    {
+        d_local_work[k] = 0.0;
+        d_elapsed_time[k] = 0.0;
+        d_start_time[k] = 0.0;
+    }
+    return;
+} // WorkloadCostModel
+
+WorkloadCostModel::~WorkloadCostModel()
+{
+    if (d_registered_for_restart)
+    {
+        RestartManager::getManager()->unregisterRestartItem(d_object_name);
+    }
+    return;
+} // ~WorkloadCostModel
+
+double WorkloadCostModel::getCost(const WorkType work_type) const
+{
+    return d_cost[work_type];
+} // getCost
+
+void WorkloadCostModel::beginTimestep()
+{
+    d_step_start_time = MPI_Wtime();
+    return;
+} // beginTimestep
+
+void WorkloadCostModel::endTimestep()
+{
+    d_elapsed_step_time += MPI_Wtime() - d_step_start_time;
+    ++d_num_steps;
+    return;
+} // endTimestep
+
+void WorkloadCostModel::startTimer(const WorkType work_type)
+{
+    d_start_time[work_type] = MPI_Wtime();
+    return;
+} // startTimer
+
+void WorkloadCostModel::stopTimer(const WorkType work_type)
+{
+    d_elapsed_time[work_type] += MPI_Wtime() - d_start_time[work_type];
+    return;
+} // stopTimer
+
+void WorkloadCostModel::resetLocalWork()
+{
+    std::fill(d_local_work, d_local_work + NUM_WORK_TYPES, 0.0);
+    return;
+} // resetLocalWork
+
+void WorkloadCostModel::addLocalWork(const WorkType work_type, const double num_items)
+{
+    d_local_work[work_type] += num_items;
+    return;
+} // addLocalWork
+
+void WorkloadCostModel::calibrate()
+{
+    const int num_steps = SAMRAI_MPI::minReduction(d_num_steps);
+    if (num_steps > 0)
+    {
+        // Determine the time per timestep spent on each type of work.  Time
+        // that is not attributed to any type of work (e.g., time spent waiting
+        // on other processes between the timed phases) is not used in the fit,
+        // so that load imbalance does not inflate the cost coefficients.
+        double step_time[NUM_WORK_TYPES];
+        double unattributed_time = d_elapsed_step_time;
+        for (int k = 0; k < NUM_WORK_TYPES; ++k)
+        {
+            step_time[k] = d_elapsed_time[k] / double(num_steps);
+            unattributed_time -= d_elapsed_time[k];
+        }
+        unattributed_time = std::max(unattributed_time, 0.0) / double(num_steps);
+
+        // Fit time = cost*work for each type of work in the least-squares sense
+        // over all processes.
+        double sums[2 * NUM_WORK_TYPES];
+        for (int k = 0; k < NUM_WORK_TYPES; ++k)
+        {
+            sums[2 * k] = step_time[k] * d_local_work[k];
+            sums[2 * k + 1] = d_local_work[k] * d_local_work[k];
+        }
+        SAMRAI_MPI::sumReduction(sums, 2 * NUM_WORK_TYPES);
+        if (d_enable_calibration && sums[2 * EULERIAN_WORK] > 0.0 && sums[2 * EULERIAN_WORK + 1] > 0.0)
+        {
+            const double cell_cost = sums[2 * EULERIAN_WORK] / sums[2 * EULERIAN_WORK + 1];
+            for (int k = 0; k < NUM_WORK_TYPES; ++k)
+            {
+                if (k == EULERIAN_WORK || sums[2 * k + 1] <= 0.0) continue;
+                const double cost = (sums[2 * k] / sums[2 * k + 1]) / cell_cost;
+                d_cost[k] = (1.0 - d_relaxation_factor) * d_cost[k] + d_relaxation_factor * cost;
+            }
+        }
+
+        // Report the measured load imbalance.
+        const double total_step_time = d_elapsed_step_time / double(num_steps);
+        const double max_step_time = SAMRAI_MPI::maxReduction(total_step_time);
+        const double min_step_time = SAMRAI_MPI::minReduction(total_step_time);
+        const double avg_step_time = SAMRAI_MPI::sumReduction(total_step_time) / double(SAMRAI_MPI::getNodes());
+        const double max_unattributed_time = SAMRAI_MPI::maxReduction(unattributed_time);
+        if (d_enable_logging)
+        {
+            plog << d_object_name << "::calibrate(): measured time per timestep: min = " << min_step_time
+                 << ", max = " << max_step_time << ", mean = " << avg_step_time
+                 << ", imbalance (max/mean) = " << (avg_step_time > 0.0 ? max_step_time / avg_step_time : 1.0) << "\n";
+            plog << d_object_name << "::calibrate(): max untimed time per timestep = " << max_unattributed_time
+                 << "\n";
+            plog << d_object_name << "::calibrate(): interaction cost = " << d_cost[INTERACTION_WORK]
+                 << ", force cost = " << d_cost[FORCE_WORK] << "\n";
+        }
+    }
+
+    // Reset the accumulated timings.
+    for (int k = 0; k < NUM_WORK_TYPES; ++k) d_elapsed_time[k] = 0.0;
+    d_elapsed_step_time = 0.0;
+    d_num_steps = 0;
+    return;
+} // calibrate
+
+void WorkloadCostModel::printWorkloadStatistics(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                const int workload_data_idx) const
+{
+    double local_workload = 0.0;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > workload_data = patch->getPatchData(workload_data_idx);
+            for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+            {
+                local_workload += (*workload_data)(b());
+            }
+        }
+    }
+    const double max_workload = SAMRAI_MPI::maxReduction(local_workload);
+    const double min_workload = SAMRAI_MPI::minReduction(local_workload);
+    const double avg_workload = SAMRAI_MPI::sumReduction(local_workload) / double(SAMRAI_MPI::getNodes());
+    plog << d_object_name << "::printWorkloadStatistics(): estimated workload per process: min = " << min_workload
+         << ", max = " << max_workload << ", mean = " << avg_workload
+         << ", imbalance (max/mean) = " << (avg_workload > 0.0 ? max_workload / avg_workload : 1.0) << "\n";
+    return;
+} // printWorkloadStatistics
+
+void WorkloadCostModel::putToDatabase(Pointer<Database> db)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(db);
+#endif
+    db->putInteger("WORKLOAD_COST_MODEL_VERSION", WORKLOAD_COST_MODEL_VERSION);
+    db->putDoubleArray("d_cost", d_cost, NUM_WORK_TYPES);
+    return;
+} // putToDatabase
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void WorkloadCostModel::getFromRestart()
+{
+    Pointer<Database> restart_db = RestartManager::getManager()->getRootDatabase();
+    Pointer<Database> db;
+    if (restart_db->isDatabase(d_object_name))
+    {
+        db = restart_db->getDatabase(d_object_name);
+    }
+    else
+    {
+        TBOX_ERROR(d_object_name << "::getFromRestart():\n"
+                                 << "  Restart database corresponding to " << d_object_name
+                                 << " not found in restart file." << std::endl);
+    }
+    int ver = db->getInteger("WORKLOAD_COST_MODEL_VERSION");
+    if (ver != WORKLOAD_COST_MODEL_VERSION)
+    {
+        TBOX_ERROR(d_object_name << "::getFromRestart():\n"
+                                 << "  Restart file version different than class version." << std::endl);
+    }
+    db->getDoubleArray("d_cost", d_cost, NUM_WORK_TYPES);
+    return;
+} // getFromRestart
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <map>
 #include <ostream>
 #include <string>
@@ -45,16 +46,19 @@
 #include "CellIndex.h"
 #include "CellIterator.h"
 #include "FaceData.h"
+#include "FaceGeometry.h"
 #include "FaceIndex.h"
 #include "FaceIterator.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "NodeData.h"
+#include "NodeGeometry.h"
 #include "NodeIndex.h"
 #include "NodeIterator.h"
 #include "Patch.h"
 #include "PatchData.h"
 #include "SideData.h"
+#include "SideGeometry.h"
 #include "SideIndex.h"
 #include "SideIterator.h"
 #include "ibtk/CartGridFunction.h"
@@ -92,13 +96,45 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// The maximum number of cached function values.  The cache is cleared when
+// this number is exceeded, e.g., after the patch hierarchy has been regridded
+// several times.
+static const size_t MAX_NUM_CACHED_VALUES = 1 << 24;
+
+// Get storage for the function values at the next num_points data locations,
+// either in the cache or in a temporary buffer.
+inline double* get_values(const unsigned int num_points,
+                          std::vector<double>* const cached_values,
+                          const bool compute_values,
+                          std::vector<double>& values_buf,
+                          size_t& offset)
+{
+    double* values;
+    if (cached_values)
+    {
+        if (compute_values) cached_values->resize(offset + num_points);
+        values = &(*cached_values)[offset];
+    }
+    else
+    {
+        values_buf.resize(num_points);
+        values = &values_buf[0];
+    }
+    offset += num_points;
+    return values;
+} // get_values
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 muParserCartGridFunction::muParserCartGridFunction(const std::string& object_name,
                                                    Pointer<Database> input_db,
                                                    Pointer<CartesianGridGeometry<NDIM> > grid_geom)
     : CartGridFunction(object_name), d_grid_geom(grid_geom), d_constants(), d_function_strings(), d_parsers(),
-      d_parser_time(), d_parser_posn()
+      d_parser_time(), d_parser_posn(), d_time_dependent(true), d_cache_values(false), d_cached_values(),
+      d_num_cached_values(0)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -123,6 +159,11 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
         }
     }
 
+    if (input_db->keyExists("cache_time_independent_values"))
+    {
+        d_cache_values = input_db->getBool("cache_time_independent_values");
+    }
+
     // Initialize the parser(s) with data read in from the input database.
     if (input_db->isString("function"))
     {
@@ -261,19 +302,31 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
         {
             it->DefineConst(map_cit->first, map_cit->second);
         }
+    }
 
-        // Variables.
-        it->DefineVar("T", &d_parser_time);
-        it->DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Variables.
+    resizeParserVariables(1, 0.0);
+
+    // Determine whether any of the functions depends on time.
+    d_time_dependent = false;
+    for (std::vector<mu::Parser>::iterator it = d_parsers.begin(); it != d_parsers.end(); ++it)
+    {
+        try
         {
-            std::ostringstream stream;
-            stream << d;
-            const std::string postfix = stream.str();
-            it->DefineVar("X" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("X_" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x_" + postfix, &(d_parser_posn[d]));
+            const mu::varmap_type& used_vars = it->GetUsedVar();
+            d_time_dependent =
+                d_time_dependent || used_vars.find("T") != used_vars.end() || used_vars.find("t") != used_vars.end();
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  error: " << e.GetMsg() << "\n"
+                       << "  in:    " << e.GetExpr() << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
         }
     }
     return;
@@ -297,8 +350,6 @@ void muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                               const bool /*initial_time*/,
                                               Pointer<PatchLevel<NDIM> > /*level*/)
 {
-    d_parser_time = data_time;
-
     const Box<NDIM>& patch_box = patch->getBox();
     const Index<NDIM>& patch_lower = patch_box.lower();
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
@@ -315,6 +366,66 @@ void muParserCartGridFunction::setDataOnPatch(const int data_idx,
     Pointer<FaceData<NDIM, double> > fc_data = data;
     Pointer<NodeData<NDIM, double> > nc_data = data;
     Pointer<SideData<NDIM, double> > sc_data = data;
+    if (!cc_data && !fc_data && !nc_data && !sc_data)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  unsupported patch data type encountered." << std::endl);
+    }
+
+    // Look up previously computed values of time-independent functions.  The
+    // values are indexed by the data centering and depth and by the patch
+    // geometry.
+    std::vector<double>* cached_values = NULL;
+    bool compute_values = true;
+    if (d_cache_values && !d_time_dependent)
+    {
+        std::vector<double> key;
+        if (cc_data)
+        {
+            key.push_back(0.0);
+            key.push_back(static_cast<double>(cc_data->getDepth()));
+        }
+        else if (fc_data)
+        {
+            key.push_back(1.0);
+            key.push_back(static_cast<double>(fc_data->getDepth()));
+        }
+        else if (nc_data)
+        {
+            key.push_back(2.0);
+            key.push_back(static_cast<double>(nc_data->getDepth()));
+        }
+        else if (sc_data)
+        {
+            key.push_back(3.0);
+            key.push_back(static_cast<double>(sc_data->getDepth()));
+        }
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            key.push_back(static_cast<double>(patch_box.lower()(d)));
+            key.push_back(static_cast<double>(patch_box.upper()(d)));
+            key.push_back(XLower[d]);
+            key.push_back(dx[d]);
+        }
+        std::map<std::vector<double>, std::vector<double> >::iterator it = d_cached_values.find(key);
+        if (it != d_cached_values.end())
+        {
+            cached_values = &it->second;
+            compute_values = false;
+        }
+        else
+        {
+            if (d_num_cached_values > MAX_NUM_CACHED_VALUES)
+            {
+                d_cached_values.clear();
+                d_num_cached_values = 0;
+            }
+            cached_values = &d_cached_values[key];
+        }
+    }
+    std::vector<double> values_buf;
+    size_t offset = 0;
+
     if (cc_data)
     {
 #if !defined(NDEBUG)
@@ -323,28 +434,26 @@ void muParserCartGridFunction::setDataOnPatch(const int data_idx,
         for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            const unsigned int num_points = static_cast<unsigned int>(patch_box.size());
+            double* const values = get_values(num_points, cached_values, compute_values, values_buf, offset);
+            if (compute_values)
             {
-                const CellIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
+                resizeParserVariables(num_points, data_time);
+                unsigned int k = 0;
+                for (CellIterator<NDIM> ic(patch_box); ic; ic++, ++k)
                 {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                }
-                try
-                {
-                    (*cc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: " << e.GetMsg() << "\n"
-                               << "  in:    " << e.GetExpr() << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
+                    const CellIndex<NDIM>& i = ic();
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                    }
                 }
+                evaluateParser(function_depth, num_points, values);
+            }
+            unsigned int k = 0;
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++, ++k)
+            {
+                (*cc_data)(ic(), data_depth) = values[k];
             }
         }
     }
@@ -379,37 +488,37 @@ void muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     function_depth = NDIM * data_depth + axis;
                 }
 
-                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                const unsigned int num_points =
+                    static_cast<unsigned int>(FaceGeometry<NDIM>::toFaceBox(patch_box, axis).size());
+                double* const values = get_values(num_points, cached_values, compute_values, values_buf, offset);
+                if (compute_values)
                 {
-                    const FaceIndex<NDIM>& i = ic();
-                    const Index<NDIM>& cell_idx = i.toCell(1);
-                    for (unsigned int d = 0; d < NDIM; ++d)
+                    resizeParserVariables(num_points, data_time);
+                    unsigned int k = 0;
+                    for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
                     {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
-                        }
-                        else
+                        const FaceIndex<NDIM>& i = ic();
+                        const Index<NDIM>& cell_idx = i.toCell(1);
+                        for (unsigned int d = 0; d < NDIM; ++d)
                         {
-                            d_parser_posn[d] =
-                                XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
+                            if (d == axis)
+                            {
+                                d_parser_posn[d][k] =
+                                    XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
+                            }
+                            else
+                            {
+                                d_parser_posn[d][k] =
+                                    XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
+                            }
                         }
                     }
-                    try
-                    {
-                        (*fc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                    evaluateParser(function_depth, num_points, values);
+                }
+                unsigned int k = 0;
+                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
+                {
+                    (*fc_data)(ic(), data_depth) = values[k];
                 }
             }
         }
@@ -422,28 +531,26 @@ void muParserCartGridFunction::setDataOnPatch(const int data_idx,
         for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
+            const unsigned int num_points = static_cast<unsigned int>(NodeGeometry<NDIM>::toNodeBox(patch_box).size());
+            double* const values = get_values(num_points, cached_values, compute_values, values_buf, offset);
+            if (compute_values)
             {
-                const NodeIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                }
-                try
-                {
-                    (*nc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: " << e.GetMsg() << "\n"
-                               << "  in:    " << e.GetExpr() << "\n");
-                }
-                catch (...)
+                resizeParserVariables(num_points, data_time);
+                unsigned int k = 0;
+                for (NodeIterator<NDIM> ic(patch_box); ic; ic++, ++k)
                 {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
+                    const NodeIndex<NDIM>& i = ic();
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                    }
                 }
+                evaluateParser(function_depth, num_points, values);
+            }
+            unsigned int k = 0;
+            for (NodeIterator<NDIM> ic(patch_box); ic; ic++, ++k)
+            {
+                (*nc_data)(ic(), data_depth) = values[k];
             }
         }
     }
@@ -478,47 +585,97 @@ void muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     function_depth = NDIM * data_depth + axis;
                 }
 
-                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                const unsigned int num_points =
+                    static_cast<unsigned int>(SideGeometry<NDIM>::toSideBox(patch_box, axis).size());
+                double* const values = get_values(num_points, cached_values, compute_values, values_buf, offset);
+                if (compute_values)
                 {
-                    const SideIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
+                    resizeParserVariables(num_points, data_time);
+                    unsigned int k = 0;
+                    for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
                     {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                        else
+                        const SideIndex<NDIM>& i = ic();
+                        for (unsigned int d = 0; d < NDIM; ++d)
                         {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                            if (d == axis)
+                            {
+                                d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                            }
+                            else
+                            {
+                                d_parser_posn[d][k] =
+                                    XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                            }
                         }
                     }
-                    try
-                    {
-                        (*sc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                    evaluateParser(function_depth, num_points, values);
+                }
+                unsigned int k = 0;
+                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
+                {
+                    (*sc_data)(ic(), data_depth) = values[k];
                 }
             }
         }
     }
-    else
+    if (cached_values && compute_values)
     {
-        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                   << "  unsupported patch data type encountered." << std::endl);
+        d_num_cached_values += offset;
     }
     return;
 } // setDataOnPatch
 
+void muParserCartGridFunction::resizeParserVariables(const unsigned int num_points, const double data_time)
+{
+    if (d_parser_time.size() < num_points)
+    {
+        // Resizing the variable arrays may move their data, and so the
+        // variables must be redefined.
+        d_parser_time.resize(num_points);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            d_parser_posn[d].resize(num_points);
+        }
+        for (std::vector<mu::Parser>::iterator it = d_parsers.begin(); it != d_parsers.end(); ++it)
+        {
+            it->DefineVar("T", &d_parser_time[0]);
+            it->DefineVar("t", &d_parser_time[0]);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                std::ostringstream stream;
+                stream << d;
+                const std::string postfix = stream.str();
+                it->DefineVar("X" + postfix, &d_parser_posn[d][0]);
+                it->DefineVar("x" + postfix, &d_parser_posn[d][0]);
+                it->DefineVar("X_" + postfix, &d_parser_posn[d][0]);
+                it->DefineVar("x_" + postfix, &d_parser_posn[d][0]);
+            }
+        }
+    }
+    std::fill(d_parser_time.begin(), d_parser_time.begin() + num_points, data_time);
+    return;
+} // resizeParserVariables
+
+void muParserCartGridFunction::evaluateParser(const int function_depth, const unsigned int num_points, double* values)
+{
+    try
+    {
+        d_parsers[function_depth].Eval(values, static_cast<int>(num_points));
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  error: " << e.GetMsg() << "\n"
+                   << "  in:    " << e.GetExpr() << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+    return;
+} // evaluateParser
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -88,6 +88,11 @@ namespace IBAMR
  * terms are discretized by the AdvectorExplicitPredictorPatchOps object supplied to the class
  * constructor.
  *
+ * Quantities that share an advection velocity are predicted together by the
+ * explicit predictor.  This may be disabled by setting the input key
+ * "group_predictions_by_velocity" to FALSE in the
+ * AdvDiffPredictorCorrectorHyperbolicPatchOps input database.
+ *
  * \see AdvDiffPredictorCorrectorHyperbolicPatchOps
  * \see HierarchyIntegrator
  * \see AdvectorExplicitPredictorPatchOps
@@ -36,6 +36,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <string>
+#include <vector>
 
 #include "ibamr/ibamr_enums.h"
 #include "tbox/Pointer.h"
@@ -232,6 +233,29 @@ public:
                                     const SAMRAI::hier::Patch<NDIM>& patch,
                                     double dt) const;
 
+    /*!
+     * \brief Compute predicted time- and face-centered values for several
+     * cell-centered quantities that are advected by the same velocity field.
+     *
+     * This is equivalent to calling predictValue() or
+     * predictValueWithSourceTerm() for each quantity, except that the scratch
+     * data required by the predictor are allocated only once and are shared by
+     * all of the quantities.
+     *
+     * The source terms \a F are optional: \a F may either be empty, or have the
+     * same number of entries as \a Q, in which case NULL entries indicate
+     * quantities without source terms.
+     *
+     * \see predictValue
+     * \see predictValueWithSourceTerm
+     */
+    void predictValues(const std::vector<SAMRAI::pdat::FaceData<NDIM, double>*>& q_half,
+                       const SAMRAI::pdat::FaceData<NDIM, double>& u_ADV,
+                       const std::vector<const SAMRAI::pdat::CellData<NDIM, double>*>& Q,
+                       const std::vector<const SAMRAI::pdat::CellData<NDIM, double>*>& F,
+                       const SAMRAI::hier::Patch<NDIM>& patch,
+                       double dt) const;
+
     /*!
      * \brief Compute predicted time- and face-centered MAC velocities from a
      * cell-centered velocity field using a second-order Godunov method (\em
@@ -366,6 +390,12 @@ private:
                                const SAMRAI::pdat::CellData<NDIM, double>& F,
                                const SAMRAI::hier::Patch<NDIM>& patch,
                                double dt) const;
+    void predict(const std::vector<SAMRAI::pdat::FaceData<NDIM, double>*>& q_half,
+                 const SAMRAI::pdat::FaceData<NDIM, double>& u_ADV,
+                 const std::vector<const SAMRAI::pdat::CellData<NDIM, double>*>& Q,
+                 const std::vector<const SAMRAI::pdat::CellData<NDIM, double>*>& F,
+                 const SAMRAI::hier::Patch<NDIM>& patch,
+                 double dt) const;
 
     /*
      * These private member functions read data from input and restart.  When
@@ -417,6 +417,13 @@ protected:
              SAMRAI::tbox::Pointer<IBTK::CartGridFunction> > d_u_fcn;
     bool d_compute_init_velocity, d_compute_half_velocity, d_compute_final_velocity;
 
+    /*
+     * Boolean indicating whether the predicted values for all of the quantities
+     * advected by a particular velocity field are computed together (default is
+     * true).
+     */
+    bool d_group_predictions_by_velocity;
+
     /*
      * Source term data.
      */
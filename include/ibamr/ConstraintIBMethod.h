@@ -228,10 +228,11 @@ private:
     void calculateKinematicsVelocity();
 
     /*!
-     * \brief Calculate momentum of kinematics velocity. This is extraneous momentum
-     * that needs to be subtracted from the kinematics velocity.
+     * \brief Calculate momentum of kinematics velocity of all self-translating
+     * structures. This is extraneous momentum that needs to be subtracted from
+     * the kinematics velocity.
      */
-    void calculateMomentumOfKinematicsVelocity(const int position_handle);
+    void calculateMomentumOfKinematicsVelocity();
 
     /*!
      * \brief Calculate volume element associated with material points.
@@ -268,14 +269,9 @@ private:
     void interpolateFluidSolveVelocity();
 
     /*!
-     * \brief Calculate the rigid translational velocity.
+     * \brief Calculate the rigid translational and rotational velocities.
      */
-    void calculateRigidTranslationalMomentum();
-
-    /*!
-     * \brief Calculate the rigid rotational velocity.
-     */
-    void calculateRigidRotationalMomentum();
+    void calculateRigidMomentum();
 
     /*!
      * \brief Calculate current velocity on the material points.
@@ -315,19 +311,28 @@ private:
     void calculateMidPointVelocity();
 
     /*!
-     * \brief Calculate hydrodynamic drag on the immersed structures.
+     * \brief Calculate hydrodynamic drag and torque on the immersed structures
+     * and the power spent during swimming.
      */
-    void calculateDrag();
+    void calculateDragTorqueAndPower();
 
     /*!
-     * \brief Calculate hydrodynamic torque on the immersed structures.
+     * \brief Group the local Lagrangian nodes of each level by the structure to
+     * which they belong.
      */
-    void calculateTorque();
+    void buildStructureNodeMap();
 
     /*!
-     * \brief Calculate power spent during swimming.
+     * \brief Accumulate per-structure quantities over the local Lagrangian
+     * nodes of all levels in a single sweep and sum them across processors
+     * with a single reduction.
+     *
+     * The kernel accumulates Kernel::NVALS values per structure.  Upon
+     * return, the values for structure \a s are stored in
+     * moments[s*Kernel::NVALS], ..., moments[(s+1)*Kernel::NVALS-1].
      */
-    void calculatePower();
+    template <class Kernel>
+    void reduceOverStructureNodes(Kernel& kernel, std::vector<double>& moments);
 
     /*!
      * \brief Calculate Eulerian Momentum.
@@ -394,6 +399,26 @@ private:
      */
     std::vector<Eigen::Matrix3d> d_moment_of_inertia_current, d_moment_of_inertia_new;
 
+    /*!
+     * Local PETSc and Lagrangian indices of the local nodes of the structures
+     * on each level, grouped by structure.  The nodes of structure s on level
+     * ln are stored at positions d_struct_node_offsets[ln][s], ...,
+     * d_struct_node_offsets[ln][s+1]-1.
+     */
+    std::vector<std::vector<int> > d_struct_node_local_idxs, d_struct_node_lag_idxs, d_struct_node_offsets;
+
+    /*!
+     * First Lagrangian index of each structure on each level (-1 if the
+     * structure does not reside on that level).
+     */
+    std::vector<std::vector<int> > d_struct_lag_idx_offsets;
+
+    /*!
+     * Whether to accumulate per-structure reductions with multiple threads.
+     * This option has an effect only when IBAMR is compiled with OpenMP.
+     */
+    bool d_use_threaded_reductions;
+
     /*!
      * Tag a Lagrangian point (generally eye of the fish) of the immersed structures.
      */
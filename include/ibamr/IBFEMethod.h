@@ -37,6 +37,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -47,6 +48,7 @@
 #include "PatchHierarchy.h"
 #include "ibamr/IBStrategy.h"
 #include "ibtk/FEDataManager.h"
+#include "ibtk/ScratchDataIndexCache.h"
 #include "ibtk/libmesh_utilities.h"
 #include "libmesh/enum_fe_family.h"
 #include "libmesh/enum_order.h"
@@ -498,6 +500,12 @@ public:
     void registerLoadBalancer(SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > load_balancer,
                               int workload_data_idx);
 
+    /*!
+     * Register a workload cost model to be used when computing work load
+     * estimates.
+     */
+    void registerWorkloadCostModel(SAMRAI::tbox::Pointer<IBTK::WorkloadCostModel> workload_cost_model);
+
     /*!
      * Update work load estimates on each level of the patch hierarchy.
      */
@@ -712,6 +720,13 @@ protected:
      */
     bool d_registered_for_restart;
 
+    /*
+     * Scratch patch data, keyed by destination patch data index, used to
+     * accumulate spread force values when physical boundary conditions are
+     * applied to the spread values.
+     */
+    IBTK::ScratchDataIndexCache d_spread_scratch_data_cache;
+
 private:
     /*!
      * \brief Default constructor.
@@ -58,6 +58,7 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/LMarkerSetVariable.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/Pointer.h"
 
@@ -308,6 +309,7 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > d_load_balancer;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_workload_var;
     int d_workload_idx;
+    SAMRAI::tbox::Pointer<IBTK::WorkloadCostModel> d_workload_cost_model;
 
     /*
      * Lagrangian marker data structures.
@@ -53,6 +53,7 @@
 
 namespace IBAMR
 {
+class IBLagrangianMultigridPreconditioner;
 class INSStaggeredHierarchyIntegrator;
 } // namespace IBAMR
 namespace SAMRAI
@@ -81,6 +82,18 @@ namespace IBAMR
  * \brief Class IBImplicitStaggeredHierarchyIntegrator is an implementation of a
  * formally second-order accurate, nonlinearly-implicit version of the immersed
  * boundary method.
+ *
+ * By default, the Lagrangian Schur complement systems that arise in the block
+ * preconditioner are solved without preconditioning.  If the input database
+ * sets <tt>use_lagrangian_multigrid_preconditioner = TRUE</tt> and the
+ * IBImplicitStrategy object is able to assemble the Jacobian of the Lagrangian
+ * force, these systems are instead preconditioned by an aggregation multigrid
+ * method applied to I-s*A, in which A is the Jacobian of the linearized
+ * Lagrangian force and s is a scaling factor that is estimated from the action
+ * of the Schur complement.  The multigrid method is configured via the
+ * optional sub-database <tt>lagrangian_multigrid_preconditioner_db</tt>.
+ *
+ * \see IBLagrangianMultigridPreconditioner
  */
 class IBImplicitStaggeredHierarchyIntegrator : public IBHierarchyIntegrator
 {
@@ -135,6 +148,11 @@ public:
     void initializeHierarchyIntegrator(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                        SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg);
 
+    /*!
+     * Regrid the hierarchy.
+     */
+    void regridHierarchy();
+
     /*!
      * Returns the number of cycles to perform for the present time step.
      */
@@ -233,9 +251,36 @@ private:
      */
     PetscErrorCode lagrangianSchurApply(Vec x, Vec y);
 
+    /*!
+     * Reset the Lagrangian multigrid preconditioner for the present linearized
+     * position.
+     */
+    void resetLagrangianMultigridPreconditioner();
+
+    /*!
+     * Estimate the scaling factor s for which I-s*A approximates the Lagrangian
+     * Schur complement, in which A is the Jacobian of the linearized Lagrangian
+     * force.
+     */
+    double estimateLagrangianSchurComplementScaling();
+
+    /*!
+     * Deallocate the Lagrangian multigrid preconditioner and the matrices used
+     * to build it.
+     */
+    void deallocateLagrangianMultigridPreconditioner();
+
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     SAMRAI::tbox::Pointer<StaggeredStokesOperator> d_stokes_op;
     KSP d_schur_solver;
+
+    /*
+     * Lagrangian Schur complement preconditioner data.
+     */
+    bool d_use_lagrangian_multigrid_pc;
+    SAMRAI::tbox::Pointer<IBLagrangianMultigridPreconditioner> d_lagrangian_mg_pc;
+    Mat d_lagrangian_force_jac, d_lagrangian_schur_mat;
+    double d_lagrangian_schur_scaling;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_u_scratch_vec, d_f_scratch_vec;
 };
 } // namespace IBAMR
@@ -38,6 +38,7 @@
 #include <vector>
 
 #include "ibamr/IBStrategy.h"
+#include "petscmat.h"
 #include "petscvec.h"
 
 namespace IBTK
@@ -130,6 +131,23 @@ public:
      */
     virtual void computeLinearizedLagrangianForce(Vec& X_vec, double data_time) = 0;
 
+    /*!
+     * Assemble the Jacobian of the Lagrangian force of the linearized problem,
+     * i.e., the matrix A for which computeLinearizedLagrangianForce() computes
+     * F = A*X, with respect to the present linearized position.
+     *
+     * If \a A_mat is NULL, a new matrix is created; otherwise, the entries of
+     * the existing matrix are recomputed.  The matrix is stored in a blocked
+     * format with block size NDIM, so that each block couples the positions of
+     * a pair of Lagrangian nodes.
+     *
+     * \return Whether the Jacobian was assembled.
+     *
+     * \note A default implementation is provided that does not assemble the
+     * Jacobian and returns false.
+     */
+    virtual bool computeLinearizedLagrangianForceJacobian(Mat& A_mat, double data_time);
+
     /*!
      * Spread the Lagrangian force of the linearized problem to the Cartesian
      * grid at the specified time within the current time interval.
@@ -0,0 +1,245 @@
+// Filename: IBLagrangianMultigridPreconditioner.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBLagrangianMultigridPreconditioner
+#define included_IBLagrangianMultigridPreconditioner
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "petscksp.h"
+#include "petscmat.h"
+#include "petscpc.h"
+#include "petscvec.h"
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+namespace SAMRAI
+{
+namespace tbox
+{
+class Database;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class IBLagrangianMultigridPreconditioner is a multigrid
+ * preconditioner for linear systems involving the Jacobian of the Lagrangian
+ * force, such as the Lagrangian Schur complement systems solved by class
+ * IBImplicitStaggeredHierarchyIntegrator.
+ *
+ * The operator is provided as an assembled matrix whose rows and columns are
+ * grouped in blocks of size NDIM, one block per Lagrangian node.  Coarse levels
+ * are generated by aggregating nodes that are strongly coupled in the operator,
+ * i.e., nodes that are connected by springs, beams, or other force generators.
+ * Aggregation is performed independently on each process.  The prolongation
+ * operator interpolates nodal translations from the aggregates and is
+ * optionally improved by one step of damped Jacobi smoothing, and coarse-level
+ * operators are computed via Galerkin projection.  On each level, the smoother
+ * is damped block Jacobi relaxation using the inverses of the NDIM x NDIM
+ * diagonal blocks of the operator.  The coarsest level is solved by a PETSc
+ * KSP whose options may be set via the prefix "<options_prefix>coarse_".
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ max_levels = 10                  // maximum number of multigrid levels
+ coarsest_level_size = 64         // nodes below which coarsening stops
+ strength_threshold = 0.08        // threshold for strong connections
+ num_pre_sweeps = 1               // number of pre-smoothing sweeps
+ num_post_sweeps = 1              // number of post-smoothing sweeps
+ smoother_damping_factor = 0.67   // damping factor for block Jacobi sweeps
+ smooth_prolongation = TRUE       // whether to smooth the prolongation
+ \endverbatim
+ */
+class IBLagrangianMultigridPreconditioner : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    IBLagrangianMultigridPreconditioner(const std::string& object_name,
+                                        SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                                        const std::string& default_options_prefix);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~IBLagrangianMultigridPreconditioner();
+
+    /*!
+     * \brief Build the multigrid hierarchy for the specified operator.
+     *
+     * \note The operator must have a block size of NDIM.  The operator is
+     * copied, so that the preconditioner must be updated whenever the entries
+     * of the operator change.
+     */
+    void initializeSolverState(Mat A_mat);
+
+    /*!
+     * \brief Update the multigrid hierarchy for new values of the operator.
+     *
+     * The aggregates and prolongation operators computed by
+     * initializeSolverState() are reused, and only the values of the
+     * coarse-level operators and smoothers are recomputed.  If the hierarchy
+     * has not yet been built, this function calls initializeSolverState().
+     *
+     * \note The operator must have the same nonzero structure as the operator
+     * used to build the hierarchy.
+     */
+    void updateSolverState(Mat A_mat);
+
+    /*!
+     * \brief Deallocate the multigrid hierarchy.
+     */
+    void deallocateSolverState();
+
+    /*!
+     * \brief Return whether the multigrid hierarchy has been built.
+     */
+    bool getIsInitialized() const;
+
+    /*!
+     * \brief Return the number of levels in the multigrid hierarchy.
+     */
+    int getNumberOfLevels() const;
+
+    /*!
+     * \brief Apply a single V-cycle to compute x = inv(A)*b approximately,
+     * using a zero initial guess.
+     */
+    PetscErrorCode apply(Vec b, Vec x);
+
+    /*!
+     * \brief Configure a PETSc PC object to apply this preconditioner.
+     */
+    void setupPCShell(PC pc);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    IBLagrangianMultigridPreconditioner();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    IBLagrangianMultigridPreconditioner(const IBLagrangianMultigridPreconditioner& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    IBLagrangianMultigridPreconditioner& operator=(const IBLagrangianMultigridPreconditioner& that);
+
+    /*!
+     * \brief Static function for applying the preconditioner via a PETSc PC
+     * object.
+     */
+    static PetscErrorCode PCApply_SAMRAI(PC pc, Vec x, Vec y);
+
+    /*!
+     * \brief Compute the aggregates of the locally owned nodes of the operator
+     * on the specified level, and return the number of local aggregates.
+     */
+    int computeAggregates(int ln, std::vector<int>& node_to_aggregate) const;
+
+    /*!
+     * \brief Build the prolongation operator from the specified coarser level
+     * to the specified level.
+     */
+    void buildProlongation(int ln, const std::vector<int>& node_to_aggregate, int num_local_aggregates);
+
+    /*!
+     * \brief Compute the inverses of the diagonal blocks of the operator on the
+     * specified level.
+     */
+    void buildSmoother(int ln);
+
+    /*!
+     * \brief Perform damped block Jacobi sweeps on the specified level.
+     */
+    void smooth(int ln, Vec b, Vec x, int num_sweeps, bool initial_guess_nonzero);
+
+    /*!
+     * \brief Apply a V-cycle starting on the specified level.
+     */
+    void applyVCycle(int ln, Vec b, Vec x);
+
+    /*!
+     * \brief Estimate the spectral radius of inv(D)*A on the specified level
+     * via power iteration, in which D is the diagonal of A.
+     */
+    double estimateSpectralRadius(int ln, Vec D_inv) const;
+
+    std::string d_object_name, d_options_prefix;
+    bool d_is_initialized;
+
+    /*!
+     * Solver parameters.
+     */
+    int d_max_levels, d_coarsest_level_size, d_num_pre_sweeps, d_num_post_sweeps;
+    double d_strength_threshold, d_smoother_damping_factor;
+    bool d_smooth_prolongation;
+
+    /*!
+     * Level data, indexed from the finest level (level 0) to the coarsest level.
+     * The prolongation operator d_P_mats[ln] maps from level ln+1 to level ln.
+     * The level 0 operator is a copy of the operator provided to
+     * initializeSolverState().
+     */
+    std::vector<Mat> d_A_mats, d_P_mats;
+    std::vector<Vec> d_b_vecs, d_x_vecs, d_r_vecs;
+    std::vector<std::vector<double> > d_block_diag_inv;
+    KSP d_coarse_solver;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBLagrangianMultigridPreconditioner
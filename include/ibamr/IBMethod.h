@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <stddef.h>
 #include <set>
 #include <string>
 #include <vector>
@@ -98,6 +99,21 @@ namespace IBAMR
  * \brief Class IBMethod is an implementation of the abstract base class
  * IBImplicitStrategy that provides functionality required by the standard IB
  * method.
+ *
+ * When the input key \p lagrangian_restart_dirname is provided, the Lagrangian
+ * data are also written to that directory whenever restart data are written,
+ * in a format that does not depend on the parallel decomposition of the data
+ * (see IBTK::LDataManager::writeLagrangianRestartData()).  Setting
+ * \p lagrangian_restart_restore_number replaces the initial Lagrangian
+ * configuration, including the data associated with the nodes, by the data
+ * written at that time step number, so that a simulation may be continued on
+ * a different number of processes.  The initial grid is then generated from
+ * the restored node positions, the time step numbering continues from the
+ * restart number, and the integrator start time must equal the time at which
+ * the data were written.  Setting
+ * \p lagrangian_restart_async_writes to TRUE writes these data by a background
+ * thread while the simulation proceeds, optionally bounding the staged data by
+ * \p lagrangian_restart_max_pending_bytes.
  */
 class IBMethod : public IBImplicitStrategy
 {
@@ -268,6 +284,12 @@ public:
      */
     void computeLinearizedLagrangianForce(Vec& X_vec, double data_time);
 
+    /*!
+     * Assemble the Jacobian of the Lagrangian force of the linearized problem
+     * with respect to the present linearized position.
+     */
+    bool computeLinearizedLagrangianForceJacobian(Mat& A_mat, double data_time);
+
     /*!
      * Spread the Lagrangian force to the Cartesian grid at the specified time
      * within the current time interval.
@@ -348,6 +370,14 @@ public:
         double init_data_time,
         bool initial_time);
 
+    /*!
+     * Overwrite the initial Lagrangian data by the values read from a
+     * decomposition-independent restart file, when one is being restored.
+     */
+    void postprocessInitializePatchHierarchy(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                             double init_data_time,
+                                             bool initial_time);
+
     /*!
      * Register a load balancer and work load patch data index with the IB
      * strategy object.
@@ -355,6 +385,12 @@ public:
     void registerLoadBalancer(SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > load_balancer,
                               int workload_data_idx);
 
+    /*!
+     * Register a workload cost model to be used when computing work load
+     * estimates.
+     */
+    void registerWorkloadCostModel(SAMRAI::tbox::Pointer<IBTK::WorkloadCostModel> workload_cost_model);
+
     /*!
      * Update work load estimates on each level of the patch hierarchy.
      */
@@ -486,6 +522,23 @@ protected:
      */
     bool d_do_log;
 
+    /*
+     * The directory to which decomposition-independent Lagrangian restart data
+     * are written, and the restart number from which such data are read when
+     * the simulation is initialized (a negative number indicates that no data
+     * are read).
+     */
+    std::string d_lag_restart_dirname;
+    int d_lag_restart_restore_num;
+
+    /*
+     * Whether the decomposition-independent Lagrangian restart data are
+     * written asynchronously, and the bound on the number of bytes staged for
+     * writing (zero indicates no bound).
+     */
+    bool d_lag_restart_async_writes;
+    size_t d_lag_restart_max_pending_bytes;
+
     /*
      * Pointers to the patch hierarchy and gridding algorithm objects associated
      * with this object.
@@ -560,6 +613,12 @@ protected:
     std::vector<int> d_n_src;
     bool d_normalize_source_strength;
 
+    /*
+     * The revision of the Lagrangian node distribution for which the force and
+     * source generators were last initialized.
+     */
+    int d_node_distribution_revision;
+
     /*
      * Post-processor object.
      */
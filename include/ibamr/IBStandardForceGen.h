@@ -226,6 +226,7 @@ private:
     std::vector<TargetPointData> d_target_point_data;
 
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_X_ghost_data, d_F_ghost_data, d_dX_data;
+    std::vector<std::vector<int> > d_nonlocal_petsc_idxs;
     std::vector<bool> d_is_initialized;
     //\}
 
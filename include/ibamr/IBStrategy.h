@@ -50,6 +50,7 @@
 namespace IBTK
 {
 class RobinPhysBdryPatchStrategy;
+class WorkloadCostModel;
 } // namespace IBTK
 
 namespace IBTK
@@ -327,6 +328,18 @@ public:
         double init_data_time,
         bool initial_time);
 
+    /*!
+     * Complete the initialization of the Lagrangian data after
+     * initializePatchHierarchy() has been called, e.g., to overwrite initial
+     * values that are set by derived classes by values read from a restart
+     * file.
+     *
+     * An empty default implementation is provided.
+     */
+    virtual void postprocessInitializePatchHierarchy(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                                     double init_data_time,
+                                                     bool initial_time);
+
     /*!
      * Register a load balancer and work load patch data index with the IB
      * strategy object.
@@ -336,6 +349,14 @@ public:
     virtual void registerLoadBalancer(SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > load_balancer,
                                       int workload_data_idx);
 
+    /*!
+     * Register a workload cost model to be used when computing work load
+     * estimates.
+     *
+     * An empty default implementation is provided.
+     */
+    virtual void registerWorkloadCostModel(SAMRAI::tbox::Pointer<IBTK::WorkloadCostModel> workload_cost_model);
+
     /*!
      * Update work load estimates on each level of the patch hierarchy.
      *
@@ -418,6 +439,13 @@ protected:
      */
     INSHierarchyIntegrator* getINSHierarchyIntegrator() const;
 
+    /*!
+     * Reset the time step number of the IBHierarchyIntegrator class registered
+     * with this IBStrategy object, e.g., when a computation is continued from
+     * data that were written at a particular time step.
+     */
+    void resetIntegratorStep(int integrator_step);
+
     /*!
      * Return a pointer to the HierarchyDataOpsReal object associated with
      * velocity-like variables.
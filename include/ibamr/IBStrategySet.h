@@ -268,6 +268,14 @@ public:
         double init_data_time,
         bool initial_time);
 
+    /*!
+     * Complete the initialization of the Lagrangian data after
+     * initializePatchHierarchy() has been called.
+     */
+    void postprocessInitializePatchHierarchy(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                             double init_data_time,
+                                             bool initial_time);
+
     /*!
      * Register a load balancer and work load patch data index with the IB
      * strategy object.
@@ -275,6 +283,12 @@ public:
     void registerLoadBalancer(SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > load_balancer,
                               int workload_data_idx);
 
+    /*!
+     * Register a workload cost model to be used when computing work load
+     * estimates.
+     */
+    void registerWorkloadCostModel(SAMRAI::tbox::Pointer<IBTK::WorkloadCostModel> workload_cost_model);
+
     /*!
      * Update work load estimates on each level of the patch hierarchy.
      */
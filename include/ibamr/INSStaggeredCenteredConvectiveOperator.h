@@ -68,6 +68,10 @@ namespace IBAMR
  * ConvectiveOperator which implements a centered convective differencing
  * operator.
  *
+ * When the input key \p use_threaded_patch_loops is set to TRUE and the library
+ * is compiled with OpenMP support, the patches of each level are processed
+ * concurrently by OpenMP threads.
+ *
  * \see INSStaggeredHierarchyIntegrator
  */
 class INSStaggeredCenteredConvectiveOperator : public ConvectiveOperator
@@ -189,6 +193,10 @@ private:
     // Cached communications operators.
     std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_bc_coefs;
     std::string d_bdry_extrap_type;
+
+    // Whether the patches of each level are processed by OpenMP threads.
+    bool d_use_threaded_patch_loops;
+
     std::vector<IBTK::HierarchyGhostCellInterpolation::InterpolationTransactionComponent> d_transaction_comps;
     SAMRAI::tbox::Pointer<IBTK::HierarchyGhostCellInterpolation> d_hier_bdry_fill;
 
@@ -102,6 +102,10 @@ namespace IBAMR
  coarse_solver_rel_residual_tol = 1.0e-5        // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50       // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 10              // see setCoarseSolverMaxIterations()
+ use_tiled_kernels = FALSE                      // see IBTK::PatchMathOps::setUseTiledKernels()
+ tile_width = 0                                 // see IBTK::PatchMathOps::setTileWidth()
+ use_threaded_tiles = FALSE                     // see IBTK::PatchMathOps::setUseThreadedTiles()
+ use_threaded_patch_loops = FALSE               // see IBTK::HierarchyMathOps::setUseThreadedPatchLoops()
  coarse_solver_db = { ... }                     // SAMRAI::tbox::Database for initializing
  coarse
  level solver
@@ -464,6 +468,20 @@ protected:
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_coarse_solver;
     SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_coarse_solver_db;
 
+    /*
+     * Options for the tiled evaluation of the operator when computing
+     * residuals (see IBTK::PatchMathOps).
+     */
+    bool d_use_tiled_kernels;
+    int d_tile_width;
+    bool d_use_threaded_tiles;
+
+    /*
+     * Whether the patches of each level are processed by OpenMP threads when
+     * computing residuals.
+     */
+    bool d_use_threaded_patch_loops;
+
     //\}
 
     /*!
@@ -54,10 +54,14 @@ namespace SAMRAI
 namespace hier
 {
 template <int DIM>
+class PatchHierarchy;
+template <int DIM>
 class PatchLevel;
 } // namespace hier
 namespace solv
 {
+template <int DIM>
+class RobinBcCoefStrategy;
 template <int DIM, class TYPE>
 class SAMRAIVectorReal;
 } // namespace solv
@@ -72,6 +76,29 @@ namespace IBAMR
  * for a staggered-grid (MAC) discretization of the incompressible Stokes
  * equations.
  *
+ * By default, the DOF indices, the PETSc matrices, and the KSP object are
+ * retained when the solver state is deallocated.  If the solver is
+ * subsequently reinitialized on the same patch level (i.e., the level has not
+ * been regenerated by a regrid operation), only the matrix values are
+ * recomputed, and the nonzero structure and DOF indices are reused.  The
+ * preconditioner is also reused when the boundary condition objects are
+ * unchanged, the problem coefficients C and D differ from those used to set it
+ * up by no more than a relative tolerance, and the solution time is the one at
+ * which it was set up; otherwise, it is rebuilt using the existing nonzero
+ * structure.  Because the boundary condition coefficients may depend on time,
+ * the preconditioner is reused at a different solution time only if
+ * reuse_pc_across_times is set.  This is appropriate only when the boundary
+ * condition coefficients do not change with time.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values), in addition to those supported by IBTK::PETScLevelSolver:
+ * \verbatim
+
+ reuse_petsc_objects = TRUE    // retain PETSc objects between initializations
+ pc_reuse_rel_tol = 0.0        // max relative change in C and D for PC reuse
+ reuse_pc_across_times = FALSE // reuse the PC when the solution time changes
+ \endverbatim
+ *
  * \see INSStaggeredHierarchyIntegrator
  */
 class StaggeredStokesPETScLevelSolver : public IBTK::PETScLevelSolver, public StaggeredStokesSolver
@@ -166,6 +193,12 @@ private:
      */
     StaggeredStokesPETScLevelSolver& operator=(const StaggeredStokesPETScLevelSolver& that);
 
+    /*!
+     * \brief Deallocate the DOF index data retained from a previous
+     * initialization, along with the schedules that depend upon it.
+     */
+    void deallocateCachedDOFIndexData();
+
     /*!
      * \name PETSc objects.
      */
@@ -179,6 +212,23 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > d_data_synch_sched, d_ghost_fill_sched;
 
     //\}
+
+    /*!
+     * \name Data used to determine whether retained PETSc objects may be
+     * reused.
+     */
+    //\{
+
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_cached_hierarchy;
+    int d_cached_level_num;
+    int d_cached_u_idx, d_cached_p_idx;
+    int d_pinned_p_dof_index;
+    double d_pc_reuse_rel_tol;
+    bool d_reuse_pc_across_times;
+    double d_pc_C, d_pc_D, d_pc_time;
+    std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_pc_U_bc_coefs;
+
+    //\}
 };
 } // namespace IBAMR
 
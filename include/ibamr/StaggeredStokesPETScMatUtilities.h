@@ -86,6 +86,23 @@ public:
                                                int p_dof_index_idx,
                                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
 
+    /*!
+     * \brief Reset the values of a parallel PETSc Mat object constructed by
+     * constructPatchLevelMACStokesOp() without modifying its nonzero structure.
+     *
+     * \note The DOF indices and patch level must be the same as those used to
+     * construct the matrix.
+     */
+    static void
+    resetPatchLevelMACStokesOpValues(Mat& mat,
+                                     const SAMRAI::solv::PoissonSpecifications& u_problem_coefs,
+                                     const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+                                     double data_time,
+                                     const std::vector<int>& num_dofs_per_proc,
+                                     int u_dof_index_idx,
+                                     int p_dof_index_idx,
+                                     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
     //\}
 
 protected:
@@ -0,0 +1,125 @@
+#! /usr/bin/env python
+#
+# Summarize the per-timestep, per-process performance traces written by
+# IBTK::PerformanceTrace.
+#
+# usage: analyze_performance_trace.py [-n NUM] [-s STEP] trace_dirname
+#
+# For each timer and counter, the maximum, mean, and minimum values over all
+# processes are computed for every recorded time step, along with the load
+# imbalance (max / mean) and the process that attains the maximum.  The entries
+# are then averaged over all recorded time steps (or reported for a single time
+# step if -s is given) and sorted by the maximum time.
+
+import glob
+import json
+import optparse
+import os
+import sys
+
+
+def read_traces(dirname):
+    steps = {}
+    for filename in sorted(glob.glob(os.path.join(dirname, "trace.*.jsonl"))):
+        with open(filename) as f:
+            for line in f:
+                line = line.strip()
+                if not line:
+                    continue
+                record = json.loads(line)
+                steps.setdefault(record["step"], []).append(record)
+    return steps
+
+
+def summarize(records, key, index):
+    stats = {}
+    num_ranks = len(records)
+    names = set()
+    for record in records:
+        names.update(record[key].keys())
+    for name in names:
+        vals = []
+        for record in records:
+            val = record[key].get(name)
+            if val is None:
+                val = 0.0
+            elif index is not None:
+                val = val[index]
+            vals.append((val, record["rank"]))
+        max_val, max_rank = max(vals)
+        min_val = min(vals)[0]
+        mean_val = sum(v[0] for v in vals) / num_ranks
+        stats[name] = (max_val, mean_val, min_val, max_rank)
+    return stats
+
+
+def accumulate(total, stats):
+    for name, (max_val, mean_val, min_val, max_rank) in stats.items():
+        entry = total.setdefault(name, [0.0, 0.0, 0.0, 0, {}])
+        entry[0] += max_val
+        entry[1] += mean_val
+        entry[2] += min_val
+        entry[3] += 1
+        entry[4][max_rank] = entry[4].get(max_rank, 0) + 1
+
+
+def print_table(title, total, num_entries, num_steps):
+    print(title)
+    print("%-64s %12s %12s %12s %9s %9s" % ("name", "max", "mean", "min", "max/mean", "max rank"))
+    rows = []
+    for name, (max_sum, mean_sum, min_sum, count, ranks) in total.items():
+        max_val = max_sum / num_steps
+        mean_val = mean_sum / num_steps
+        min_val = min_sum / num_steps
+        imbalance = max_val / mean_val if mean_val > 0.0 else 1.0
+        slowest_rank = max(ranks.items(), key=lambda item: item[1])[0]
+        rows.append((max_val, name, mean_val, min_val, imbalance, slowest_rank))
+    rows.sort(reverse=True)
+    for max_val, name, mean_val, min_val, imbalance, slowest_rank in rows[:num_entries]:
+        print("%-64s %12.5e %12.5e %12.5e %9.3f %9d" % (name[:64], max_val, mean_val, min_val, imbalance,
+                                                       slowest_rank))
+    print("")
+
+
+def main():
+    parser = optparse.OptionParser(usage="usage: %prog [options] trace_dirname")
+    parser.add_option("-n", "--num-entries", type="int", default=40,
+                      help="number of timers and counters to report (default: 40)")
+    parser.add_option("-s", "--step", type="int", default=None,
+                      help="report a single recorded time step instead of the average over all steps")
+    options, args = parser.parse_args()
+    if len(args) != 1:
+        parser.error("a single trace directory is required")
+
+    steps = read_traces(args[0])
+    if not steps:
+        sys.stderr.write("no trace data found in %s\n" % args[0])
+        return 1
+    if options.step is not None:
+        if options.step not in steps:
+            sys.stderr.write("time step %d was not recorded\n" % options.step)
+            return 1
+        steps = {options.step: steps[options.step]}
+
+    timer_total = {}
+    counter_total = {}
+    wall_total = {}
+    for step in sorted(steps.keys()):
+        records = steps[step]
+        accumulate(timer_total, summarize(records, "timers", 0))
+        accumulate(counter_total, summarize(records, "counters", None))
+        wall = dict((r["rank"], r["wall"]) for r in records)
+        accumulate(wall_total, {"wall": (max(wall.values()), sum(wall.values()) / len(wall),
+                                         min(wall.values()), max(wall, key=wall.get))})
+
+    num_steps = len(steps)
+    num_ranks = max(len(records) for records in steps.values())
+    print("recorded time steps: %d    processes: %d\n" % (num_steps, num_ranks))
+    print_table("time step wall clock time (seconds per step):", wall_total, 1, num_steps)
+    print_table("timers (seconds per step):", timer_total, options.num_entries, num_steps)
+    print_table("counters (per step):", counter_total, options.num_entries, num_steps)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
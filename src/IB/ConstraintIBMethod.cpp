@@ -37,6 +37,10 @@
 #include <utility>
 #include <algorithm>
 #include <cmath>
+#include <numeric>
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
 
 #include "PatchHierarchy.h"
 #include "HierarchyDataOpsManager.h"
@@ -153,6 +157,328 @@ inline void solveSystemOfEqns(std::vector<double>& ang_mom, const Eigen::Matrix3
     return;
 }
 #endif
+
+// Number of independent components of a symmetric NDIM x NDIM tensor.
+static const int NSYM = NDIM * (NDIM + 1) / 2;
+
+// Accumulate the first moment r and the second moments r_i*r_j (i <= j) of a
+// nodal position r.
+inline void accumulate_moments(const double* const r, double* const acc)
+{
+    for (int d = 0; d < NDIM; ++d) acc[d] += r[d];
+    double* const S = acc + NDIM;
+    for (int i = 0, k = 0; i < NDIM; ++i)
+    {
+        for (int j = i; j < NDIM; ++j, ++k) S[k] += r[i] * r[j];
+    }
+    return;
+} // accumulate_moments
+
+// Accumulate the (3D or out-of-plane) components of r X u.
+inline void accumulate_r_cross_u(const double* const r, const double* const u, double* const acc)
+{
+#if (NDIM == 2)
+    acc[2] += r[0] * u[1] - r[1] * u[0];
+#endif
+#if (NDIM == 3)
+    acc[0] += r[1] * u[2] - r[2] * u[1];
+    acc[1] += -r[0] * u[2] + r[2] * u[0];
+    acc[2] += r[0] * u[1] - r[1] * u[0];
+#endif
+    return;
+} // accumulate_r_cross_u
+
+// Compute the moment of inertia tensor about the centroid of n nodes from
+// the first moments m and second moments S of the nodal positions, which may
+// be taken relative to an arbitrary shift point.
+inline void compute_moment_of_inertia(Eigen::Matrix3d& I, const double* const m, const double* const S, const double n)
+{
+    double C[NDIM][NDIM];
+    for (int i = 0, k = 0; i < NDIM; ++i)
+    {
+        for (int j = i; j < NDIM; ++j, ++k) C[i][j] = C[j][i] = S[k] - m[i] * m[j] / n;
+    }
+    I.setZero();
+#if (NDIM == 2)
+    I(0, 0) = C[1][1];
+    I(0, 1) = -C[0][1];
+    I(1, 1) = C[0][0];
+    I(2, 2) = C[0][0] + C[1][1];
+#endif
+#if (NDIM == 3)
+    I(0, 0) = C[1][1] + C[2][2];
+    I(0, 1) = -C[0][1];
+    I(0, 2) = -C[0][2];
+    I(1, 1) = C[0][0] + C[2][2];
+    I(1, 2) = -C[1][2];
+    I(2, 2) = C[0][0] + C[1][1];
+#endif
+    I(1, 0) = I(0, 1);
+    I(2, 0) = I(0, 2);
+    I(2, 1) = I(1, 2);
+    return;
+} // compute_moment_of_inertia
+
+// The following kernels are used with
+// ConstraintIBMethod::reduceOverStructureNodes().  Each kernel accumulates
+// NVALS values per structure.  Kernels are invoked concurrently when threaded
+// reductions are enabled, so operator() must only write to acc.
+
+// Accumulates the first and second moments of the current and new positions
+// of each structure, taken relative to the shift points X0_current and X0_new
+// to limit round-off error, along with the new position of the tagged point.
+class PositionMomentsKernel
+{
+public:
+    static const int NVALS = 2 * (NDIM + NSYM) + NDIM;
+
+    PositionMomentsKernel(const std::vector<Pointer<LData> >& X_current_data,
+                          const std::vector<Pointer<LData> >& X_new_data,
+                          const std::vector<std::vector<double> >& X0_current,
+                          const std::vector<std::vector<double> >& X0_new,
+                          const std::vector<int>& tagged_pt_lag_idx)
+        : d_X_current_data(X_current_data), d_X_new_data(X_new_data), d_X0_current(X0_current), d_X0_new(X0_new),
+          d_tagged_pt_lag_idx(tagged_pt_lag_idx), d_X_current(NULL), d_X_new(NULL)
+    {
+    }
+
+    inline void beginLevel(const int ln)
+    {
+        d_X_current = d_X_current_data[ln]->getLocalFormVecArray()->data();
+        d_X_new = d_X_new_data[ln]->getLocalFormVecArray()->data();
+        return;
+    }
+
+    inline void endLevel(const int ln)
+    {
+        d_X_current_data[ln]->restoreArrays();
+        d_X_new_data[ln]->restoreArrays();
+        return;
+    }
+
+    inline void operator()(const int s, const int local_idx, const int lag_idx, double* const acc) const
+    {
+        const double* const X_current = d_X_current + NDIM * local_idx;
+        const double* const X_new = d_X_new + NDIM * local_idx;
+        double r_current[NDIM], r_new[NDIM];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            r_current[d] = X_current[d] - d_X0_current[s][d];
+            r_new[d] = X_new[d] - d_X0_new[s][d];
+        }
+        accumulate_moments(r_current, acc);
+        accumulate_moments(r_new, acc + NDIM + NSYM);
+        if (lag_idx == d_tagged_pt_lag_idx[s])
+        {
+            for (int d = 0; d < NDIM; ++d) acc[2 * (NDIM + NSYM) + d] = X_new[d];
+        }
+        return;
+    }
+
+private:
+    const std::vector<Pointer<LData> >& d_X_current_data;
+    const std::vector<Pointer<LData> >& d_X_new_data;
+    const std::vector<std::vector<double> >& d_X0_current;
+    const std::vector<std::vector<double> >& d_X0_new;
+    const std::vector<int>& d_tagged_pt_lag_idx;
+    const double* d_X_current;
+    const double* d_X_new;
+};
+
+// Accumulates the linear and angular momentum (about the center of mass
+// X_com) of the deformational kinematics velocity of each self-translating
+// structure.
+class KinematicsMomentumKernel
+{
+public:
+    static const int NVALS = NDIM + 3;
+
+    KinematicsMomentumKernel(const std::vector<Pointer<LData> >& X_data,
+                             const std::vector<Pointer<ConstraintIBKinematics> >& ib_kinematics,
+                             const std::vector<std::vector<int> >& struct_lag_idx_offsets,
+                             const std::vector<std::vector<double> >& X_com)
+        : d_X_data(X_data), d_ib_kinematics(ib_kinematics), d_struct_lag_idx_offsets(struct_lag_idx_offsets),
+          d_X_com(X_com), d_X(NULL), d_def_vel(ib_kinematics.size(), NULL), d_offsets(NULL)
+    {
+    }
+
+    inline void beginLevel(const int ln)
+    {
+        typedef ConstraintIBKinematics::StructureParameters StructureParameters;
+        d_X = d_X_data[ln]->getLocalFormVecArray()->data();
+        d_offsets = &d_struct_lag_idx_offsets[ln][0];
+        for (unsigned int s = 0; s < d_ib_kinematics.size(); ++s)
+        {
+            const StructureParameters& struct_param = d_ib_kinematics[s]->getStructureParameters();
+            if (d_offsets[s] >= 0 && struct_param.getStructureIsSelfTranslating())
+            {
+                d_def_vel[s] = &d_ib_kinematics[s]->getKinematicsVelocity(ln);
+            }
+            else
+            {
+                d_def_vel[s] = NULL;
+            }
+        }
+        return;
+    }
+
+    inline void endLevel(const int ln)
+    {
+        d_X_data[ln]->restoreArrays();
+        return;
+    }
+
+    inline void operator()(const int s, const int local_idx, const int lag_idx, double* const acc) const
+    {
+        if (!d_def_vel[s]) return;
+        const std::vector<std::vector<double> >& def_vel = *d_def_vel[s];
+        const int idx = lag_idx - d_offsets[s];
+        const double* const X = d_X + NDIM * local_idx;
+        double r[NDIM], U_def[NDIM];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            U_def[d] = def_vel[d][idx];
+            r[d] = X[d] - d_X_com[s][d];
+            acc[d] += U_def[d];
+        }
+        accumulate_r_cross_u(r, U_def, acc + NDIM);
+        return;
+    }
+
+private:
+    const std::vector<Pointer<LData> >& d_X_data;
+    const std::vector<Pointer<ConstraintIBKinematics> >& d_ib_kinematics;
+    const std::vector<std::vector<int> >& d_struct_lag_idx_offsets;
+    const std::vector<std::vector<double> >& d_X_com;
+    const double* d_X;
+    std::vector<const std::vector<std::vector<double> >*> d_def_vel;
+    const int* d_offsets;
+};
+
+// Accumulates the linear and angular momentum (about the center of mass
+// X_com) of the interpolated velocity of each structure.
+class RigidMomentumKernel
+{
+public:
+    static const int NVALS = NDIM + 3;
+
+    RigidMomentumKernel(const std::vector<Pointer<LData> >& U_data,
+                        const std::vector<Pointer<LData> >& X_data,
+                        const std::vector<std::vector<double> >& X_com)
+        : d_U_data(U_data), d_X_data(X_data), d_X_com(X_com), d_U(NULL), d_X(NULL)
+    {
+    }
+
+    inline void beginLevel(const int ln)
+    {
+        d_U = d_U_data[ln]->getLocalFormVecArray()->data();
+        d_X = d_X_data[ln]->getLocalFormVecArray()->data();
+        return;
+    }
+
+    inline void endLevel(const int ln)
+    {
+        d_U_data[ln]->restoreArrays();
+        d_X_data[ln]->restoreArrays();
+        return;
+    }
+
+    inline void operator()(const int s, const int local_idx, const int /*lag_idx*/, double* const acc) const
+    {
+        const double* const U = d_U + NDIM * local_idx;
+        const double* const X = d_X + NDIM * local_idx;
+        double r[NDIM];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            r[d] = X[d] - d_X_com[s][d];
+            acc[d] += U[d];
+        }
+        accumulate_r_cross_u(r, U, acc + NDIM);
+        return;
+    }
+
+private:
+    const std::vector<Pointer<LData> >& d_U_data;
+    const std::vector<Pointer<LData> >& d_X_data;
+    const std::vector<std::vector<double> >& d_X_com;
+    const double* d_U;
+    const double* d_X;
+};
+
+// Accumulates the inertial and constraint contributions to the hydrodynamic
+// force, torque (about the center of mass X_com), and power of each
+// structure.
+class DragTorqueAndPowerKernel
+{
+public:
+    static const int NVALS = 4 * NDIM + 2 * 3;
+
+    DragTorqueAndPowerKernel(const std::vector<Pointer<LData> >& U_new_data,
+                             const std::vector<Pointer<LData> >& U_current_data,
+                             const std::vector<Pointer<LData> >& U_correction_data,
+                             const std::vector<Pointer<LData> >& X_data,
+                             const std::vector<std::vector<double> >& X_com)
+        : d_U_new_data(U_new_data), d_U_current_data(U_current_data), d_U_correction_data(U_correction_data),
+          d_X_data(X_data), d_X_com(X_com), d_U_new(NULL), d_U_current(NULL), d_U_correction(NULL), d_X(NULL)
+    {
+    }
+
+    inline void beginLevel(const int ln)
+    {
+        d_U_new = d_U_new_data[ln]->getLocalFormVecArray()->data();
+        d_U_current = d_U_current_data[ln]->getLocalFormVecArray()->data();
+        d_U_correction = d_U_correction_data[ln]->getLocalFormVecArray()->data();
+        d_X = d_X_data[ln]->getLocalFormVecArray()->data();
+        return;
+    }
+
+    inline void endLevel(const int ln)
+    {
+        d_U_new_data[ln]->restoreArrays();
+        d_U_current_data[ln]->restoreArrays();
+        d_U_correction_data[ln]->restoreArrays();
+        d_X_data[ln]->restoreArrays();
+        return;
+    }
+
+    inline void operator()(const int s, const int local_idx, const int /*lag_idx*/, double* const acc) const
+    {
+        const double* const U_new = d_U_new + NDIM * local_idx;
+        const double* const U_current = d_U_current + NDIM * local_idx;
+        const double* const U_correction = d_U_correction + NDIM * local_idx;
+        const double* const X = d_X + NDIM * local_idx;
+        double* const inertia_force = acc;
+        double* const constraint_force = inertia_force + NDIM;
+        double* const inertia_torque = constraint_force + NDIM;
+        double* const constraint_torque = inertia_torque + 3;
+        double* const inertia_power = constraint_torque + 3;
+        double* const constraint_power = inertia_power + NDIM;
+        double r[NDIM], dU[NDIM];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            r[d] = X[d] - d_X_com[s][d];
+            dU[d] = U_new[d] - U_current[d];
+            inertia_force[d] += dU[d];
+            constraint_force[d] += U_correction[d];
+            inertia_power[d] += dU[d] * U_new[d];
+            constraint_power[d] += U_correction[d] * U_new[d];
+        }
+        accumulate_r_cross_u(r, dU, inertia_torque);
+        accumulate_r_cross_u(r, U_correction, constraint_torque);
+        return;
+    }
+
+private:
+    const std::vector<Pointer<LData> >& d_U_new_data;
+    const std::vector<Pointer<LData> >& d_U_current_data;
+    const std::vector<Pointer<LData> >& d_U_correction_data;
+    const std::vector<Pointer<LData> >& d_X_data;
+    const std::vector<std::vector<double> >& d_X_com;
+    const double* d_U_new;
+    const double* d_U_current;
+    const double* d_U_correction;
+    const double* d_X;
+};
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -176,7 +502,8 @@ ConstraintIBMethod::ConstraintIBMethod(const std::string& object_name,
       d_center_of_mass_current(d_no_structures, std::vector<double>(3, 0.0)),
       d_center_of_mass_new(d_no_structures, std::vector<double>(3, 0.0)),
       d_moment_of_inertia_current(d_no_structures, Eigen::Matrix3d::Zero()),
-      d_moment_of_inertia_new(d_no_structures, Eigen::Matrix3d::Zero()), d_tagged_pt_lag_idx(d_no_structures, 0),
+      d_moment_of_inertia_new(d_no_structures, Eigen::Matrix3d::Zero()), d_use_threaded_reductions(false),
+      d_tagged_pt_lag_idx(d_no_structures, 0),
       d_tagged_pt_position(d_no_structures, std::vector<double>(3, 0.0)),
       d_rho_fluid(std::numeric_limits<double>::quiet_NaN()), d_mu_fluid(std::numeric_limits<double>::quiet_NaN()),
       d_timestep_counter(0), d_output_interval(1), d_print_output(false), d_output_drag(false), d_output_torque(false),
@@ -411,8 +738,7 @@ void ConstraintIBMethod::postprocessSolveFluidEquations(double current_time, dou
     IBTK_TIMER_STOP(t_calculateKinematicsVelocity);
 
     IBTK_TIMER_START(t_calculateRigidMomentum);
-    calculateRigidTranslationalMomentum();
-    calculateRigidRotationalMomentum();
+    calculateRigidMomentum();
     IBTK_TIMER_STOP(t_calculateRigidMomentum);
 
     IBTK_TIMER_START(t_correctVelocityOnLagrangianMesh);
@@ -430,10 +756,8 @@ void ConstraintIBMethod::postprocessSolveFluidEquations(double current_time, dou
         IBTK_TIMER_STOP(t_applyProjection);
     }
 
-    if (d_output_drag) calculateDrag();
-    if (d_output_torque) calculateTorque();
+    if (d_output_drag || d_output_torque || d_output_power) calculateDragTorqueAndPower();
     if (d_output_eul_mom) calculateEulerianMomentum();
-    if (d_output_power) calculatePower();
 
     IBTK_TIMER_STOP(t_postprocessSolveFluidEquation);
 
@@ -640,6 +964,9 @@ void ConstraintIBMethod::preprocessIntegrateData(double current_time, double new
         d_l_data_U_current[ln] = d_l_data_manager->createLData(d_object_name + "current_lag_vel", ln, NDIM, false);
     }
 
+    // Group the local nodes by structure for the per-structure reductions.
+    buildStructureNodeMap();
+
     // Compue the current Lagrangian velocity according to constraint for the predictor Euler step.
     calculateCurrentLagrangianVelocity();
     return;
@@ -667,6 +994,10 @@ void ConstraintIBMethod::postprocessIntegrateData(double current_time, double ne
     d_l_data_X_half_Euler.clear();
     d_l_data_X_new_MidPoint.clear();
     d_l_data_U_current.clear();
+    d_struct_node_local_idxs.clear();
+    d_struct_node_lag_idxs.clear();
+    d_struct_node_offsets.clear();
+    d_struct_lag_idx_offsets.clear();
 
     return;
 }
@@ -678,6 +1009,7 @@ void ConstraintIBMethod::getFromInput(Pointer<Database> input_db, const bool fro
     d_needs_div_free_projection = input_db->getBoolWithDefault("needs_divfree_projection", d_needs_div_free_projection);
     d_rho_fluid = input_db->getDoubleWithDefault("rho_fluid", d_rho_fluid);
     d_mu_fluid = input_db->getDoubleWithDefault("mu_fluid", d_mu_fluid);
+    d_use_threaded_reductions = input_db->getBoolWithDefault("use_threaded_reductions", d_use_threaded_reductions);
 
     // Printing stuff to files.
     Pointer<Database> output_db = input_db->getDatabase("PrintOutput");
@@ -760,8 +1092,7 @@ void ConstraintIBMethod::getFromRestart()
 
 void ConstraintIBMethod::setInitialLagrangianVelocity()
 {
-    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
-
+    buildStructureNodeMap();
     calculateCOMandMOIOfStructures();
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -771,238 +1102,194 @@ void ConstraintIBMethod::setInitialLagrangianVelocity()
                                                           d_center_of_mass_current[struct_no],
                                                           d_tagged_pt_position[struct_no]);
         d_ib_kinematics[struct_no]->setShape(0.0, d_incremented_angle_from_reference_axis[struct_no]);
+    }
+    calculateMomentumOfKinematicsVelocity();
 
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-        if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
-
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
         d_vel_com_def_current[struct_no] = d_vel_com_def_new[struct_no];
         d_omega_com_def_current[struct_no] = d_omega_com_def_new[struct_no];
     }
     return;
 } // setInitialLagrangianVelocity
 
-void ConstraintIBMethod::calculateCOMandMOIOfStructures()
+void ConstraintIBMethod::buildStructureNodeMap()
 {
-    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
-    // Zero out the COM vector.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        for (int d = 0; d < 3; ++d)
-        {
-            d_center_of_mass_current[struct_no][d] = 0.0;
-            d_center_of_mass_new[struct_no][d] = 0.0;
-        }
-    }
-    std::vector<std::vector<double> > tagged_position(d_no_structures, std::vector<double>(3, 0.0));
+    d_struct_node_local_idxs.assign(finest_ln + 1, std::vector<int>());
+    d_struct_node_lag_idxs.assign(finest_ln + 1, std::vector<int>());
+    d_struct_node_offsets.assign(finest_ln + 1, std::vector<int>(d_no_structures + 1, 0));
+    d_struct_lag_idx_offsets.assign(finest_ln + 1, std::vector<int>(d_no_structures, -1));
 
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
 
-        // Get LData corresponding to the present and new position of the structures.
-        Pointer<LData> ptr_x_lag_data_current(NULL), ptr_x_lag_data_new(NULL);
-        ptr_x_lag_data_current = d_l_data_manager->getLData("X", ln);
-        if (tbox::MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
-        {
-            ptr_x_lag_data_new = d_l_data_manager->getLData("X", ln);
-        }
-        else
+        // Get structures on this level, sorted by their Lagrangian index ranges.
+        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
+        std::vector<std::pair<std::pair<int, int>, int> > struct_ranges;
+        struct_ranges.reserve(structIDs.size());
+        for (unsigned int k = 0; k < structIDs.size(); ++k)
         {
-            ptr_x_lag_data_new = d_l_data_X_half_Euler[ln];
+            std::pair<int, int> lag_idx_range = d_l_data_manager->getLagrangianStructureIndexRange(structIDs[k], ln);
+            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
+                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
+            const int location_struct_handle =
+                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            d_struct_lag_idx_offsets[ln][location_struct_handle] = lag_idx_range.first;
+            struct_ranges.push_back(std::make_pair(lag_idx_range, location_struct_handle));
         }
+        std::sort(struct_ranges.begin(), struct_ranges.end());
+        std::vector<int> range_lower(struct_ranges.size());
+        for (unsigned int k = 0; k < struct_ranges.size(); ++k) range_lower[k] = struct_ranges[k].first.first;
 
-        const boost::multi_array_ref<double, 2>& X_data_current = *ptr_x_lag_data_current->getLocalFormVecArray();
-        const boost::multi_array_ref<double, 2>& X_data_new = *ptr_x_lag_data_new->getLocalFormVecArray();
+        // Determine the structure to which each local node belongs.
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const size_t num_local_nodes = local_nodes.size();
+        std::vector<int> node_struct_handle(num_local_nodes, -1);
+        std::vector<int>& offsets = d_struct_node_offsets[ln];
+        for (size_t k = 0; k < num_local_nodes; ++k)
+        {
+            const int lag_idx = local_nodes[k]->getLagrangianIndex();
+            const std::vector<int>::const_iterator it =
+                std::upper_bound(range_lower.begin(), range_lower.end(), lag_idx);
+            if (it == range_lower.begin()) continue;
+            const std::pair<std::pair<int, int>, int>& struct_range = struct_ranges[it - range_lower.begin() - 1];
+            if (lag_idx >= struct_range.first.second) continue;
+            node_struct_handle[k] = struct_range.second;
+            ++offsets[struct_range.second + 1];
+        }
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        // Group the local nodes by structure.
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        d_struct_node_local_idxs[ln].resize(offsets.back());
+        d_struct_node_lag_idxs[ln].resize(offsets.back());
+        std::vector<int> next_pos(offsets.begin(), offsets.end() - 1);
+        for (size_t k = 0; k < num_local_nodes; ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            if (node_struct_handle[k] < 0) continue;
+            const int pos = next_pos[node_struct_handle[k]]++;
+            d_struct_node_local_idxs[ln][pos] = local_nodes[k]->getLocalPETScIndex();
+            d_struct_node_lag_idxs[ln][pos] = local_nodes[k]->getLagrangianIndex();
+        }
+    }
+    return;
+} // buildStructureNodeMap
 
-            double X_com_current[NDIM] = { 0.0 }, X_com_new[NDIM] = { 0.0 };
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+template <class Kernel>
+void ConstraintIBMethod::reduceOverStructureNodes(Kernel& kernel, std::vector<double>& moments)
+{
+    moments.assign(d_no_structures * Kernel::NVALS, 0.0);
+    if (moments.empty()) return;
+
+    const int finest_ln = static_cast<int>(d_struct_node_offsets.size()) - 1;
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        const std::vector<int>& offsets = d_struct_node_offsets[ln];
+        if (offsets.back() == 0) continue;
+        const int* const local_idxs = &d_struct_node_local_idxs[ln][0];
+        const int* const lag_idxs = &d_struct_node_lag_idxs[ln][0];
+
+        kernel.beginLevel(ln);
+#if defined(_OPENMP)
+        if (d_use_threaded_reductions)
+        {
+            // Accumulate into per-thread buffers that are summed in thread
+            // order, so that the result does not depend on the schedule.
+            std::vector<std::vector<double> > thread_moments(omp_get_max_threads());
+#pragma omp parallel
             {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+                std::vector<double>& acc = thread_moments[omp_get_thread_num()];
+                acc.assign(moments.size(), 0.0);
+                for (int s = 0; s < d_no_structures; ++s)
                 {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X_current = &X_data_current[local_idx][0];
-                    const double* const X_new = &X_data_new[local_idx][0];
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        X_com_current[d] += X_current[d];
-                        X_com_new[d] += X_new[d];
-                    }
-                    if (lag_idx == d_tagged_pt_lag_idx[location_struct_handle])
+#pragma omp for schedule(static) nowait
+                    for (int k = offsets[s]; k < offsets[s + 1]; ++k)
                     {
-                        for (unsigned int d = 0; d < NDIM; ++d) tagged_position[location_struct_handle][d] = X_new[d];
+                        kernel(s, local_idxs[k], lag_idxs[k], &acc[s * Kernel::NVALS]);
                     }
                 }
             }
-            for (int d = 0; d < NDIM; ++d)
+            for (unsigned int t = 0; t < thread_moments.size(); ++t)
             {
-                d_center_of_mass_current[location_struct_handle][d] += X_com_current[d];
-                d_center_of_mass_new[location_struct_handle][d] += X_com_new[d];
+                for (unsigned int i = 0; i < thread_moments[t].size(); ++i) moments[i] += thread_moments[t][i];
             }
         }
-        ptr_x_lag_data_current->restoreArrays();
-        ptr_x_lag_data_new->restoreArrays();
-    }
-
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-        const int total_nodes = struct_param.getTotalNodes();
-
-        SAMRAI_MPI::sumReduction(&d_center_of_mass_current[struct_no][0], NDIM);
-        SAMRAI_MPI::sumReduction(&d_center_of_mass_new[struct_no][0], NDIM);
-
-        for (int i = 0; i < 3; ++i)
+        else
+#endif
         {
-            d_center_of_mass_current[struct_no][i] /= total_nodes;
-            d_center_of_mass_new[struct_no][i] /= total_nodes;
+            for (int s = 0; s < d_no_structures; ++s)
+            {
+                double* const acc = &moments[s * Kernel::NVALS];
+                for (int k = offsets[s]; k < offsets[s + 1]; ++k) kernel(s, local_idxs[k], lag_idxs[k], acc);
+            }
         }
+        kernel.endLevel(ln);
     }
+    SAMRAI_MPI::sumReduction(&moments[0], static_cast<int>(moments.size()));
+    return;
+} // reduceOverStructureNodes
 
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        SAMRAI_MPI::sumReduction(&tagged_position[struct_no][0], 3);
-        d_tagged_pt_position[struct_no] = tagged_position[struct_no];
-    }
-
-    // Zero out the moment of inertia tensor.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        d_moment_of_inertia_current[struct_no].setZero();
-        d_moment_of_inertia_new[struct_no].setZero();
-    }
+void ConstraintIBMethod::calculateCOMandMOIOfStructures()
+{
+    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
+    // Get LData corresponding to the present and new position of the structures.
+    std::vector<Pointer<LData> > X_current_data(finest_ln + 1), X_new_data(finest_ln + 1);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
-
-        // Get LData corresponding to the present position of the structures.
-        Pointer<LData> ptr_x_lag_data_current, ptr_x_lag_data_new;
-        ptr_x_lag_data_current = d_l_data_manager->getLData("X", ln);
-        if (tbox::MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
+        X_current_data[ln] = d_l_data_manager->getLData("X", ln);
+        if (MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
         {
-            ptr_x_lag_data_new = d_l_data_manager->getLData("X", ln);
+            X_new_data[ln] = X_current_data[ln];
         }
         else
         {
-            ptr_x_lag_data_new = d_l_data_X_half_Euler[ln];
+            X_new_data[ln] = d_l_data_X_half_Euler[ln];
         }
+    }
 
-        const boost::multi_array_ref<double, 2>& X_data_current = *ptr_x_lag_data_current->getLocalFormVecArray();
-        const boost::multi_array_ref<double, 2>& X_data_new = *ptr_x_lag_data_new->getLocalFormVecArray();
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
-        {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-            if (!struct_param.getStructureIsSelfRotating()) continue;
-
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-            const std::vector<double>& X_com_current = d_center_of_mass_current[location_struct_handle];
-            const std::vector<double>& X_com_new = d_center_of_mass_new[location_struct_handle];
-
-            Eigen::Matrix3d Inertia_current(3, 3), Inertia_new(3, 3);
-            Inertia_current.setZero();
-            Inertia_new.setZero();
-
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-            {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X_current = &X_data_current[local_idx][0];
-                    const double* const X_new = &X_data_new[local_idx][0];
-#if (NDIM == 2)
-                    Inertia_current(0, 0) += std::pow(X_current[1] - X_com_current[1], 2);
-                    Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
-                    Inertia_current(1, 1) += std::pow(X_current[0] - X_com_current[0], 2);
-                    Inertia_current(2, 2) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
-
-                    Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2);
-                    Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
-                    Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2);
-                    Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
-#endif
-
-#if (NDIM == 3)
-                    Inertia_current(0, 0) +=
-                        std::pow(X_current[1] - X_com_current[1], 2) + std::pow(X_current[2] - X_com_current[2], 2);
-                    Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
-                    Inertia_current(0, 2) += -(X_current[0] - X_com_current[0]) * (X_current[2] - X_com_current[2]);
-                    Inertia_current(1, 1) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[2] - X_com_current[2], 2);
-                    Inertia_current(1, 2) += -(X_current[1] - X_com_current[1]) * (X_current[2] - X_com_current[2]);
-                    Inertia_current(2, 2) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
-
-                    Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2) + std::pow(X_new[2] - X_com_new[2], 2);
-                    Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
-                    Inertia_new(0, 2) += -(X_new[0] - X_com_new[0]) * (X_new[2] - X_com_new[2]);
-                    Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[2] - X_com_new[2], 2);
-                    Inertia_new(1, 2) += -(X_new[1] - X_com_new[1]) * (X_new[2] - X_com_new[2]);
-                    Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
-#endif
-                }
-            }
-            d_moment_of_inertia_current[location_struct_handle] += Inertia_current;
-            d_moment_of_inertia_new[location_struct_handle] += Inertia_new;
-        } // all structs
-        ptr_x_lag_data_current->restoreArrays();
-        ptr_x_lag_data_new->restoreArrays();
-    } // all levels
+    // Compute the moments of the positions in a single sweep.  The moments are
+    // taken relative to the previously computed centers of mass, which are
+    // identical on all processors.
+    PositionMomentsKernel kernel(
+        X_current_data, X_new_data, d_center_of_mass_current, d_center_of_mass_new, d_tagged_pt_lag_idx);
+    std::vector<double> moments;
+    reduceOverStructureNodes(kernel, moments);
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        const int total_nodes = struct_param.getTotalNodes();
+        const double* const m_current = &moments[struct_no * PositionMomentsKernel::NVALS];
+        const double* const S_current = m_current + NDIM;
+        const double* const m_new = S_current + NSYM;
+        const double* const S_new = m_new + NDIM;
+        const double* const X_tagged = S_new + NSYM;
+
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_current[struct_no](0, 0), 9);
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_new[struct_no](0, 0), 9);
+            compute_moment_of_inertia(d_moment_of_inertia_current[struct_no], m_current, S_current, total_nodes);
+            compute_moment_of_inertia(d_moment_of_inertia_new[struct_no], m_new, S_new, total_nodes);
+        }
+        else
+        {
+            d_moment_of_inertia_current[struct_no].setZero();
+            d_moment_of_inertia_new[struct_no].setZero();
         }
-    }
-
-    // Fill-in symmetric part of inertia tensor.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        d_moment_of_inertia_current[struct_no](1, 0) = d_moment_of_inertia_current[struct_no](0, 1);
-        d_moment_of_inertia_current[struct_no](2, 0) = d_moment_of_inertia_current[struct_no](0, 2);
-        d_moment_of_inertia_current[struct_no](2, 1) = d_moment_of_inertia_current[struct_no](1, 2);
 
-        d_moment_of_inertia_new[struct_no](1, 0) = d_moment_of_inertia_new[struct_no](0, 1);
-        d_moment_of_inertia_new[struct_no](2, 0) = d_moment_of_inertia_new[struct_no](0, 2);
-        d_moment_of_inertia_new[struct_no](2, 1) = d_moment_of_inertia_new[struct_no](1, 2);
+        for (int d = 0; d < NDIM; ++d)
+        {
+            d_center_of_mass_current[struct_no][d] += m_current[d] / total_nodes;
+            d_center_of_mass_new[struct_no][d] += m_new[d] / total_nodes;
+            d_tagged_pt_position[struct_no][d] = X_tagged[d];
+        }
     }
 
     // write the COM and MOI to the output file
@@ -1039,13 +1326,10 @@ void ConstraintIBMethod::calculateCOMandMOIOfStructures()
 
 void ConstraintIBMethod::calculateKinematicsVelocity()
 {
-    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
     const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
     // Theta_new = Theta_old + Omega_old*dt
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-
         for (int d = 0; d < 3; ++d)
             d_incremented_angle_from_reference_axis[struct_no][d] +=
                 (d_rigid_rot_vel_current[struct_no][d] - d_omega_com_def_current[struct_no][d]) * dt;
@@ -1056,152 +1340,70 @@ void ConstraintIBMethod::calculateKinematicsVelocity()
                                                           d_tagged_pt_position[struct_no]);
 
         d_ib_kinematics[struct_no]->setShape(d_FuRMoRP_new_time, d_incremented_angle_from_reference_axis[struct_no]);
-
-        if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
     }
+    calculateMomentumOfKinematicsVelocity();
 
     return;
 } // calculateKinematicsVelocity
 
-void ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_handle)
+void ConstraintIBMethod::calculateMomentumOfKinematicsVelocity()
 {
     typedef ConstraintIBKinematics::StructureParameters StructureParameters;
-    Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
-    const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-    Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
-    Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
-    const int coarsest_ln = struct_param.getCoarsestLevelNumber();
-    const int finest_ln = struct_param.getFinestLevelNumber();
-    const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
-    const int total_nodes = struct_param.getTotalNodes();
-
-    // Zero out linear momentum of kinematics velocity of the structure.
-    for (int d = 0; d < 3; ++d) d_vel_com_def_new[position_handle][d] = 0.0;
-
-    // Calculate linear momentum
-    for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size(); ++ln, ++itr)
-    {
-#if !defined(NDEBUG)
-        TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
-#endif
-
-        std::pair<int, int> lag_idx_range = range[itr];
-        const int offset = lag_idx_range.first;
-        double U_com_def[NDIM] = { 0.0 };
-
-        // Get LMesh corresponding to the present position of the structures
-        // on this level.
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+    // Get LData corresponding to the present position of the structures.
+    std::vector<Pointer<LData> > X_data(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        if (MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
         {
-            const LNode* const node_idx = *cit;
-            const int lag_idx = node_idx->getLagrangianIndex();
-            if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-            {
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    U_com_def[d] += def_vel[d][lag_idx - offset];
-                }
-            }
+            X_data[ln] = d_l_data_manager->getLData("X", ln);
         }
-        for (int d = 0; d < NDIM; ++d)
+        else
         {
-            d_vel_com_def_new[position_handle][d] += U_com_def[d];
+            X_data[ln] = d_l_data_X_half_Euler[ln];
         }
     }
-    SAMRAI_MPI::sumReduction(&d_vel_com_def_new[position_handle][0], NDIM);
 
-    for (int d = 0; d < 3; ++d)
-    {
-        if (calculate_trans_mom[d])
-            d_vel_com_def_new[position_handle][d] /= total_nodes;
-        else
-            d_vel_com_def_new[position_handle][d] = 0.0;
-    }
+    // Calculate linear and angular momentum of all self-translating structures.
+    KinematicsMomentumKernel kernel(X_data, d_ib_kinematics, d_struct_lag_idx_offsets, d_center_of_mass_new);
+    std::vector<double> moments;
+    reduceOverStructureNodes(kernel, moments);
 
-    // Calculate angular momentum.
-    if (struct_param.getStructureIsSelfRotating())
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        // Zero out angular momentum of kinematics velocity of the structure.
-        for (int d = 0; d < 3; ++d) d_omega_com_def_new[position_handle][d] = 0.0;
-
-        for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size();
-             ++ln, ++itr)
-        {
-#if !defined(NDEBUG)
-            TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
-#endif
-
-            std::pair<int, int> lag_idx_range = range[itr];
-            const int offset = lag_idx_range.first;
-            double R_cross_U_def[3] = { 0.0 };
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (!struct_param.getStructureIsSelfTranslating()) continue;
 
-            // Get LData corresponding to the present position of the structures.
-            Pointer<LData> ptr_x_lag_data;
-            if (MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
-            {
-                ptr_x_lag_data = d_l_data_manager->getLData("X", ln);
-            }
-            else
-            {
-                ptr_x_lag_data = d_l_data_X_half_Euler[ln];
-            }
+        Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
+        const int total_nodes = struct_param.getTotalNodes();
+        const double* const U_com_def = &moments[struct_no * KinematicsMomentumKernel::NVALS];
+        const double* const R_cross_U_def = U_com_def + NDIM;
 
-            const boost::multi_array_ref<double, 2>& X_data = *ptr_x_lag_data->getLocalFormVecArray();
-            const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-            const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-            const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+        for (int d = 0; d < 3; ++d) d_vel_com_def_new[struct_no][d] = 0.0;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            if (calculate_trans_mom[d]) d_vel_com_def_new[struct_no][d] = U_com_def[d] / total_nodes;
+        }
 
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-            {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X = &X_data[local_idx][0];
+        // Find angular velocity of deformational velocity.
+        if (struct_param.getStructureIsSelfRotating())
+        {
+            for (int d = 0; d < 3; ++d) d_omega_com_def_new[struct_no][d] = R_cross_U_def[d];
 #if (NDIM == 2)
-                    double x = X[0] - d_center_of_mass_new[position_handle][0];
-                    double y = X[1] - d_center_of_mass_new[position_handle][1];
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
-
+            d_omega_com_def_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
 
 #if (NDIM == 3)
-                    double x = X[0] - d_center_of_mass_new[position_handle][0];
-                    double y = X[1] - d_center_of_mass_new[position_handle][1];
-                    double z = X[2] - d_center_of_mass_new[position_handle][2];
-
-                    R_cross_U_def[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
-
-                    R_cross_U_def[1] += (-x * (def_vel[2][lag_idx - offset]) + z * (def_vel[0][lag_idx - offset]));
-
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
-#endif
-                }
-            }
+            solveSystemOfEqns(d_omega_com_def_new[struct_no], d_moment_of_inertia_new[struct_no]);
+            Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
             for (int d = 0; d < 3; ++d)
-            {
-                d_omega_com_def_new[position_handle][d] += R_cross_U_def[d];
-            }
-            ptr_x_lag_data->restoreArrays();
-        } // all levels
-        SAMRAI_MPI::sumReduction(&d_omega_com_def_new[position_handle][0], 3);
-
-// Find angular velocity of deformational velocity.
-#if (NDIM == 2)
-        d_omega_com_def_new[position_handle][2] /= d_moment_of_inertia_new[position_handle](2, 2);
-#endif
-
-#if (NDIM == 3)
-        solveSystemOfEqns(d_omega_com_def_new[position_handle], d_moment_of_inertia_new[position_handle]);
-        for (int d = 0; d < 3; ++d)
-            if (!calculate_rot_mom[d]) d_omega_com_def_new[position_handle][d] = 0.0;
+                if (!calculate_rot_mom[d]) d_omega_com_def_new[struct_no][d] = 0.0;
 #endif
-    } // if struct is rotating
+        }
+    }
 
     return;
 } // calculateMomentumOfKinematicsVelocity
@@ -1339,176 +1541,42 @@ void ConstraintIBMethod::calculateVolumeElement()
 
 } // calculateVolumeElement
 
-void ConstraintIBMethod::calculateRigidTranslationalMomentum()
+void ConstraintIBMethod::calculateRigidMomentum()
 {
-
-    // Zero out new rigid momentum.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        for (int d = 0; d < 3; ++d) d_rigid_trans_vel_new[struct_no][d] = 0.0;
-    }
-
     typedef ConstraintIBKinematics::StructureParameters StructureParameters;
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
-
-    // Calculate rigid translational velocity.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
 
-        // Get LData corresponding to the present position of the structures.
-        const boost::multi_array_ref<double, 2>& U_interp_data = *d_l_data_U_interp[ln]->getLocalFormVecArray();
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
-        {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-            if (!struct_param.getStructureIsSelfTranslating()) continue;
-
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            double U_rigid[NDIM] = { 0.0 };
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-            {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U = &U_interp_data[local_idx][0];
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        U_rigid[d] += U[d];
-                    }
-                }
-            }
-            for (int d = 0; d < NDIM; ++d) d_rigid_trans_vel_new[location_struct_handle][d] += U_rigid[d];
-        } // all structs
-        d_l_data_U_interp[ln]->restoreArrays();
-    } // all levels
+    // Calculate rigid translational and rotational momentum in a single sweep.
+    RigidMomentumKernel kernel(d_l_data_U_interp, d_l_data_X_half_Euler, d_center_of_mass_new);
+    std::vector<double> moments;
+    reduceOverStructureNodes(kernel, moments);
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
+        // Zero out new rigid momentum.
+        for (int d = 0; d < 3; ++d)
+        {
+            d_rigid_trans_vel_new[struct_no][d] = 0.0;
+            d_rigid_rot_vel_new[struct_no][d] = 0.0;
+        }
+
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        const double* const U_rigid = &moments[struct_no * RigidMomentumKernel::NVALS];
+        const double* const Omega_rigid = U_rigid + NDIM;
         if (struct_param.getStructureIsSelfTranslating())
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_trans_vel_new[struct_no][0], NDIM);
             Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
             for (int d = 0; d < NDIM; ++d)
             {
                 if (calculate_trans_mom[d])
-                    d_rigid_trans_vel_new[struct_no][d] /= struct_param.getTotalNodes();
+                    d_rigid_trans_vel_new[struct_no][d] = U_rigid[d] / struct_param.getTotalNodes();
                 else
                     d_rigid_trans_vel_new[struct_no][d] = 0.0;
             }
         }
-    }
-
-    if (!SAMRAI_MPI::getRank() && d_print_output && d_output_trans_vel && (d_timestep_counter % d_output_interval) == 0)
-    {
-        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-        {
-            *d_trans_vel_stream[struct_no]
-                << d_FuRMoRP_new_time << '\t' << d_rigid_trans_vel_new[struct_no][0] << '\t'
-                << d_rigid_trans_vel_new[struct_no][1] << '\t' << d_rigid_trans_vel_new[struct_no][2] << '\t'
-                << d_vel_com_def_new[struct_no][0] << '\t' << d_vel_com_def_new[struct_no][1] << '\t'
-                << d_vel_com_def_new[struct_no][2] << std::endl;
-        }
-    }
-
-    return;
-
-} // calculateRigidTranslationalMomentum
-
-void ConstraintIBMethod::calculateRigidRotationalMomentum()
-{
-
-    // Zero out new rigid momentum.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        for (int d = 0; d < 3; ++d) d_rigid_rot_vel_new[struct_no][d] = 0.0;
-    }
-
-    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
-
-    // Calculate rigid rotational velocity.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
-
-        // Get ponter to LData.
-        const boost::multi_array_ref<double, 2>& U_interp_data = *d_l_data_U_interp[ln]->getLocalFormVecArray();
-        const boost::multi_array_ref<double, 2>& X_data = *d_l_data_X_half_Euler[ln]->getLocalFormVecArray();
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
-        {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-            if (!struct_param.getStructureIsSelfRotating()) continue;
-
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            double Omega_rigid[3] = { 0.0 };
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-            {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U = &U_interp_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
-#if (NDIM == 2)
-                    const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    Omega_rigid[2] += x * U[1] - y * U[0];
-#endif
-
-#if (NDIM == 3)
-                    const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    const double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
-                    Omega_rigid[0] += y * U[2] - z * U[1];
-                    Omega_rigid[1] += -x * U[2] + z * U[0];
-                    Omega_rigid[2] += x * U[1] - y * U[0];
-#endif
-                }
-            }
-            for (int d = 0; d < 3; ++d) d_rigid_rot_vel_new[location_struct_handle][d] += Omega_rigid[d];
-        } // all structs
-        d_l_data_U_interp[ln]->restoreArrays();
-        d_l_data_X_half_Euler[ln]->restoreArrays();
-    } // all levels
-
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_rot_vel_new[struct_no][0], 3);
+            for (int d = 0; d < 3; ++d) d_rigid_rot_vel_new[struct_no][d] = Omega_rigid[d];
 #if (NDIM == 2)
             d_rigid_rot_vel_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
@@ -1522,6 +1590,18 @@ void ConstraintIBMethod::calculateRigidRotationalMomentum()
         }
     }
 
+    if (!SAMRAI_MPI::getRank() && d_print_output && d_output_trans_vel && (d_timestep_counter % d_output_interval) == 0)
+    {
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+        {
+            *d_trans_vel_stream[struct_no]
+                << d_FuRMoRP_new_time << '\t' << d_rigid_trans_vel_new[struct_no][0] << '\t'
+                << d_rigid_trans_vel_new[struct_no][1] << '\t' << d_rigid_trans_vel_new[struct_no][2] << '\t'
+                << d_vel_com_def_new[struct_no][0] << '\t' << d_vel_com_def_new[struct_no][1] << '\t'
+                << d_vel_com_def_new[struct_no][2] << std::endl;
+        }
+    }
+
     if (!SAMRAI_MPI::getRank() && d_print_output && d_output_rot_vel && (d_timestep_counter % d_output_interval) == 0)
     {
         for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -1537,7 +1617,7 @@ void ConstraintIBMethod::calculateRigidRotationalMomentum()
 
     return;
 
-} // calculateRigidRotationalMomentum
+} // calculateRigidMomentum
 
 void ConstraintIBMethod::calculateCurrentLagrangianVelocity()
 {
@@ -2215,75 +2295,47 @@ void ConstraintIBMethod::calculateMidPointVelocity()
 
 } // calculateMidPointVelocity
 
-void ConstraintIBMethod::calculateDrag()
+void ConstraintIBMethod::calculateDragTorqueAndPower()
 {
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
     const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
 
+    // Calculate drag, torque and power in a single sweep.
+    DragTorqueAndPowerKernel kernel(
+        d_l_data_U_new, d_l_data_U_current, d_l_data_U_correction, d_X_new_data, d_center_of_mass_new);
+    std::vector<double> moments;
+    reduceOverStructureNodes(kernel, moments);
+
     std::vector<std::vector<double> > inertia_force(d_no_structures, std::vector<double>(3, 0.0));
     std::vector<std::vector<double> > constraint_force(d_no_structures, std::vector<double>(3, 0.0));
-
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
-
-        const boost::multi_array_ref<double, 2>& U_new_data = *d_l_data_U_new[ln]->getLocalFormVecArray();
-        const boost::multi_array_ref<double, 2>& U_current_data = *d_l_data_U_current[ln]->getLocalFormVecArray();
-        const boost::multi_array_ref<double, 2>& U_correction_data = *d_l_data_U_correction[ln]->getLocalFormVecArray();
-
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
-        {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-            {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_new = &U_new_data[local_idx][0];
-                    const double* const U_current = &U_current_data[local_idx][0];
-                    const double* const U_correction = &U_correction_data[local_idx][0];
-
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        inertia_force[location_struct_handle][d] += U_new[d] - U_current[d];
-                        constraint_force[location_struct_handle][d] += U_correction[d];
-                    }
-                }
-            }
-        } // all structs
-        d_l_data_U_new[ln]->restoreArrays();
-        d_l_data_U_current[ln]->restoreArrays();
-        d_l_data_U_correction[ln]->restoreArrays();
-    }
-
+    std::vector<std::vector<double> > inertia_torque(d_no_structures, std::vector<double>(3, 0.0));
+    std::vector<std::vector<double> > constraint_torque(d_no_structures, std::vector<double>(3, 0.0));
+    std::vector<std::vector<double> > inertia_power(d_no_structures, std::vector<double>(3, 0.0));
+    std::vector<std::vector<double> > constraint_power(d_no_structures, std::vector<double>(3, 0.0));
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_force[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_force[struct_no][0], 3);
+        const double* const F_inertia = &moments[struct_no * DragTorqueAndPowerKernel::NVALS];
+        const double* const F_constraint = F_inertia + NDIM;
+        const double* const T_inertia = F_constraint + NDIM;
+        const double* const T_constraint = T_inertia + 3;
+        const double* const P_inertia = T_constraint + 3;
+        const double* const P_constraint = P_inertia + NDIM;
         for (int d = 0; d < NDIM; ++d)
         {
-            inertia_force[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
-            constraint_force[struct_no][d] *= (d_rho_fluid / dt);
+            inertia_force[struct_no][d] = F_inertia[d] * (d_rho_fluid / dt) * d_vol_element[struct_no];
+            constraint_force[struct_no][d] = F_constraint[d] * (d_rho_fluid / dt);
+            inertia_power[struct_no][d] = P_inertia[d] * (d_rho_fluid / dt) * d_vol_element[struct_no];
+            constraint_power[struct_no][d] = P_constraint[d] * (d_rho_fluid / dt);
+        }
+        for (int d = 0; d < 3; ++d)
+        {
+            inertia_torque[struct_no][d] = T_inertia[d] * (d_rho_fluid / dt) * d_vol_element[struct_no];
+            constraint_torque[struct_no][d] = T_constraint[d] * (d_rho_fluid / dt);
         }
     }
 
-    if (!SAMRAI_MPI::getRank() && d_print_output && d_output_drag && (d_timestep_counter % d_output_interval) == 0)
+    if (SAMRAI_MPI::getRank() || !d_print_output || (d_timestep_counter % d_output_interval) != 0) return;
+
+    if (d_output_drag)
     {
         for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
         {
@@ -2294,105 +2346,7 @@ void ConstraintIBMethod::calculateDrag()
         }
     }
 
-    return;
-} // calculateDrag
-
-void ConstraintIBMethod::calculateTorque()
-{
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
-    const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
-
-    std::vector<std::vector<double> > inertia_torque(d_no_structures, std::vector<double>(3, 0.0));
-    std::vector<std::vector<double> > constraint_torque(d_no_structures, std::vector<double>(3, 0.0));
-    double R_cross_U_inertia[3] = { 0.0 }, R_cross_U_constraint[3] = { 0.0 };
-
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
-
-        const boost::multi_array_ref<double, 2>& U_new_data = *d_l_data_U_new[ln]->getLocalFormVecArray();
-        const boost::multi_array_ref<double, 2>& U_current_data = *d_l_data_U_current[ln]->getLocalFormVecArray();
-        const boost::multi_array_ref<double, 2>& U_correction_data = *d_l_data_U_correction[ln]->getLocalFormVecArray();
-        const boost::multi_array_ref<double, 2>& X_data = *d_X_new_data[ln]->getLocalFormVecArray();
-
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
-        {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-            {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_new = &U_new_data[local_idx][0];
-                    const double* const U_current = &U_current_data[local_idx][0];
-                    const double* const U_correction = &U_correction_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
-#if (NDIM == 2)
-                    double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    R_cross_U_inertia[2] = (x * (U_new[1] - U_current[1]) - y * (U_new[0] - U_current[0]));
-                    R_cross_U_constraint[2] = (x * (U_correction[1]) - y * (U_correction[0]));
-#endif
-
-#if (NDIM == 3)
-                    double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
-
-                    R_cross_U_inertia[0] = (y * (U_new[2] - U_current[2]) - z * (U_new[1] - U_current[1]));
-
-                    R_cross_U_inertia[1] = (-x * (U_new[2] - U_current[2]) + z * (U_new[0] - U_current[0]));
-
-                    R_cross_U_inertia[2] = (x * (U_new[1] - U_current[1]) - y * (U_new[0] - U_current[0]));
-
-                    R_cross_U_constraint[0] = (y * (U_correction[2]) - z * (U_correction[1]));
-
-                    R_cross_U_constraint[1] = (-x * (U_correction[2]) + z * (U_correction[0]));
-
-                    R_cross_U_constraint[2] = (x * (U_correction[1]) - y * (U_correction[0]));
-#endif
-
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        inertia_torque[location_struct_handle][d] += R_cross_U_inertia[d];
-                        constraint_torque[location_struct_handle][d] += R_cross_U_constraint[d];
-                    }
-                }
-            }
-        } // all structs
-        d_l_data_U_new[ln]->restoreArrays();
-        d_l_data_U_current[ln]->restoreArrays();
-        d_l_data_U_correction[ln]->restoreArrays();
-    }
-
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        SAMRAI_MPI::sumReduction(&inertia_torque[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_torque[struct_no][0], 3);
-        for (int d = 0; d < NDIM; ++d)
-        {
-            inertia_torque[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
-            constraint_torque[struct_no][d] *= (d_rho_fluid / dt);
-        }
-    }
-
-    if (!SAMRAI_MPI::getRank() && d_print_output && d_output_torque && (d_timestep_counter % d_output_interval) == 0)
+    if (d_output_torque)
     {
         for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
         {
@@ -2403,78 +2357,7 @@ void ConstraintIBMethod::calculateTorque()
         }
     }
 
-    return;
-} // calculateTorque
-
-void ConstraintIBMethod::calculatePower()
-{
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
-    const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
-
-    std::vector<std::vector<double> > inertia_power(d_no_structures, std::vector<double>(3, 0.0));
-    std::vector<std::vector<double> > constraint_power(d_no_structures, std::vector<double>(3, 0.0));
-
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
-
-        const boost::multi_array_ref<double, 2>& U_new_data = *d_l_data_U_new[ln]->getLocalFormVecArray();
-        const boost::multi_array_ref<double, 2>& U_current_data = *d_l_data_U_current[ln]->getLocalFormVecArray();
-        const boost::multi_array_ref<double, 2>& U_correction_data = *d_l_data_U_correction[ln]->getLocalFormVecArray();
-
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
-        {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-            {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_new = &U_new_data[local_idx][0];
-                    const double* const U_current = &U_current_data[local_idx][0];
-                    const double* const U_correction = &U_correction_data[local_idx][0];
-
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        inertia_power[location_struct_handle][d] += (U_new[d] - U_current[d]) * U_new[d];
-                        constraint_power[location_struct_handle][d] += U_correction[d] * U_new[d];
-                    }
-                }
-            }
-        } // all structs
-        d_l_data_U_new[ln]->restoreArrays();
-        d_l_data_U_current[ln]->restoreArrays();
-        d_l_data_U_correction[ln]->restoreArrays();
-    }
-
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        SAMRAI_MPI::sumReduction(&inertia_power[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_power[struct_no][0], 3);
-        for (int d = 0; d < NDIM; ++d)
-        {
-            inertia_power[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
-            constraint_power[struct_no][d] *= (d_rho_fluid / dt);
-        }
-    }
-
-    if (!SAMRAI_MPI::getRank() && d_print_output && d_output_drag && (d_timestep_counter % d_output_interval) == 0)
+    if (d_output_power)
     {
         for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
         {
@@ -2486,6 +2369,6 @@ void ConstraintIBMethod::calculatePower()
     }
 
     return;
-} // calculatePower
+} // calculateDragTorqueAndPower
 
 } // IBAMR
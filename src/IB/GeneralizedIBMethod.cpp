@@ -668,18 +668,23 @@ void GeneralizedIBMethod::initializeLevelData(Pointer<BasePatchHierarchy<NDIM> >
                                                               /*manage_data*/ true);
         Pointer<LData> W_data = d_l_data_manager->createLData("W", level_number, NDIM, /*manage_data*/ true);
 
-        // 2. Initialize the Lagrangian data.
+        // 2. Initialize the Lagrangian data.  When the initial configuration
+        //    is replaced by Lagrangian restart data, these values are instead
+        //    restored by postprocessInitializePatchHierarchy().
         static const int global_index_offset = 0;
         static const int local_index_offset = 0;
-        d_l_initializer->initializeDirectorDataOnPatchLevel(global_index_offset,
-                                                            local_index_offset,
-                                                            D_data,
-                                                            hierarchy,
-                                                            level_number,
-                                                            init_data_time,
-                                                            can_be_refined,
-                                                            initial_time,
-                                                            d_l_data_manager);
+        if (d_lag_restart_restore_num < 0)
+        {
+            d_l_initializer->initializeDirectorDataOnPatchLevel(global_index_offset,
+                                                                local_index_offset,
+                                                                D_data,
+                                                                hierarchy,
+                                                                level_number,
+                                                                init_data_time,
+                                                                can_be_refined,
+                                                                initial_time,
+                                                                d_l_data_manager);
+        }
 
         // 3. Register data with any registered data writer.
         if (d_silo_writer)
@@ -60,6 +60,7 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_enums.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
@@ -116,6 +117,7 @@ void IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double cu
                                                                  const int num_cycles)
 {
     IBHierarchyIntegrator::preprocessIntegrateHierarchy(current_time, new_time, num_cycles);
+    if (d_workload_cost_model) d_workload_cost_model->beginTimestep();
 
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -173,7 +175,9 @@ void IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double cu
                                     "use the same number of cycles,\n"
                                  << "  or that the IB solver use only a single cycle.\n");
     }
+    if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::EULERIAN_WORK);
     d_ins_hier_integrator->preprocessIntegrateHierarchy(current_time, new_time, ins_num_cycles);
+    if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::EULERIAN_WORK);
 
     // Compute the Lagrangian forces and spread them to the Eulerian grid.
     switch (d_time_stepping_type)
@@ -181,14 +185,18 @@ void IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double cu
     case FORWARD_EULER:
     case TRAPEZOIDAL_RULE:
         if (d_enable_logging) plog << d_object_name << "::preprocessIntegrateHierarchy(): computing Lagrangian force\n";
+        if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::FORCE_WORK);
         d_ib_method_ops->computeLagrangianForce(current_time);
+        if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::FORCE_WORK);
         if (d_enable_logging)
             plog << d_object_name << "::preprocessIntegrateHierarchy(): spreading Lagrangian force "
                                      "to the Eulerian grid\n";
         d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
         d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
+        if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::INTERACTION_WORK);
         d_ib_method_ops->spreadForce(
             d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), current_time);
+        if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::INTERACTION_WORK);
         d_hier_velocity_data_ops->copyData(d_f_current_idx, d_f_idx);
         break;
     case MIDPOINT_RULE:
@@ -264,13 +272,17 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         break;
     case MIDPOINT_RULE:
         if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
+        if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::FORCE_WORK);
         d_ib_method_ops->computeLagrangianForce(half_time);
+        if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::FORCE_WORK);
         if (d_enable_logging)
             plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the Eulerian grid\n";
         d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
         d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
+        if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::INTERACTION_WORK);
         d_ib_method_ops->spreadForce(
             d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), half_time);
+        if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::INTERACTION_WORK);
         break;
     case TRAPEZOIDAL_RULE:
         if (d_current_num_cycles == 1 || cycle_num > 0)
@@ -280,14 +292,18 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
             // in preprocessIntegrateHierarchy(), so we don't bother to
             // recompute it.
             if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
+            if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::FORCE_WORK);
             d_ib_method_ops->computeLagrangianForce(new_time);
+            if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::FORCE_WORK);
             if (d_enable_logging)
                 plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force "
                                          "to the Eulerian grid\n";
             d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
             d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
+            if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::INTERACTION_WORK);
             d_ib_method_ops->spreadForce(
                 d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), new_time);
+            if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::INTERACTION_WORK);
             d_hier_velocity_data_ops->linearSum(d_f_idx, 0.5, d_f_current_idx, 0.5, d_f_idx);
         }
         break;
@@ -310,13 +326,16 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
             plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian fluid source "
                                      "strength to the Eulerian grid\n";
         d_hier_pressure_data_ops->setToScalar(d_q_idx, 0.0);
+        if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::INTERACTION_WORK);
         d_ib_method_ops->spreadFluidSource(d_q_idx, getProlongRefineSchedules(d_object_name + "::q"), half_time);
+        if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::INTERACTION_WORK);
     }
 
     // Solve the incompressible Navier-Stokes equations.
     d_ib_method_ops->preprocessSolveFluidEquations(current_time, new_time, cycle_num);
     if (d_enable_logging)
         plog << d_object_name << "::integrateHierarchy(): solving the incompressible Navier-Stokes equations\n";
+    if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::EULERIAN_WORK);
     if (d_current_num_cycles > 1)
     {
         d_ins_hier_integrator->integrateHierarchy(current_time, new_time, cycle_num);
@@ -332,6 +351,7 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
             d_ins_hier_integrator->integrateHierarchy(current_time, new_time, ins_cycle_num);
         }
     }
+    if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::EULERIAN_WORK);
     d_ib_method_ops->postprocessSolveFluidEquations(current_time, new_time, cycle_num);
 
     // Interpolate the Eulerian velocity to the curvilinear mesh.
@@ -346,10 +366,12 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
             plog << d_object_name << "::integrateHierarchy(): interpolating Eulerian velocity to "
                                      "the Lagrangian mesh\n";
         d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
+        if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::INTERACTION_WORK);
         d_ib_method_ops->interpolateVelocity(d_u_idx,
                                              getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
                                              getGhostfillRefineSchedules(d_object_name + "::u"),
                                              half_time);
+        if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::INTERACTION_WORK);
         break;
     case TRAPEZOIDAL_RULE:
         d_hier_velocity_data_ops->copyData(d_u_idx, u_new_idx);
@@ -357,10 +379,12 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
             plog << d_object_name << "::integrateHierarchy(): interpolating Eulerian velocity to "
                                      "the Lagrangian mesh\n";
         d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
+        if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::INTERACTION_WORK);
         d_ib_method_ops->interpolateVelocity(d_u_idx,
                                              getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
                                              getGhostfillRefineSchedules(d_object_name + "::u"),
                                              new_time);
+        if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::INTERACTION_WORK);
         break;
     default:
         TBOX_ERROR(d_object_name << "::integrateHierarchy():\n"
@@ -413,10 +437,12 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
                                      "pressure to the Lagrangian mesh\n";
         d_hier_pressure_data_ops->copyData(d_p_idx, p_new_idx);
         d_p_phys_bdry_op->setPatchDataIndex(d_p_idx);
+        if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::INTERACTION_WORK);
         d_ib_method_ops->interpolatePressure(d_p_idx,
                                              getCoarsenSchedules(d_object_name + "::p::CONSERVATIVE_COARSEN"),
                                              getGhostfillRefineSchedules(d_object_name + "::p"),
                                              half_time);
+        if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::INTERACTION_WORK);
     }
 
     // Execute any registered callbacks.
@@ -445,10 +471,12 @@ void IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const double c
         plog << d_object_name << "::postprocessIntegrateHierarchy(): interpolating Eulerian "
                                  "velocity to the Lagrangian mesh\n";
     d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
+    if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::INTERACTION_WORK);
     d_ib_method_ops->interpolateVelocity(d_u_idx,
                                          getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
                                          getGhostfillRefineSchedules(d_object_name + "::u"),
                                          new_time);
+    if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::INTERACTION_WORK);
 
     // Synchronize new state data.
     if (!skip_synchronize_new_state_data)
@@ -490,8 +518,10 @@ void IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const double c
 
     // Deallocate the fluid solver.
     const int ins_num_cycles = d_ins_hier_integrator->getNumberOfCycles();
+    if (d_workload_cost_model) d_workload_cost_model->startTimer(WorkloadCostModel::EULERIAN_WORK);
     d_ins_hier_integrator->postprocessIntegrateHierarchy(
         current_time, new_time, skip_synchronize_new_state_data, ins_num_cycles);
+    if (d_workload_cost_model) d_workload_cost_model->stopTimer(WorkloadCostModel::EULERIAN_WORK);
 
     // Deallocate IB data.
     d_ib_method_ops->postprocessIntegrateData(current_time, new_time, num_cycles);
@@ -512,6 +542,8 @@ void IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const double c
         level->deallocatePatchData(d_new_data);
     }
 
+    if (d_workload_cost_model) d_workload_cost_model->endTimestep();
+
     // Execute any registered callbacks.
     executePostprocessIntegrateHierarchyCallbackFcns(
         current_time, new_time, skip_synchronize_new_state_data, num_cycles);
@@ -37,6 +37,7 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <map>
 #include <ostream>
 #include <set>
 #include <string>
@@ -72,6 +73,7 @@
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LEInteractor.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 #include "libmesh/auto_ptr.h"
@@ -679,6 +681,30 @@ void IBFEMethod::spreadForce(const int f_data_idx,
                              const double data_time)
 {
     TBOX_ASSERT(MathUtilities<double>::equalEps(data_time, d_half_time));
+
+    // If physical boundary conditions are to be applied to the spread values,
+    // the spread values from all parts are accumulated in persistent scratch
+    // data on the FE levels so that the boundary conditions are applied only
+    // once.  Otherwise, values are spread directly into the Eulerian data.
+    int f_spread_data_idx = f_data_idx;
+    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops;
+    int fe_coarsest_ln = std::numeric_limits<int>::max(), fe_finest_ln = -1;
+    for (unsigned int part = 0; part < d_num_parts; ++part)
+    {
+        fe_coarsest_ln = std::min(fe_coarsest_ln, d_fe_data_managers[part]->getLevelNumber());
+        fe_finest_ln = std::max(fe_finest_ln, d_fe_data_managers[part]->getLevelNumber());
+    }
+    if (f_phys_bdry_op && fe_coarsest_ln <= fe_finest_ln)
+    {
+        f_spread_data_idx =
+            d_spread_scratch_data_cache.getScratchDataIndex(f_data_idx, d_hierarchy, fe_coarsest_ln, fe_finest_ln);
+        Pointer<hier::Variable<NDIM> > f_var;
+        VariableDatabase<NDIM>::getDatabase()->mapIndexToVariable(f_data_idx, f_var);
+        f_data_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
+        f_data_ops->resetLevels(fe_coarsest_ln, fe_finest_ln);
+        f_data_ops->setToScalar(f_spread_data_idx, 0.0, /*interior_only*/ false);
+    }
+
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
         PetscVector<double>* X_vec = d_X_half_vecs[part];
@@ -689,8 +715,12 @@ void IBFEMethod::spreadForce(const int f_data_idx,
         F_vec->localize(*F_ghost_vec);
         if (d_use_IB_spread_operator)
         {
-            d_fe_data_managers[part]->spread(
-                f_data_idx, *F_ghost_vec, *X_ghost_vec, FORCE_SYSTEM_NAME, f_phys_bdry_op, data_time);
+            d_fe_data_managers[part]->spread(f_spread_data_idx,
+                                             *F_ghost_vec,
+                                             *X_ghost_vec,
+                                             FORCE_SYSTEM_NAME,
+                                             f_spread_data_idx == f_data_idx ? f_phys_bdry_op : NULL,
+                                             data_time);
         }
         else
         {
@@ -709,10 +739,32 @@ void IBFEMethod::spreadForce(const int f_data_idx,
             }
             else
             {
-                spreadTransmissionForceDensity(f_data_idx, *X_ghost_vec, f_phys_bdry_op, data_time, part);
+                spreadTransmissionForceDensity(f_spread_data_idx,
+                                               *X_ghost_vec,
+                                               f_spread_data_idx == f_data_idx ? f_phys_bdry_op : NULL,
+                                               data_time,
+                                               part);
             }
         }
     }
+
+    // Apply the physical boundary conditions to the accumulated spread values
+    // and add them to the Eulerian data.
+    if (f_spread_data_idx != f_data_idx)
+    {
+        for (int ln = fe_coarsest_ln; ln <= fe_finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_spread_data_idx);
+                f_phys_bdry_op->setPatchDataIndex(f_spread_data_idx);
+                f_phys_bdry_op->accumulateFromPhysicalBoundaryData(*patch, data_time, f_data->getGhostCellWidth());
+            }
+        }
+        f_data_ops->add(f_data_idx, f_data_idx, f_spread_data_idx);
+    }
     return;
 } // spreadForce
 
@@ -845,6 +897,15 @@ void IBFEMethod::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balancer
     return;
 } // registerLoadBalancer
 
+void IBFEMethod::registerWorkloadCostModel(Pointer<WorkloadCostModel> workload_cost_model)
+{
+    for (unsigned int part = 0; part < d_num_parts; ++part)
+    {
+        d_fe_data_managers[part]->registerWorkloadCostModel(workload_cost_model);
+    }
+    return;
+} // registerWorkloadCostModel
+
 void IBFEMethod::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/, int /*workload_data_idx*/)
 {
     for (unsigned int part = 0; part < d_num_parts; ++part)
@@ -909,6 +970,9 @@ void IBFEMethod::resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> >
         d_fe_data_managers[part]->setPatchLevels(0, hierarchy->getFinestLevelNumber());
         d_fe_data_managers[part]->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_hier_level);
     }
+
+    // Deallocate any spreading scratch data; it is reallocated on demand.
+    d_spread_scratch_data_cache.deallocateScratchData();
     return;
 } // resetHierarchyConfiguration
 
@@ -1395,23 +1459,22 @@ void IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 {
     if (d_constrained_part[part] || !d_split_forces) return;
 
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-
-    // Make a copy of the Eulerian data.
-    Pointer<hier::Variable<NDIM> > f_var;
-    var_db->mapIndexToVariable(f_data_idx, f_var);
-    const int f_copy_data_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    // If physical boundary conditions are to be applied to the spread values,
+    // accumulate the spread values in persistent scratch data on the FE level.
+    // Otherwise, spread directly into the Eulerian data.
+    const int level_num = d_fe_data_managers[part]->getLevelNumber();
+    int f_spread_data_idx = f_data_idx;
+    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops;
+    if (f_phys_bdry_op)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(f_copy_data_idx);
+        f_spread_data_idx =
+            d_spread_scratch_data_cache.getScratchDataIndex(f_data_idx, d_hierarchy, level_num, level_num);
+        Pointer<hier::Variable<NDIM> > f_var;
+        VariableDatabase<NDIM>::getDatabase()->mapIndexToVariable(f_data_idx, f_var);
+        f_data_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
+        f_data_ops->resetLevels(level_num, level_num);
+        f_data_ops->setToScalar(f_spread_data_idx, 0.0, /*interior_only*/ false);
     }
-    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops =
-        HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
 
     // Extract the mesh.
     EquationSystems* equation_systems = d_fe_data_managers[part]->getEquationSystems();
@@ -1508,7 +1571,6 @@ void IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
     // onto the grid.
     const std::vector<std::vector<Elem*> >& active_patch_element_map =
         d_fe_data_managers[part]->getActivePatchElementMap();
-    const int level_num = d_fe_data_managers[part]->getLevelNumber();
     TensorValue<double> PP, FF, FF_inv_trans;
     VectorValue<double> F, F_s;
     libMesh::Point X_qp;
@@ -1656,24 +1718,20 @@ void IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
         const std::string& spread_kernel_fcn = d_spread_spec.kernel_fcn;
         const hier::IntVector<NDIM>& ghost_width = d_fe_data_managers[part]->getGhostCellWidth();
         const Box<NDIM> spread_box = Box<NDIM>::grow(patch->getBox(), ghost_width);
-        Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_data_idx);
+        Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_spread_data_idx);
         LEInteractor::spread(f_data, T_bdry, NDIM, X_bdry, NDIM, patch, spread_box, spread_kernel_fcn);
         if (f_phys_bdry_op)
         {
-            f_phys_bdry_op->setPatchDataIndex(f_data_idx);
+            f_phys_bdry_op->setPatchDataIndex(f_spread_data_idx);
             f_phys_bdry_op->accumulateFromPhysicalBoundaryData(*patch, data_time, f_data->getGhostCellWidth());
         }
     }
 
     // Accumulate data.
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    if (f_spread_data_idx != f_data_idx)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(f_copy_data_idx);
+        f_data_ops->add(f_data_idx, f_data_idx, f_spread_data_idx);
     }
-    var_db->removePatchDataIndex(f_copy_data_idx);
 
     VecRestoreArray(X_local_vec, &X_local_soln);
     VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
@@ -2354,6 +2412,16 @@ void IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     else if (db->isDouble("IB_point_density"))
         d_interp_spec.point_density = db->getDouble("IB_point_density");
 
+    if (db->isBool("interp_use_anisotropic_quadrature"))
+        d_interp_spec.use_anisotropic_quadrature = db->getBool("interp_use_anisotropic_quadrature");
+    else if (db->isBool("IB_use_anisotropic_quadrature"))
+        d_interp_spec.use_anisotropic_quadrature = db->getBool("IB_use_anisotropic_quadrature");
+
+    if (db->isBool("interp_use_nodal_quadrature"))
+        d_interp_spec.use_nodal_quadrature = db->getBool("interp_use_nodal_quadrature");
+    else if (db->isBool("IB_use_nodal_quadrature"))
+        d_interp_spec.use_nodal_quadrature = db->getBool("IB_use_nodal_quadrature");
+
     if (db->isBool("interp_use_consistent_mass_matrix"))
         d_interp_spec.use_consistent_mass_matrix = db->getBool("interp_use_consistent_mass_matrix");
     else if (db->isBool("IB_use_consistent_mass_matrix"))
@@ -2394,6 +2462,16 @@ void IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     else if (db->isDouble("IB_point_density"))
         d_spread_spec.point_density = db->getDouble("IB_point_density");
 
+    if (db->isBool("spread_use_anisotropic_quadrature"))
+        d_spread_spec.use_anisotropic_quadrature = db->getBool("spread_use_anisotropic_quadrature");
+    else if (db->isBool("IB_use_anisotropic_quadrature"))
+        d_spread_spec.use_anisotropic_quadrature = db->getBool("IB_use_anisotropic_quadrature");
+
+    if (db->isBool("spread_use_nodal_quadrature"))
+        d_spread_spec.use_nodal_quadrature = db->getBool("spread_use_nodal_quadrature");
+    else if (db->isBool("IB_use_nodal_quadrature"))
+        d_spread_spec.use_nodal_quadrature = db->getBool("IB_use_nodal_quadrature");
+
     // Force computation settings.
     if (db->isBool("split_forces")) d_split_forces = db->getBool("split_forces");
     if (db->isBool("use_jump_conditions")) d_use_jump_conditions = db->getBool("use_jump_conditions");
@@ -39,6 +39,7 @@
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
+#include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
@@ -52,6 +53,7 @@
 #include "IntVector.h"
 #include "LoadBalancer.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "RefineAlgorithm.h"
@@ -74,6 +76,7 @@
 #include "ibtk/LMarkerSetVariable.h"
 #include "ibtk/LMarkerUtilities.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
@@ -157,6 +160,7 @@ void IBHierarchyIntegrator::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > lo
         registerVariable(d_workload_idx, d_workload_var, 0, getCurrentContext());
     }
     d_ib_method_ops->registerLoadBalancer(load_balancer, d_workload_idx);
+    if (d_workload_cost_model) d_ib_method_ops->registerWorkloadCostModel(d_workload_cost_model);
     return;
 } // registerLoadBalancer
 
@@ -395,6 +399,7 @@ void IBHierarchyIntegrator::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM
         level->deallocatePatchData(d_u_idx);
         level->deallocatePatchData(d_scratch_data);
     }
+    d_ib_method_ops->postprocessInitializePatchHierarchy(hierarchy, d_integrator_time, initial_time);
 
     // Indicate that the hierarchy is initialized.
     d_hierarchy_is_initialized = true;
@@ -408,7 +413,22 @@ void IBHierarchyIntegrator::regridHierarchy()
     {
         if (d_enable_logging) plog << d_object_name << "::regridHierarchy(): updating workload estimates\n";
         d_hier_cc_data_ops->setToScalar(d_workload_idx, 1.0);
+        if (d_workload_cost_model)
+        {
+            d_workload_cost_model->resetLocalWork();
+            double num_local_cells = 0.0;
+            for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    num_local_cells += static_cast<double>(level->getPatch(p())->getBox().size());
+                }
+            }
+            d_workload_cost_model->addLocalWork(WorkloadCostModel::EULERIAN_WORK, num_local_cells);
+        }
         d_ib_method_ops->updateWorkloadEstimates(d_hierarchy, d_workload_idx);
+        if (d_workload_cost_model) d_workload_cost_model->calibrate();
     }
 
     // Collect the marker particles to level 0 of the patch hierarchy.
@@ -436,6 +456,12 @@ void IBHierarchyIntegrator::regridHierarchy()
         LMarkerUtilities::pruneInvalidMarkers(d_mark_current_idx, d_hierarchy);
     }
 
+    // Report the distribution of the workload over the processes.
+    if (d_load_balancer && d_workload_cost_model)
+    {
+        d_workload_cost_model->printWorkloadStatistics(d_hierarchy, d_workload_idx);
+    }
+
     // Reset the regrid CFL estimate.
     d_regrid_cfl_estimate = 0.0;
     return;
@@ -485,6 +511,14 @@ IBHierarchyIntegrator::IBHierarchyIntegrator(const std::string& object_name,
     d_workload_var.setNull();
     d_workload_idx = -1;
 
+    // Setup the workload cost model, if requested.
+    if (input_db && input_db->isDatabase("WorkloadCostModel"))
+    {
+        d_workload_cost_model = new WorkloadCostModel(d_object_name + "::WorkloadCostModel",
+                                                      input_db->getDatabase("WorkloadCostModel"),
+                                                      d_registered_for_restart);
+    }
+
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
     if (from_restart) getFromRestart();
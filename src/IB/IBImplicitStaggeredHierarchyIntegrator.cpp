@@ -55,6 +55,7 @@
 #include "ibamr/IBHierarchyIntegrator.h"
 #include "ibamr/IBImplicitStaggeredHierarchyIntegrator.h"
 #include "ibamr/IBImplicitStrategy.h"
+#include "ibamr/IBLagrangianMultigridPreconditioner.h"
 #include "ibamr/IBStrategy.h"
 #include "ibamr/INSHierarchyIntegrator.h"
 #include "ibamr/INSStaggeredHierarchyIntegrator.h"
@@ -119,12 +120,29 @@ IBImplicitStaggeredHierarchyIntegrator::IBImplicitStaggeredHierarchyIntegrator(
     Pointer<INSStaggeredHierarchyIntegrator> ins_hier_integrator,
     bool register_for_restart)
     : IBHierarchyIntegrator(object_name, input_db, ib_implicit_ops, ins_hier_integrator, register_for_restart),
-      d_ib_implicit_ops(ib_implicit_ops)
+      d_ib_implicit_ops(ib_implicit_ops), d_use_lagrangian_multigrid_pc(false), d_lagrangian_force_jac(NULL),
+      d_lagrangian_schur_mat(NULL), d_lagrangian_schur_scaling(-1.0)
 {
     // Setup IB ops object to use "fixed" Lagrangian-Eulerian coupling
     // operators.
     d_ib_implicit_ops->setUseFixedLEOperators(true);
 
+    // Setup the (optional) Lagrangian Schur complement preconditioner.
+    if (input_db && input_db->keyExists("use_lagrangian_multigrid_preconditioner"))
+    {
+        d_use_lagrangian_multigrid_pc = input_db->getBool("use_lagrangian_multigrid_preconditioner");
+    }
+    if (d_use_lagrangian_multigrid_pc)
+    {
+        Pointer<Database> mg_db;
+        if (input_db->isDatabase("lagrangian_multigrid_preconditioner_db"))
+        {
+            mg_db = input_db->getDatabase("lagrangian_multigrid_preconditioner_db");
+        }
+        d_lagrangian_mg_pc = new IBLagrangianMultigridPreconditioner(
+            d_object_name + "::lagrangian_mg_pc", mg_db, "ib_schur_mg_");
+    }
+
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
     if (from_restart) getFromRestart();
@@ -133,7 +151,7 @@ IBImplicitStaggeredHierarchyIntegrator::IBImplicitStaggeredHierarchyIntegrator(
 
 IBImplicitStaggeredHierarchyIntegrator::~IBImplicitStaggeredHierarchyIntegrator()
 {
-    // intentionally blank
+    deallocateLagrangianMultigridPreconditioner();
     return;
 } // ~IBImplicitStaggeredHierarchyIntegrator
 
@@ -161,6 +179,10 @@ void IBImplicitStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const
     // Initialize IB data.
     d_ib_implicit_ops->preprocessIntegrateData(current_time, new_time, num_cycles);
 
+    // The scaling of the approximate Lagrangian Schur complement depends on the
+    // time step size, and it is re-estimated once per time step.
+    d_lagrangian_schur_scaling = -1.0;
+
     // Initialize the fluid solver.
     const int ins_num_cycles = d_ins_hier_integrator->getNumberOfCycles();
     if (ins_num_cycles != d_current_num_cycles && d_current_num_cycles != 1)
@@ -311,8 +333,15 @@ void IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy(const double cur
     PC schur_pc;
     ierr = KSPGetPC(d_schur_solver, &schur_pc);
     IBTK_CHKERRQ(ierr);
-    ierr = PCSetType(schur_pc, PCNONE);
-    IBTK_CHKERRQ(ierr);
+    if (d_lagrangian_mg_pc)
+    {
+        d_lagrangian_mg_pc->setupPCShell(schur_pc);
+    }
+    else
+    {
+        ierr = PCSetType(schur_pc, PCNONE);
+        IBTK_CHKERRQ(ierr);
+    }
     ierr = KSPSetFromOptions(d_schur_solver);
     IBTK_CHKERRQ(ierr);
 
@@ -480,6 +509,16 @@ IBImplicitStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pa
     IBHierarchyIntegrator::initializeHierarchyIntegrator(hierarchy, gridding_alg);
 } // initializeHierarchyIntegrator
 
+void IBImplicitStaggeredHierarchyIntegrator::regridHierarchy()
+{
+    IBHierarchyIntegrator::regridHierarchy();
+
+    // Regridding may redistribute the Lagrangian data, so that the Jacobian of
+    // the Lagrangian force and the multigrid hierarchy must be rebuilt.
+    deallocateLagrangianMultigridPreconditioner();
+    return;
+} // regridHierarchy
+
 int IBImplicitStaggeredHierarchyIntegrator::getNumberOfCycles() const
 {
     return d_ins_hier_integrator->getNumberOfCycles();
@@ -611,6 +650,7 @@ PetscErrorCode IBImplicitStaggeredHierarchyIntegrator::compositeIBJacobianSetup(
     IBTK_CHKERRQ(ierr);
     Vec X = component_sol_vecs[1];
     d_ib_implicit_ops->setLinearizedPosition(X);
+    if (d_lagrangian_mg_pc) resetLagrangianMultigridPreconditioner();
     return 0;
 } // compositeIBJacobianSetup
 
@@ -834,6 +874,112 @@ PetscErrorCode IBImplicitStaggeredHierarchyIntegrator::lagrangianSchurApply(Vec
     return 0;
 } // lagrangianSchurApply
 
+void IBImplicitStaggeredHierarchyIntegrator::resetLagrangianMultigridPreconditioner()
+{
+    const double half_time = d_integrator_time + 0.5 * d_current_dt;
+    if (!d_ib_implicit_ops->computeLinearizedLagrangianForceJacobian(d_lagrangian_force_jac, half_time))
+    {
+        TBOX_ERROR(d_object_name << "::resetLagrangianMultigridPreconditioner():\n"
+                                 << "  the Lagrangian multigrid preconditioner requires an IB implicit strategy that "
+                                    "assembles the Jacobian of the Lagrangian force"
+                                 << std::endl);
+    }
+
+    // The Lagrangian Schur complement is approximated by M = I-s*A.  The
+    // scaling s is estimated only once per time step.
+    PetscErrorCode ierr;
+    if (d_lagrangian_schur_scaling < 0.0)
+    {
+        d_lagrangian_schur_scaling = estimateLagrangianSchurComplementScaling();
+    }
+    const double s = d_lagrangian_schur_scaling;
+    if (!d_lagrangian_schur_mat)
+    {
+        ierr = MatDuplicate(d_lagrangian_force_jac, MAT_COPY_VALUES, &d_lagrangian_schur_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    else
+    {
+        ierr = MatCopy(d_lagrangian_force_jac, d_lagrangian_schur_mat, SAME_NONZERO_PATTERN);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = MatScale(d_lagrangian_schur_mat, -s);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatShift(d_lagrangian_schur_mat, 1.0);
+    IBTK_CHKERRQ(ierr);
+
+    // The nonzero structure of M does not change until the Lagrangian data are
+    // redistributed, so that the multigrid hierarchy is built once and then
+    // only updated with the new values of M.
+    if (d_lagrangian_mg_pc->getIsInitialized())
+    {
+        d_lagrangian_mg_pc->updateSolverState(d_lagrangian_schur_mat);
+    }
+    else
+    {
+        d_lagrangian_mg_pc->initializeSolverState(d_lagrangian_schur_mat);
+    }
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::resetLagrangianMultigridPreconditioner(): Schur complement scaling = " << s
+             << ", number of multigrid levels = " << d_lagrangian_mg_pc->getNumberOfLevels() << "\n";
+    }
+    return;
+} // resetLagrangianMultigridPreconditioner
+
+double IBImplicitStaggeredHierarchyIntegrator::estimateLagrangianSchurComplementScaling()
+{
+    // The Schur complement is Sc = I-K*A, in which K = dt*J*inv(L)*S/2 is
+    // approximately a multiple of the identity.  We estimate that multiple by
+    // the value of s that minimizes |(I-Sc)*v - s*A*v| for a random vector v.
+    PetscErrorCode ierr;
+    Vec v, w, z;
+    ierr = MatGetVecs(d_lagrangian_force_jac, &v, &w);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDuplicate(v, &z);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSetRandom(v, NULL);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatMult(d_lagrangian_force_jac, v, w);
+    IBTK_CHKERRQ(ierr);
+    ierr = lagrangianSchurApply(v, z);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecAYPX(z, -1.0, v);
+    IBTK_CHKERRQ(ierr);
+    double w_dot_z, w_dot_w;
+    ierr = VecDot(w, z, &w_dot_z);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDot(w, w, &w_dot_w);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&v);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&w);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&z);
+    IBTK_CHKERRQ(ierr);
+
+    // NOTE: A is negative semi-definite and K is positive semi-definite, so
+    // that s should be nonnegative.
+    return w_dot_w > 0.0 ? std::max(w_dot_z / w_dot_w, 0.0) : 0.0;
+} // estimateLagrangianSchurComplementScaling
+
+void IBImplicitStaggeredHierarchyIntegrator::deallocateLagrangianMultigridPreconditioner()
+{
+    PetscErrorCode ierr;
+    if (d_lagrangian_mg_pc) d_lagrangian_mg_pc->deallocateSolverState();
+    if (d_lagrangian_schur_mat)
+    {
+        ierr = MatDestroy(&d_lagrangian_schur_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_lagrangian_force_jac)
+    {
+        ierr = MatDestroy(&d_lagrangian_force_jac);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // deallocateLagrangianMultigridPreconditioner
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -54,6 +54,11 @@ IBImplicitStrategy::~IBImplicitStrategy()
     return;
 } // ~IBImplicitStrategy
 
+bool IBImplicitStrategy::computeLinearizedLagrangianForceJacobian(Mat& /*A_mat*/, double /*data_time*/)
+{
+    return false;
+} // computeLinearizedLagrangianForceJacobian
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -51,6 +51,7 @@
 #include "ibtk/LDataManager.h"
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
+#include "ibtk/compiler_hints.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
 #include "petscsys.h"
@@ -73,13 +74,254 @@ namespace
 // Timers.
 static Timer* t_compute_lagrangian_force_and_torque;
 static Timer* t_initialize_level_data;
+
+// Indices of the material parameters of a rod.
+enum
+{
+    DS = 0,
+    A1 = 1,
+    A2 = 2,
+    A3 = 3,
+    B1 = 4,
+    B2 = 5,
+    B3 = 6,
+    KAPPA1 = 7,
+    KAPPA2 = 8,
+    TAU = 9
+};
+
+// Compute the force and moment generated by a single rod using the general
+// matrix square root of the rotation relating the director triads at the
+// "current" and "next" nodes.
+inline void compute_rod_force_and_torque(const double* const D_curr,
+                                         const double* const D_next,
+                                         const double* const X_curr,
+                                         const double* const X_next,
+                                         const double* const params,
+                                         double* const F_curr,
+                                         double* const F_next,
+                                         double* const N_curr,
+                                         double* const N_next)
+{
+    Eigen::Map<const Vector3d> D1(D_curr + 0), D2(D_curr + 3), D3(D_curr + 6);
+    Eigen::Map<const Vector3d> D1_next(D_next + 0), D2_next(D_next + 3), D3_next(D_next + 6);
+    Eigen::Map<const Vector3d> X(X_curr), X_next_map(X_next);
+
+    boost::array<Eigen::Map<const Vector3d>*, 3> D = { { &D1, &D2, &D3 } };
+    boost::array<Eigen::Map<const Vector3d>*, 3> D_nxt = { { &D1_next, &D2_next, &D3_next } };
+    Matrix3d A(Matrix3d::Zero());
+    for (int i = 0; i < 3; ++i)
+    {
+        A += (*D_nxt[i]) * (*D[i]).transpose();
+    }
+    Matrix3d sqrt_A = A.sqrt();
+    const Vector3d D1_half = sqrt_A * D1;
+    const Vector3d D2_half = sqrt_A * D2;
+    const Vector3d D3_half = sqrt_A * D3;
+
+    const double ds = params[DS];
+    const Vector3d dX_ds((X_next_map - X) / ds);
+    const double F1 = params[B1] * D1_half.dot(dX_ds);
+    const double F2 = params[B2] * D2_half.dot(dX_ds);
+    const double F3 = params[B3] * (D3_half.dot(dX_ds) - 1.0);
+    const Vector3d F_half = F1 * D1_half + F2 * D2_half + F3 * D3_half;
+
+    const Vector3d dD1_ds((D1_next - D1) / ds);
+    const Vector3d dD2_ds((D2_next - D2) / ds);
+    const Vector3d dD3_ds((D3_next - D3) / ds);
+    const double N1 = params[A1] * (dD2_ds.dot(D3_half) - params[KAPPA1]);
+    const double N2 = params[A2] * (dD3_ds.dot(D1_half) - params[KAPPA2]);
+    const double N3 = params[A3] * (dD1_ds.dot(D2_half) - params[TAU]);
+    const Vector3d N_half = N1 * D1_half + N2 * D2_half + N3 * D3_half;
+
+    Eigen::Map<Vector3d> F_curr_map(F_curr), F_next_map(F_next), N_curr_map(N_curr), N_next_map(N_next);
+    F_curr_map = F_half;
+    F_next_map = -F_half;
+    N_curr_map = N_half + 0.5 * (X_next_map - X).cross(F_half);
+    N_next_map = -N_half + 0.5 * (X_next_map - X).cross(F_half);
+    return;
+} // compute_rod_force_and_torque
+
+// Compute the forces and moments generated by rods k_begin, ..., k_end-1.
+//
+// The rotation A = sum_i D_next_i D_i^T relating the director triads at the
+// "current" and "next" nodes is converted to a quaternion, and its square
+// root is obtained as the rotation by half of the angle about the same axis.
+// This avoids the general matrix square root, and the loop over the rods of a
+// block is written without branches so that it can be vectorized.  Rods whose
+// triads are rotated by nearly pi relative to each other, for which the
+// quaternion is ill-conditioned, are handled by compute_rod_force_and_torque().
+void compute_rod_forces_and_torques(const int k_begin,
+                                    const int k_end,
+                                    const int* const curr_local_idxs,
+                                    const double* const D_vals,
+                                    const double* const D_next_vals,
+                                    const double* const X_vals,
+                                    const double* const X_next_vals,
+                                    const boost::array<std::vector<double>, IBRodForceSpec::NUM_MATERIAL_PARAMS>& params,
+                                    double* const F_curr_vals,
+                                    double* const F_next_vals,
+                                    double* const N_curr_vals,
+                                    double* const N_next_vals)
+{
+    static const int BLOCKSIZE = 16; // this parameter needs to be tuned
+    static const double QUAT_EPS = 1.0e-6;
+    double D[3][3][BLOCKSIZE], D_next[3][3][BLOCKSIZE], dX[3][BLOCKSIZE];
+    int needs_general_sqrt[BLOCKSIZE];
+    for (int k_block = k_begin; k_block < k_end; k_block += BLOCKSIZE)
+    {
+        const int n = std::min(BLOCKSIZE, k_end - k_block);
+
+        // Gather the directors and node positions of the rods in this block.
+        for (int l = 0; l < n; ++l)
+        {
+            const int k = k_block + l;
+            const double* const D_curr_node = D_vals + curr_local_idxs[k] * 3 * 3;
+            const double* const D_next_node = D_next_vals + k * 3 * 3;
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int d = 0; d < 3; ++d)
+                {
+                    D[i][d][l] = D_curr_node[3 * i + d];
+                    D_next[i][d][l] = D_next_node[3 * i + d];
+                }
+            }
+            for (int d = 0; d < 3; ++d)
+            {
+                dX[d][l] = X_next_vals[k * NDIM + d] - X_vals[curr_local_idxs[k] * NDIM + d];
+            }
+        }
+
+        // Evaluate the rod forces and moments.
+        const double* const ds = &params[DS][k_block];
+        const double* const a1 = &params[A1][k_block];
+        const double* const a2 = &params[A2][k_block];
+        const double* const a3 = &params[A3][k_block];
+        const double* const b1 = &params[B1][k_block];
+        const double* const b2 = &params[B2][k_block];
+        const double* const b3 = &params[B3][k_block];
+        const double* const kappa1 = &params[KAPPA1][k_block];
+        const double* const kappa2 = &params[KAPPA2][k_block];
+        const double* const tau = &params[TAU][k_block];
+        for (int l = 0; l < n; ++l)
+        {
+            double A[3][3];
+            for (int r = 0; r < 3; ++r)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    A[r][c] = D_next[0][r][l] * D[0][c][l] + D_next[1][r][l] * D[1][c][l] +
+                              D_next[2][r][l] * D[2][c][l];
+                }
+            }
+
+            // Unit quaternion (q0,q1,q2,q3) corresponding to A.
+            const double four_q0_sq = 1.0 + A[0][0] + A[1][1] + A[2][2];
+            needs_general_sqrt[l] = four_q0_sq < QUAT_EPS;
+            const double q0 = 0.5 * std::sqrt(std::max(four_q0_sq, QUAT_EPS));
+            const double fac = 0.25 / q0;
+            const double q1 = (A[2][1] - A[1][2]) * fac;
+            const double q2 = (A[0][2] - A[2][0]) * fac;
+            const double q3 = (A[1][0] - A[0][1]) * fac;
+
+            // Unit quaternion (h0,h1,h2,h3) corresponding to sqrt(A).
+            const double norm_inv = 1.0 / std::sqrt((1.0 + q0) * (1.0 + q0) + q1 * q1 + q2 * q2 + q3 * q3);
+            const double h0 = (1.0 + q0) * norm_inv;
+            const double h1 = q1 * norm_inv;
+            const double h2 = q2 * norm_inv;
+            const double h3 = q3 * norm_inv;
+            const double sqrt_A[3][3] = { { 1.0 - 2.0 * (h2 * h2 + h3 * h3),
+                                            2.0 * (h1 * h2 - h0 * h3),
+                                            2.0 * (h1 * h3 + h0 * h2) },
+                                          { 2.0 * (h1 * h2 + h0 * h3),
+                                            1.0 - 2.0 * (h1 * h1 + h3 * h3),
+                                            2.0 * (h2 * h3 - h0 * h1) },
+                                          { 2.0 * (h1 * h3 - h0 * h2),
+                                            2.0 * (h2 * h3 + h0 * h1),
+                                            1.0 - 2.0 * (h1 * h1 + h2 * h2) } };
+
+            double D_half[3][3];
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int d = 0; d < 3; ++d)
+                {
+                    D_half[i][d] = sqrt_A[d][0] * D[i][0][l] + sqrt_A[d][1] * D[i][1][l] + sqrt_A[d][2] * D[i][2][l];
+                }
+            }
+
+            const double ds_inv = 1.0 / ds[l];
+            double D_half_dot_dX_ds[3];
+            for (int i = 0; i < 3; ++i)
+            {
+                D_half_dot_dX_ds[i] =
+                    (D_half[i][0] * dX[0][l] + D_half[i][1] * dX[1][l] + D_half[i][2] * dX[2][l]) * ds_inv;
+            }
+            const double F1 = b1[l] * D_half_dot_dX_ds[0];
+            const double F2 = b2[l] * D_half_dot_dX_ds[1];
+            const double F3 = b3[l] * (D_half_dot_dX_ds[2] - 1.0);
+
+            double dD_ds_dot_D_half[3];
+            for (int i = 0; i < 3; ++i)
+            {
+                const int j = (i + 1) % 3; // dD2.D3, dD3.D1, dD1.D2
+                const int m = (i + 2) % 3;
+                dD_ds_dot_D_half[i] = ((D_next[j][0][l] - D[j][0][l]) * D_half[m][0] +
+                                       (D_next[j][1][l] - D[j][1][l]) * D_half[m][1] +
+                                       (D_next[j][2][l] - D[j][2][l]) * D_half[m][2]) *
+                                      ds_inv;
+            }
+            const double N1 = a1[l] * (dD_ds_dot_D_half[0] - kappa1[l]);
+            const double N2 = a2[l] * (dD_ds_dot_D_half[1] - kappa2[l]);
+            const double N3 = a3[l] * (dD_ds_dot_D_half[2] - tau[l]);
+
+            double F_half[3], N_half[3];
+            for (int d = 0; d < 3; ++d)
+            {
+                F_half[d] = F1 * D_half[0][d] + F2 * D_half[1][d] + F3 * D_half[2][d];
+                N_half[d] = N1 * D_half[0][d] + N2 * D_half[1][d] + N3 * D_half[2][d];
+            }
+            const double dX_cross_F_half[3] = { dX[1][l] * F_half[2] - dX[2][l] * F_half[1],
+                                                dX[2][l] * F_half[0] - dX[0][l] * F_half[2],
+                                                dX[0][l] * F_half[1] - dX[1][l] * F_half[0] };
+
+            const int k = k_block + l;
+            for (int d = 0; d < 3; ++d)
+            {
+                F_curr_vals[k * NDIM + d] = F_half[d];
+                F_next_vals[k * NDIM + d] = -F_half[d];
+                N_curr_vals[k * NDIM + d] = N_half[d] + 0.5 * dX_cross_F_half[d];
+                N_next_vals[k * NDIM + d] = -N_half[d] + 0.5 * dX_cross_F_half[d];
+            }
+        }
+
+        // Recompute the forces and moments of any rods for which the quaternion
+        // is ill-conditioned.
+        for (int l = 0; l < n; ++l)
+        {
+            if (LIKELY(!needs_general_sqrt[l])) continue;
+            const int k = k_block + l;
+            double rod_params[IBRodForceSpec::NUM_MATERIAL_PARAMS];
+            for (int p = 0; p < IBRodForceSpec::NUM_MATERIAL_PARAMS; ++p) rod_params[p] = params[p][k];
+            compute_rod_force_and_torque(D_vals + curr_local_idxs[k] * 3 * 3,
+                                         D_next_vals + k * 3 * 3,
+                                         X_vals + curr_local_idxs[k] * NDIM,
+                                         X_next_vals + k * NDIM,
+                                         rod_params,
+                                         F_curr_vals + k * NDIM,
+                                         F_next_vals + k * NDIM,
+                                         N_curr_vals + k * NDIM,
+                                         N_next_vals + k * NDIM);
+        }
+    }
+    return;
+} // compute_rod_forces_and_torques
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 IBKirchhoffRodForceGen::IBKirchhoffRodForceGen(Pointer<Database> input_db)
-    : d_D_next_mats(), d_X_next_mats(), d_petsc_curr_node_idxs(), d_petsc_next_node_idxs(), d_material_params(),
-      d_is_initialized()
+    : d_D_next_mats(), d_X_next_mats(), d_petsc_curr_node_idxs(), d_petsc_next_node_idxs(),
+      d_local_curr_node_idxs(), d_material_params(), d_is_initialized()
 {
     // Initialize object with data read from the input database.
     getFromInput(input_db);
@@ -140,6 +382,7 @@ void IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<ND
     d_X_next_mats.resize(new_size);
     d_petsc_curr_node_idxs.resize(new_size);
     d_petsc_next_node_idxs.resize(new_size);
+    d_local_curr_node_idxs.resize(new_size);
     d_material_params.resize(new_size);
     d_is_initialized.resize(new_size, false);
 
@@ -147,7 +390,8 @@ void IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<ND
     Mat& X_next_mat = d_X_next_mats[level_num];
     std::vector<int>& petsc_curr_node_idxs = d_petsc_curr_node_idxs[level_num];
     std::vector<int>& petsc_next_node_idxs = d_petsc_next_node_idxs[level_num];
-    std::vector<boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> >& material_params =
+    std::vector<int>& local_curr_node_idxs = d_local_curr_node_idxs[level_num];
+    boost::array<std::vector<double>, IBRodForceSpec::NUM_MATERIAL_PARAMS>& material_params =
         d_material_params[level_num];
 
     if (D_next_mat)
@@ -162,7 +406,8 @@ void IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<ND
     }
     petsc_curr_node_idxs.clear();
     petsc_next_node_idxs.clear();
-    material_params.clear();
+    local_curr_node_idxs.clear();
+    for (int p = 0; p < IBRodForceSpec::NUM_MATERIAL_PARAMS; ++p) material_params[p].clear();
 
     // The LMesh object provides the set of local Lagrangian nodes.
     const Pointer<LMesh> mesh = l_data_manager->getLMesh(level_num);
@@ -191,7 +436,10 @@ void IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<ND
             {
                 petsc_curr_node_idxs.push_back(curr_idx);
                 petsc_next_node_idxs.push_back(next_idxs[k]);
-                material_params.push_back(params[k]);
+                for (int p = 0; p < IBRodForceSpec::NUM_MATERIAL_PARAMS; ++p)
+                {
+                    material_params[p].push_back(params[k][p]);
+                }
             }
         }
     }
@@ -205,8 +453,16 @@ void IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<ND
     const int global_node_offset = l_data_manager->getGlobalNodeOffset(level_num);
     const int num_local_nodes = l_data_manager->getNumberOfLocalNodes(level_num);
 
-    // Determine the non-zero structure for the matrices.
+    // Determine the local indices of the "current" nodes, which are always
+    // local to the present MPI process.
     const int local_sz = static_cast<int>(petsc_curr_node_idxs.size());
+    local_curr_node_idxs.resize(local_sz);
+    for (int k = 0; k < local_sz; ++k)
+    {
+        local_curr_node_idxs[k] = petsc_curr_node_idxs[k] - global_node_offset;
+    }
+
+    // Determine the non-zero structure for the matrices.
 
     std::vector<int> next_d_nz(local_sz, 1), next_o_nz(local_sz, 0);
     for (int k = 0; k < local_sz; ++k)
@@ -341,8 +597,6 @@ void IBKirchhoffRodForceGen::computeLagrangianForceAndTorque(Pointer<LData> F_da
     TBOX_ASSERT(d_is_initialized[level_number]);
 #endif
 
-    const int global_offset = l_data_manager->getGlobalNodeOffset(level_number);
-
     int ierr;
 
     // Create appropriately sized temporary vectors.
@@ -389,83 +643,37 @@ void IBKirchhoffRodForceGen::computeLagrangianForceAndTorque(Pointer<LData> F_da
 
     std::vector<int>& petsc_curr_node_idxs = d_petsc_curr_node_idxs[level_number];
     std::vector<int>& petsc_next_node_idxs = d_petsc_next_node_idxs[level_number];
-    const std::vector<boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> >& material_params =
+    const std::vector<int>& local_curr_node_idxs = d_local_curr_node_idxs[level_number];
+    const boost::array<std::vector<double>, IBRodForceSpec::NUM_MATERIAL_PARAMS>& material_params =
         d_material_params[level_number];
 
-    const size_t local_sz = petsc_curr_node_idxs.size();
+    const int local_sz = static_cast<int>(petsc_curr_node_idxs.size());
     std::vector<double> F_curr_node_vals(NDIM * local_sz, 0.0);
     std::vector<double> N_curr_node_vals(NDIM * local_sz, 0.0);
     std::vector<double> F_next_node_vals(NDIM * local_sz, 0.0);
     std::vector<double> N_next_node_vals(NDIM * local_sz, 0.0);
 
-    for (unsigned int k = 0; k < local_sz; ++k)
+    // Compute the forces applied by the rods to the "current" and "next" nodes.
+    // Each rod writes only to its own entries of the force and moment arrays,
+    // so that chunks of rods may be processed concurrently.
+    static const int CHUNKSIZE = 1024;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int k_chunk = 0; k_chunk < local_sz; k_chunk += CHUNKSIZE)
     {
-        // Compute the forces applied by the rod to the "current" and "next"
-        // nodes.
-        const int D1_offset = 0;
-        Eigen::Map<const Vector3d> D1(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D1_offset]);
-        Eigen::Map<const Vector3d> D1_next(&D_next_vals[k * 3 * 3 + D1_offset]);
-
-        const int D2_offset = 3;
-        Eigen::Map<const Vector3d> D2(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D2_offset]);
-        Eigen::Map<const Vector3d> D2_next(&D_next_vals[k * 3 * 3 + D2_offset]);
-
-        const int D3_offset = 6;
-        Eigen::Map<const Vector3d> D3(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D3_offset]);
-        Eigen::Map<const Vector3d> D3_next(&D_next_vals[k * 3 * 3 + D3_offset]);
-
-        Eigen::Map<const Vector3d> X(&X_vals[(petsc_curr_node_idxs[k] - global_offset) * NDIM]);
-        Eigen::Map<const Vector3d> X_next(&X_next_vals[k * NDIM]);
-
-        boost::array<Eigen::Map<const Vector3d>*, 3> D = { { &D1, &D2, &D3 } };
-        boost::array<Eigen::Map<const Vector3d>*, 3> D_next = { { &D1_next, &D2_next, &D3_next } };
-        Matrix3d A(Matrix3d::Zero());
-        for (int i = 0; i < 3; ++i)
-        {
-            A += (*D_next[i]) * (*D[i]).transpose();
-        }
-        Matrix3d sqrt_A = A.sqrt();
-        Vector3d D1_half, D2_half, D3_half;
-        boost::array<Vector3d*, 3> D_half = { { &D1_half, &D2_half, &D3_half } };
-        for (int i = 0; i < 3; ++i)
-        {
-            *D_half[i] = sqrt_A * (*D[i]);
-        }
-
-        const double ds = material_params[k][0];
-        const double a1 = material_params[k][1];
-        const double a2 = material_params[k][2];
-        const double a3 = material_params[k][3];
-        const double b1 = material_params[k][4];
-        const double b2 = material_params[k][5];
-        const double b3 = material_params[k][6];
-        const double kappa1 = material_params[k][7];
-        const double kappa2 = material_params[k][8];
-        const double tau = material_params[k][9];
-
-        const Vector3d dX_ds((X_next - X) / ds);
-        const double F1 = b1 * D1_half.dot(dX_ds);
-        const double F2 = b2 * D2_half.dot(dX_ds);
-        const double F3 = b3 * (D3_half.dot(dX_ds) - 1.0);
-        const Vector3d F_half = F1 * D1_half + F2 * D2_half + F3 * D3_half;
-
-        const Vector3d dD1_ds((D1_next - D1) / ds);
-        const Vector3d dD2_ds((D2_next - D2) / ds);
-        const Vector3d dD3_ds((D3_next - D3) / ds);
-        const double N1 = a1 * (dD2_ds.dot(D3_half) - kappa1);
-        const double N2 = a2 * (dD3_ds.dot(D1_half) - kappa2);
-        const double N3 = a3 * (dD1_ds.dot(D2_half) - tau);
-        const Vector3d N_half = N1 * D1_half + N2 * D2_half + N3 * D3_half;
-
-        Eigen::Map<Vector3d> F_curr(&F_curr_node_vals[k * NDIM]);
-        Eigen::Map<Vector3d> F_next(&F_next_node_vals[k * NDIM]);
-        F_curr = F_half;
-        F_next = -F_half;
-
-        Eigen::Map<Vector3d> N_curr(&N_curr_node_vals[k * NDIM]);
-        Eigen::Map<Vector3d> N_next(&N_next_node_vals[k * NDIM]);
-        N_curr = N_half + 0.5 * (X_next - X).cross(F_half);
-        N_next = -N_half + 0.5 * (X_next - X).cross(F_half);
+        compute_rod_forces_and_torques(k_chunk,
+                                       std::min(k_chunk + CHUNKSIZE, local_sz),
+                                       &local_curr_node_idxs[0],
+                                       D_vals,
+                                       D_next_vals,
+                                       X_vals,
+                                       X_next_vals,
+                                       material_params,
+                                       &F_curr_node_vals[0],
+                                       &F_next_node_vals[0],
+                                       &N_curr_node_vals[0],
+                                       &N_next_node_vals[0]);
     }
 
     ierr = VecRestoreArray(D_vec, &D_vals);
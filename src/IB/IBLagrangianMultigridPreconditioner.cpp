@@ -0,0 +1,734 @@
+// Filename: IBLagrangianMultigridPreconditioner.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "ibamr/IBLagrangianMultigridPreconditioner.h"
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/IBTK_CHKERRQ.h"
+#include "ibtk/ibtk_utilities.h"
+#include "petscksp.h"
+#include "petscmat.h"
+#include "petscpc.h"
+#include "petscsys.h"
+#include "petscvec.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_initialize_solver_state;
+static Timer* t_update_solver_state;
+static Timer* t_deallocate_solver_state;
+static Timer* t_apply;
+
+// Number of power iterations used to estimate the spectral radius of the
+// Jacobi-preconditioned operator.
+static const int NUM_POWER_ITERATIONS = 10;
+
+// Coarsening is stopped when the number of aggregates is not sufficiently
+// smaller than the number of nodes.
+static const double MIN_COARSENING_RATIO = 0.9;
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+IBLagrangianMultigridPreconditioner::IBLagrangianMultigridPreconditioner(const std::string& object_name,
+                                                                         Pointer<Database> input_db,
+                                                                         const std::string& default_options_prefix)
+    : d_object_name(object_name), d_options_prefix(default_options_prefix), d_is_initialized(false),
+      d_max_levels(10), d_coarsest_level_size(64), d_num_pre_sweeps(1), d_num_post_sweeps(1),
+      d_strength_threshold(0.08), d_smoother_damping_factor(0.67), d_smooth_prolongation(true), d_A_mats(),
+      d_P_mats(), d_b_vecs(), d_x_vecs(), d_r_vecs(), d_block_diag_inv(), d_coarse_solver(NULL)
+{
+    if (input_db)
+    {
+        if (input_db->keyExists("options_prefix")) d_options_prefix = input_db->getString("options_prefix");
+        if (input_db->keyExists("max_levels")) d_max_levels = input_db->getInteger("max_levels");
+        if (input_db->keyExists("coarsest_level_size"))
+            d_coarsest_level_size = input_db->getInteger("coarsest_level_size");
+        if (input_db->keyExists("strength_threshold"))
+            d_strength_threshold = input_db->getDouble("strength_threshold");
+        if (input_db->keyExists("num_pre_sweeps")) d_num_pre_sweeps = input_db->getInteger("num_pre_sweeps");
+        if (input_db->keyExists("num_post_sweeps")) d_num_post_sweeps = input_db->getInteger("num_post_sweeps");
+        if (input_db->keyExists("smoother_damping_factor"))
+            d_smoother_damping_factor = input_db->getDouble("smoother_damping_factor");
+        if (input_db->keyExists("smooth_prolongation"))
+            d_smooth_prolongation = input_db->getBool("smooth_prolongation");
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_max_levels >= 1);
+    TBOX_ASSERT(d_num_pre_sweeps >= 0 && d_num_post_sweeps >= 0);
+    TBOX_ASSERT(d_num_pre_sweeps + d_num_post_sweeps > 0);
+#endif
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_initialize_solver_state = TimerManager::getManager()->getTimer(
+                     "IBAMR::IBLagrangianMultigridPreconditioner::initializeSolverState()");
+                 t_update_solver_state = TimerManager::getManager()->getTimer(
+                     "IBAMR::IBLagrangianMultigridPreconditioner::updateSolverState()");
+                 t_deallocate_solver_state = TimerManager::getManager()->getTimer(
+                     "IBAMR::IBLagrangianMultigridPreconditioner::deallocateSolverState()");
+                 t_apply =
+                     TimerManager::getManager()->getTimer("IBAMR::IBLagrangianMultigridPreconditioner::apply()"););
+    return;
+} // IBLagrangianMultigridPreconditioner
+
+IBLagrangianMultigridPreconditioner::~IBLagrangianMultigridPreconditioner()
+{
+    if (d_is_initialized) deallocateSolverState();
+    return;
+} // ~IBLagrangianMultigridPreconditioner
+
+void IBLagrangianMultigridPreconditioner::initializeSolverState(Mat A_mat)
+{
+    IBTK_TIMER_START(t_initialize_solver_state);
+
+    if (d_is_initialized) deallocateSolverState();
+
+    PetscErrorCode ierr;
+    PetscInt bs;
+    ierr = MatGetBlockSize(A_mat, &bs);
+    IBTK_CHKERRQ(ierr);
+    if (bs != NDIM)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState():\n"
+                                 << "  operator must have block size NDIM = " << NDIM << std::endl);
+    }
+
+    // Coarse-level operators are computed via Galerkin projection, which
+    // requires a point (i.e., non-blocked) matrix format.
+    Mat A_fine;
+    ierr = MatConvert(A_mat, MATAIJ, MAT_INITIAL_MATRIX, &A_fine);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatSetBlockSize(A_fine, NDIM);
+    IBTK_CHKERRQ(ierr);
+    d_A_mats.push_back(A_fine);
+
+    // Build the coarse levels by successive aggregation.
+    while (static_cast<int>(d_A_mats.size()) < d_max_levels)
+    {
+        const int ln = static_cast<int>(d_A_mats.size()) - 1;
+        PetscInt n_global;
+        ierr = MatGetSize(d_A_mats[ln], &n_global, NULL);
+        IBTK_CHKERRQ(ierr);
+        const int num_global_nodes = n_global / NDIM;
+        if (num_global_nodes <= d_coarsest_level_size) break;
+
+        std::vector<int> node_to_aggregate;
+        int num_local_aggregates = computeAggregates(ln, node_to_aggregate);
+        const int num_global_aggregates = SAMRAI_MPI::sumReduction(num_local_aggregates);
+        if (num_global_aggregates == 0 || num_global_aggregates > MIN_COARSENING_RATIO * num_global_nodes) break;
+
+        buildProlongation(ln, node_to_aggregate, num_local_aggregates);
+        Mat A_coarse;
+        ierr = MatPtAP(d_A_mats[ln], d_P_mats[ln], MAT_INITIAL_MATRIX, 2.0, &A_coarse);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatSetBlockSize(A_coarse, NDIM);
+        IBTK_CHKERRQ(ierr);
+        d_A_mats.push_back(A_coarse);
+    }
+
+    // Setup the smoothers and the work vectors.
+    const int num_levels = static_cast<int>(d_A_mats.size());
+    d_block_diag_inv.resize(num_levels);
+    d_b_vecs.resize(num_levels, NULL);
+    d_x_vecs.resize(num_levels, NULL);
+    d_r_vecs.resize(num_levels, NULL);
+    for (int ln = 0; ln < num_levels; ++ln)
+    {
+        if (ln < num_levels - 1) buildSmoother(ln);
+        ierr = MatGetVecs(d_A_mats[ln], &d_x_vecs[ln], &d_b_vecs[ln]);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDuplicate(d_b_vecs[ln], &d_r_vecs[ln]);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Setup the coarsest level solver.
+    ierr = KSPCreate(PETSC_COMM_WORLD, &d_coarse_solver);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetOptionsPrefix(d_coarse_solver, (d_options_prefix + "coarse_").c_str());
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetOperators(d_coarse_solver, d_A_mats.back(), d_A_mats.back(), SAME_NONZERO_PATTERN);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetType(d_coarse_solver, KSPPREONLY);
+    IBTK_CHKERRQ(ierr);
+    PC coarse_pc;
+    ierr = KSPGetPC(d_coarse_solver, &coarse_pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCSetType(coarse_pc, PCREDUNDANT);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetFromOptions(d_coarse_solver);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetUp(d_coarse_solver);
+    IBTK_CHKERRQ(ierr);
+
+    d_is_initialized = true;
+
+    IBTK_TIMER_STOP(t_initialize_solver_state);
+    return;
+} // initializeSolverState
+
+void IBLagrangianMultigridPreconditioner::updateSolverState(Mat A_mat)
+{
+    if (!d_is_initialized)
+    {
+        initializeSolverState(A_mat);
+        return;
+    }
+
+    PetscErrorCode ierr;
+    PetscInt m, n, m_fine, n_fine;
+    ierr = MatGetSize(A_mat, &m, &n);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatGetSize(d_A_mats[0], &m_fine, &n_fine);
+    IBTK_CHKERRQ(ierr);
+    if (m != m_fine || n != n_fine)
+    {
+        TBOX_ERROR(d_object_name << "::updateSolverState():\n"
+                                 << "  operator size does not match the size of the operator used to build the "
+                                    "multigrid hierarchy"
+                                 << std::endl);
+    }
+
+    IBTK_TIMER_START(t_update_solver_state);
+
+    // Copy the new values into the finest-level operator, which has the same
+    // nonzero structure as the operator used to build the hierarchy.
+    //
+    // NOTE: MatCopy() falls back to a row-by-row copy when the two matrices
+    // have different formats.
+    ierr = MatCopy(A_mat, d_A_mats[0], SAME_NONZERO_PATTERN);
+    IBTK_CHKERRQ(ierr);
+
+    // Recompute the values of the coarse-level operators.  The aggregates and
+    // prolongation operators are retained, so that only the numeric phase of
+    // the Galerkin products needs to be repeated.
+    const int num_levels = static_cast<int>(d_A_mats.size());
+    for (int ln = 0; ln < num_levels - 1; ++ln)
+    {
+        ierr = MatPtAP(d_A_mats[ln], d_P_mats[ln], MAT_REUSE_MATRIX, 2.0, &d_A_mats[ln + 1]);
+        IBTK_CHKERRQ(ierr);
+        buildSmoother(ln);
+    }
+
+    // Refactor the coarsest level operator.
+    ierr = KSPSetOperators(d_coarse_solver, d_A_mats.back(), d_A_mats.back(), SAME_NONZERO_PATTERN);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetUp(d_coarse_solver);
+    IBTK_CHKERRQ(ierr);
+
+    IBTK_TIMER_STOP(t_update_solver_state);
+    return;
+} // updateSolverState
+
+void IBLagrangianMultigridPreconditioner::deallocateSolverState()
+{
+    if (!d_is_initialized) return;
+
+    IBTK_TIMER_START(t_deallocate_solver_state);
+
+    PetscErrorCode ierr;
+    ierr = KSPDestroy(&d_coarse_solver);
+    IBTK_CHKERRQ(ierr);
+    for (unsigned int ln = 0; ln < d_A_mats.size(); ++ln)
+    {
+        ierr = MatDestroy(&d_A_mats[ln]);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&d_b_vecs[ln]);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&d_x_vecs[ln]);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&d_r_vecs[ln]);
+        IBTK_CHKERRQ(ierr);
+    }
+    for (unsigned int ln = 0; ln < d_P_mats.size(); ++ln)
+    {
+        ierr = MatDestroy(&d_P_mats[ln]);
+        IBTK_CHKERRQ(ierr);
+    }
+    d_A_mats.clear();
+    d_P_mats.clear();
+    d_b_vecs.clear();
+    d_x_vecs.clear();
+    d_r_vecs.clear();
+    d_block_diag_inv.clear();
+
+    d_is_initialized = false;
+
+    IBTK_TIMER_STOP(t_deallocate_solver_state);
+    return;
+} // deallocateSolverState
+
+bool IBLagrangianMultigridPreconditioner::getIsInitialized() const
+{
+    return d_is_initialized;
+} // getIsInitialized
+
+int IBLagrangianMultigridPreconditioner::getNumberOfLevels() const
+{
+    return static_cast<int>(d_A_mats.size());
+} // getNumberOfLevels
+
+PetscErrorCode IBLagrangianMultigridPreconditioner::apply(Vec b, Vec x)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_is_initialized);
+#endif
+    IBTK_TIMER_START(t_apply);
+    applyVCycle(0, b, x);
+    IBTK_TIMER_STOP(t_apply);
+    return 0;
+} // apply
+
+void IBLagrangianMultigridPreconditioner::setupPCShell(PC pc)
+{
+    PetscErrorCode ierr;
+    ierr = PCSetType(pc, PCSHELL);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCShellSetContext(pc, this);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCShellSetApply(pc, PCApply_SAMRAI);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCShellSetName(pc, d_object_name.c_str());
+    IBTK_CHKERRQ(ierr);
+    return;
+} // setupPCShell
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+PetscErrorCode IBLagrangianMultigridPreconditioner::PCApply_SAMRAI(PC pc, Vec x, Vec y)
+{
+    PetscErrorCode ierr;
+    void* ctx;
+    ierr = PCShellGetContext(pc, &ctx);
+    IBTK_CHKERRQ(ierr);
+    IBLagrangianMultigridPreconditioner* mg_pc = static_cast<IBLagrangianMultigridPreconditioner*>(ctx);
+    ierr = mg_pc->apply(x, y);
+    return ierr;
+} // PCApply_SAMRAI
+
+int IBLagrangianMultigridPreconditioner::computeAggregates(const int ln, std::vector<int>& node_to_aggregate) const
+{
+    PetscErrorCode ierr;
+    Mat A = d_A_mats[ln];
+    PetscInt row_start, row_end;
+    ierr = MatGetOwnershipRange(A, &row_start, &row_end);
+    IBTK_CHKERRQ(ierr);
+    const int node_start = row_start / NDIM;
+    const int num_local_nodes = (row_end - row_start) / NDIM;
+
+    // Compute the Frobenius norms of the locally owned blocks of the operator.
+    // Couplings to nodes owned by other processes are ignored, so that each
+    // process aggregates its nodes independently.
+    std::vector<std::map<int, double> > block_norms(num_local_nodes);
+    std::vector<double> diag_norms(num_local_nodes, 0.0);
+    for (int i = 0; i < num_local_nodes; ++i)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const PetscInt row = row_start + NDIM * i + d;
+            PetscInt ncols;
+            const PetscInt* cols;
+            const PetscScalar* vals;
+            ierr = MatGetRow(A, row, &ncols, &cols, &vals);
+            IBTK_CHKERRQ(ierr);
+            for (PetscInt k = 0; k < ncols; ++k)
+            {
+                if (cols[k] < row_start || cols[k] >= row_end) continue;
+                const int j = cols[k] / NDIM - node_start;
+                block_norms[i][j] += vals[k] * vals[k];
+            }
+            ierr = MatRestoreRow(A, row, &ncols, &cols, &vals);
+            IBTK_CHKERRQ(ierr);
+        }
+        diag_norms[i] = std::sqrt(block_norms[i][i]);
+    }
+
+    // Determine the strongly coupled neighbors of each node.
+    std::vector<std::vector<std::pair<int, double> > > strong_nbrs(num_local_nodes);
+    for (int i = 0; i < num_local_nodes; ++i)
+    {
+        for (std::map<int, double>::const_iterator it = block_norms[i].begin(); it != block_norms[i].end(); ++it)
+        {
+            const int j = it->first;
+            if (j == i) continue;
+            const double a_ij = std::sqrt(it->second);
+            if (a_ij > d_strength_threshold * std::sqrt(diag_norms[i] * diag_norms[j]))
+            {
+                strong_nbrs[i].push_back(std::make_pair(j, a_ij));
+            }
+        }
+    }
+
+    // Phase 1: Form aggregates from nodes whose strongly coupled neighbors are
+    // all unaggregated.
+    node_to_aggregate.assign(num_local_nodes, -1);
+    int num_aggregates = 0;
+    for (int i = 0; i < num_local_nodes; ++i)
+    {
+        if (node_to_aggregate[i] != -1) continue;
+        bool nbrs_are_free = true;
+        for (unsigned int k = 0; k < strong_nbrs[i].size() && nbrs_are_free; ++k)
+        {
+            nbrs_are_free = node_to_aggregate[strong_nbrs[i][k].first] == -1;
+        }
+        if (!nbrs_are_free) continue;
+        node_to_aggregate[i] = num_aggregates;
+        for (unsigned int k = 0; k < strong_nbrs[i].size(); ++k)
+        {
+            node_to_aggregate[strong_nbrs[i][k].first] = num_aggregates;
+        }
+        ++num_aggregates;
+    }
+
+    // Phase 2: Add each remaining node to the aggregate of its most strongly
+    // coupled aggregated neighbor.
+    const std::vector<int> phase_one_aggregates(node_to_aggregate);
+    for (int i = 0; i < num_local_nodes; ++i)
+    {
+        if (node_to_aggregate[i] != -1) continue;
+        double max_a_ij = 0.0;
+        for (unsigned int k = 0; k < strong_nbrs[i].size(); ++k)
+        {
+            const int j = strong_nbrs[i][k].first;
+            const double a_ij = strong_nbrs[i][k].second;
+            if (phase_one_aggregates[j] != -1 && a_ij > max_a_ij)
+            {
+                node_to_aggregate[i] = phase_one_aggregates[j];
+                max_a_ij = a_ij;
+            }
+        }
+    }
+
+    // Phase 3: Form aggregates from any remaining nodes and their unaggregated
+    // strongly coupled neighbors.
+    for (int i = 0; i < num_local_nodes; ++i)
+    {
+        if (node_to_aggregate[i] != -1) continue;
+        node_to_aggregate[i] = num_aggregates;
+        for (unsigned int k = 0; k < strong_nbrs[i].size(); ++k)
+        {
+            const int j = strong_nbrs[i][k].first;
+            if (node_to_aggregate[j] == -1) node_to_aggregate[j] = num_aggregates;
+        }
+        ++num_aggregates;
+    }
+    return num_aggregates;
+} // computeAggregates
+
+void IBLagrangianMultigridPreconditioner::buildProlongation(const int ln,
+                                                            const std::vector<int>& node_to_aggregate,
+                                                            const int num_local_aggregates)
+{
+    PetscErrorCode ierr;
+    Mat A = d_A_mats[ln];
+    PetscInt row_start, row_end;
+    ierr = MatGetOwnershipRange(A, &row_start, &row_end);
+    IBTK_CHKERRQ(ierr);
+    const int num_local_nodes = (row_end - row_start) / NDIM;
+
+    // The tentative prolongation operator injects the translation of each
+    // aggregate into each of its nodes.
+    Mat P_tent;
+    ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                        NDIM * num_local_nodes,
+                        NDIM * num_local_aggregates,
+                        PETSC_DETERMINE,
+                        PETSC_DETERMINE,
+                        1,
+                        NULL,
+                        0,
+                        NULL,
+                        &P_tent);
+    IBTK_CHKERRQ(ierr);
+    PetscInt col_start;
+    ierr = MatGetOwnershipRangeColumn(P_tent, &col_start, NULL);
+    IBTK_CHKERRQ(ierr);
+    for (int i = 0; i < num_local_nodes; ++i)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const PetscInt row = row_start + NDIM * i + d;
+            const PetscInt col = col_start + NDIM * node_to_aggregate[i] + d;
+            ierr = MatSetValue(P_tent, row, col, 1.0, INSERT_VALUES);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    ierr = MatAssemblyBegin(P_tent, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatAssemblyEnd(P_tent, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatSetBlockSize(P_tent, NDIM);
+    IBTK_CHKERRQ(ierr);
+    if (!d_smooth_prolongation)
+    {
+        d_P_mats.push_back(P_tent);
+        return;
+    }
+
+    // Smooth the tentative prolongation operator via a single damped Jacobi
+    // iteration: P = (I - omega*inv(D)*A)*P_tent with omega = 4/(3*rho), in
+    // which rho is the spectral radius of inv(D)*A.
+    Vec D_inv;
+    ierr = MatGetVecs(A, NULL, &D_inv);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatGetDiagonal(A, D_inv);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecReciprocal(D_inv);
+    IBTK_CHKERRQ(ierr);
+    const double omega = 4.0 / (3.0 * estimateSpectralRadius(ln, D_inv));
+    Mat P;
+    ierr = MatMatMult(A, P_tent, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &P);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatDiagonalScale(P, D_inv, NULL);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatAYPX(P, -omega, P_tent, DIFFERENT_NONZERO_PATTERN);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatSetBlockSize(P, NDIM);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&D_inv);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatDestroy(&P_tent);
+    IBTK_CHKERRQ(ierr);
+    d_P_mats.push_back(P);
+    return;
+} // buildProlongation
+
+void IBLagrangianMultigridPreconditioner::buildSmoother(const int ln)
+{
+    PetscErrorCode ierr;
+    Mat A = d_A_mats[ln];
+    PetscInt row_start, row_end;
+    ierr = MatGetOwnershipRange(A, &row_start, &row_end);
+    IBTK_CHKERRQ(ierr);
+    const int num_local_nodes = (row_end - row_start) / NDIM;
+
+    // Extract and invert the diagonal blocks.  Blocks that are (nearly)
+    // singular are replaced by their diagonals.
+    std::vector<double>& block_diag_inv = d_block_diag_inv[ln];
+    block_diag_inv.resize(NDIM * NDIM * num_local_nodes);
+    MatrixNd block, block_inv;
+    for (int i = 0; i < num_local_nodes; ++i)
+    {
+        const PetscInt block_start = row_start + NDIM * i;
+        block.setZero();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const PetscInt row = block_start + d;
+            PetscInt ncols;
+            const PetscInt* cols;
+            const PetscScalar* vals;
+            ierr = MatGetRow(A, row, &ncols, &cols, &vals);
+            IBTK_CHKERRQ(ierr);
+            for (PetscInt k = 0; k < ncols; ++k)
+            {
+                if (cols[k] >= block_start && cols[k] < block_start + static_cast<PetscInt>(NDIM))
+                {
+                    block(d, cols[k] - block_start) = vals[k];
+                }
+            }
+            ierr = MatRestoreRow(A, row, &ncols, &cols, &vals);
+            IBTK_CHKERRQ(ierr);
+        }
+        const double block_norm = block.norm();
+        if (std::abs(block.determinant()) > std::sqrt(std::numeric_limits<double>::epsilon()) *
+                                                 std::pow(block_norm, static_cast<double>(NDIM)))
+        {
+            block_inv = block.inverse();
+        }
+        else
+        {
+            block_inv.setZero();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                if (block(d, d) != 0.0) block_inv(d, d) = 1.0 / block(d, d);
+            }
+        }
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            for (unsigned int e = 0; e < NDIM; ++e)
+            {
+                block_diag_inv[NDIM * NDIM * i + NDIM * d + e] = block_inv(d, e);
+            }
+        }
+    }
+    return;
+} // buildSmoother
+
+void IBLagrangianMultigridPreconditioner::smooth(const int ln,
+                                                 Vec b,
+                                                 Vec x,
+                                                 const int num_sweeps,
+                                                 const bool initial_guess_nonzero)
+{
+    PetscErrorCode ierr;
+    Vec r = d_r_vecs[ln];
+    if (!initial_guess_nonzero)
+    {
+        ierr = VecSet(x, 0.0);
+        IBTK_CHKERRQ(ierr);
+    }
+    const std::vector<double>& block_diag_inv = d_block_diag_inv[ln];
+    const int num_local_nodes = static_cast<int>(block_diag_inv.size()) / (NDIM * NDIM);
+    for (int sweep = 0; sweep < num_sweeps; ++sweep)
+    {
+        // r := b - A*x
+        if (sweep == 0 && !initial_guess_nonzero)
+        {
+            ierr = VecCopy(b, r);
+            IBTK_CHKERRQ(ierr);
+        }
+        else
+        {
+            ierr = MatMult(d_A_mats[ln], x, r);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecAYPX(r, -1.0, b);
+            IBTK_CHKERRQ(ierr);
+        }
+
+        // x := x + omega*inv(D)*r
+        const PetscScalar* r_arr;
+        PetscScalar* x_arr;
+        ierr = VecGetArrayRead(r, &r_arr);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGetArray(x, &x_arr);
+        IBTK_CHKERRQ(ierr);
+        for (int i = 0; i < num_local_nodes; ++i)
+        {
+            const double* const D_inv = &block_diag_inv[NDIM * NDIM * i];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                double dx = 0.0;
+                for (unsigned int e = 0; e < NDIM; ++e)
+                {
+                    dx += D_inv[NDIM * d + e] * r_arr[NDIM * i + e];
+                }
+                x_arr[NDIM * i + d] += d_smoother_damping_factor * dx;
+            }
+        }
+        ierr = VecRestoreArray(x, &x_arr);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecRestoreArrayRead(r, &r_arr);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // smooth
+
+void IBLagrangianMultigridPreconditioner::applyVCycle(const int ln, Vec b, Vec x)
+{
+    PetscErrorCode ierr;
+    if (ln == static_cast<int>(d_A_mats.size()) - 1)
+    {
+        ierr = KSPSolve(d_coarse_solver, b, x);
+        IBTK_CHKERRQ(ierr);
+        return;
+    }
+
+    // Pre-smoothing.
+    smooth(ln, b, x, d_num_pre_sweeps, false);
+
+    // Coarse-grid correction: x := x + P*inv(A_coarse)*P^T*(b - A*x).
+    Vec r = d_r_vecs[ln];
+    ierr = MatMult(d_A_mats[ln], x, r);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecAYPX(r, -1.0, b);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatMultTranspose(d_P_mats[ln], r, d_b_vecs[ln + 1]);
+    IBTK_CHKERRQ(ierr);
+    applyVCycle(ln + 1, d_b_vecs[ln + 1], d_x_vecs[ln + 1]);
+    ierr = MatMultAdd(d_P_mats[ln], d_x_vecs[ln + 1], x, x);
+    IBTK_CHKERRQ(ierr);
+
+    // Post-smoothing.
+    smooth(ln, b, x, d_num_post_sweeps, true);
+    return;
+} // applyVCycle
+
+double IBLagrangianMultigridPreconditioner::estimateSpectralRadius(const int ln, Vec D_inv) const
+{
+    PetscErrorCode ierr;
+    Vec x, y;
+    ierr = VecDuplicate(D_inv, &x);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDuplicate(D_inv, &y);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSetRandom(x, NULL);
+    IBTK_CHKERRQ(ierr);
+    double x_norm;
+    ierr = VecNormalize(x, &x_norm);
+    IBTK_CHKERRQ(ierr);
+    double rho = 0.0;
+    for (int k = 0; k < NUM_POWER_ITERATIONS; ++k)
+    {
+        ierr = MatMult(d_A_mats[ln], x, y);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecPointwiseMult(y, D_inv, y);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecNormalize(y, &rho);
+        IBTK_CHKERRQ(ierr);
+        if (rho == 0.0) break;
+        ierr = VecSwap(x, y);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = VecDestroy(&x);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&y);
+    IBTK_CHKERRQ(ierr);
+    return rho > 0.0 ? rho : 1.0;
+} // estimateSpectralRadius
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
@@ -86,6 +86,7 @@
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
 #include "petscsys.h"
@@ -156,6 +157,7 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_ib_force_fcn_needs_init = true;
     d_ib_source_fcn = NULL;
     d_ib_source_fcn_needs_init = true;
+    d_node_distribution_revision = -1;
     d_normalize_source_strength = false;
     d_post_processor = NULL;
     d_silo_writer = NULL;
@@ -166,6 +168,10 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_ghosts = std::max(LEInteractor::getMinimumGhostWidth(d_interp_kernel_fcn),
                         LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
     d_do_log = false;
+    d_lag_restart_dirname = "";
+    d_lag_restart_restore_num = -1;
+    d_lag_restart_async_writes = false;
+    d_lag_restart_max_pending_bytes = 0;
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -186,6 +192,14 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_l_data_manager = LDataManager::getManager(
         d_object_name + "::LDataManager", d_interp_kernel_fcn, d_spread_kernel_fcn, d_ghosts, d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    if (d_lag_restart_async_writes)
+    {
+        d_l_data_manager->setAsynchronousLagrangianRestartWrites(true, d_lag_restart_max_pending_bytes);
+    }
+    if (d_lag_restart_restore_num >= 0)
+    {
+        d_l_data_manager->setInitialLagrangianRestartData(d_lag_restart_dirname, d_lag_restart_restore_num);
+    }
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -224,6 +238,7 @@ IBMethod::~IBMethod()
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
         d_registered_for_restart = false;
     }
+    if (d_lag_restart_async_writes) d_l_data_manager->waitForLagrangianRestartWrites();
     if (d_force_jac)
     {
         PetscErrorCode ierr;
@@ -722,6 +737,67 @@ void IBMethod::computeLinearizedLagrangianForce(Vec& X_vec, const double /*data_
     return;
 } // computeLinearizedLagrangianForce
 
+bool IBMethod::computeLinearizedLagrangianForceJacobian(Mat& A_mat, const double data_time)
+{
+    if (!d_ib_force_fcn) return false;
+
+    PetscErrorCode ierr;
+    const int level_num = d_hierarchy->getFinestLevelNumber();
+    if (!A_mat)
+    {
+        // The force object computes the number of nonzero blocks in each row
+        // of the (blocked) Jacobian; each node contributes NDIM rows.
+        const int num_local_nodes = static_cast<int>(d_l_data_manager->getNumberOfLocalNodes(level_num));
+        const int num_nonlocal_nodes =
+            static_cast<int>(d_l_data_manager->getNumberOfNodes(level_num)) - num_local_nodes;
+        std::vector<int> d_nnz(NDIM * num_local_nodes, 0), o_nnz(NDIM * num_local_nodes, 0);
+        d_ib_force_fcn->computeLagrangianForceJacobianNonzeroStructure(
+            d_nnz, o_nnz, d_hierarchy, level_num, d_l_data_manager);
+        std::vector<int> d_bnnz(num_local_nodes), o_bnnz(num_local_nodes);
+        for (int k = 0; k < num_local_nodes; ++k)
+        {
+            d_bnnz[k] = std::min(d_nnz[NDIM * k], num_local_nodes);
+            o_bnnz[k] = std::min(o_nnz[NDIM * k], num_nonlocal_nodes);
+        }
+        ierr = MatCreateBAIJ(PETSC_COMM_WORLD,
+                             NDIM,
+                             NDIM * num_local_nodes,
+                             NDIM * num_local_nodes,
+                             PETSC_DETERMINE,
+                             PETSC_DETERMINE,
+                             PETSC_DEFAULT,
+                             num_local_nodes > 0 ? &d_bnnz[0] : NULL,
+                             PETSC_DEFAULT,
+                             num_local_nodes > 0 ? &o_bnnz[0] : NULL,
+                             &A_mat);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatSetOption(A_mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
+        IBTK_CHKERRQ(ierr);
+    }
+    else
+    {
+        ierr = MatZeroEntries(A_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // NOTE: computeLinearizedLagrangianForce() evaluates 0.5*dF/dX, and the
+    // linearized force does not depend on the velocity.
+    std::vector<Pointer<LData> >* X_jac_data;
+    bool* X_jac_needs_ghost_fill;
+    getLinearizedPositionData(&X_jac_data, &X_jac_needs_ghost_fill);
+    d_ib_force_fcn->computeLagrangianForceJacobian(A_mat,
+                                                   MAT_FINAL_ASSEMBLY,
+                                                   0.5,
+                                                   (*X_jac_data)[level_num],
+                                                   0.0,
+                                                   Pointer<LData>(NULL),
+                                                   d_hierarchy,
+                                                   level_num,
+                                                   data_time,
+                                                   d_l_data_manager);
+    return true;
+} // computeLinearizedLagrangianForceJacobian
+
 void IBMethod::spreadForce(const int f_data_idx,
                            RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                            const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
@@ -1187,6 +1263,29 @@ void IBMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy
     return;
 } // initializePatchHierarchy
 
+void IBMethod::postprocessInitializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                   const double init_data_time,
+                                                   const bool initial_time)
+{
+    if (!initial_time || d_lag_restart_restore_num < 0) return;
+
+    // Overwrite the initial values of all of the Lagrangian data by the values
+    // read from the decomposition-independent restart file that also provided
+    // the initial node positions and node data, and continue the time step
+    // numbering from the restart number.
+    const double restart_time =
+        d_l_data_manager->readLagrangianRestartData(d_lag_restart_dirname, d_lag_restart_restore_num);
+    if (!MathUtilities<double>::equalEps(restart_time, init_data_time))
+    {
+        TBOX_ERROR(d_object_name << "::postprocessInitializePatchHierarchy():\n"
+                                 << "  Lagrangian restart data were written at time " << restart_time
+                                 << " but the simulation is being initialized at time " << init_data_time << "\n"
+                                 << "  set the start time of the integrator to " << restart_time << std::endl);
+    }
+    resetIntegratorStep(d_lag_restart_restore_num);
+    return;
+} // postprocessInitializePatchHierarchy
+
 void IBMethod::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balancer, int workload_data_idx)
 {
 #if !defined(NDEBUG)
@@ -1198,6 +1297,12 @@ void IBMethod::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balancer,
     return;
 } // registerLoadBalancer
 
+void IBMethod::registerWorkloadCostModel(Pointer<WorkloadCostModel> workload_cost_model)
+{
+    d_l_data_manager->registerWorkloadCostModel(workload_cost_model);
+    return;
+} // registerWorkloadCostModel
+
 void IBMethod::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/, int /*workload_data_idx*/)
 {
     d_l_data_manager->updateWorkloadEstimates();
@@ -1263,9 +1368,15 @@ void IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
         X_data[ln]->restoreArrays();
     }
 
-    // Indicate that the force and source strategies need to be re-initialized.
-    d_ib_force_fcn_needs_init = true;
-    d_ib_source_fcn_needs_init = true;
+    // Indicate that the force and source strategies need to be re-initialized
+    // if the distribution of the Lagrangian nodes has changed.
+    const int node_distribution_revision = d_l_data_manager->getNodeDistributionRevision();
+    if (node_distribution_revision != d_node_distribution_revision)
+    {
+        d_ib_force_fcn_needs_init = true;
+        d_ib_source_fcn_needs_init = true;
+        d_node_distribution_revision = node_distribution_revision;
+    }
     return;
 } // endDataRedistribution
 
@@ -1422,6 +1533,14 @@ void IBMethod::putToDatabase(Pointer<Database> db)
         }
     }
     db->putBool("d_normalize_source_strength", d_normalize_source_strength);
+
+    // Also write the Lagrangian data in a form that may be read on any number
+    // of processes.
+    if (!d_lag_restart_dirname.empty())
+    {
+        d_l_data_manager->writeLagrangianRestartData(
+            d_lag_restart_dirname, d_ib_solver->getIntegratorStep(), d_ib_solver->getIntegratorTime());
+    }
     return;
 } // putToDatabase
 
@@ -1788,6 +1907,21 @@ void IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
 
         if (db->isBool("normalize_source_strength"))
             d_normalize_source_strength = db->getBool("normalize_source_strength");
+
+        if (db->keyExists("lagrangian_restart_restore_number"))
+            d_lag_restart_restore_num = db->getInteger("lagrangian_restart_restore_number");
+    }
+    if (db->keyExists("lagrangian_restart_dirname"))
+        d_lag_restart_dirname = db->getString("lagrangian_restart_dirname");
+    if (db->keyExists("lagrangian_restart_async_writes"))
+        d_lag_restart_async_writes = db->getBool("lagrangian_restart_async_writes");
+    if (db->keyExists("lagrangian_restart_max_pending_bytes"))
+        d_lag_restart_max_pending_bytes = static_cast<size_t>(db->getDouble("lagrangian_restart_max_pending_bytes"));
+    if (d_lag_restart_restore_num >= 0 && d_lag_restart_dirname.empty())
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  lagrangian_restart_restore_number requires lagrangian_restart_dirname"
+                                 << std::endl);
     }
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
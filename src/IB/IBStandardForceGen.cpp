@@ -122,6 +122,18 @@ void resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+inline int getGlobalPETScNodeIndex(const int idx,
+                                   const int global_node_offset,
+                                   const int num_local_nodes,
+                                   const std::vector<int>& nonlocal_petsc_idxs)
+{
+    // NOTE: Cached PETSc indices are local (ghosted) indices that correspond to
+    // a data depth of NDIM.
+    const int local_idx = idx / NDIM;
+    if (local_idx < num_local_nodes) return global_node_offset + local_idx;
+    return nonlocal_petsc_idxs[local_idx - num_local_nodes];
+} // getGlobalPETScNodeIndex
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -171,6 +183,7 @@ void IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM>
     d_X_ghost_data.resize(new_size);
     d_F_ghost_data.resize(new_size);
     d_dX_data.resize(new_size);
+    d_nonlocal_petsc_idxs.resize(new_size);
     d_is_initialized.resize(new_size, false);
 
     // Keep track of all of the nonlocal PETSc indices required to compute the
@@ -187,6 +200,7 @@ void IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM>
 
     // Put the nonlocal PETSc indices into a vector.
     std::vector<int> nonlocal_petsc_idxs(nonlocal_petsc_idx_set.begin(), nonlocal_petsc_idx_set.end());
+    d_nonlocal_petsc_idxs[level_number] = nonlocal_petsc_idxs;
 
     // Put all cached PETSc node indices into local form.
     const int global_node_offset = l_data_manager->getGlobalNodeOffset(level_number);
@@ -331,6 +345,7 @@ IBStandardForceGen::computeLagrangianForceJacobianNonzeroStructure(std::vector<i
     // Determine the global node offset and the number of local nodes.
     const int global_node_offset = l_data_manager->getGlobalNodeOffset(level_number);
     const int num_local_nodes = l_data_manager->getNumberOfLocalNodes(level_number);
+    const std::vector<int>& nonlocal_petsc_idxs = d_nonlocal_petsc_idxs[level_number];
 
     // Determine the non-zero structure for the matrix used to store the
     // Jacobian of the force.
@@ -359,14 +374,16 @@ IBStandardForceGen::computeLagrangianForceJacobianNonzeroStructure(std::vector<i
         const std::vector<int>& petsc_slave_node_idxs = d_spring_data[level_number].petsc_slave_node_idxs;
         for (unsigned int k = 0; k < petsc_mastr_node_idxs.size(); ++k)
         {
-            const int& mastr_idx = petsc_mastr_node_idxs[k];
-            const int& slave_idx = petsc_slave_node_idxs[k];
+            const int mastr_idx = getGlobalPETScNodeIndex(
+                petsc_mastr_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
+            const int slave_idx = getGlobalPETScNodeIndex(
+                petsc_slave_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
 
             const bool slave_is_local =
                 (slave_idx >= global_node_offset && slave_idx < global_node_offset + num_local_nodes);
 
             static const int N = 2;
-            const int idxs[N] = { mastr_idx / NDIM, slave_idx / NDIM };
+            const int idxs[N] = { mastr_idx, slave_idx };
             const double vals[N] = { 1.0, 1.0 };
 
             if (slave_is_local)
@@ -389,9 +406,12 @@ IBStandardForceGen::computeLagrangianForceJacobianNonzeroStructure(std::vector<i
         const std::vector<int>& petsc_prev_node_idxs = d_beam_data[level_number].petsc_prev_node_idxs;
         for (unsigned int k = 0; k < petsc_mastr_node_idxs.size(); ++k)
         {
-            const int& mastr_idx = petsc_mastr_node_idxs[k];
-            const int& next_idx = petsc_next_node_idxs[k];
-            const int& prev_idx = petsc_prev_node_idxs[k];
+            const int mastr_idx = getGlobalPETScNodeIndex(
+                petsc_mastr_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
+            const int next_idx = getGlobalPETScNodeIndex(
+                petsc_next_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
+            const int prev_idx = getGlobalPETScNodeIndex(
+                petsc_prev_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
 
             const bool next_is_local =
                 (next_idx >= global_node_offset && next_idx < global_node_offset + num_local_nodes);
@@ -401,7 +421,7 @@ IBStandardForceGen::computeLagrangianForceJacobianNonzeroStructure(std::vector<i
             if (next_is_local && prev_is_local)
             {
                 static const int d_N = 3;
-                const int d_idxs[d_N] = { mastr_idx / NDIM, next_idx / NDIM, prev_idx / NDIM };
+                const int d_idxs[d_N] = { mastr_idx, next_idx, prev_idx };
                 const double d_vals[d_N] = { 2.0, 2.0, 2.0 };
                 ierr = VecSetValues(d_nnz_vec, d_N, d_idxs, d_vals, ADD_VALUES);
                 IBTK_CHKERRQ(ierr);
@@ -409,13 +429,13 @@ IBStandardForceGen::computeLagrangianForceJacobianNonzeroStructure(std::vector<i
             else if (next_is_local && (!prev_is_local))
             {
                 static const int d_N = 2;
-                const int d_idxs[d_N] = { mastr_idx / NDIM, next_idx / NDIM };
+                const int d_idxs[d_N] = { mastr_idx, next_idx };
                 const double d_vals[d_N] = { 1.0, 1.0 };
                 ierr = VecSetValues(d_nnz_vec, d_N, d_idxs, d_vals, ADD_VALUES);
                 IBTK_CHKERRQ(ierr);
 
                 static const int o_N = 3;
-                const int o_idxs[o_N] = { mastr_idx / NDIM, next_idx / NDIM, prev_idx / NDIM };
+                const int o_idxs[o_N] = { mastr_idx, next_idx, prev_idx };
                 const double o_vals[o_N] = { 1.0, 1.0, 2.0 };
                 ierr = VecSetValues(o_nnz_vec, o_N, o_idxs, o_vals, ADD_VALUES);
                 IBTK_CHKERRQ(ierr);
@@ -423,13 +443,13 @@ IBStandardForceGen::computeLagrangianForceJacobianNonzeroStructure(std::vector<i
             else if ((!next_is_local) && prev_is_local)
             {
                 static const int d_N = 2;
-                const int d_idxs[d_N] = { mastr_idx / NDIM, prev_idx / NDIM };
+                const int d_idxs[d_N] = { mastr_idx, prev_idx };
                 const double d_vals[d_N] = { 1.0, 1.0 };
                 ierr = VecSetValues(d_nnz_vec, d_N, d_idxs, d_vals, ADD_VALUES);
                 IBTK_CHKERRQ(ierr);
 
                 static const int o_N = 3;
-                const int o_idxs[o_N] = { mastr_idx / NDIM, next_idx / NDIM, prev_idx / NDIM };
+                const int o_idxs[o_N] = { mastr_idx, next_idx, prev_idx };
                 const double o_vals[o_N] = { 1.0, 2.0, 1.0 };
                 ierr = VecSetValues(o_nnz_vec, o_N, o_idxs, o_vals, ADD_VALUES);
                 IBTK_CHKERRQ(ierr);
@@ -442,13 +462,13 @@ IBStandardForceGen::computeLagrangianForceJacobianNonzeroStructure(std::vector<i
                 // on different processors, and for the case that the previous
                 // and next nodes are on the same processor.
                 static const int d_N = 2;
-                const int d_idxs[d_N] = { next_idx / NDIM, prev_idx / NDIM };
+                const int d_idxs[d_N] = { next_idx, prev_idx };
                 const double d_vals[d_N] = { 2.0, 2.0 };
                 ierr = VecSetValues(d_nnz_vec, d_N, d_idxs, d_vals, ADD_VALUES);
                 IBTK_CHKERRQ(ierr);
 
                 static const int o_N = 3;
-                const int o_idxs[o_N] = { mastr_idx / NDIM, next_idx / NDIM, prev_idx / NDIM };
+                const int o_idxs[o_N] = { mastr_idx, next_idx, prev_idx };
                 const double o_vals[o_N] = { 2.0, 2.0, 2.0 };
                 ierr = VecSetValues(o_nnz_vec, o_N, o_idxs, o_vals, ADD_VALUES);
                 IBTK_CHKERRQ(ierr);
@@ -514,6 +534,23 @@ void IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
 #endif
 
     int ierr;
+
+    // Initialize ghost data.
+    Pointer<LData> X_ghost_data = d_X_ghost_data[level_number];
+    Pointer<LData> dX_data = d_dX_data[level_number];
+    ierr = VecAXPBYPCZ(X_ghost_data->getVec(), 1.0, 1.0, 0.0, X_data->getVec(), dX_data->getVec());
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateBegin(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+
+    // The cached PETSc indices are local indices, whereas the matrix is
+    // indexed by global block (i.e., node) indices.
+    const int global_node_offset = l_data_manager->getGlobalNodeOffset(level_number);
+    const int num_local_nodes = l_data_manager->getNumberOfLocalNodes(level_number);
+    const std::vector<int>& nonlocal_petsc_idxs = d_nonlocal_petsc_idxs[level_number];
+
     { // Spring forces.
 
         const std::vector<int>& lag_mastr_node_idxs = d_spring_data[level_number].lag_mastr_node_idxs;
@@ -523,7 +560,7 @@ void IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
         const std::vector<SpringForceFcnPtr>& force_fcns = d_spring_data[level_number].force_fcns;
         const std::vector<SpringForceDerivFcnPtr>& force_deriv_fcns = d_spring_data[level_number].force_deriv_fcns;
         const std::vector<const double*>& parameters = d_spring_data[level_number].parameters;
-        const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+        const double* const X_node = X_ghost_data->getGhostedLocalFormVecArray()->data();
         MatrixNd dF_dX;
         Vector D;
         double R, T, dT_dR, eps;
@@ -564,9 +601,11 @@ void IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
                 }
             }
 
-            // Change the indices to block indices.
-            petsc_mastr_idx /= NDIM;
-            petsc_slave_idx /= NDIM;
+            // Change the indices to global block indices.
+            petsc_mastr_idx =
+                getGlobalPETScNodeIndex(petsc_mastr_idx, global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
+            petsc_slave_idx =
+                getGlobalPETScNodeIndex(petsc_slave_idx, global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
 
             // Accumulate the off-diagonal parts of the matrix.
             ierr = MatSetValuesBlocked(J_mat, 1, &petsc_mastr_idx, 1, &petsc_slave_idx, dF_dX.data(), ADD_VALUES);
@@ -596,9 +635,12 @@ void IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
         MatrixNd dF_dX(MatrixNd::Zero());
         for (unsigned int k = 0; k < petsc_mastr_node_idxs.size(); ++k)
         {
-            const int petsc_mastr_idx = petsc_mastr_node_idxs[k] / NDIM; // block indices
-            const int petsc_next_idx = petsc_next_node_idxs[k] / NDIM;
-            const int petsc_prev_idx = petsc_prev_node_idxs[k] / NDIM;
+            const int petsc_mastr_idx = getGlobalPETScNodeIndex(
+                petsc_mastr_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
+            const int petsc_next_idx = getGlobalPETScNodeIndex(
+                petsc_next_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
+            const int petsc_prev_idx = getGlobalPETScNodeIndex(
+                petsc_prev_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
             const double& bend = *rigidities[k];
 
             for (unsigned int alpha = 0; alpha < NDIM; ++alpha)
@@ -644,7 +686,7 @@ void IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
         MatrixNd dF_dX(MatrixNd::Zero());
         for (unsigned int k = 0; k < petsc_node_idxs.size(); ++k)
         {
-            const int petsc_node_idx = petsc_node_idxs[k] / NDIM; // block index
+            const int petsc_node_idx = global_node_offset + petsc_node_idxs[k] / NDIM; // block index
             const double& K = *kappa[k];
             const double& E = *eta[k];
             for (unsigned int alpha = 0; alpha < NDIM; ++alpha)
@@ -656,6 +698,8 @@ void IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
         }
     }
 
+    X_ghost_data->restoreArrays();
+
     // Assemble the matrix.
     ierr = MatAssemblyBegin(J_mat, assembly_type);
     IBTK_CHKERRQ(ierr);
@@ -53,6 +53,7 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -218,12 +219,26 @@ void IBStrategy::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > /*hiera
     return;
 } // initializePatchHierarchy
 
+void IBStrategy::postprocessInitializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                     double /*init_data_time*/,
+                                                     bool /*initial_time*/)
+{
+    // intentionally blank
+    return;
+} // postprocessInitializePatchHierarchy
+
 void IBStrategy::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > /*load_balancer*/, int /*workload_data_idx*/)
 {
     // intentionally blank
     return;
 } // registerLoadBalancer
 
+void IBStrategy::registerWorkloadCostModel(Pointer<WorkloadCostModel> /*workload_cost_model*/)
+{
+    // intentionally blank
+    return;
+} // registerWorkloadCostModel
+
 void IBStrategy::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/, int /*workload_data_idx*/)
 {
     // intentionally blank
@@ -291,6 +306,15 @@ INSHierarchyIntegrator* IBStrategy::getINSHierarchyIntegrator() const
     return d_ib_solver->d_ins_hier_integrator;
 } // getINSHierarchyIntegrator
 
+void IBStrategy::resetIntegratorStep(const int integrator_step)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_ib_solver);
+#endif
+    d_ib_solver->d_integrator_step = integrator_step;
+    return;
+} // resetIntegratorStep
+
 Pointer<HierarchyDataOpsReal<NDIM, double> > IBStrategy::getVelocityHierarchyDataOps() const
 {
 #if !defined(NDEBUG)
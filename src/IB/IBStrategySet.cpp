@@ -44,6 +44,7 @@
 #include "ibamr/IBStrategy.h"
 #include "ibamr/IBStrategySet.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/WorkloadCostModel.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -333,6 +334,18 @@ void IBStrategySet::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hier
     return;
 } // initializePatchHierarchy
 
+void IBStrategySet::postprocessInitializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                        double init_data_time,
+                                                        bool initial_time)
+{
+    for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
+         ++cit)
+    {
+        (*cit)->postprocessInitializePatchHierarchy(hierarchy, init_data_time, initial_time);
+    }
+    return;
+} // postprocessInitializePatchHierarchy
+
 void IBStrategySet::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balancer, int workload_data_idx)
 {
     for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
@@ -343,6 +356,16 @@ void IBStrategySet::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balan
     return;
 } // registerLoadBalancer
 
+void IBStrategySet::registerWorkloadCostModel(Pointer<WorkloadCostModel> workload_cost_model)
+{
+    for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
+         ++cit)
+    {
+        (*cit)->registerWorkloadCostModel(workload_cost_model);
+    }
+    return;
+} // registerWorkloadCostModel
+
 void IBStrategySet::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > hierarchy, int workload_data_idx)
 {
     for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
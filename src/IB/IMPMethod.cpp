@@ -37,6 +37,7 @@
 #include <stddef.h>
 #include <algorithm>
 #include <limits>
+#include <map>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -85,6 +86,7 @@
 #include "ibtk/LSetData.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/libmesh_utilities.h"
 #include "libmesh/tensor_value.h"
 #include "libmesh/type_tensor.h"
@@ -795,17 +797,27 @@ void IMPMethod::spreadForce(const int f_data_idx,
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(sc_data);
 
-    // Make a copy of the Eulerian data.
-    const int f_copy_data_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
+    // If physical boundary conditions are to be applied to the spread values,
+    // accumulate the spread values in persistent scratch data on the levels
+    // that contain Lagrangian data.  Otherwise, spread directly into the
+    // Eulerian data.
+    int f_spread_data_idx = f_data_idx;
+    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops;
+    int lag_coarsest_ln = finest_ln + 1, lag_finest_ln = coarsest_ln - 1;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(f_copy_data_idx);
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        lag_coarsest_ln = std::min(lag_coarsest_ln, ln);
+        lag_finest_ln = std::max(lag_finest_ln, ln);
+    }
+    if (f_phys_bdry_op && lag_coarsest_ln <= lag_finest_ln)
+    {
+        f_spread_data_idx =
+            d_spread_scratch_data_cache.getScratchDataIndex(f_data_idx, d_hierarchy, lag_coarsest_ln, lag_finest_ln);
+        f_data_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
+        f_data_ops->resetLevels(lag_coarsest_ln, lag_finest_ln);
+        f_data_ops->setToScalar(f_spread_data_idx, 0.0, /*interior_only*/ false);
     }
-    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops =
-        HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
 
     // Synchronize Lagrangian values.
     std::vector<Pointer<LData> >* X_data;
@@ -813,13 +825,17 @@ void IMPMethod::spreadForce(const int f_data_idx,
     getPositionData(&X_data, &X_needs_ghost_fill, data_time);
     for (int ln = finest_ln; ln >= coarsest_ln; --ln)
     {
-        if (*X_needs_ghost_fill && (*X_data)[ln]) (*X_data)[ln]->beginGhostUpdate();
-        if (d_tau_data[ln]) d_tau_data[ln]->beginGhostUpdate();
+        std::vector<Pointer<LData> > ghost_update_data;
+        if (*X_needs_ghost_fill) ghost_update_data.push_back((*X_data)[ln]);
+        ghost_update_data.push_back(d_tau_data[ln]);
+        d_l_data_manager->beginGhostUpdate(ghost_update_data, ln);
     }
     for (int ln = finest_ln; ln >= coarsest_ln; --ln)
     {
-        if (*X_needs_ghost_fill && (*X_data)[ln]) (*X_data)[ln]->endGhostUpdate();
-        if (d_tau_data[ln]) d_tau_data[ln]->endGhostUpdate();
+        std::vector<Pointer<LData> > ghost_update_data;
+        if (*X_needs_ghost_fill) ghost_update_data.push_back((*X_data)[ln]);
+        ghost_update_data.push_back(d_tau_data[ln]);
+        d_l_data_manager->endGhostUpdate(ghost_update_data, ln);
     }
     *X_needs_ghost_fill = false;
 
@@ -834,7 +850,7 @@ void IMPMethod::spreadForce(const int f_data_idx,
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_data_idx);
+            Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_spread_data_idx);
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_l_data_manager->getLNodePatchDescriptorIndex());
             const Box<NDIM>& patch_box = patch->getBox();
             Box<NDIM> side_boxes[NDIM];
@@ -921,21 +937,17 @@ void IMPMethod::spreadForce(const int f_data_idx,
             }
             if (f_phys_bdry_op)
             {
-                f_phys_bdry_op->setPatchDataIndex(f_data_idx);
+                f_phys_bdry_op->setPatchDataIndex(f_spread_data_idx);
                 f_phys_bdry_op->accumulateFromPhysicalBoundaryData(*patch, data_time, f_data->getGhostCellWidth());
             }
         }
     }
 
     // Accumulate data.
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    if (f_spread_data_idx != f_data_idx)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(f_copy_data_idx);
+        f_data_ops->add(f_data_idx, f_data_idx, f_spread_data_idx);
     }
-    var_db->removePatchDataIndex(f_copy_data_idx);
     return;
 } // spreadForce
 
@@ -980,6 +992,12 @@ void IMPMethod::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balancer,
     return;
 } // registerLoadBalancer
 
+void IMPMethod::registerWorkloadCostModel(Pointer<WorkloadCostModel> workload_cost_model)
+{
+    d_l_data_manager->registerWorkloadCostModel(workload_cost_model);
+    return;
+} // registerWorkloadCostModel
+
 void IMPMethod::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/, int /*workload_data_idx*/)
 {
     d_l_data_manager->updateWorkloadEstimates();
@@ -1071,6 +1089,9 @@ void IMPMethod::resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > h
     d_l_data_manager->setPatchHierarchy(hierarchy);
     d_l_data_manager->setPatchLevels(0, finest_hier_level);
     d_l_data_manager->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+
+    // Deallocate any spreading scratch data; it is reallocated on demand.
+    d_spread_scratch_data_cache.deallocateScratchData();
     return;
 } // resetHierarchyConfiguration
 
@@ -391,18 +391,25 @@ void PenaltyIBMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hi
             Pointer<LData> K_data = d_l_data_manager->createLData("K", ln, 1, /*manage_data*/ true);
             Pointer<LData> Y_data = d_l_data_manager->createLData("Y", ln, NDIM, /*manage_data*/ true);
             Pointer<LData> V_data = d_l_data_manager->createLData("V", ln, NDIM, /*manage_data*/ true);
+            // NOTE: The initializer assigns the mass data according to the
+            // initial configuration of the structure.  When that configuration
+            // is replaced by Lagrangian restart data, these values are instead
+            // restored by postprocessInitializePatchHierarchy().
             static const int global_index_offset = 0;
             static const int local_index_offset = 0;
-            d_l_initializer->initializeMassDataOnPatchLevel(global_index_offset,
-                                                            local_index_offset,
-                                                            M_data,
-                                                            K_data,
-                                                            d_hierarchy,
-                                                            ln,
-                                                            init_data_time,
-                                                            can_be_refined,
-                                                            initial_time,
-                                                            d_l_data_manager);
+            if (d_lag_restart_restore_num < 0)
+            {
+                d_l_initializer->initializeMassDataOnPatchLevel(global_index_offset,
+                                                                local_index_offset,
+                                                                M_data,
+                                                                K_data,
+                                                                d_hierarchy,
+                                                                ln,
+                                                                init_data_time,
+                                                                can_be_refined,
+                                                                initial_time,
+                                                                d_l_data_manager);
+            }
             if (d_silo_writer)
             {
                 d_silo_writer->registerVariableData("M", M_data, ln);
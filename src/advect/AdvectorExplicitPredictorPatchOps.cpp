@@ -35,6 +35,7 @@
 #include <limits>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "ArrayData.h"
 #include "Box.h"
@@ -60,11 +61,12 @@
 #define ADVECT_STABLEDT_FC IBAMR_FC_FUNC_(advect_stabledt2d, ADVECT_STABLEDT2D)
 #define GODUNOV_INCOMPRESSIBILITY_FIX_FC                                                                               \
     IBAMR_FC_FUNC_(godunov_incompressibility_fix2d, GODUNOV_INCOMPRESSIBILITY_FIX2D)
-#define ADVECT_PREDICT_FC IBAMR_FC_FUNC_(advect_predict2d, ADVECT_PREDICT2D)
-#define ADVECT_PREDICT_WITH_SOURCE_FC IBAMR_FC_FUNC_(advect_predict_with_source2d, ADVECT_PREDICT_WITH_SOURCE2D)
-#define ADVECT_PREDICT_PPM_FC IBAMR_FC_FUNC_(advect_predict_ppm2d, ADVECT_PREDICT_PPM2D)
+#define ADVECT_PREDICT_FC IBAMR_FC_FUNC_(advect_predict_depths2d, ADVECT_PREDICT_DEPTHS2D)
+#define ADVECT_PREDICT_WITH_SOURCE_FC                                                                                  \
+    IBAMR_FC_FUNC_(advect_predict_with_source_depths2d, ADVECT_PREDICT_WITH_SOURCE_DEPTHS2D)
+#define ADVECT_PREDICT_PPM_FC IBAMR_FC_FUNC_(advect_predict_ppm_depths2d, ADVECT_PREDICT_PPM_DEPTHS2D)
 #define ADVECT_PREDICT_PPM_WITH_SOURCE_FC                                                                              \
-    IBAMR_FC_FUNC_(advect_predict_ppm_with_source2d, ADVECT_PREDICT_PPM_WITH_SOURCE2D)
+    IBAMR_FC_FUNC_(advect_predict_ppm_with_source_depths2d, ADVECT_PREDICT_PPM_WITH_SOURCE_DEPTHS2D)
 #endif
 
 #if (NDIM == 3)
@@ -73,11 +75,12 @@
 #define ADVECT_STABLEDT_FC IBAMR_FC_FUNC_(advect_stabledt3d, ADVECT_STABLEDT3D)
 #define GODUNOV_INCOMPRESSIBILITY_FIX_FC                                                                               \
     IBAMR_FC_FUNC_(godunov_incompressibility_fix3d, GODUNOV_INCOMPRESSIBILITY_FIX3D)
-#define ADVECT_PREDICT_FC IBAMR_FC_FUNC_(advect_predict3d, ADVECT_PREDICT3D)
-#define ADVECT_PREDICT_WITH_SOURCE_FC IBAMR_FC_FUNC_(advect_predict_with_source3d, ADVECT_PREDICT_WITH_SOURCE3D)
-#define ADVECT_PREDICT_PPM_FC IBAMR_FC_FUNC_(advect_predict_ppm3d, ADVECT_PREDICT_PPM3D)
+#define ADVECT_PREDICT_FC IBAMR_FC_FUNC_(advect_predict_depths3d, ADVECT_PREDICT_DEPTHS3D)
+#define ADVECT_PREDICT_WITH_SOURCE_FC                                                                                  \
+    IBAMR_FC_FUNC_(advect_predict_with_source_depths3d, ADVECT_PREDICT_WITH_SOURCE_DEPTHS3D)
+#define ADVECT_PREDICT_PPM_FC IBAMR_FC_FUNC_(advect_predict_ppm_depths3d, ADVECT_PREDICT_PPM_DEPTHS3D)
 #define ADVECT_PREDICT_PPM_WITH_SOURCE_FC                                                                              \
-    IBAMR_FC_FUNC_(advect_predict_ppm_with_source3d, ADVECT_PREDICT_PPM_WITH_SOURCE3D)
+    IBAMR_FC_FUNC_(advect_predict_ppm_with_source_depths3d, ADVECT_PREDICT_PPM_WITH_SOURCE_DEPTHS3D)
 #endif
 
 extern "C" {
@@ -241,6 +244,7 @@ void GODUNOV_INCOMPRESSIBILITY_FIX_FC(const int&,
 void ADVECT_PREDICT_FC(const double*,
                        const double&,
                        const int&,
+                       const int&,
 #if (NDIM == 3)
                        const unsigned int&,
 #endif
@@ -298,6 +302,7 @@ void ADVECT_PREDICT_FC(const double*,
 void ADVECT_PREDICT_WITH_SOURCE_FC(const double*,
                                    const double&,
                                    const int&,
+                                   const int&,
 #if (NDIM == 3)
                                    const unsigned int&,
 #endif
@@ -364,6 +369,7 @@ void ADVECT_PREDICT_WITH_SOURCE_FC(const double*,
 void ADVECT_PREDICT_PPM_FC(const double*,
                            const double&,
                            const int&,
+                           const int&,
 #if (NDIM == 3)
                            const unsigned int&,
 #endif
@@ -427,6 +433,7 @@ void ADVECT_PREDICT_PPM_FC(const double*,
 void ADVECT_PREDICT_PPM_WITH_SOURCE_FC(const double*,
                                        const double&,
                                        const int&,
+                                       const int&,
 #if (NDIM == 3)
                                        const unsigned int&,
 #endif
@@ -772,6 +779,17 @@ void AdvectorExplicitPredictorPatchOps::predictValueWithSourceTerm(FaceData<NDIM
     return;
 } // predictValueWithSourceTerm
 
+void AdvectorExplicitPredictorPatchOps::predictValues(const std::vector<FaceData<NDIM, double>*>& q_half,
+                                                      const FaceData<NDIM, double>& u_ADV,
+                                                      const std::vector<const CellData<NDIM, double>*>& Q,
+                                                      const std::vector<const CellData<NDIM, double>*>& F,
+                                                      const Patch<NDIM>& patch,
+                                                      const double dt) const
+{
+    predict(q_half, u_ADV, Q, F, patch, dt);
+    return;
+} // predictValues
+
 void AdvectorExplicitPredictorPatchOps::predictNormalVelocity(FaceData<NDIM, double>& v_half,
                                                               const FaceData<NDIM, double>& u_ADV,
                                                               const CellData<NDIM, double>& V,
@@ -938,174 +956,12 @@ void AdvectorExplicitPredictorPatchOps::predict(FaceData<NDIM, double>& q_half,
                                                 const Patch<NDIM>& patch,
                                                 const double dt) const
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(q_half.getDepth() == Q.getDepth());
-    TBOX_ASSERT(q_half.getBox() == patch.getBox());
-
-    TBOX_ASSERT(u_ADV.getDepth() == 1);
-    TBOX_ASSERT(u_ADV.getBox() == patch.getBox());
-
-    TBOX_ASSERT(Q.getBox() == patch.getBox());
-#endif
-    const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch.getPatchGeometry();
-    const double* const dx = patch_geom->getDx();
-
-    const Index<NDIM>& ilower = patch.getBox().lower();
-    const Index<NDIM>& iupper = patch.getBox().upper();
-
-    const IntVector<NDIM>& u_ADV_ghost_cells = u_ADV.getGhostCellWidth();
-    const IntVector<NDIM>& Q_ghost_cells = Q.getGhostCellWidth();
-    const IntVector<NDIM>& q_half_ghost_cells = q_half.getGhostCellWidth();
-
-    CellData<NDIM, double> dQ(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> Q_L(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> Q_R(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> Q_temp1(patch.getBox(), 1, Q_ghost_cells);
-    FaceData<NDIM, double> q_half_temp(patch.getBox(), 1, q_half_ghost_cells);
-#if (NDIM > 2)
-    CellData<NDIM, double> Q_temp2(patch.getBox(), 1, Q_ghost_cells);
-#endif
-
-    for (int depth = 0; depth < Q.getDepth(); ++depth)
-    {
-        switch (d_limiter_type)
-        {
-        case CTU_ONLY:
-        case MINMOD_LIMITED:
-        case MC_LIMITED:
-        case SUPERBEE_LIMITED:
-        case MUSCL_LIMITED:
-        case SECOND_ORDER:
-        case FOURTH_ORDER:
-#if (NDIM == 2)
-            ADVECT_PREDICT_FC(dx,
-                              dt,
-                              d_limiter_type,
-                              ilower(0),
-                              iupper(0),
-                              ilower(1),
-                              iupper(1),
-                              Q_ghost_cells(0),
-                              Q_ghost_cells(1),
-                              Q.getPointer(depth),
-                              Q_temp1.getPointer(0),
-                              u_ADV_ghost_cells(0),
-                              u_ADV_ghost_cells(1),
-                              q_half_ghost_cells(0),
-                              q_half_ghost_cells(1),
-                              u_ADV.getPointer(0),
-                              u_ADV.getPointer(1),
-                              q_half_temp.getPointer(0),
-                              q_half_temp.getPointer(1),
-                              q_half.getPointer(0, depth),
-                              q_half.getPointer(1, depth));
-#endif
-#if (NDIM == 3)
-            ADVECT_PREDICT_FC(dx,
-                              dt,
-                              d_limiter_type,
-                              static_cast<unsigned int>(d_using_full_ctu),
-                              ilower(0),
-                              iupper(0),
-                              ilower(1),
-                              iupper(1),
-                              ilower(2),
-                              iupper(2),
-                              Q_ghost_cells(0),
-                              Q_ghost_cells(1),
-                              Q_ghost_cells(2),
-                              Q.getPointer(depth),
-                              Q_temp1.getPointer(0),
-                              Q_temp2.getPointer(0),
-                              u_ADV_ghost_cells(0),
-                              u_ADV_ghost_cells(1),
-                              u_ADV_ghost_cells(2),
-                              q_half_ghost_cells(0),
-                              q_half_ghost_cells(1),
-                              q_half_ghost_cells(2),
-                              u_ADV.getPointer(0),
-                              u_ADV.getPointer(1),
-                              u_ADV.getPointer(2),
-                              q_half_temp.getPointer(0),
-                              q_half_temp.getPointer(1),
-                              q_half_temp.getPointer(2),
-                              q_half.getPointer(0, depth),
-                              q_half.getPointer(1, depth),
-                              q_half.getPointer(2, depth));
-#endif
-            break;
-        case PPM:
-        case XSPPM7:
-#if (NDIM == 2)
-            ADVECT_PREDICT_PPM_FC(dx,
-                                  dt,
-                                  d_limiter_type,
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  Q_ghost_cells(0),
-                                  Q_ghost_cells(1),
-                                  Q.getPointer(depth),
-                                  Q_temp1.getPointer(0),
-                                  dQ.getPointer(0),
-                                  Q_L.getPointer(0),
-                                  Q_R.getPointer(0),
-                                  u_ADV_ghost_cells(0),
-                                  u_ADV_ghost_cells(1),
-                                  q_half_ghost_cells(0),
-                                  q_half_ghost_cells(1),
-                                  u_ADV.getPointer(0),
-                                  u_ADV.getPointer(1),
-                                  q_half_temp.getPointer(0),
-                                  q_half_temp.getPointer(1),
-                                  q_half.getPointer(0, depth),
-                                  q_half.getPointer(1, depth));
-#endif
-#if (NDIM == 3)
-            ADVECT_PREDICT_PPM_FC(dx,
-                                  dt,
-                                  d_limiter_type,
-                                  static_cast<unsigned int>(d_using_full_ctu),
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  Q_ghost_cells(0),
-                                  Q_ghost_cells(1),
-                                  Q_ghost_cells(2),
-                                  Q.getPointer(depth),
-                                  Q_temp1.getPointer(0),
-                                  Q_temp2.getPointer(0),
-                                  dQ.getPointer(0),
-                                  Q_L.getPointer(0),
-                                  Q_R.getPointer(0),
-                                  u_ADV_ghost_cells(0),
-                                  u_ADV_ghost_cells(1),
-                                  u_ADV_ghost_cells(2),
-                                  q_half_ghost_cells(0),
-                                  q_half_ghost_cells(1),
-                                  q_half_ghost_cells(2),
-                                  u_ADV.getPointer(0),
-                                  u_ADV.getPointer(1),
-                                  u_ADV.getPointer(2),
-                                  q_half_temp.getPointer(0),
-                                  q_half_temp.getPointer(1),
-                                  q_half_temp.getPointer(2),
-                                  q_half.getPointer(0, depth),
-                                  q_half.getPointer(1, depth),
-                                  q_half.getPointer(2, depth));
-#endif
-            break;
-        case UNKNOWN_LIMITER_TYPE:
-            TBOX_ERROR(d_object_name << "::predict(q_half, u_ADV, Q, patch, dt):\n"
-                                     << "  Limiter corresponding to d_limiter_type = " << d_limiter_type
-                                     << " not implemented");
-            break;
-        }
-    }
+    predict(std::vector<FaceData<NDIM, double>*>(1, &q_half),
+            u_ADV,
+            std::vector<const CellData<NDIM, double>*>(1, &Q),
+            std::vector<const CellData<NDIM, double>*>(),
+            patch,
+            dt);
     return;
 } // predict
 
@@ -1115,18 +971,29 @@ void AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, dou
                                                               const CellData<NDIM, double>& F,
                                                               const Patch<NDIM>& patch,
                                                               const double dt) const
+{
+    predict(std::vector<FaceData<NDIM, double>*>(1, &q_half),
+            u_ADV,
+            std::vector<const CellData<NDIM, double>*>(1, &Q),
+            std::vector<const CellData<NDIM, double>*>(1, &F),
+            patch,
+            dt);
+    return;
+} // predictWithSourceTerm
+
+void AdvectorExplicitPredictorPatchOps::predict(const std::vector<FaceData<NDIM, double>*>& q_half_data,
+                                                const FaceData<NDIM, double>& u_ADV,
+                                                const std::vector<const CellData<NDIM, double>*>& Q_data,
+                                                const std::vector<const CellData<NDIM, double>*>& F_data,
+                                                const Patch<NDIM>& patch,
+                                                const double dt) const
 {
 #if !defined(NDEBUG)
-    TBOX_ASSERT(q_half.getDepth() == Q.getDepth());
-    TBOX_ASSERT(q_half.getDepth() == F.getDepth());
-    TBOX_ASSERT(q_half.getBox() == patch.getBox());
+    TBOX_ASSERT(q_half_data.size() == Q_data.size());
+    TBOX_ASSERT(F_data.empty() || F_data.size() == Q_data.size());
 
     TBOX_ASSERT(u_ADV.getDepth() == 1);
     TBOX_ASSERT(u_ADV.getBox() == patch.getBox());
-
-    TBOX_ASSERT(Q.getBox() == patch.getBox());
-
-    TBOX_ASSERT(F.getBox() == patch.getBox());
 #endif
     const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch.getPatchGeometry();
     const double* const dx = patch_geom->getDx();
@@ -1135,104 +1002,82 @@ void AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, dou
     const Index<NDIM>& iupper = patch.getBox().upper();
 
     const IntVector<NDIM>& u_ADV_ghost_cells = u_ADV.getGhostCellWidth();
-    const IntVector<NDIM>& Q_ghost_cells = Q.getGhostCellWidth();
-    const IntVector<NDIM>& F_ghost_cells = F.getGhostCellWidth();
-    const IntVector<NDIM>& q_half_ghost_cells = q_half.getGhostCellWidth();
 
-    CellData<NDIM, double> dQ(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> Q_L(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> Q_R(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> Q_temp1(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> F_temp1(patch.getBox(), 1, F_ghost_cells);
-    FaceData<NDIM, double> q_half_temp(patch.getBox(), 1, q_half_ghost_cells);
+    // The scratch data required by the predictor are shared by all of the
+    // quantities advected by u_ADV.  They are only reallocated when the ghost
+    // cell widths of consecutive quantities differ.
+    Pointer<CellData<NDIM, double> > dQ_scratch, Q_L_scratch, Q_R_scratch, Q_temp1_scratch, F_temp1_scratch;
+    Pointer<FaceData<NDIM, double> > q_half_temp_scratch;
 #if (NDIM > 2)
-    CellData<NDIM, double> Q_temp2(patch.getBox(), 1, Q_ghost_cells);
-    CellData<NDIM, double> F_temp2(patch.getBox(), 1, F_ghost_cells);
+    Pointer<CellData<NDIM, double> > Q_temp2_scratch, F_temp2_scratch;
 #endif
-
-    for (int depth = 0; depth < Q.getDepth(); ++depth)
+    for (unsigned int l = 0; l < Q_data.size(); ++l)
     {
-        switch (d_limiter_type)
+        FaceData<NDIM, double>& q_half = *q_half_data[l];
+        const CellData<NDIM, double>& Q = *Q_data[l];
+        const CellData<NDIM, double>* const F_ptr = F_data.empty() ? NULL : F_data[l];
+#if !defined(NDEBUG)
+        TBOX_ASSERT(q_half.getDepth() == Q.getDepth());
+        TBOX_ASSERT(q_half.getBox() == patch.getBox());
+        TBOX_ASSERT(Q.getBox() == patch.getBox());
+        if (F_ptr)
         {
-        case CTU_ONLY:
-        case MINMOD_LIMITED:
-        case MC_LIMITED:
-        case SUPERBEE_LIMITED:
-        case MUSCL_LIMITED:
-        case SECOND_ORDER:
-        case FOURTH_ORDER:
-#if (NDIM == 2)
-            ADVECT_PREDICT_WITH_SOURCE_FC(dx,
-                                          dt,
-                                          d_limiter_type,
-                                          ilower(0),
-                                          iupper(0),
-                                          ilower(1),
-                                          iupper(1),
-                                          Q_ghost_cells(0),
-                                          Q_ghost_cells(1),
-                                          F_ghost_cells(0),
-                                          F_ghost_cells(1),
-                                          Q.getPointer(depth),
-                                          Q_temp1.getPointer(0),
-                                          F.getPointer(depth),
-                                          F_temp1.getPointer(0),
-                                          u_ADV_ghost_cells(0),
-                                          u_ADV_ghost_cells(1),
-                                          q_half_ghost_cells(0),
-                                          q_half_ghost_cells(1),
-                                          u_ADV.getPointer(0),
-                                          u_ADV.getPointer(1),
-                                          q_half_temp.getPointer(0),
-                                          q_half_temp.getPointer(1),
-                                          q_half.getPointer(0, depth),
-                                          q_half.getPointer(1, depth));
+            TBOX_ASSERT(q_half.getDepth() == F_ptr->getDepth());
+            TBOX_ASSERT(F_ptr->getBox() == patch.getBox());
+        }
 #endif
-#if (NDIM == 3)
-            ADVECT_PREDICT_WITH_SOURCE_FC(dx,
-                                          dt,
-                                          d_limiter_type,
-                                          static_cast<unsigned int>(d_using_full_ctu),
-                                          ilower(0),
-                                          iupper(0),
-                                          ilower(1),
-                                          iupper(1),
-                                          ilower(2),
-                                          iupper(2),
-                                          Q_ghost_cells(0),
-                                          Q_ghost_cells(1),
-                                          Q_ghost_cells(2),
-                                          F_ghost_cells(0),
-                                          F_ghost_cells(1),
-                                          F_ghost_cells(2),
-                                          Q.getPointer(depth),
-                                          Q_temp1.getPointer(0),
-                                          Q_temp2.getPointer(0),
-                                          F.getPointer(depth),
-                                          F_temp1.getPointer(0),
-                                          F_temp2.getPointer(0),
-                                          u_ADV_ghost_cells(0),
-                                          u_ADV_ghost_cells(1),
-                                          u_ADV_ghost_cells(2),
-                                          q_half_ghost_cells(0),
-                                          q_half_ghost_cells(1),
-                                          q_half_ghost_cells(2),
-                                          u_ADV.getPointer(0),
-                                          u_ADV.getPointer(1),
-                                          u_ADV.getPointer(2),
-                                          q_half_temp.getPointer(0),
-                                          q_half_temp.getPointer(1),
-                                          q_half_temp.getPointer(2),
-                                          q_half.getPointer(0, depth),
-                                          q_half.getPointer(1, depth),
-                                          q_half.getPointer(2, depth));
+        const IntVector<NDIM>& Q_ghost_cells = Q.getGhostCellWidth();
+        const IntVector<NDIM>& q_half_ghost_cells = q_half.getGhostCellWidth();
+        if (!Q_temp1_scratch || Q_temp1_scratch->getGhostCellWidth() != Q_ghost_cells)
+        {
+            dQ_scratch = new CellData<NDIM, double>(patch.getBox(), 1, Q_ghost_cells);
+            Q_L_scratch = new CellData<NDIM, double>(patch.getBox(), 1, Q_ghost_cells);
+            Q_R_scratch = new CellData<NDIM, double>(patch.getBox(), 1, Q_ghost_cells);
+            Q_temp1_scratch = new CellData<NDIM, double>(patch.getBox(), 1, Q_ghost_cells);
+#if (NDIM > 2)
+            Q_temp2_scratch = new CellData<NDIM, double>(patch.getBox(), 1, Q_ghost_cells);
+#endif
+        }
+        if (!q_half_temp_scratch || q_half_temp_scratch->getGhostCellWidth() != q_half_ghost_cells)
+        {
+            q_half_temp_scratch = new FaceData<NDIM, double>(patch.getBox(), 1, q_half_ghost_cells);
+        }
+        CellData<NDIM, double>& dQ = *dQ_scratch;
+        CellData<NDIM, double>& Q_L = *Q_L_scratch;
+        CellData<NDIM, double>& Q_R = *Q_R_scratch;
+        CellData<NDIM, double>& Q_temp1 = *Q_temp1_scratch;
+        FaceData<NDIM, double>& q_half_temp = *q_half_temp_scratch;
+#if (NDIM > 2)
+        CellData<NDIM, double>& Q_temp2 = *Q_temp2_scratch;
+#endif
+        if (F_ptr)
+        {
+            const CellData<NDIM, double>& F = *F_ptr;
+            const IntVector<NDIM>& F_ghost_cells = F.getGhostCellWidth();
+            if (!F_temp1_scratch || F_temp1_scratch->getGhostCellWidth() != F_ghost_cells)
+            {
+                F_temp1_scratch = new CellData<NDIM, double>(patch.getBox(), 1, F_ghost_cells);
+#if (NDIM > 2)
+                F_temp2_scratch = new CellData<NDIM, double>(patch.getBox(), 1, F_ghost_cells);
+#endif
+            }
+            CellData<NDIM, double>& F_temp1 = *F_temp1_scratch;
+#if (NDIM > 2)
+            CellData<NDIM, double>& F_temp2 = *F_temp2_scratch;
 #endif
-            break;
-        case PPM:
-        case XSPPM7:
+            switch (d_limiter_type)
+            {
+            case CTU_ONLY:
+            case MINMOD_LIMITED:
+            case MC_LIMITED:
+            case SUPERBEE_LIMITED:
+            case MUSCL_LIMITED:
+            case SECOND_ORDER:
+            case FOURTH_ORDER:
 #if (NDIM == 2)
-            ADVECT_PREDICT_PPM_WITH_SOURCE_FC(dx,
+                ADVECT_PREDICT_WITH_SOURCE_FC(dx,
                                               dt,
+                                              Q.getDepth(),
                                               d_limiter_type,
                                               ilower(0),
                                               iupper(0),
@@ -1242,12 +1087,9 @@ void AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, dou
                                               Q_ghost_cells(1),
                                               F_ghost_cells(0),
                                               F_ghost_cells(1),
-                                              Q.getPointer(depth),
+                                              Q.getPointer(0),
                                               Q_temp1.getPointer(0),
-                                              dQ.getPointer(0),
-                                              Q_L.getPointer(0),
-                                              Q_R.getPointer(0),
-                                              F.getPointer(depth),
+                                              F.getPointer(0),
                                               F_temp1.getPointer(0),
                                               u_ADV_ghost_cells(0),
                                               u_ADV_ghost_cells(1),
@@ -1257,12 +1099,13 @@ void AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, dou
                                               u_ADV.getPointer(1),
                                               q_half_temp.getPointer(0),
                                               q_half_temp.getPointer(1),
-                                              q_half.getPointer(0, depth),
-                                              q_half.getPointer(1, depth));
+                                              q_half.getPointer(0),
+                                              q_half.getPointer(1));
 #endif
 #if (NDIM == 3)
-            ADVECT_PREDICT_PPM_WITH_SOURCE_FC(dx,
+                ADVECT_PREDICT_WITH_SOURCE_FC(dx,
                                               dt,
+                                              Q.getDepth(),
                                               d_limiter_type,
                                               static_cast<unsigned int>(d_using_full_ctu),
                                               ilower(0),
@@ -1277,13 +1120,10 @@ void AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, dou
                                               F_ghost_cells(0),
                                               F_ghost_cells(1),
                                               F_ghost_cells(2),
-                                              Q.getPointer(depth),
+                                              Q.getPointer(0),
                                               Q_temp1.getPointer(0),
                                               Q_temp2.getPointer(0),
-                                              dQ.getPointer(0),
-                                              Q_L.getPointer(0),
-                                              Q_R.getPointer(0),
-                                              F.getPointer(depth),
+                                              F.getPointer(0),
                                               F_temp1.getPointer(0),
                                               F_temp2.getPointer(0),
                                               u_ADV_ghost_cells(0),
@@ -1298,20 +1138,242 @@ void AdvectorExplicitPredictorPatchOps::predictWithSourceTerm(FaceData<NDIM, dou
                                               q_half_temp.getPointer(0),
                                               q_half_temp.getPointer(1),
                                               q_half_temp.getPointer(2),
-                                              q_half.getPointer(0, depth),
-                                              q_half.getPointer(1, depth),
-                                              q_half.getPointer(2, depth));
+                                              q_half.getPointer(0),
+                                              q_half.getPointer(1),
+                                              q_half.getPointer(2));
+#endif
+                break;
+            case PPM:
+            case XSPPM7:
+#if (NDIM == 2)
+                ADVECT_PREDICT_PPM_WITH_SOURCE_FC(dx,
+                                                  dt,
+                                                  Q.getDepth(),
+                                                  d_limiter_type,
+                                                  ilower(0),
+                                                  iupper(0),
+                                                  ilower(1),
+                                                  iupper(1),
+                                                  Q_ghost_cells(0),
+                                                  Q_ghost_cells(1),
+                                                  F_ghost_cells(0),
+                                                  F_ghost_cells(1),
+                                                  Q.getPointer(0),
+                                                  Q_temp1.getPointer(0),
+                                                  dQ.getPointer(0),
+                                                  Q_L.getPointer(0),
+                                                  Q_R.getPointer(0),
+                                                  F.getPointer(0),
+                                                  F_temp1.getPointer(0),
+                                                  u_ADV_ghost_cells(0),
+                                                  u_ADV_ghost_cells(1),
+                                                  q_half_ghost_cells(0),
+                                                  q_half_ghost_cells(1),
+                                                  u_ADV.getPointer(0),
+                                                  u_ADV.getPointer(1),
+                                                  q_half_temp.getPointer(0),
+                                                  q_half_temp.getPointer(1),
+                                                  q_half.getPointer(0),
+                                                  q_half.getPointer(1));
+#endif
+#if (NDIM == 3)
+                ADVECT_PREDICT_PPM_WITH_SOURCE_FC(dx,
+                                                  dt,
+                                                  Q.getDepth(),
+                                                  d_limiter_type,
+                                                  static_cast<unsigned int>(d_using_full_ctu),
+                                                  ilower(0),
+                                                  iupper(0),
+                                                  ilower(1),
+                                                  iupper(1),
+                                                  ilower(2),
+                                                  iupper(2),
+                                                  Q_ghost_cells(0),
+                                                  Q_ghost_cells(1),
+                                                  Q_ghost_cells(2),
+                                                  F_ghost_cells(0),
+                                                  F_ghost_cells(1),
+                                                  F_ghost_cells(2),
+                                                  Q.getPointer(0),
+                                                  Q_temp1.getPointer(0),
+                                                  Q_temp2.getPointer(0),
+                                                  dQ.getPointer(0),
+                                                  Q_L.getPointer(0),
+                                                  Q_R.getPointer(0),
+                                                  F.getPointer(0),
+                                                  F_temp1.getPointer(0),
+                                                  F_temp2.getPointer(0),
+                                                  u_ADV_ghost_cells(0),
+                                                  u_ADV_ghost_cells(1),
+                                                  u_ADV_ghost_cells(2),
+                                                  q_half_ghost_cells(0),
+                                                  q_half_ghost_cells(1),
+                                                  q_half_ghost_cells(2),
+                                                  u_ADV.getPointer(0),
+                                                  u_ADV.getPointer(1),
+                                                  u_ADV.getPointer(2),
+                                                  q_half_temp.getPointer(0),
+                                                  q_half_temp.getPointer(1),
+                                                  q_half_temp.getPointer(2),
+                                                  q_half.getPointer(0),
+                                                  q_half.getPointer(1),
+                                                  q_half.getPointer(2));
+#endif
+                break;
+            case UNKNOWN_LIMITER_TYPE:
+                TBOX_ERROR(d_object_name << "::predict():\n"
+                                         << "  Limiter corresponding to d_limiter_type = " << d_limiter_type
+                                         << " not implemented");
+                break;
+            }
+        }
+        else
+        {
+            switch (d_limiter_type)
+            {
+            case CTU_ONLY:
+            case MINMOD_LIMITED:
+            case MC_LIMITED:
+            case SUPERBEE_LIMITED:
+            case MUSCL_LIMITED:
+            case SECOND_ORDER:
+            case FOURTH_ORDER:
+#if (NDIM == 2)
+                ADVECT_PREDICT_FC(dx,
+                                  dt,
+                                  Q.getDepth(),
+                                  d_limiter_type,
+                                  ilower(0),
+                                  iupper(0),
+                                  ilower(1),
+                                  iupper(1),
+                                  Q_ghost_cells(0),
+                                  Q_ghost_cells(1),
+                                  Q.getPointer(0),
+                                  Q_temp1.getPointer(0),
+                                  u_ADV_ghost_cells(0),
+                                  u_ADV_ghost_cells(1),
+                                  q_half_ghost_cells(0),
+                                  q_half_ghost_cells(1),
+                                  u_ADV.getPointer(0),
+                                  u_ADV.getPointer(1),
+                                  q_half_temp.getPointer(0),
+                                  q_half_temp.getPointer(1),
+                                  q_half.getPointer(0),
+                                  q_half.getPointer(1));
+#endif
+#if (NDIM == 3)
+                ADVECT_PREDICT_FC(dx,
+                                  dt,
+                                  Q.getDepth(),
+                                  d_limiter_type,
+                                  static_cast<unsigned int>(d_using_full_ctu),
+                                  ilower(0),
+                                  iupper(0),
+                                  ilower(1),
+                                  iupper(1),
+                                  ilower(2),
+                                  iupper(2),
+                                  Q_ghost_cells(0),
+                                  Q_ghost_cells(1),
+                                  Q_ghost_cells(2),
+                                  Q.getPointer(0),
+                                  Q_temp1.getPointer(0),
+                                  Q_temp2.getPointer(0),
+                                  u_ADV_ghost_cells(0),
+                                  u_ADV_ghost_cells(1),
+                                  u_ADV_ghost_cells(2),
+                                  q_half_ghost_cells(0),
+                                  q_half_ghost_cells(1),
+                                  q_half_ghost_cells(2),
+                                  u_ADV.getPointer(0),
+                                  u_ADV.getPointer(1),
+                                  u_ADV.getPointer(2),
+                                  q_half_temp.getPointer(0),
+                                  q_half_temp.getPointer(1),
+                                  q_half_temp.getPointer(2),
+                                  q_half.getPointer(0),
+                                  q_half.getPointer(1),
+                                  q_half.getPointer(2));
+#endif
+                break;
+            case PPM:
+            case XSPPM7:
+#if (NDIM == 2)
+                ADVECT_PREDICT_PPM_FC(dx,
+                                      dt,
+                                      Q.getDepth(),
+                                      d_limiter_type,
+                                      ilower(0),
+                                      iupper(0),
+                                      ilower(1),
+                                      iupper(1),
+                                      Q_ghost_cells(0),
+                                      Q_ghost_cells(1),
+                                      Q.getPointer(0),
+                                      Q_temp1.getPointer(0),
+                                      dQ.getPointer(0),
+                                      Q_L.getPointer(0),
+                                      Q_R.getPointer(0),
+                                      u_ADV_ghost_cells(0),
+                                      u_ADV_ghost_cells(1),
+                                      q_half_ghost_cells(0),
+                                      q_half_ghost_cells(1),
+                                      u_ADV.getPointer(0),
+                                      u_ADV.getPointer(1),
+                                      q_half_temp.getPointer(0),
+                                      q_half_temp.getPointer(1),
+                                      q_half.getPointer(0),
+                                      q_half.getPointer(1));
+#endif
+#if (NDIM == 3)
+                ADVECT_PREDICT_PPM_FC(dx,
+                                      dt,
+                                      Q.getDepth(),
+                                      d_limiter_type,
+                                      static_cast<unsigned int>(d_using_full_ctu),
+                                      ilower(0),
+                                      iupper(0),
+                                      ilower(1),
+                                      iupper(1),
+                                      ilower(2),
+                                      iupper(2),
+                                      Q_ghost_cells(0),
+                                      Q_ghost_cells(1),
+                                      Q_ghost_cells(2),
+                                      Q.getPointer(0),
+                                      Q_temp1.getPointer(0),
+                                      Q_temp2.getPointer(0),
+                                      dQ.getPointer(0),
+                                      Q_L.getPointer(0),
+                                      Q_R.getPointer(0),
+                                      u_ADV_ghost_cells(0),
+                                      u_ADV_ghost_cells(1),
+                                      u_ADV_ghost_cells(2),
+                                      q_half_ghost_cells(0),
+                                      q_half_ghost_cells(1),
+                                      q_half_ghost_cells(2),
+                                      u_ADV.getPointer(0),
+                                      u_ADV.getPointer(1),
+                                      u_ADV.getPointer(2),
+                                      q_half_temp.getPointer(0),
+                                      q_half_temp.getPointer(1),
+                                      q_half_temp.getPointer(2),
+                                      q_half.getPointer(0),
+                                      q_half.getPointer(1),
+                                      q_half.getPointer(2));
 #endif
-            break;
-        case UNKNOWN_LIMITER_TYPE:
-            TBOX_ERROR(d_object_name << "::predictWithSourceTerm(q_half, u_ADV, Q, F, patch, dt):\n"
-                                     << "  Limiter corresponding to d_limiter_type = " << d_limiter_type
-                                     << " not implemented");
-            break;
+                break;
+            case UNKNOWN_LIMITER_TYPE:
+                TBOX_ERROR(d_object_name << "::predict():\n"
+                                         << "  Limiter corresponding to d_limiter_type = " << d_limiter_type
+                                         << " not implemented");
+                break;
+            }
         }
     }
     return;
-} // predictWithSourceTerm
+} // predict
 
 void AdvectorExplicitPredictorPatchOps::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
 {
@@ -248,12 +248,12 @@ AdvectorPredictorCorrectorHyperbolicPatchOps::AdvectorPredictorCorrectorHyperbol
     Pointer<CartesianGridGeometry<NDIM> > grid_geom,
     bool register_for_restart)
     : d_integrator(NULL), d_explicit_predictor(explicit_predictor), d_u_var(), d_u_is_div_free(), d_u_fcn(),
-      d_compute_init_velocity(true), d_compute_half_velocity(true), d_compute_final_velocity(true), d_F_var(),
-      d_F_fcn(), d_Q_var(), d_Q_u_map(), d_Q_F_map(), d_Q_difference_form(), d_Q_init(), d_Q_bc_coef(),
-      d_overwrite_tags(true), d_object_name(object_name), d_registered_for_restart(register_for_restart),
-      d_grid_geometry(grid_geom), d_visit_writer(NULL), d_extrap_bc_helper(), d_extrap_type("CONSTANT"),
-      d_refinement_criteria(), d_dev_tol(), d_dev(), d_dev_time_max(), d_dev_time_min(), d_grad_tol(),
-      d_grad_time_max(), d_grad_time_min()
+      d_compute_init_velocity(true), d_compute_half_velocity(true), d_compute_final_velocity(true),
+      d_group_predictions_by_velocity(true), d_F_var(), d_F_fcn(), d_Q_var(), d_Q_u_map(), d_Q_F_map(),
+      d_Q_difference_form(), d_Q_init(), d_Q_bc_coef(), d_overwrite_tags(true), d_object_name(object_name),
+      d_registered_for_restart(register_for_restart), d_grid_geometry(grid_geom), d_visit_writer(NULL),
+      d_extrap_bc_helper(), d_extrap_type("CONSTANT"), d_refinement_criteria(), d_dev_tol(), d_dev(),
+      d_dev_time_max(), d_dev_time_min(), d_grad_tol(), d_grad_time_max(), d_grad_time_min()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -648,6 +648,10 @@ void AdvectorPredictorCorrectorHyperbolicPatchOps::computeFluxesOnPatch(Patch<ND
 
     PatchFaceDataOpsReal<NDIM, double> patch_fc_data_ops;
 
+    // Collect the quantities that are advected by each velocity field.
+    std::map<Pointer<FaceVariable<NDIM, double> >, std::vector<FaceData<NDIM, double>*> > q_integral_data_map;
+    std::map<Pointer<FaceVariable<NDIM, double> >, std::vector<const CellData<NDIM, double>*> > Q_data_map;
+    std::map<Pointer<FaceVariable<NDIM, double> >, std::vector<const CellData<NDIM, double>*> > F_data_map;
     for (std::set<Pointer<CellVariable<NDIM, double> > >::const_iterator cit = d_Q_var.begin(); cit != d_Q_var.end();
          ++cit)
     {
@@ -659,19 +663,46 @@ void AdvectorPredictorCorrectorHyperbolicPatchOps::computeFluxesOnPatch(Patch<ND
             q_integral_data->fillAll(0.0);
             continue;
         }
-
-        // Predict time- and face-centered values.
         Pointer<CellData<NDIM, double> > Q_data = patch.getPatchData(Q_var, getDataContext());
-        Pointer<FaceData<NDIM, double> > u_data = patch.getPatchData(u_var, getDataContext());
         Pointer<CellVariable<NDIM, double> > F_var = d_Q_F_map[Q_var];
-        if (F_var)
+        Pointer<CellData<NDIM, double> > F_data;
+        if (F_var) F_data = patch.getPatchData(F_var, getDataContext());
+        q_integral_data_map[u_var].push_back(q_integral_data.getPointer());
+        Q_data_map[u_var].push_back(Q_data.getPointer());
+        F_data_map[u_var].push_back(F_data.getPointer());
+    }
+
+    // Predict time- and face-centered values.  When predictions are grouped by
+    // velocity, all of the quantities advected by a particular velocity field
+    // are predicted together so that the predictor scratch data are shared.
+    for (std::map<Pointer<FaceVariable<NDIM, double> >, std::vector<FaceData<NDIM, double>*> >::const_iterator it =
+             q_integral_data_map.begin();
+         it != q_integral_data_map.end();
+         ++it)
+    {
+        Pointer<FaceVariable<NDIM, double> > u_var = it->first;
+        Pointer<FaceData<NDIM, double> > u_data = patch.getPatchData(u_var, getDataContext());
+        const std::vector<FaceData<NDIM, double>*>& q_integral_data = it->second;
+        const std::vector<const CellData<NDIM, double>*>& Q_data = Q_data_map[u_var];
+        const std::vector<const CellData<NDIM, double>*>& F_data = F_data_map[u_var];
+        if (d_group_predictions_by_velocity)
         {
-            Pointer<CellData<NDIM, double> > F_data = patch.getPatchData(F_var, getDataContext());
-            d_explicit_predictor->predictValueWithSourceTerm(*q_integral_data, *u_data, *Q_data, *F_data, patch, dt);
+            d_explicit_predictor->predictValues(q_integral_data, *u_data, Q_data, F_data, patch, dt);
         }
         else
         {
-            d_explicit_predictor->predictValue(*q_integral_data, *u_data, *Q_data, patch, dt);
+            for (unsigned int l = 0; l < Q_data.size(); ++l)
+            {
+                if (F_data[l])
+                {
+                    d_explicit_predictor->predictValueWithSourceTerm(
+                        *q_integral_data[l], *u_data, *Q_data[l], *F_data[l], patch, dt);
+                }
+                else
+                {
+                    d_explicit_predictor->predictValue(*q_integral_data[l], *u_data, *Q_data[l], patch, dt);
+                }
+            }
         }
     }
 
@@ -700,6 +731,7 @@ void AdvectorPredictorCorrectorHyperbolicPatchOps::computeFluxesOnPatch(Patch<ND
     }
 
     // Compute fluxes and other face-centered quantities.
+    std::set<Pointer<FaceVariable<NDIM, double> > > u_integral_computed;
     for (std::set<Pointer<CellVariable<NDIM, double> > >::const_iterator cit = d_Q_var.begin(); cit != d_Q_var.end();
          ++cit)
     {
@@ -724,8 +756,13 @@ void AdvectorPredictorCorrectorHyperbolicPatchOps::computeFluxesOnPatch(Patch<ND
             Pointer<FaceData<NDIM, double> > q_integral_data = getQIntegralData(Q_var, patch, getDataContext());
             patch_fc_data_ops.scale(q_integral_data, dt, q_integral_data, patch_box);
 
-            Pointer<FaceData<NDIM, double> > u_integral_data = getUIntegralData(Q_var, patch, getDataContext());
-            patch_fc_data_ops.scale(u_integral_data, dt, u_data, patch_box);
+            // The time integral of the advection velocity is shared by all of
+            // the quantities advected by u_var, so it is only computed once.
+            if (u_integral_computed.insert(u_var).second)
+            {
+                Pointer<FaceData<NDIM, double> > u_integral_data = getUIntegralData(Q_var, patch, getDataContext());
+                patch_fc_data_ops.scale(u_integral_data, dt, u_data, patch_box);
+            }
         }
     }
     return;
@@ -1407,6 +1444,8 @@ void AdvectorPredictorCorrectorHyperbolicPatchOps::getFromInput(Pointer<Database
     if (db->keyExists("compute_init_velocity")) d_compute_init_velocity = db->getBool("compute_init_velocity");
     if (db->keyExists("compute_half_velocity")) d_compute_half_velocity = db->getBool("compute_half_velocity");
     if (db->keyExists("compute_final_velocity")) d_compute_final_velocity = db->getBool("compute_final_velocity");
+    if (db->keyExists("group_predictions_by_velocity"))
+        d_group_predictions_by_velocity = db->getBool("group_predictions_by_velocity");
 
     if (db->keyExists("extrap_type")) d_extrap_type = db->getString("extrap_type");
     if (!(d_extrap_type == "CONSTANT" || d_extrap_type == "LINEAR" || d_extrap_type == "QUADRATIC"))
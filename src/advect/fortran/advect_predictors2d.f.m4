@@ -1995,3 +1995,341 @@ c
       return
       end
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Apply advect_predict2d to each depth component of Q.
+c
+c     All of the components share the advection velocity and the
+c     scratch arrays, so that a multicomponent quantity requires only
+c     a single call from C++.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine advect_predict_depths2d(
+     &     dx,dt,
+     &     depth,
+     &     limiter,
+     &     ifirst0,ilast0,ifirst1,ilast1,
+     &     nQgc0,nQgc1,
+     &     Q,Q1,
+     &     nugc0,nugc1,
+     &     nqhalfgc0,nqhalfgc1, 
+     &     u0,u1,
+     &     qtemp0,qtemp1,
+     &     qhalf0,qhalf1)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0,ifirst1,ilast1
+
+      INTEGER nQgc0,nQgc1
+
+      INTEGER nugc0,nugc1
+      INTEGER nqhalfgc0,nqhalfgc1
+
+      INTEGER limiter
+      INTEGER depth
+
+      REAL dx(0:NDIM-1),dt
+
+      REAL Q(CELL2dVECG(ifirst,ilast,nQgc),0:depth-1)
+      REAL Q1(ifirst1-nQgc1:ilast1+nQgc1,
+     &               ifirst0-nQgc0:ilast0+nQgc0)
+
+      REAL u0(FACE2d0VECG(ifirst,ilast,nugc))
+      REAL u1(FACE2d1VECG(ifirst,ilast,nugc))
+
+      REAL qtemp0(FACE2d0VECG(ifirst,ilast,nqhalfgc))
+      REAL qtemp1(FACE2d1VECG(ifirst,ilast,nqhalfgc))
+c
+c     Input/Output.
+c
+      REAL qhalf0(FACE2d0VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+      REAL qhalf1(FACE2d1VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+c
+c     Local variables.
+c
+      INTEGER d
+c
+      do d = 0,depth-1
+         call advect_predict2d(
+     &        dx,dt,
+     &        limiter,
+     &        ifirst0,ilast0,ifirst1,ilast1,
+     &        nQgc0,nQgc1,
+     &        Q(ifirst0-nQgc0,ifirst1-nQgc1,d),
+     &        Q1,
+     &        nugc0,nugc1,
+     &        nqhalfgc0,nqhalfgc1,
+     &        u0,u1,
+     &        qtemp0,qtemp1,
+     &        qhalf0(ifirst0-nqhalfgc0,ifirst1-nqhalfgc1,d),
+     &        qhalf1(ifirst1-nqhalfgc1,ifirst0-nqhalfgc0,d))
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Apply advect_predict_with_source2d to each depth component of Q.
+c
+c     All of the components share the advection velocity and the
+c     scratch arrays, so that a multicomponent quantity requires only
+c     a single call from C++.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine advect_predict_with_source_depths2d(
+     &     dx,dt,
+     &     depth,
+     &     limiter,
+     &     ifirst0,ilast0,ifirst1,ilast1,
+     &     nQgc0,nQgc1,
+     &     nFgc0,nFgc1,
+     &     Q,Qscratch1,
+     &     F,Fscratch1,
+     &     nugc0,nugc1,
+     &     nqhalfgc0,nqhalfgc1,
+     &     u0,u1,
+     &     qtemp0,qtemp1,
+     &     qhalf0,qhalf1)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0,ifirst1,ilast1
+
+      INTEGER nQgc0,nQgc1
+      INTEGER nFgc0,nFgc1
+
+      INTEGER nugc0,nugc1
+      INTEGER nqhalfgc0,nqhalfgc1
+
+      INTEGER limiter
+      INTEGER depth
+
+      REAL dx(0:NDIM-1),dt
+
+      REAL Q(CELL2dVECG(ifirst,ilast,nQgc),0:depth-1)
+      REAL Qscratch1(ifirst1-nQgc1:ilast1+nQgc1,
+     &               ifirst0-nQgc0:ilast0+nQgc0)
+
+      REAL F(CELL2dVECG(ifirst,ilast,nFgc),0:depth-1)
+      REAL Fscratch1(ifirst1-nFgc1:ilast1+nFgc1,
+     &               ifirst0-nFgc0:ilast0+nFgc0)
+
+      REAL u0(FACE2d0VECG(ifirst,ilast,nugc))
+      REAL u1(FACE2d1VECG(ifirst,ilast,nugc))
+
+      REAL qtemp0(FACE2d0VECG(ifirst,ilast,nqhalfgc))
+      REAL qtemp1(FACE2d1VECG(ifirst,ilast,nqhalfgc))
+c
+c     Input/Output.
+c
+      REAL qhalf0(FACE2d0VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+      REAL qhalf1(FACE2d1VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+c
+c     Local variables.
+c
+      INTEGER d
+c
+      do d = 0,depth-1
+         call advect_predict_with_source2d(
+     &        dx,dt,
+     &        limiter,
+     &        ifirst0,ilast0,ifirst1,ilast1,
+     &        nQgc0,nQgc1,
+     &        nFgc0,nFgc1,
+     &        Q(ifirst0-nQgc0,ifirst1-nQgc1,d),
+     &        Qscratch1,
+     &        F(ifirst0-nFgc0,ifirst1-nFgc1,d),
+     &        Fscratch1,
+     &        nugc0,nugc1,
+     &        nqhalfgc0,nqhalfgc1,
+     &        u0,u1,
+     &        qtemp0,qtemp1,
+     &        qhalf0(ifirst0-nqhalfgc0,ifirst1-nqhalfgc1,d),
+     &        qhalf1(ifirst1-nqhalfgc1,ifirst0-nqhalfgc0,d))
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Apply advect_predict_PPM2d to each depth component of Q.
+c
+c     All of the components share the advection velocity and the
+c     scratch arrays, so that a multicomponent quantity requires only
+c     a single call from C++.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine advect_predict_PPM_depths2d(
+     &     dx,dt,
+     &     depth,
+     &     limiter,
+     &     ifirst0,ilast0,ifirst1,ilast1,
+     &     nQgc0,nQgc1,
+     &     Q0,Q1,
+     &     dQ,Q_L,Q_R,
+     &     nugc0,nugc1,
+     &     nqhalfgc0,nqhalfgc1,
+     &     u0,u1,
+     &     qtemp0,qtemp1,
+     &     qhalf0,qhalf1)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0,ifirst1,ilast1
+
+      INTEGER nQgc0,nQgc1
+
+      INTEGER nugc0,nugc1
+      INTEGER nqhalfgc0,nqhalfgc1
+
+      INTEGER limiter
+      INTEGER depth
+
+      REAL dx(0:NDIM-1),dt
+
+      REAL Q0(CELL2dVECG(ifirst,ilast,nQgc),0:depth-1)
+      REAL Q1(ifirst1-nQgc1:ilast1+nQgc1,
+     &        ifirst0-nQgc0:ilast0+nQgc0)
+      REAL dQ(CELL2dVECG(ifirst,ilast,nQgc))
+      REAL Q_L(CELL2dVECG(ifirst,ilast,nQgc))
+      REAL Q_R(CELL2dVECG(ifirst,ilast,nQgc))
+
+      REAL u0(FACE2d0VECG(ifirst,ilast,nugc))
+      REAL u1(FACE2d1VECG(ifirst,ilast,nugc))
+
+      REAL qtemp0(FACE2d0VECG(ifirst,ilast,nqhalfgc))
+      REAL qtemp1(FACE2d1VECG(ifirst,ilast,nqhalfgc))
+c
+c     Input/Output.
+c
+      REAL qhalf0(FACE2d0VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+      REAL qhalf1(FACE2d1VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+c
+c     Local variables.
+c
+      INTEGER d
+c
+      do d = 0,depth-1
+         call advect_predict_PPM2d(
+     &        dx,dt,
+     &        limiter,
+     &        ifirst0,ilast0,ifirst1,ilast1,
+     &        nQgc0,nQgc1,
+     &        Q0(ifirst0-nQgc0,ifirst1-nQgc1,d),
+     &        Q1,
+     &        dQ,Q_L,Q_R,
+     &        nugc0,nugc1,
+     &        nqhalfgc0,nqhalfgc1,
+     &        u0,u1,
+     &        qtemp0,qtemp1,
+     &        qhalf0(ifirst0-nqhalfgc0,ifirst1-nqhalfgc1,d),
+     &        qhalf1(ifirst1-nqhalfgc1,ifirst0-nqhalfgc0,d))
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Apply advect_predict_PPM_with_source2d to each depth component of Q.
+c
+c     All of the components share the advection velocity and the
+c     scratch arrays, so that a multicomponent quantity requires only
+c     a single call from C++.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine advect_predict_PPM_with_source_depths2d(
+     &     dx,dt,
+     &     depth,
+     &     limiter,
+     &     ifirst0,ilast0,ifirst1,ilast1,
+     &     nQgc0,nQgc1,
+     &     nFgc0,nFgc1,
+     &     Q0,Q1,
+     &     dQ,Q_L,Q_R,
+     &     F0,F1,
+     &     nugc0,nugc1,
+     &     nqhalfgc0,nqhalfgc1,
+     &     u0,u1,
+     &     qtemp0,qtemp1,
+     &     qhalf0,qhalf1)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0,ifirst1,ilast1
+
+      INTEGER nQgc0,nQgc1
+      INTEGER nFgc0,nFgc1
+
+      INTEGER nugc0,nugc1
+      INTEGER nqhalfgc0,nqhalfgc1
+
+      INTEGER limiter
+      INTEGER depth
+
+      REAL dx(0:NDIM-1),dt
+
+      REAL Q0(CELL2dVECG(ifirst,ilast,nQgc),0:depth-1)
+      REAL Q1(ifirst1-nQgc1:ilast1+nQgc1,
+     &        ifirst0-nQgc0:ilast0+nQgc0)
+      REAL dQ(CELL2dVECG(ifirst,ilast,nQgc))
+      REAL Q_L(CELL2dVECG(ifirst,ilast,nQgc))
+      REAL Q_R(CELL2dVECG(ifirst,ilast,nQgc))
+
+      REAL F0(CELL2dVECG(ifirst,ilast,nFgc),0:depth-1)
+      REAL F1(ifirst1-nFgc1:ilast1+nFgc1,
+     &        ifirst0-nFgc0:ilast0+nFgc0)
+
+      REAL u0(FACE2d0VECG(ifirst,ilast,nugc))
+      REAL u1(FACE2d1VECG(ifirst,ilast,nugc))
+
+      REAL qtemp0(FACE2d0VECG(ifirst,ilast,nqhalfgc))
+      REAL qtemp1(FACE2d1VECG(ifirst,ilast,nqhalfgc))
+c
+c     Input/Output.
+c
+      REAL qhalf0(FACE2d0VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+      REAL qhalf1(FACE2d1VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+c
+c     Local variables.
+c
+      INTEGER d
+c
+      do d = 0,depth-1
+         call advect_predict_PPM_with_source2d(
+     &        dx,dt,
+     &        limiter,
+     &        ifirst0,ilast0,ifirst1,ilast1,
+     &        nQgc0,nQgc1,
+     &        nFgc0,nFgc1,
+     &        Q0(ifirst0-nQgc0,ifirst1-nQgc1,d),
+     &        Q1,
+     &        dQ,Q_L,Q_R,
+     &        F0(ifirst0-nFgc0,ifirst1-nFgc1,d),
+     &        F1,
+     &        nugc0,nugc1,
+     &        nqhalfgc0,nqhalfgc1,
+     &        u0,u1,
+     &        qtemp0,qtemp1,
+     &        qhalf0(ifirst0-nqhalfgc0,ifirst1-nqhalfgc1,d),
+     &        qhalf1(ifirst1-nqhalfgc1,ifirst0-nqhalfgc0,d))
+      enddo
+c
+      return
+      end
@@ -2536,3 +2536,403 @@ c
       return
       end
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Apply advect_predict3d to each depth component of Q.
+c
+c     All of the components share the advection velocity and the
+c     scratch arrays, so that a multicomponent quantity requires only
+c     a single call from C++.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine advect_predict_depths3d(
+     &     dx,dt,
+     &     depth,
+     &     limiter,
+     &     usefullctu,
+     &     ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2,
+     &     nQgc0,nQgc1,nQgc2,
+     &     Q0,Q1,Q2,
+     &     nugc0,nugc1,nugc2,
+     &     nqhalfgc0,nqhalfgc1,nqhalfgc2,
+     &     u0,u1,u2,
+     &     qtemp0,qtemp1,qtemp2,
+     &     qhalf0,qhalf1,qhalf2)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2
+
+      INTEGER nQgc0,nQgc1,nQgc2
+
+      INTEGER nugc0,nugc1,nugc2
+      INTEGER nqhalfgc0,nqhalfgc1,nqhalfgc2
+
+      INTEGER limiter
+      INTEGER depth
+
+      LOGICAL usefullctu
+
+      REAL dx(0:NDIM-1), dt
+
+      REAL Q0(CELL3dVECG(ifirst,ilast,nQgc),0:depth-1)
+      REAL Q1(ifirst1-nQgc1:ilast1+nQgc1,
+     &        ifirst2-nQgc2:ilast2+nQgc2,
+     &        ifirst0-nQgc0:ilast0+nQgc0)
+      REAL Q2(ifirst2-nQgc2:ilast2+nQgc2,
+     &        ifirst0-nQgc0:ilast0+nQgc0,
+     &        ifirst1-nQgc1:ilast1+nQgc1)
+
+      REAL u0(FACE3d0VECG(ifirst,ilast,nugc))
+      REAL u1(FACE3d1VECG(ifirst,ilast,nugc))
+      REAL u2(FACE3d2VECG(ifirst,ilast,nugc))
+
+      REAL qtemp0(FACE3d0VECG(ifirst,ilast,nqhalfgc))
+      REAL qtemp1(FACE3d1VECG(ifirst,ilast,nqhalfgc))
+      REAL qtemp2(FACE3d2VECG(ifirst,ilast,nqhalfgc))
+c
+c     Input/Output.
+c
+      REAL qhalf0(FACE3d0VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+      REAL qhalf1(FACE3d1VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+      REAL qhalf2(FACE3d2VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+c
+c     Local variables.
+c
+      INTEGER d
+c
+      do d = 0,depth-1
+         call advect_predict3d(
+     &        dx,dt,
+     &        limiter,
+     &        usefullctu,
+     &        ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2,
+     &        nQgc0,nQgc1,nQgc2,
+     &        Q0(ifirst0-nQgc0,ifirst1-nQgc1,ifirst2-nQgc2,d),
+     &        Q1,Q2,
+     &        nugc0,nugc1,nugc2,
+     &        nqhalfgc0,nqhalfgc1,nqhalfgc2,
+     &        u0,u1,u2,
+     &        qtemp0,qtemp1,qtemp2,
+     &        qhalf0(ifirst0-nqhalfgc0,ifirst1-nqhalfgc1,
+     &             ifirst2-nqhalfgc2,d),
+     &        qhalf1(ifirst1-nqhalfgc1,ifirst2-nqhalfgc2,
+     &             ifirst0-nqhalfgc0,d),
+     &        qhalf2(ifirst2-nqhalfgc2,ifirst0-nqhalfgc0,
+     &             ifirst1-nqhalfgc1,d))
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Apply advect_predict_with_source3d to each depth component of Q.
+c
+c     All of the components share the advection velocity and the
+c     scratch arrays, so that a multicomponent quantity requires only
+c     a single call from C++.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine advect_predict_with_source_depths3d(
+     &     dx,dt,
+     &     depth,
+     &     limiter,usefullctu,
+     &     ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2,
+     &     nQgc0,nQgc1,nQgc2,
+     &     nFgc0,nFgc1,nFgc2,
+     &     Q,Qscratch1,Qscratch2,
+     &     F,Fscratch1,Fscratch2,
+     &     nugc0,nugc1,nugc2,
+     &     nqhalfgc0,nqhalfgc1,nqhalfgc2,
+     &     u0,u1,u2,
+     &     qtemp0,qtemp1,qtemp2,
+     &     qhalf0,qhalf1,qhalf2)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2
+
+      INTEGER nQgc0,nQgc1,nQgc2
+      INTEGER nFgc0,nFgc1,nFgc2
+
+      INTEGER nugc0,nugc1,nugc2
+      INTEGER nqhalfgc0,nqhalfgc1,nqhalfgc2
+
+      LOGICAL usefullctu
+
+      INTEGER limiter
+      INTEGER depth
+
+      REAL dx(0:NDIM-1), dt
+
+      REAL Q(CELL3dVECG(ifirst,ilast,nQgc),0:depth-1)
+      REAL Qscratch1(ifirst1-nQgc1:ilast1+nQgc1,
+     &               ifirst2-nQgc2:ilast2+nQgc2,
+     &               ifirst0-nQgc0:ilast0+nQgc0)
+      REAL Qscratch2(ifirst2-nQgc2:ilast2+nQgc2,
+     &               ifirst0-nQgc0:ilast0+nQgc0,
+     &               ifirst1-nQgc1:ilast1+nQgc1)
+
+      REAL F(CELL3dVECG(ifirst,ilast,nFgc),0:depth-1)
+      REAL Fscratch1(ifirst1-nFgc1:ilast1+nFgc1,
+     &               ifirst2-nFgc2:ilast2+nFgc2,
+     &               ifirst0-nFgc0:ilast0+nFgc0)
+      REAL Fscratch2(ifirst2-nFgc2:ilast2+nFgc2,
+     &               ifirst0-nFgc0:ilast0+nFgc0,
+     &               ifirst1-nFgc1:ilast1+nFgc1)
+
+      REAL u0(FACE3d0VECG(ifirst,ilast,nugc))
+      REAL u1(FACE3d1VECG(ifirst,ilast,nugc))
+      REAL u2(FACE3d2VECG(ifirst,ilast,nugc))
+
+      REAL qtemp0(FACE3d0VECG(ifirst,ilast,nqhalfgc))
+      REAL qtemp1(FACE3d1VECG(ifirst,ilast,nqhalfgc))
+      REAL qtemp2(FACE3d2VECG(ifirst,ilast,nqhalfgc))
+c
+c     Input/Output.
+c
+      REAL qhalf0(FACE3d0VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+      REAL qhalf1(FACE3d1VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+      REAL qhalf2(FACE3d2VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+c
+c     Local variables.
+c
+      INTEGER d
+c
+      do d = 0,depth-1
+         call advect_predict_with_source3d(
+     &        dx,dt,
+     &        limiter,usefullctu,
+     &        ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2,
+     &        nQgc0,nQgc1,nQgc2,
+     &        nFgc0,nFgc1,nFgc2,
+     &        Q(ifirst0-nQgc0,ifirst1-nQgc1,ifirst2-nQgc2,d),
+     &        Qscratch1,Qscratch2,
+     &        F(ifirst0-nFgc0,ifirst1-nFgc1,ifirst2-nFgc2,d),
+     &        Fscratch1,Fscratch2,
+     &        nugc0,nugc1,nugc2,
+     &        nqhalfgc0,nqhalfgc1,nqhalfgc2,
+     &        u0,u1,u2,
+     &        qtemp0,qtemp1,qtemp2,
+     &        qhalf0(ifirst0-nqhalfgc0,ifirst1-nqhalfgc1,
+     &             ifirst2-nqhalfgc2,d),
+     &        qhalf1(ifirst1-nqhalfgc1,ifirst2-nqhalfgc2,
+     &             ifirst0-nqhalfgc0,d),
+     &        qhalf2(ifirst2-nqhalfgc2,ifirst0-nqhalfgc0,
+     &             ifirst1-nqhalfgc1,d))
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Apply advect_predict_PPM3d to each depth component of Q.
+c
+c     All of the components share the advection velocity and the
+c     scratch arrays, so that a multicomponent quantity requires only
+c     a single call from C++.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine advect_predict_PPM_depths3d(
+     &     dx,dt,
+     &     depth,
+     &     limiter,usefullctu,
+     &     ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2,
+     &     nQgc0,nQgc1,nQgc2,
+     &     Q0,Q1,Q2,
+     &     dQ,Q_L,Q_R,
+     &     nugc0,nugc1,nugc2,
+     &     nqhalfgc0,nqhalfgc1,nqhalfgc2,
+     &     u0,u1,u2,
+     &     qtemp0,qtemp1,qtemp2,
+     &     qhalf0,qhalf1,qhalf2)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2
+
+      INTEGER nQgc0,nQgc1,nQgc2
+
+      INTEGER nugc0,nugc1,nugc2
+      INTEGER nqhalfgc0,nqhalfgc1,nqhalfgc2
+
+      LOGICAL usefullctu
+
+      INTEGER limiter
+      INTEGER depth
+
+      REAL dx(0:NDIM-1), dt
+
+      REAL Q0(CELL3dVECG(ifirst,ilast,nQgc),0:depth-1)
+      REAL Q1(ifirst1-nQgc1:ilast1+nQgc1,
+     &        ifirst2-nQgc2:ilast2+nQgc2,
+     &        ifirst0-nQgc0:ilast0+nQgc0)
+      REAL Q2(ifirst2-nQgc2:ilast2+nQgc2,
+     &        ifirst0-nQgc0:ilast0+nQgc0,
+     &        ifirst1-nQgc1:ilast1+nQgc1)
+      REAL dQ(CELL3dVECG(ifirst,ilast,nQgc))
+      REAL Q_L(CELL3dVECG(ifirst,ilast,nQgc))
+      REAL Q_R(CELL3dVECG(ifirst,ilast,nQgc))
+
+      REAL u0(FACE3d0VECG(ifirst,ilast,nugc))
+      REAL u1(FACE3d1VECG(ifirst,ilast,nugc))
+      REAL u2(FACE3d2VECG(ifirst,ilast,nugc))
+
+      REAL qtemp0(FACE3d0VECG(ifirst,ilast,nqhalfgc))
+      REAL qtemp1(FACE3d1VECG(ifirst,ilast,nqhalfgc))
+      REAL qtemp2(FACE3d2VECG(ifirst,ilast,nqhalfgc))
+c
+c     Input/Output.
+c
+      REAL qhalf0(FACE3d0VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+      REAL qhalf1(FACE3d1VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+      REAL qhalf2(FACE3d2VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+c
+c     Local variables.
+c
+      INTEGER d
+c
+      do d = 0,depth-1
+         call advect_predict_PPM3d(
+     &        dx,dt,
+     &        limiter,usefullctu,
+     &        ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2,
+     &        nQgc0,nQgc1,nQgc2,
+     &        Q0(ifirst0-nQgc0,ifirst1-nQgc1,ifirst2-nQgc2,d),
+     &        Q1,Q2,
+     &        dQ,Q_L,Q_R,
+     &        nugc0,nugc1,nugc2,
+     &        nqhalfgc0,nqhalfgc1,nqhalfgc2,
+     &        u0,u1,u2,
+     &        qtemp0,qtemp1,qtemp2,
+     &        qhalf0(ifirst0-nqhalfgc0,ifirst1-nqhalfgc1,
+     &             ifirst2-nqhalfgc2,d),
+     &        qhalf1(ifirst1-nqhalfgc1,ifirst2-nqhalfgc2,
+     &             ifirst0-nqhalfgc0,d),
+     &        qhalf2(ifirst2-nqhalfgc2,ifirst0-nqhalfgc0,
+     &             ifirst1-nqhalfgc1,d))
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Apply advect_predict_PPM_with_source3d to each depth component of Q.
+c
+c     All of the components share the advection velocity and the
+c     scratch arrays, so that a multicomponent quantity requires only
+c     a single call from C++.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine advect_predict_PPM_with_source_depths3d(
+     &     dx,dt,
+     &     depth,
+     &     limiter,usefullctu,
+     &     ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2,
+     &     nQgc0,nQgc1,nQgc2,
+     &     nFgc0,nFgc1,nFgc2,
+     &     Q0,Q1,Q2,
+     &     dQ,Q_L,Q_R,
+     &     F0,F1,F2,
+     &     nugc0,nugc1,nugc2,
+     &     nqhalfgc0,nqhalfgc1,nqhalfgc2,
+     &     u0,u1,u2,
+     &     qtemp0,qtemp1,qtemp2,
+     &     qhalf0,qhalf1,qhalf2)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2
+
+      INTEGER nQgc0,nQgc1,nQgc2
+      INTEGER nFgc0,nFgc1,nFgc2
+
+      INTEGER nugc0,nugc1,nugc2
+      INTEGER nqhalfgc0,nqhalfgc1,nqhalfgc2
+
+      LOGICAL usefullctu
+
+      INTEGER limiter
+      INTEGER depth
+
+      REAL dx(0:NDIM-1), dt
+
+      REAL Q0(CELL3dVECG(ifirst,ilast,nQgc),0:depth-1)
+      REAL Q1(ifirst1-nQgc1:ilast1+nQgc1,
+     &        ifirst2-nQgc2:ilast2+nQgc2,
+     &        ifirst0-nQgc0:ilast0+nQgc0)
+      REAL Q2(ifirst2-nQgc2:ilast2+nQgc2,
+     &        ifirst0-nQgc0:ilast0+nQgc0,
+     &        ifirst1-nQgc1:ilast1+nQgc1)
+      REAL dQ(CELL3dVECG(ifirst,ilast,nQgc))
+      REAL Q_L(CELL3dVECG(ifirst,ilast,nQgc))
+      REAL Q_R(CELL3dVECG(ifirst,ilast,nQgc))
+
+      REAL F0(CELL3dVECG(ifirst,ilast,nFgc),0:depth-1)
+      REAL F1(ifirst1-nFgc1:ilast1+nFgc1,
+     &        ifirst2-nFgc2:ilast2+nFgc2,
+     &        ifirst0-nFgc0:ilast0+nFgc0)
+      REAL F2(ifirst2-nFgc2:ilast2+nFgc2,
+     &        ifirst0-nFgc0:ilast0+nFgc0,
+     &        ifirst1-nFgc1:ilast1+nFgc1)
+
+      REAL u0(FACE3d0VECG(ifirst,ilast,nugc))
+      REAL u1(FACE3d1VECG(ifirst,ilast,nugc))
+      REAL u2(FACE3d2VECG(ifirst,ilast,nugc))
+
+      REAL qtemp0(FACE3d0VECG(ifirst,ilast,nqhalfgc))
+      REAL qtemp1(FACE3d1VECG(ifirst,ilast,nqhalfgc))
+      REAL qtemp2(FACE3d2VECG(ifirst,ilast,nqhalfgc))
+c
+c     Input/Output.
+c
+      REAL qhalf0(FACE3d0VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+      REAL qhalf1(FACE3d1VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+      REAL qhalf2(FACE3d2VECG(ifirst,ilast,nqhalfgc),0:depth-1)
+c
+c     Local variables.
+c
+      INTEGER d
+c
+      do d = 0,depth-1
+         call advect_predict_PPM_with_source3d(
+     &        dx,dt,
+     &        limiter,usefullctu,
+     &        ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2,
+     &        nQgc0,nQgc1,nQgc2,
+     &        nFgc0,nFgc1,nFgc2,
+     &        Q0(ifirst0-nQgc0,ifirst1-nQgc1,ifirst2-nQgc2,d),
+     &        Q1,Q2,
+     &        dQ,Q_L,Q_R,
+     &        F0(ifirst0-nFgc0,ifirst1-nFgc1,ifirst2-nFgc2,d),
+     &        F1,F2,
+     &        nugc0,nugc1,nugc2,
+     &        nqhalfgc0,nqhalfgc1,nqhalfgc2,
+     &        u0,u1,u2,
+     &        qtemp0,qtemp1,qtemp2,
+     &        qhalf0(ifirst0-nqhalfgc0,ifirst1-nqhalfgc1,
+     &             ifirst2-nqhalfgc2,d),
+     &        qhalf1(ifirst1-nqhalfgc1,ifirst2-nqhalfgc2,
+     &             ifirst0-nqhalfgc0,d),
+     &        qhalf2(ifirst2-nqhalfgc2,ifirst0-nqhalfgc0,
+     &             ifirst1-nqhalfgc1,d))
+      enddo
+c
+      return
+      end
@@ -616,6 +616,13 @@ void INSCollocatedHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pat
         else
         {
             d_pressure_precond_type = CCPoissonSolverManager::DEFAULT_FAC_PRECONDITIONER;
+
+            // Default to preconditioning the projection-Poisson solve with a
+            // full multigrid cycle.
+            if (!d_pressure_precond_db->keyExists("enable_fmg"))
+            {
+                d_pressure_precond_db->putBool("enable_fmg", true);
+            }
         }
         d_pressure_precond_db->putInteger("max_iterations", 1);
     }
@@ -635,6 +642,13 @@ void INSCollocatedHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pat
         else
         {
             d_regrid_projection_precond_type = CCPoissonSolverManager::DEFAULT_FAC_PRECONDITIONER;
+
+            // A full multigrid cycle provides a substantially better
+            // approximate projection than a single FAC cycle.
+            if (!d_regrid_projection_precond_db->keyExists("enable_fmg"))
+            {
+                d_regrid_projection_precond_db->putBool("enable_fmg", true);
+            }
         }
         d_regrid_projection_precond_db->putInteger("max_iterations", 1);
     }
@@ -114,6 +114,7 @@
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/NewtonKrylovSolver.h"
+#include "ibtk/PETScKrylovLinearSolver.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/SCPoissonSolverManager.h"
 #include "ibtk/SideDataSynchronization.h"
@@ -753,6 +754,13 @@ void INSStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Patc
         else
         {
             d_regrid_projection_precond_type = CCPoissonSolverManager::DEFAULT_FAC_PRECONDITIONER;
+
+            // A full multigrid cycle provides a substantially better
+            // approximate projection than a single FAC cycle.
+            if (!d_regrid_projection_precond_db->keyExists("enable_fmg"))
+            {
+                d_regrid_projection_precond_db->putBool("enable_fmg", true);
+            }
         }
         d_regrid_projection_precond_db->putInteger("max_iterations", 1);
     }
@@ -1887,6 +1895,12 @@ void INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     d_side_synch_op = new SideDataSynchronization();
     d_side_synch_op->initializeOperatorState(synch_transaction, d_hierarchy);
 
+    // Discard any Krylov subspace retained by the Stokes solver, since it is
+    // not defined on the new patch hierarchy.
+    PETScKrylovLinearSolver* p_stokes_petsc_solver =
+        dynamic_cast<PETScKrylovLinearSolver*>(d_stokes_solver.getPointer());
+    if (p_stokes_petsc_solver) p_stokes_petsc_solver->clearRecycledSubspace();
+
     // Indicate that vectors and solvers need to be re-initialized.
     d_coarsest_reset_ln = coarsest_level;
     d_finest_reset_ln = finest_level;
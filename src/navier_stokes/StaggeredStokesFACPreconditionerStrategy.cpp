@@ -81,6 +81,7 @@
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/PatchMathOps.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/SideNoCornersFillPattern.h"
 #include "ibtk/SideSynchCopyFillPattern.h"
@@ -140,7 +141,8 @@ StaggeredStokesFACPreconditionerStrategy::StaggeredStokesFACPreconditionerStrate
       d_U_restriction_method("CONSERVATIVE_COARSEN"), d_P_restriction_method("CONSERVATIVE_COARSEN"),
       d_coarse_solver_type("BLOCK_JACOBI"), d_coarse_solver_default_options_prefix(default_options_prefix + "_coarse"),
       d_coarse_solver_rel_residual_tol(1.0e-5), d_coarse_solver_abs_residual_tol(1.0e-50),
-      d_coarse_solver_max_iterations(10), d_coarse_solver(), d_coarse_solver_db(), d_context(NULL),
+      d_coarse_solver_max_iterations(10), d_coarse_solver(), d_coarse_solver_db(), d_use_tiled_kernels(false),
+      d_tile_width(0), d_use_threaded_tiles(false), d_use_threaded_patch_loops(false), d_context(NULL),
       d_side_scratch_idx(-1), d_cell_scratch_idx(-1), d_U_cf_bdry_op(), d_P_cf_bdry_op(), d_U_op_stencil_fill_pattern(),
       d_P_op_stencil_fill_pattern(), d_U_synch_fill_pattern(), d_U_prolongation_refine_operator(),
       d_P_prolongation_refine_operator(), d_prolongation_refine_patch_strategy(), d_prolongation_refine_algorithm(),
@@ -168,6 +170,11 @@ StaggeredStokesFACPreconditionerStrategy::StaggeredStokesFACPreconditionerStrate
         if (input_db->keyExists("coarse_solver_max_iterations"))
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
         if (input_db->isDatabase("coarse_solver_db")) d_coarse_solver_db = input_db->getDatabase("coarse_solver_db");
+        if (input_db->keyExists("use_tiled_kernels")) d_use_tiled_kernels = input_db->getBool("use_tiled_kernels");
+        if (input_db->keyExists("tile_width")) d_tile_width = input_db->getInteger("tile_width");
+        if (input_db->keyExists("use_threaded_tiles")) d_use_threaded_tiles = input_db->getBool("use_threaded_tiles");
+        if (input_db->keyExists("use_threaded_patch_loops"))
+            d_use_threaded_patch_loops = input_db->getBool("use_threaded_patch_loops");
     }
 
     // Setup scratch variables.
@@ -564,6 +571,11 @@ void StaggeredStokesFACPreconditionerStrategy::computeResidual(SAMRAIVectorReal<
         stream << d_object_name << "::level_math_ops_" << finest_level_num;
         d_level_math_ops[finest_level_num] =
             new HierarchyMathOps(stream.str(), d_hierarchy, coarsest_level_num, finest_level_num);
+        PatchMathOps& patch_math_ops = d_level_math_ops[finest_level_num]->getPatchMathOps();
+        patch_math_ops.setUseTiledKernels(d_use_tiled_kernels);
+        patch_math_ops.setTileWidth(d_tile_width);
+        patch_math_ops.setUseThreadedTiles(d_use_threaded_tiles);
+        d_level_math_ops[finest_level_num]->setUseThreadedPatchLoops(d_use_threaded_patch_loops);
     }
     d_level_math_ops[finest_level_num]->grad(U_res_idx,
                                              U_res_sc_var,
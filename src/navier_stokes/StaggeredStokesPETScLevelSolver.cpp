@@ -33,6 +33,8 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
+#include <cmath>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -61,6 +63,7 @@
 #include "petscsys.h"
 #include "petscvec.h"
 #include "tbox/Database.h"
+#include "tbox/MathUtilities.h"
 #include "tbox/Pointer.h"
 #include "tbox/SAMRAI_MPI.h"
 
@@ -75,6 +78,13 @@ namespace
 // Number of ghosts cells used for each variable quantity.
 static const int CELLG = 1;
 static const int SIDEG = 1;
+
+// Relative difference between two coefficient values.
+inline double compute_rel_change(const double a, const double a_ref)
+{
+    if (a == a_ref) return 0.0;
+    return std::abs(a - a_ref) / std::max(std::abs(a), std::abs(a_ref));
+} // compute_rel_change
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -83,10 +93,21 @@ StaggeredStokesPETScLevelSolver::StaggeredStokesPETScLevelSolver(const std::stri
                                                                  Pointer<Database> input_db,
                                                                  const std::string& default_options_prefix)
     : d_context(NULL), d_u_dof_index_idx(-1), d_p_dof_index_idx(-1), d_u_dof_index_var(NULL), d_p_dof_index_var(NULL),
-      d_data_synch_sched(NULL), d_ghost_fill_sched(NULL)
+      d_data_synch_sched(NULL), d_ghost_fill_sched(NULL), d_cached_hierarchy(NULL), d_cached_level_num(-1),
+      d_cached_u_idx(-1), d_cached_p_idx(-1), d_pinned_p_dof_index(-1), d_pc_reuse_rel_tol(0.0),
+      d_reuse_pc_across_times(false), d_pc_C(0.0), d_pc_D(0.0), d_pc_time(0.0), d_pc_U_bc_coefs()
 {
     GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
     PETScLevelSolver::init(input_db, default_options_prefix);
+    d_reuse_petsc_objects = true;
+    if (input_db)
+    {
+        if (input_db->keyExists("reuse_petsc_objects"))
+            d_reuse_petsc_objects = input_db->getBool("reuse_petsc_objects");
+        if (input_db->keyExists("pc_reuse_rel_tol")) d_pc_reuse_rel_tol = input_db->getDouble("pc_reuse_rel_tol");
+        if (input_db->keyExists("reuse_pc_across_times"))
+            d_reuse_pc_across_times = input_db->getBool("reuse_pc_across_times");
+    }
 
     // Construct the DOF index variable/context.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -113,6 +134,7 @@ StaggeredStokesPETScLevelSolver::StaggeredStokesPETScLevelSolver(const std::stri
 StaggeredStokesPETScLevelSolver::~StaggeredStokesPETScLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    deallocateCachedDOFIndexData();
     return;
 } // ~StaggeredStokesPETScLevelSolver
 
@@ -121,52 +143,121 @@ StaggeredStokesPETScLevelSolver::~StaggeredStokesPETScLevelSolver()
 void StaggeredStokesPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVectorReal<NDIM, double>& x,
                                                                        const SAMRAIVectorReal<NDIM, double>& /*b*/)
 {
-    // Allocate DOF index data.
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_num);
-    if (!level->checkAllocated(d_u_dof_index_idx)) level->allocatePatchData(d_u_dof_index_idx);
-    if (!level->checkAllocated(d_p_dof_index_idx)) level->allocatePatchData(d_p_dof_index_idx);
-
-    // Setup PETSc objects.
     int ierr;
-    StaggeredStokesPETScVecUtilities::constructPatchLevelDOFIndices(
-        d_num_dofs_per_proc, d_u_dof_index_idx, d_p_dof_index_idx, level);
-    const int mpi_rank = SAMRAI_MPI::getRank();
-    ierr = VecCreateMPI(PETSC_COMM_WORLD, d_num_dofs_per_proc[mpi_rank], PETSC_DETERMINE, &d_petsc_x);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecCreateMPI(PETSC_COMM_WORLD, d_num_dofs_per_proc[mpi_rank], PETSC_DETERMINE, &d_petsc_b);
-    IBTK_CHKERRQ(ierr);
-    StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(d_petsc_mat,
-                                                                     d_U_problem_coefs,
-                                                                     d_U_bc_coefs,
-                                                                     d_new_time,
-                                                                     d_num_dofs_per_proc,
-                                                                     d_u_dof_index_idx,
-                                                                     d_p_dof_index_idx,
-                                                                     level);
-    ierr = MatDuplicate(d_petsc_mat, MAT_COPY_VALUES, &d_petsc_pc);
-    IBTK_CHKERRQ(ierr);
-    HierarchyDataOpsManager<NDIM>* hier_ops_manager = HierarchyDataOpsManager<NDIM>::getManager();
-    Pointer<HierarchyDataOpsInteger<NDIM> > hier_p_dof_index_ops =
-        hier_ops_manager->getOperationsInteger(d_p_dof_index_var, d_hierarchy, true);
-    hier_p_dof_index_ops->resetLevels(d_level_num, d_level_num);
-    const int min_p_idx =
-        hier_p_dof_index_ops->min(d_p_dof_index_idx); // NOTE: HierarchyDataOpsInteger::max() is broken
-    ierr = MatZeroRowsColumns(d_petsc_pc, 1, &min_p_idx, 1.0, NULL, NULL);
-    IBTK_CHKERRQ(ierr);
-    d_petsc_ksp_ops_flag = SAME_PRECONDITIONER;
+
+    // The DOF indices and the nonzero structure of the matrix retained from a
+    // previous initialization remain valid so long as the patch level has not
+    // been regenerated.  (The DOF index data are not allocated on regenerated
+    // patch levels.)
+    const bool reuse_petsc_objects = d_petsc_mat && d_hierarchy == d_cached_hierarchy &&
+                                     d_level_num == d_cached_level_num && level->checkAllocated(d_u_dof_index_idx) &&
+                                     level->checkAllocated(d_p_dof_index_idx);
+    const double C = d_U_problem_coefs.getCConstant();
+    const double D = d_U_problem_coefs.getDConstant();
+    if (reuse_petsc_objects)
+    {
+        // Reset the matrix values without modifying the nonzero structure.
+        StaggeredStokesPETScMatUtilities::resetPatchLevelMACStokesOpValues(d_petsc_mat,
+                                                                           d_U_problem_coefs,
+                                                                           d_U_bc_coefs,
+                                                                           d_new_time,
+                                                                           d_num_dofs_per_proc,
+                                                                           d_u_dof_index_idx,
+                                                                           d_p_dof_index_idx,
+                                                                           level);
+
+        // Reuse the preconditioner if the coefficients are sufficiently close to
+        // those used to set it up; otherwise, rebuild it using the existing
+        // nonzero structure.  The boundary condition objects may provide
+        // time-dependent coefficients, so unless the user has indicated
+        // otherwise, the preconditioner is also rebuilt whenever the solution
+        // time changes.
+        const bool reuse_pc = d_U_bc_coefs == d_pc_U_bc_coefs &&
+                              (d_reuse_pc_across_times || MathUtilities<double>::equalEps(d_new_time, d_pc_time)) &&
+                              std::max(compute_rel_change(C, d_pc_C), compute_rel_change(D, d_pc_D)) <=
+                                  d_pc_reuse_rel_tol;
+        if (reuse_pc)
+        {
+            d_petsc_ksp_ops_flag = SAME_PRECONDITIONER;
+        }
+        else
+        {
+            ierr = MatCopy(d_petsc_mat, d_petsc_pc, SAME_NONZERO_PATTERN);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatZeroRowsColumns(d_petsc_pc, 1, &d_pinned_p_dof_index, 1.0, NULL, NULL);
+            IBTK_CHKERRQ(ierr);
+            d_petsc_ksp_ops_flag = SAME_NONZERO_PATTERN;
+            d_pc_C = C;
+            d_pc_D = D;
+            d_pc_time = d_new_time;
+            d_pc_U_bc_coefs = d_U_bc_coefs;
+        }
+    }
+    else
+    {
+        // Free any PETSc objects and DOF index data that cannot be reused.
+        deallocatePETScObjects();
+        deallocateCachedDOFIndexData();
+
+        // Allocate DOF index data.
+        if (!level->checkAllocated(d_u_dof_index_idx)) level->allocatePatchData(d_u_dof_index_idx);
+        if (!level->checkAllocated(d_p_dof_index_idx)) level->allocatePatchData(d_p_dof_index_idx);
+
+        // Setup PETSc objects.
+        StaggeredStokesPETScVecUtilities::constructPatchLevelDOFIndices(
+            d_num_dofs_per_proc, d_u_dof_index_idx, d_p_dof_index_idx, level);
+        const int mpi_rank = SAMRAI_MPI::getRank();
+        ierr = VecCreateMPI(PETSC_COMM_WORLD, d_num_dofs_per_proc[mpi_rank], PETSC_DETERMINE, &d_petsc_x);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecCreateMPI(PETSC_COMM_WORLD, d_num_dofs_per_proc[mpi_rank], PETSC_DETERMINE, &d_petsc_b);
+        IBTK_CHKERRQ(ierr);
+        StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(d_petsc_mat,
+                                                                         d_U_problem_coefs,
+                                                                         d_U_bc_coefs,
+                                                                         d_new_time,
+                                                                         d_num_dofs_per_proc,
+                                                                         d_u_dof_index_idx,
+                                                                         d_p_dof_index_idx,
+                                                                         level);
+        ierr = MatDuplicate(d_petsc_mat, MAT_COPY_VALUES, &d_petsc_pc);
+        IBTK_CHKERRQ(ierr);
+        HierarchyDataOpsManager<NDIM>* hier_ops_manager = HierarchyDataOpsManager<NDIM>::getManager();
+        Pointer<HierarchyDataOpsInteger<NDIM> > hier_p_dof_index_ops =
+            hier_ops_manager->getOperationsInteger(d_p_dof_index_var, d_hierarchy, true);
+        hier_p_dof_index_ops->resetLevels(d_level_num, d_level_num);
+        d_pinned_p_dof_index =
+            hier_p_dof_index_ops->min(d_p_dof_index_idx); // NOTE: HierarchyDataOpsInteger::max() is broken
+        ierr = MatZeroRowsColumns(d_petsc_pc, 1, &d_pinned_p_dof_index, 1.0, NULL, NULL);
+        IBTK_CHKERRQ(ierr);
+        d_petsc_ksp_ops_flag = SAME_PRECONDITIONER;
+        d_pc_C = C;
+        d_pc_D = D;
+        d_pc_time = d_new_time;
+        d_pc_U_bc_coefs = d_U_bc_coefs;
+        d_cached_hierarchy = d_hierarchy;
+        d_cached_level_num = d_level_num;
+    }
+
+    // Setup the data synchronization and ghost filling schedules, which depend
+    // only on the patch level and the patch data indices.
     const int u_idx = x.getComponentDescriptorIndex(0);
     const int p_idx = x.getComponentDescriptorIndex(1);
-    d_data_synch_sched = StaggeredStokesPETScVecUtilities::constructDataSynchSchedule(u_idx, p_idx, level);
-    d_ghost_fill_sched = StaggeredStokesPETScVecUtilities::constructGhostFillSchedule(u_idx, p_idx, level);
+    if (u_idx != d_cached_u_idx || p_idx != d_cached_p_idx)
+    {
+        d_data_synch_sched = StaggeredStokesPETScVecUtilities::constructDataSynchSchedule(u_idx, p_idx, level);
+        d_ghost_fill_sched = StaggeredStokesPETScVecUtilities::constructGhostFillSchedule(u_idx, p_idx, level);
+        d_cached_u_idx = u_idx;
+        d_cached_p_idx = p_idx;
+    }
     return;
 } // initializeSolverStateSpecialized
 
 void StaggeredStokesPETScLevelSolver::deallocateSolverStateSpecialized()
 {
-    // Deallocate DOF index data.
-    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_num);
-    if (level->checkAllocated(d_u_dof_index_idx)) level->deallocatePatchData(d_u_dof_index_idx);
-    if (level->checkAllocated(d_p_dof_index_idx)) level->deallocatePatchData(d_p_dof_index_idx);
+    // Retain the DOF index data when the PETSc objects are to be reused.
+    if (d_reuse_petsc_objects) return;
+    deallocateCachedDOFIndexData();
     return;
 } // deallocateSolverStateSpecialized
 
@@ -211,6 +302,24 @@ void StaggeredStokesPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void StaggeredStokesPETScLevelSolver::deallocateCachedDOFIndexData()
+{
+    if (d_cached_hierarchy && d_cached_level_num >= 0 &&
+        d_cached_level_num <= d_cached_hierarchy->getFinestLevelNumber())
+    {
+        Pointer<PatchLevel<NDIM> > level = d_cached_hierarchy->getPatchLevel(d_cached_level_num);
+        if (level->checkAllocated(d_u_dof_index_idx)) level->deallocatePatchData(d_u_dof_index_idx);
+        if (level->checkAllocated(d_p_dof_index_idx)) level->deallocatePatchData(d_p_dof_index_idx);
+    }
+    d_cached_hierarchy.setNull();
+    d_cached_level_num = -1;
+    d_data_synch_sched.setNull();
+    d_ghost_fill_sched.setNull();
+    d_cached_u_idx = -1;
+    d_cached_p_idx = -1;
+    return;
+} // deallocateCachedDOFIndexData
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -244,6 +244,66 @@ void StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
 #endif
 
     // Set the matrix coefficients.
+    resetPatchLevelMACStokesOpValues(
+        mat, u_problem_coefs, u_bc_coefs, data_time, num_dofs_per_proc, u_dof_index_idx, p_dof_index_idx, patch_level);
+    return;
+} // constructPatchLevelMACStokesOp
+
+void StaggeredStokesPETScMatUtilities::resetPatchLevelMACStokesOpValues(
+    Mat& mat,
+    const PoissonSpecifications& u_problem_coefs,
+    const std::vector<RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+    double data_time,
+    const std::vector<int>& num_dofs_per_proc,
+    int u_dof_index_idx,
+    int p_dof_index_idx,
+    Pointer<PatchLevel<NDIM> > patch_level)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mat);
+#endif
+    int ierr;
+
+    // Setup the finite difference stencils.
+    static const int uu_stencil_sz = 2 * NDIM + 1;
+    boost::array<Index<NDIM>, uu_stencil_sz> uu_stencil(array_constant<Index<NDIM>, uu_stencil_sz>(Index<NDIM>(0)));
+    for (unsigned int axis = 0, uu_stencil_index = 1; axis < NDIM; ++axis)
+    {
+        for (int side = 0; side <= 1; ++side, ++uu_stencil_index)
+        {
+            uu_stencil[uu_stencil_index](axis) = (side == 0 ? -1 : +1);
+        }
+    }
+    static const int up_stencil_sz = 2;
+    boost::array<boost::array<Index<NDIM>, up_stencil_sz>, NDIM> up_stencil(
+        array_constant<boost::array<Index<NDIM>, up_stencil_sz>, NDIM>(
+            array_constant<Index<NDIM>, up_stencil_sz>(Index<NDIM>(0))));
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        for (int side = 0; side <= 1; ++side)
+        {
+            up_stencil[axis][side](axis) = (side == 0 ? -1 : 0);
+        }
+    }
+    static const int pu_stencil_sz = 4;
+    boost::array<Index<NDIM>, pu_stencil_sz> pu_stencil(array_constant<Index<NDIM>, pu_stencil_sz>(Index<NDIM>(0)));
+    for (unsigned int axis = 0, pu_stencil_index = 0; axis < NDIM; ++axis)
+    {
+        for (int side = 0; side <= 1; ++side, ++pu_stencil_index)
+        {
+            pu_stencil[pu_stencil_index](axis) = (side == 0 ? 0 : +1);
+        }
+    }
+
+    // Determine the index ranges.
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int nlocal = num_dofs_per_proc[mpi_rank];
+    const int ilower = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
+    const int iupper = ilower + nlocal;
+
+    // Set the matrix coefficients.  Because the coefficients are set using the
+    // same stencils used to construct the matrix, the nonzero structure of the
+    // matrix is not modified.
     const double C = u_problem_coefs.getCConstant();
     const double D = u_problem_coefs.getDConstant();
     for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
@@ -547,7 +607,7 @@ void StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
     ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
     IBTK_CHKERRQ(ierr);
     return;
-} // constructPatchLevelMACStokesOp
+} // resetPatchLevelMACStokesOpValues
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 